@@ -252,7 +252,7 @@ void DefaultCentralSystemEventsHandler::ChargePointRequestHandler::meterValues(u
         cout << " - timestamp : " << meter_value.timestamp.str() << ", sampled values : " << endl;
         for (const SampledValue& sampled_value : meter_value.sampledValue)
         {
-            cout << "    - value = " << sampled_value.value;
+            cout << "    - value = " << sampled_value.str();
             if (sampled_value.unit.isSet())
             {
                 cout << ", unit = " << UnitOfMeasureHelper.toString(sampled_value.unit);
@@ -35,6 +35,8 @@ SOFTWARE.
 // With MSVC compiler, the system() call returns directly the command's return value
 #ifdef _MSC_VER
 #define WEXITSTATUS(x) (x)
+#define popen          _popen
+#define pclose         _pclose
 #endif // _MSC_VER
 
 using namespace std;
@@ -206,6 +208,26 @@ bool DefaultChargePointEventsHandler::getLocalLimitationsSchedule(unsigned int
     return false;
 }
 
+/** @copydoc void IChargePointEventsHandler::setpointChanged(unsigned int,
+                                                             const ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>&,
+                                                             const ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>&) */
+void DefaultChargePointEventsHandler::setpointChanged(unsigned int                                                     connector_id,
+                                                      const ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& charge_point_setpoint,
+                                                      const ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& connector_setpoint)
+{
+    cout << "Setpoint changed : " << connector_id
+         << " - charge point = " << (charge_point_setpoint.isSet() ? std::to_string(charge_point_setpoint.value().value) : "not set")
+         << " - connector = " << (connector_setpoint.isSet() ? std::to_string(connector_setpoint.value().value) : "not set") << endl;
+}
+
+/** @copydoc bool IChargePointEventsHandler::getConnectorConsumption(unsigned int, float&) */
+bool DefaultChargePointEventsHandler::getConnectorConsumption(unsigned int connector_id, float& current)
+{
+    (void)connector_id;
+    (void)current;
+    return false;
+}
+
 /** @copydoc bool IChargePointEventsHandler::resetRequested(ocpp::types::ResetType) */
 bool DefaultChargePointEventsHandler::resetRequested(ocpp::types::ResetType reset_type)
 {
@@ -341,6 +363,79 @@ bool DefaultChargePointEventsHandler::downloadFile(const std::string& url, const
     return ret;
 }
 
+/** @copydoc bool IChargePointEventsHandler::downloadFileStreamed(const std::string&,
+                                                                 const std::string&,
+                                                                 std::function<void(const void*, size_t)>) */
+bool DefaultChargePointEventsHandler::downloadFileStreamed(const std::string&                       url,
+                                                           const std::string&                       file,
+                                                           std::function<void(const void*, size_t)> data_received)
+{
+    bool ret = true;
+    cout << "Downloading (streamed) from " << url << " to " << file << endl;
+
+    std::string connection_url = url;
+    std::string params;
+    if (connection_url.find("ftp://") == 0)
+    {
+        // FTP => no specific params
+    }
+    else if (connection_url.find("ftps://") == 0)
+    {
+        // FTPS
+        params = "--insecure --ssl";
+        ocpp::helpers::replace(connection_url, "ftps://", "ftp://", false);
+    }
+    else if (connection_url.find("http://") == 0)
+    {
+        // HTTP => no specific params
+    }
+    else if (connection_url.find("https://") == 0)
+    {
+        // HTTP
+        params = "--insecure";
+    }
+    else
+    {
+        // Unsupported protocol
+        ret = false;
+    }
+    if (ret)
+    {
+        // Download to the standard output and give the data to the stack which saves them
+        std::stringstream ss;
+        ss << "curl --silent " << params << " -o - " << connection_url;
+        cout << "Command line : " << ss.str() << endl;
+        FILE* input = popen(ss.str().c_str(), "r");
+        if (input)
+        {
+            char   buffer[64u * 1024u];
+            size_t size = 0;
+            while ((size = fread(buffer, 1u, sizeof(buffer), input)) != 0)
+            {
+                data_received(buffer, size);
+            }
+            ret = (ferror(input) == 0);
+        }
+        else
+        {
+            ret = false;
+        }
+        if (input)
+        {
+            int err = WEXITSTATUS(pclose(input));
+            ret     = ret && (err == 0);
+        }
+    }
+
+    return ret;
+}
+
+/** @copydoc void IChargePointEventsHandler::downloadProgress(const std::string&, size_t) */
+void DefaultChargePointEventsHandler::downloadProgress(const std::string& file, size_t received)
+{
+    cout << "Download progress : " << file << " - " << received << " bytes" << endl;
+}
+
 // Security extensions
 
 /** @copydoc ocpp::types::CertificateStatusEnumType IChargePointEventsHandler::caCertificateReceived(ocpp::types::CertificateUseEnumType,
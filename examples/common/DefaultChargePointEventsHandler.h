@@ -99,6 +99,16 @@ class DefaultChargePointEventsHandler : public ocpp::chargepoint::IChargePointEv
     /** @copydoc bool IChargePointEventsHandler::getLocalLimitationsSchedule(unsigned int, unsigned int, ocpp::types::ChargingSchedule&) */
     bool getLocalLimitationsSchedule(unsigned int connector_id, unsigned int duration, ocpp::types::ChargingSchedule& schedule) override;
 
+    /** @copydoc void IChargePointEventsHandler::setpointChanged(unsigned int,
+                                                                 const ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>&,
+                                                                 const ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>&) */
+    void setpointChanged(unsigned int                                                     connector_id,
+                         const ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& charge_point_setpoint,
+                         const ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& connector_setpoint) override;
+
+    /** @copydoc bool IChargePointEventsHandler::getConnectorConsumption(unsigned int, float&) */
+    bool getConnectorConsumption(unsigned int connector_id, float& current) override;
+
     /** @copydoc bool IChargePointEventsHandler::resetRequested(ocpp::types::ResetType) */
     bool resetRequested(ocpp::types::ResetType reset_type) override;
 
@@ -122,6 +132,16 @@ class DefaultChargePointEventsHandler : public ocpp::chargepoint::IChargePointEv
     /** @copydoc bool IChargePointEventsHandler::downloadFile(const std::string&, const std::string&) */
     bool downloadFile(const std::string& url, const std::string& file) override;
 
+    /** @copydoc bool IChargePointEventsHandler::downloadFileStreamed(const std::string&,
+                                                                     const std::string&,
+                                                                     std::function<void(const void*, size_t)>) */
+    bool downloadFileStreamed(const std::string&                       url,
+                              const std::string&                       file,
+                              std::function<void(const void*, size_t)> data_received) override;
+
+    /** @copydoc void IChargePointEventsHandler::downloadProgress(const std::string&, size_t) */
+    void downloadProgress(const std::string& file, size_t received) override;
+
     // Security extensions
 
     /** @copydoc ocpp::types::CertificateStatusEnumType IChargePointEventsHandler::caCertificateReceived(ocpp::types::CertificateUseEnumType,
@@ -78,6 +78,22 @@ class CentralSystemConfig : public ocpp::config::ICentralSystemConfig
     std::string tlsServerCertificateCa() const override { return getString("TlsServerCertificateCa"); }
     /** @brief Enable client authentication using certificate */
     bool tlsClientCertificateAuthent() const override { return getBool("TlsClientCertificateAuthent"); }
+    /** @brief Interval between 2 rotations of the keys protecting the TLS session tickets (0 = no rotation) */
+    std::chrono::seconds tlsTicketKeyRotationInterval() const override
+    {
+        return get<std::chrono::seconds>("TlsTicketKeyRotationInterval");
+    }
+    /** @brief Maximum number of messages waiting to be sent on the websocket connection (0 = no limit) */
+    unsigned int webSocketSendQueueMaxMessages() const override { return get<unsigned int>("WebSocketSendQueueMaxMessages"); }
+    /** @brief Maximum size in bytes of the messages waiting to be sent on the websocket connection (0 = no limit) */
+    unsigned int webSocketSendQueueMaxSize() const override { return get<unsigned int>("WebSocketSendQueueMaxSize"); }
+    /** @brief Behavior when the websocket send queue is full : fail, block or disconnect */
+    std::string webSocketSendQueuePolicy() const override { return getString("WebSocketSendQueuePolicy"); }
+    /** @brief Maximum wait time for room in the websocket send queue when using the block policy */
+    std::chrono::milliseconds webSocketSendQueueBlockTimeout() const override
+    {
+        return get<std::chrono::milliseconds>("WebSocketSendQueueBlockTimeout");
+    }
 
     // Logs
 
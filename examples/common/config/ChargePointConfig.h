@@ -84,6 +84,19 @@ class ChargePointConfig : public ocpp::config::IChargePointConfig
     /** @brief Skip server name check in certificates for TLS connections
      *         (Warning : enabling this feature is not recommended in production) */
     bool tlsSkipServerNameCheck() const override { return getBool("TlsSkipServerNameCheck"); }
+    /** @brief Persist the TLS session in the database to resume it on the next connections */
+    bool tlsSessionResumption() const override { return getBool("TlsSessionResumption"); }
+    /** @brief Maximum number of messages waiting to be sent on the websocket connection (0 = no limit) */
+    unsigned int webSocketSendQueueMaxMessages() const override { return get<unsigned int>("WebSocketSendQueueMaxMessages"); }
+    /** @brief Maximum size in bytes of the messages waiting to be sent on the websocket connection (0 = no limit) */
+    unsigned int webSocketSendQueueMaxSize() const override { return get<unsigned int>("WebSocketSendQueueMaxSize"); }
+    /** @brief Behavior when the websocket send queue is full : fail, block or disconnect */
+    std::string webSocketSendQueuePolicy() const override { return getString("WebSocketSendQueuePolicy"); }
+    /** @brief Maximum wait time for room in the websocket send queue when using the block policy */
+    std::chrono::milliseconds webSocketSendQueueBlockTimeout() const override
+    {
+        return get<std::chrono::milliseconds>("WebSocketSendQueueBlockTimeout");
+    }
 
     // Charge point identification
 
@@ -110,6 +123,10 @@ class ChargePointConfig : public ocpp::config::IChargePointConfig
 
     /** @brief Nominal operating voltage (needed for Watt to Amp conversions in smart charging profiles) */
     float operatingVoltage() const override { return static_cast<float>(getFloat("OperatingVoltage")); }
+    /** @brief Local load balancing policy between the connectors : none, proportional, priority or minrate */
+    std::string loadBalancingPolicy() const override { return getString("LoadBalancingPolicy"); }
+    /** @brief Interval between 2 refreshes of the connectors consumption for the local load balancing (0 = no periodic refresh) */
+    std::chrono::milliseconds loadBalancingInterval() const override { return get<std::chrono::milliseconds>("LoadBalancingInterval"); }
 
     // Authent
 
@@ -121,6 +138,12 @@ class ChargePointConfig : public ocpp::config::IChargePointConfig
     /** @brief Maximum number of entries in the log (0 = no logs in database) */
     unsigned int logMaxEntriesCount() const override { return get<unsigned int>("LogMaxEntriesCount"); }
 
+    // Maintenance
+
+    /** @brief Maximum bandwidth of the firmware downloads in bytes per second (0 = no limit),
+     *         only applies when IChargePointEventsHandler::downloadFileStreamed() is overridden */
+    unsigned int transferMaxBandwidth() const override { return get<unsigned int>("TransferMaxBandwidth"); }
+
     // Security
 
     /** @brief Enable internal certificate management : the certificates will be managed by Open OCPP only */
@@ -129,6 +152,8 @@ class ChargePointConfig : public ocpp::config::IChargePointConfig
     bool securityEventNotificationEnabled() const override { return getBool("SecurityEventNotificationEnabled"); }
     /** @brief Maximum number of entries in the security log (0 = no security logs in database) */
     unsigned int securityLogMaxEntriesCount() const override { return get<unsigned int>("SecurityLogMaxEntriesCount"); };
+    /** @brief Compression of the security log exports : none or gzip */
+    std::string securityLogExportCompression() const override { return getString("SecurityLogExportCompression"); }
     /** @brief Hash type for certificate request generation : sha256, sha384 or sha512 */
     virtual std::string clientCertificateRequestHashType() const override { return getString("ClientCertificateRequestHashType"); }
     /** @brief Key type for certificate request generation : ec or rsa */
@@ -143,6 +168,12 @@ class ChargePointConfig : public ocpp::config::IChargePointConfig
      *         if ec has been selected for key type : prime256v1, secp256k1, secp384r1, secp521r1, 
      *         brainpoolP256t1, brainpoolP384t1 or brainpoolP512t1 */
     virtual std::string clientCertificateRequestEcCurve() const override { return getString("ClientCertificateRequestEcCurve"); }
+    /** @brief Number of private keys generated in advance in background for certificate request generation
+     *         (0 = keys are generated on demand) */
+    virtual unsigned int clientCertificateRequestKeyPoolSize() const override
+    {
+        return get<unsigned int>("ClientCertificateRequestKeyPoolSize");
+    }
     /** @brief Country for the subject field of certificate request generation (can be left empty) */
     virtual std::string clientCertificateRequestSubjectCountry() const override
     {
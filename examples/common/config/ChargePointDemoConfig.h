@@ -34,7 +34,11 @@ class ChargePointDemoConfig
 {
   public:
     /** @brief Constructor */
-    ChargePointDemoConfig(const std::string& config_file) : m_config(config_file), m_stack_config(m_config), m_ocpp_config(m_config) { }
+    ChargePointDemoConfig(const std::string& config_file) : m_config(config_file), m_stack_config(m_config), m_ocpp_config(m_config)
+    {
+        // Coalesce the configuration changes to limit the writes to the filesystem
+        m_config.setWriteBehind(std::chrono::milliseconds(500));
+    }
 
     /** @brief Stack internal configuration */
     ocpp::config::IChargePointConfig& stackConfig() { return m_stack_config; }
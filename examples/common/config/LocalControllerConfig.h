@@ -73,6 +73,22 @@ class LocalControllerConfig : public ocpp::config::ILocalControllerConfig
     std::string tlsServerCertificateCa() const override { return getString("TlsServerCertificateCa"); }
     /** @brief Enable client authentication using certificate */
     bool tlsClientCertificateAuthent() const override { return getBool("TlsClientCertificateAuthent"); }
+    /** @brief Interval between 2 rotations of the keys protecting the TLS session tickets (0 = no rotation) */
+    std::chrono::seconds tlsTicketKeyRotationInterval() const override
+    {
+        return get<std::chrono::seconds>("TlsTicketKeyRotationInterval");
+    }
+    /** @brief Maximum number of messages waiting to be sent on the websocket connection (0 = no limit) */
+    unsigned int webSocketSendQueueMaxMessages() const override { return get<unsigned int>("WebSocketSendQueueMaxMessages"); }
+    /** @brief Maximum size in bytes of the messages waiting to be sent on the websocket connection (0 = no limit) */
+    unsigned int webSocketSendQueueMaxSize() const override { return get<unsigned int>("WebSocketSendQueueMaxSize"); }
+    /** @brief Behavior when the websocket send queue is full : fail, block or disconnect */
+    std::string webSocketSendQueuePolicy() const override { return getString("WebSocketSendQueuePolicy"); }
+    /** @brief Maximum wait time for room in the websocket send queue when using the block policy */
+    std::chrono::milliseconds webSocketSendQueueBlockTimeout() const override
+    {
+        return get<std::chrono::milliseconds>("WebSocketSendQueueBlockTimeout");
+    }
     /** @brief Client certificate */
     std::string tlsClientCertificate() const { return getString("TlsClientCertificate"); }
     /** @brief Client certificate's private key */
@@ -99,6 +115,23 @@ class LocalControllerConfig : public ocpp::config::ILocalControllerConfig
     };
     /** @brief Disconnect from Charge Point on Central System disconnection */
     bool disconnectFromCpWhenCsDisconnected() const override { return getBool("DisconnectFromCpWhenCsDisconnected"); }
+    /** @brief Forward the requests between Charge Point and Central System without decoding them
+               (only the requests for which a user handler has been registered are decoded) */
+    bool transparentForwarding() const override { return getBool("TransparentForwarding"); }
+    /** @brief Validate the JSON payloads of the requests and responses forwarded in transparent mode against the OCPP schemas */
+    bool transparentForwardingValidation() const override { return getBool("TransparentForwardingValidation"); }
+    /** @brief Acknowledge locally the transaction related requests (StartTransaction, StopTransaction, MeterValues)
+               when the Central System is unreachable, and replay them once the connection is back */
+    bool storeAndForward() const override { return getBool("StoreAndForward"); }
+    /** @brief Maximum number of stored requests per Charge Point (0 = no limit) */
+    unsigned int storeAndForwardMaxMessages() const override { return get<unsigned int>("StoreAndForwardMaxMessages"); }
+    /** @brief Maximum number of stored requests replayed in a row (0 = no limit) */
+    unsigned int storeAndForwardReplayBatchSize() const override { return get<unsigned int>("StoreAndForwardReplayBatchSize"); }
+    /** @brief Interval between 2 replays of stored requests */
+    std::chrono::milliseconds storeAndForwardReplayInterval() const override
+    {
+        return get<std::chrono::milliseconds>("StoreAndForwardReplayInterval");
+    }
 
     // Unused from Central System configuration interface
 
@@ -24,9 +24,11 @@ SOFTWARE.
 
 #include "OcppConfig.h"
 #include "ChargePointConfig.h"
+#include "StringHelpers.h"
 
 #include <map>
 #include <string>
+#include <unordered_map>
 
 using namespace std;
 using namespace ocpp::types;
@@ -119,6 +121,33 @@ static const map<string, int> CONFIGURATION_VALUES = {
     {"ChargePointIdentifier", PARAM_READ_WRITE | PARAM_REBOOT},
     {"FirmwareVersion", PARAM_READ}};
 
+/** @brief Build the case insensitive index of the configuration values */
+static unordered_map<string, map<string, int>::const_iterator> buildConfigurationIndex()
+{
+    unordered_map<string, map<string, int>::const_iterator> index;
+    index.reserve(CONFIGURATION_VALUES.size());
+    for (auto it = CONFIGURATION_VALUES.cbegin(); it != CONFIGURATION_VALUES.cend(); ++it)
+    {
+        index[ocpp::helpers::tolower(it->first)] = it;
+    }
+    return index;
+}
+
+/** @brief Case insensitive index of the configuration values (OCPP keys are case insensitive) */
+static const unordered_map<string, map<string, int>::const_iterator> CONFIGURATION_INDEX = buildConfigurationIndex();
+
+/** @brief Look for a configuration value using its case insensitive name */
+static map<string, int>::const_iterator findConfigurationValue(const std::string& key)
+{
+    map<string, int>::const_iterator ret = CONFIGURATION_VALUES.cend();
+    const auto                       it  = CONFIGURATION_INDEX.find(ocpp::helpers::tolower(key));
+    if (it != CONFIGURATION_INDEX.end())
+    {
+        ret = it->second;
+    }
+    return ret;
+}
+
 /** @brief Constructor */
 OcppConfig::OcppConfig(ocpp::helpers::IniFile& config) : m_config(config) { }
 
@@ -133,52 +162,38 @@ void OcppConfig::getConfiguration(const std::vector<ocpp::types::CiStringType<50
     if (keys.empty())
     {
         // Return all available parameters
+        values.reserve(CONFIGURATION_VALUES.size());
         for (const auto& param : CONFIGURATION_VALUES)
         {
-            KeyValue key_value;
+            values.emplace_back();
+            KeyValue& key_value = values.back();
             key_value.key.assign(param.first);
             key_value.readonly = ((param.second & PARAM_WRITE) == 0);
-            IniFile::Value value;
             if ((param.second & PARAM_READ) != 0)
             {
-                if ((param.second & PARAM_OCPP) != 0)
-                {
-                    value = m_config.get(OCPP_PARAMS, param.first);
-                }
-                else
-                {
-                    value = m_config.get(STACK_PARAMS, param.first);
-                }
-                key_value.value.value().assign(value.toString());
+                const std::string& section = (((param.second & PARAM_OCPP) != 0) ? OCPP_PARAMS : STACK_PARAMS);
+                key_value.value.value().assign(m_config.get(section, param.first).toString());
             }
-            values.push_back(key_value);
         }
     }
     else
     {
         // Look for each requested parameter
+        values.reserve(keys.size());
         for (const auto& key : keys)
         {
-            const auto it = CONFIGURATION_VALUES.find(key);
+            const auto it = findConfigurationValue(key);
             if (it != CONFIGURATION_VALUES.end())
             {
-                KeyValue key_value;
+                values.emplace_back();
+                KeyValue& key_value = values.back();
                 key_value.key.assign(it->first);
                 key_value.readonly = ((it->second & PARAM_WRITE) == 0);
-                IniFile::Value value;
                 if ((it->second & PARAM_READ) != 0)
                 {
-                    if ((it->second & PARAM_OCPP) != 0)
-                    {
-                        value = m_config.get(OCPP_PARAMS, it->first);
-                    }
-                    else
-                    {
-                        value = m_config.get(STACK_PARAMS, it->first);
-                    }
-                    key_value.value.value().assign(value.toString());
+                    const std::string& section = (((it->second & PARAM_OCPP) != 0) ? OCPP_PARAMS : STACK_PARAMS);
+                    key_value.value.value().assign(m_config.get(section, it->first).toString());
                 }
-                values.push_back(key_value);
             }
             else
             {
@@ -192,7 +207,7 @@ void OcppConfig::getConfiguration(const std::vector<ocpp::types::CiStringType<50
 ocpp::types::ConfigurationStatus OcppConfig::setConfiguration(const std::string& key, const std::string& value)
 {
     ConfigurationStatus ret = ConfigurationStatus::NotSupported;
-    const auto          it  = CONFIGURATION_VALUES.find(key);
+    const auto          it  = findConfigurationValue(key);
     if (it != CONFIGURATION_VALUES.end())
     {
         if ((it->second & PARAM_WRITE) != 0)
@@ -211,11 +226,11 @@ ocpp::types::ConfigurationStatus OcppConfig::setConfiguration(const std::string&
             {
                 if ((it->second & PARAM_OCPP) != 0)
                 {
-                    m_config.set(OCPP_PARAMS, key, value);
+                    m_config.set(OCPP_PARAMS, it->first, value);
                 }
                 else
                 {
-                    m_config.set(STACK_PARAMS, key, value);
+                    m_config.set(STACK_PARAMS, it->first, value);
                 }
                 if ((it->second & PARAM_REBOOT) != 0)
                 {
@@ -114,6 +114,7 @@ int main(int argc, char* argv[])
     // From now on the stack is alive :)
 
     // App loop
+    auto last_balancing = std::chrono::steady_clock::now();
     while (true)
     {
         // Wait for at least 1 connected charge point
@@ -123,6 +124,14 @@ int main(int argc, char* argv[])
         }
         std::this_thread::sleep_for(std::chrono::seconds(1));
 
+        // Balance the upstream connections between the websocket pools
+        // (a moved connection is re-established, so it is done only every few minutes)
+        if ((std::chrono::steady_clock::now() - last_balancing) >= std::chrono::minutes(5))
+        {
+            ocpp::websockets::WebsocketFactory::balanceClientPools();
+            last_balancing = std::chrono::steady_clock::now();
+        }
+
         // For each connected charge point
         for (auto& iter_chargepoint : event_handler.chargePoints())
         {
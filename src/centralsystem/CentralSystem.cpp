@@ -72,6 +72,7 @@ CentralSystem::CentralSystem(const ocpp::config::ICentralSystemConfig&        st
       m_messages_validator(),
       m_ws_server(),
       m_rpc_server(),
+      m_fast_path(),
       m_uptime_timer(),
       m_uptime(0),
       m_total_uptime(0)
@@ -205,8 +206,15 @@ bool CentralSystem::start()
             credentials.server_certificate_private_key_passphrase = m_stack_config.tlsServerCertificatePrivateKeyPassphrase();
             credentials.server_certificate_ca                     = m_stack_config.tlsServerCertificateCa();
             credentials.client_certificate_authent                = m_stack_config.tlsClientCertificateAuthent();
+            credentials.tls_ticket_key_rotation_interval          = m_stack_config.tlsTicketKeyRotationInterval();
             credentials.encoded_pem_certificates                  = false;
 
+            // Configure websocket send queue
+            m_ws_server->setSendQueueConfig(ocpp::websockets::SendQueueConfig(m_stack_config.webSocketSendQueueMaxMessages(),
+                                                                              m_stack_config.webSocketSendQueueMaxSize(),
+                                                                              m_stack_config.webSocketSendQueuePolicy(),
+                                                                              m_stack_config.webSocketSendQueueBlockTimeout()));
+
             // Start listening
             ret = m_rpc_server->start(m_stack_config.listenUrl(),
                                       credentials,
@@ -264,6 +272,25 @@ bool CentralSystem::stop()
     return ret;
 }
 
+/** @copydoc ocpp::websockets::TlsStats ICentralSystem::getTlsStats() const */
+ocpp::websockets::TlsStats CentralSystem::getTlsStats() const
+{
+    ocpp::websockets::TlsStats stats;
+
+    if (m_ws_server)
+    {
+        stats = m_ws_server->tlsStats();
+    }
+
+    return stats;
+}
+
+/** @copydoc void ICentralSystem::registerFastPathHandler(IChargePointFastPathHandler&) */
+void CentralSystem::registerFastPathHandler(IChargePointFastPathHandler& handler)
+{
+    m_fast_path.registerHandler(handler);
+}
+
 /** @copydoc bool RpcServer::IListener::rpcAcceptConnection(const char*) */
 bool CentralSystem::rpcAcceptConnection(const char* ip_address)
 {
@@ -294,7 +321,7 @@ void CentralSystem::rpcClientConnected(const std::string& chargepoint_id, std::s
 
     // Instanciate proxy
     std::shared_ptr<ICentralSystem::IChargePoint> chargepoint(
-        new ChargePointProxy(*this, chargepoint_id, client, m_messages_validator, m_messages_converter, m_stack_config));
+        new ChargePointProxy(*this, chargepoint_id, client, m_messages_validator, m_messages_converter, m_stack_config, m_fast_path));
 
     // Notify connection
     m_events_handler.chargePointConnected(chargepoint);
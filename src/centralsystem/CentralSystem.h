@@ -19,6 +19,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #ifndef OPENOCPP_CENTRALSYSTEM_H
 #define OPENOCPP_CENTRALSYSTEM_H
 
+#include "ChargePointFastPath.h"
 #include "Database.h"
 #include "ICentralSystem.h"
 #include "InternalConfigManager.h"
@@ -67,6 +68,12 @@ class CentralSystem : public ICentralSystem, public ocpp::rpc::RpcServer::IListe
     /** @copydoc bool ICentralSystem::stop() */
     bool stop() override;
 
+    /** @copydoc void ICentralSystem::registerFastPathHandler(IChargePointFastPathHandler&) */
+    void registerFastPathHandler(IChargePointFastPathHandler& handler) override;
+
+    /** @copydoc ocpp::websockets::TlsStats ICentralSystem::getTlsStats() const */
+    ocpp::websockets::TlsStats getTlsStats() const override;
+
     // RpcServer::IListener interface
 
     /** @copydoc bool RpcServer::IListener::rpcAcceptConnection(const char*) */
@@ -109,6 +116,8 @@ class CentralSystem : public ICentralSystem, public ocpp::rpc::RpcServer::IListe
     std::unique_ptr<ocpp::websockets::IWebsocketServer> m_ws_server;
     /** @brief RPC server */
     std::unique_ptr<ocpp::rpc::RpcServer> m_rpc_server;
+    /** @brief Fast path for the steady state requests */
+    ChargePointFastPath m_fast_path;
 
     /** @brief Uptime timer */
     std::unique_ptr<ocpp::helpers::Timer> m_uptime_timer;
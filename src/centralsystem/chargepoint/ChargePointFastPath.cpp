@@ -0,0 +1,185 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "ChargePointFastPath.h"
+#include "Clock.h"
+#include "Heartbeat.h"
+#include "Logger.h"
+#include "StatusNotification.h"
+
+#include <cstring>
+
+using namespace ocpp::types;
+
+namespace ocpp
+{
+namespace centralsystem
+{
+
+/** @brief Constructor */
+ChargePointFastPath::ChargePointFastPath() : m_handler(nullptr) { }
+
+/** @brief Destructor */
+ChargePointFastPath::~ChargePointFastPath() { }
+
+/** @brief Process a request received from a charge point */
+bool ChargePointFastPath::process(const std::string&      chargepoint_id,
+                                  const char*             action,
+                                  const rapidjson::Value& payload,
+                                  std::string&            response)
+{
+    bool ret = false;
+
+    // Check if the fast path is enabled
+    if (m_handler)
+    {
+        if (ocpp::messages::HEARTBEAT_ACTION == action)
+        {
+            // Heartbeat request has no fields
+            if (payload.ObjectEmpty())
+            {
+                LOG_DEBUG << "[" << chargepoint_id << "] - Heartbeat received";
+
+                // Notify request
+                m_handler->heartbeat(chargepoint_id);
+
+                // Prepare response
+                heartbeatResponse(response);
+                ret = true;
+            }
+        }
+        else if (ocpp::messages::STATUS_NOTIFICATION_ACTION == action)
+        {
+            // Decode request, invalid requests are processed by the standard path to generate the appropriate error
+            StatusNotificationInfo status;
+            if (parseStatusNotification(payload, status))
+            {
+                LOG_DEBUG << "[" << chargepoint_id << "] - Status notification received : connectorId = " << status.connector_id
+                          << " -  status = " << ChargePointStatusHelper.toString(status.status)
+                          << " - errorCode = " << ChargePointErrorCodeHelper.toString(status.error_code);
+
+                // Notify request
+                m_handler->statusNotification(chargepoint_id, status);
+
+                // Empty response
+                response = "{}";
+                ret      = true;
+            }
+        }
+        else
+        {
+            // Not handled by the fast path
+        }
+    }
+
+    return ret;
+}
+
+/** @brief Decode the payload of a StatusNotification request */
+bool ChargePointFastPath::parseStatusNotification(const rapidjson::Value& payload, StatusNotificationInfo& status)
+{
+    bool ret           = payload.IsObject();
+    bool has_connector = false;
+    bool has_error     = false;
+    bool has_status    = false;
+
+    status.connector_id = 0;
+    status.error_code   = ChargePointErrorCode::NoError;
+    status.status       = ChargePointStatus::Available;
+    status.timestamp    = DateTime();
+    status.info         = nullptr;
+    status.vendor_id    = nullptr;
+    status.vendor_error = nullptr;
+
+    // Decode fields
+    for (auto it = payload.MemberBegin(); ret && (it != payload.MemberEnd()); ++it)
+    {
+        const char*             name  = it->name.GetString();
+        const rapidjson::Value& value = it->value;
+        if (strcmp(name, "connectorId") == 0)
+        {
+            ret = value.IsUint();
+            if (ret)
+            {
+                status.connector_id = value.GetUint();
+                has_connector       = true;
+            }
+        }
+        else if (strcmp(name, "errorCode") == 0)
+        {
+            ret = value.IsString();
+            if (ret)
+            {
+                ret       = ChargePointErrorCodeHelper.fromString(value.GetString(), value.GetStringLength(), status.error_code);
+                has_error = ret;
+            }
+        }
+        else if (strcmp(name, "status") == 0)
+        {
+            ret = value.IsString();
+            if (ret)
+            {
+                ret        = ChargePointStatusHelper.fromString(value.GetString(), value.GetStringLength(), status.status);
+                has_status = ret;
+            }
+        }
+        else if (strcmp(name, "info") == 0)
+        {
+            ret         = value.IsString() && (value.GetStringLength() <= 50u);
+            status.info = value.GetString();
+        }
+        else if (strcmp(name, "timestamp") == 0)
+        {
+            ret = value.IsString() && status.timestamp.assign(value.GetString());
+        }
+        else if (strcmp(name, "vendorId") == 0)
+        {
+            ret              = value.IsString() && (value.GetStringLength() <= 255u);
+            status.vendor_id = value.GetString();
+        }
+        else if (strcmp(name, "vendorErrorCode") == 0)
+        {
+            ret                 = value.IsString() && (value.GetStringLength() <= 50u);
+            status.vendor_error = value.GetString();
+        }
+        else
+        {
+            // Additional properties are not allowed
+            ret = false;
+        }
+    }
+
+    // Check required fields
+    return (ret && has_connector && has_error && has_status);
+}
+
+/** @brief Get the heartbeat response corresponding to the current time */
+void ChargePointFastPath::heartbeatResponse(std::string& response)
+{
+    // Current time representation is shared and only formatted once per second
+    char   now[DateTime::MAX_STR_SIZE];
+    size_t len = ocpp::helpers::Clock::format(now);
+
+    response.reserve(len + 20u);
+    response = "{\"currentTime\":\"";
+    response.append(now, len);
+    response += "\"}";
+}
+
+} // namespace centralsystem
+} // namespace ocpp
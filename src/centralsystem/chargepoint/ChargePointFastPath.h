@@ -0,0 +1,82 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPENOCPP_CHARGEPOINTFASTPATH_H
+#define OPENOCPP_CHARGEPOINTFASTPATH_H
+
+#include "IChargePointFastPathHandler.h"
+#include "json.h"
+
+#include <string>
+
+namespace ocpp
+{
+namespace centralsystem
+{
+
+/** @brief Fast path processing of the Heartbeat and StatusNotification requests, shared by all the charge points */
+class ChargePointFastPath
+{
+  public:
+    /** @brief Constructor */
+    ChargePointFastPath();
+    /** @brief Destructor */
+    virtual ~ChargePointFastPath();
+
+    /**
+     * @brief Register the user handler which enables the fast path
+     * @param handler User handler
+     */
+    void registerHandler(IChargePointFastPathHandler& handler) { m_handler = &handler; }
+
+    /**
+     * @brief Indicate if the fast path is enabled
+     * @return true if the fast path is enabled, false otherwise
+     */
+    bool isEnabled() const { return (m_handler != nullptr); }
+
+    /**
+     * @brief Process a request received from a charge point
+     * @param chargepoint_id Charge point's identifier
+     * @param action Action
+     * @param payload JSON payload for the action
+     * @param response Serialized JSON response payload
+     * @return true if the request has been handled, false if it must be processed through the standard path
+     */
+    bool process(const std::string& chargepoint_id, const char* action, const rapidjson::Value& payload, std::string& response);
+
+    /**
+     * @brief Decode the payload of a StatusNotification request
+     * @param payload JSON payload of the request
+     * @param status Decoded status notification (strings point into the payload)
+     * @return true if the payload is valid, false otherwise
+     */
+    static bool parseStatusNotification(const rapidjson::Value& payload, StatusNotificationInfo& status);
+
+  private:
+    /** @brief User handler */
+    IChargePointFastPathHandler* m_handler;
+
+    /** @brief Get the heartbeat response corresponding to the current time */
+    void heartbeatResponse(std::string& response);
+};
+
+} // namespace centralsystem
+} // namespace ocpp
+
+#endif // OPENOCPP_CHARGEPOINTFASTPATH_H
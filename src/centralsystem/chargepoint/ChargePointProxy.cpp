@@ -62,7 +62,8 @@ ChargePointProxy::ChargePointProxy(ICentralSystem&
                                    std::shared_ptr<ocpp::rpc::RpcServer::Client> rpc,
                                    const ocpp::messages::MessagesValidator&      messages_validator,
                                    ocpp::messages::MessagesConverter&            messages_converter,
-                                   const ocpp::config::ICentralSystemConfig&     stack_config)
+                                   const ocpp::config::ICentralSystemConfig&     stack_config,
+                                   ChargePointFastPath&                          fast_path)
     : m_central_system(central_system),
       m_identifier(identifier),
       m_rpc(rpc),
@@ -70,10 +71,16 @@ ChargePointProxy::ChargePointProxy(ICentralSystem&
       m_msg_sender(*m_rpc, messages_converter, messages_validator, stack_config.callRequestTimeout()),
       m_handler(m_identifier, messages_converter, m_msg_dispatcher, stack_config),
       m_messages_validator(messages_validator),
-      m_messages_converter(messages_converter)
+      m_messages_converter(messages_converter),
+      m_user_handler(nullptr),
+      m_fast_path(fast_path)
 {
     m_rpc->registerSpy(*this);
     m_rpc->registerListener(*this);
+    if (m_fast_path.isEnabled())
+    {
+        m_rpc->registerFastPathHandler(*this);
+    }
 }
 
 /** @brief Destructor */
@@ -96,6 +103,12 @@ const std::string& ChargePointProxy::ipAddress() const
     return m_rpc->ipAddress();
 }
 
+/** @copydoc ocpp::websockets::SendQueueStats ICentralSystem::IChargePoint::sendQueueStats() const */
+ocpp::websockets::SendQueueStats ChargePointProxy::sendQueueStats() const
+{
+    return m_rpc->sendQueueStats();
+}
+
 /** @copydoc void ICentralSystem::IChargePoint::setTimeout(std::chrono::milliseconds) */
 void ChargePointProxy::setTimeout(std::chrono::milliseconds timeout)
 {
@@ -1250,5 +1263,13 @@ void ChargePointProxy::rcpMessageSent(const std::string& msg)
     LOG_COM << "[" << m_identifier << "] - TX : " << msg;
 }
 
+// RpcBase::IFastPathHandler interface
+
+/** @copydoc bool RpcBase::IFastPathHandler::rpcFastCallReceived(const char*, const rapidjson::Value&, std::string&) */
+bool ChargePointProxy::rpcFastCallReceived(const char* action, const rapidjson::Value& payload, std::string& response)
+{
+    return m_fast_path.process(m_identifier, action, payload, response);
+}
+
 } // namespace centralsystem
 } // namespace ocpp
@@ -19,6 +19,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #ifndef OPENOCPP_CS_CHARGEPOINTPROXY_H
 #define OPENOCPP_CS_CHARGEPOINTPROXY_H
 
+#include "ChargePointFastPath.h"
 #include "ChargePointHandler.h"
 #include "GenericMessageSender.h"
 #include "ICentralSystem.h"
@@ -37,7 +38,10 @@ namespace centralsystem
 {
 
 /** @brief Charge point proxy */
-class ChargePointProxy : public ICentralSystem::IChargePoint, public ocpp::rpc::IRpc::IListener, public ocpp::rpc::IRpc::ISpy
+class ChargePointProxy : public ICentralSystem::IChargePoint,
+                         public ocpp::rpc::IRpc::IListener,
+                         public ocpp::rpc::IRpc::ISpy,
+                         public ocpp::rpc::RpcBase::IFastPathHandler
 {
   public:
     /**
@@ -48,13 +52,15 @@ class ChargePointProxy : public ICentralSystem::IChargePoint, public ocpp::rpc::
      * @param messages_validator JSON schemas needed to validate payloads
      * @param messages_converter Converter from/to OCPP to/from JSON messages
      * @param stack_config Stack configuration
+     * @param fast_path Fast path for the steady state requests
      */
     ChargePointProxy(ICentralSystem&                               central_system,
                      const std::string&                            identifier,
                      std::shared_ptr<ocpp::rpc::RpcServer::Client> rpc,
                      const ocpp::messages::MessagesValidator&      messages_validator,
                      ocpp::messages::MessagesConverter&            messages_converter,
-                     const ocpp::config::ICentralSystemConfig&     stack_config);
+                     const ocpp::config::ICentralSystemConfig&     stack_config,
+                     ChargePointFastPath&                          fast_path);
     /** @brief Destructor */
     virtual ~ChargePointProxy();
 
@@ -69,6 +75,9 @@ class ChargePointProxy : public ICentralSystem::IChargePoint, public ocpp::rpc::
     /** @copydoc const std::string& ICentralSystem::IChargePoint::ipAddress() const */
     const std::string& ipAddress() const override;
 
+    /** @copydoc ocpp::websockets::SendQueueStats ICentralSystem::IChargePoint::sendQueueStats() const */
+    ocpp::websockets::SendQueueStats sendQueueStats() const override;
+
     /** @copydoc const std::string& ICentralSystem::IChargePoint::identifier() const */
     const std::string& identifier() const override { return m_identifier; }
 
@@ -312,6 +321,11 @@ class ChargePointProxy : public ICentralSystem::IChargePoint, public ocpp::rpc::
     /** @copydoc void IRpc::ISpy::rcpMessageSent(const std::string& msg) */
     void rcpMessageSent(const std::string& msg) override;
 
+    // RpcBase::IFastPathHandler interface
+
+    /** @copydoc bool RpcBase::IFastPathHandler::rpcFastCallReceived(const char*, const rapidjson::Value&, std::string&) */
+    bool rpcFastCallReceived(const char* action, const rapidjson::Value& payload, std::string& response) override;
+
     // Accessors
 
     /** @brief RPC connection */
@@ -342,6 +356,8 @@ class ChargePointProxy : public ICentralSystem::IChargePoint, public ocpp::rpc::
     ocpp::messages::MessagesConverter& m_messages_converter;
     /** @brief User request handler */
     IChargePointRequestHandler* m_user_handler;
+    /** @brief Fast path for the steady state requests */
+    ChargePointFastPath& m_fast_path;
 
     /**
      * @brief Generic ISO15118 request sender
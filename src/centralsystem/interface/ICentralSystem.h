@@ -25,9 +25,12 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "CertificateHashDataType.h"
 #include "ChargingProfile.h"
 #include "ICentralSystemConfig.h"
+#include "IChargePointFastPathHandler.h"
 #include "IChargePointRequestHandler.h"
 #include "KeyValue.h"
 #include "SecurityEvent.h"
+#include "SendQueueConfig.h"
+#include "TlsSession.h"
 
 #include <memory>
 
@@ -113,6 +116,19 @@ class ICentralSystem
      */
     virtual bool stop() = 0;
 
+    /**
+     * @brief Register a handler to process the Heartbeat and StatusNotification requests
+     *        directly from the websocket thread (applies to the charge points connecting after the call)
+     * @param handler Fast path handler
+     */
+    virtual void registerFastPathHandler(IChargePointFastPathHandler& handler) = 0;
+
+    /**
+     * @brief Get the statistics of the TLS handshakes of the charge point connections
+     * @return Statistics of the TLS handshakes
+     */
+    virtual ocpp::websockets::TlsStats getTlsStats() const = 0;
+
     /** @brief Interface for charge point proxy implementations */
     class IChargePoint
     {
@@ -132,6 +148,12 @@ class ICentralSystem
          */
         virtual const std::string& ipAddress() const = 0;
 
+        /**
+         * @brief Get the statistics of the websocket send queue of the charge point
+         * @return Statistics of the websocket send queue
+         */
+        virtual ocpp::websockets::SendQueueStats sendQueueStats() const = 0;
+
         /**
          * @brief Get the charge point identifier
          * @return charge point identifier
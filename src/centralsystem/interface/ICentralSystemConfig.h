@@ -71,6 +71,16 @@ class ICentralSystemConfig
     virtual std::string tlsServerCertificateCa() const = 0;
     /** @brief Enable client authentication using certificate */
     virtual bool tlsClientCertificateAuthent() const = 0;
+    /** @brief Interval between 2 rotations of the keys protecting the TLS session tickets (0 = no rotation) */
+    virtual std::chrono::seconds tlsTicketKeyRotationInterval() const = 0;
+    /** @brief Maximum number of messages waiting to be sent on the websocket connection (0 = no limit) */
+    virtual unsigned int webSocketSendQueueMaxMessages() const = 0;
+    /** @brief Maximum size in bytes of the messages waiting to be sent on the websocket connection (0 = no limit) */
+    virtual unsigned int webSocketSendQueueMaxSize() const = 0;
+    /** @brief Behavior when the websocket send queue is full : fail, block or disconnect */
+    virtual std::string webSocketSendQueuePolicy() const = 0;
+    /** @brief Maximum wait time for room in the websocket send queue when using the block policy */
+    virtual std::chrono::milliseconds webSocketSendQueueBlockTimeout() const = 0;
 
     // Log
 
@@ -0,0 +1,82 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPENOCPP_ICHARGEPOINTFASTPATHHANDLER_H
+#define OPENOCPP_ICHARGEPOINTFASTPATHHANDLER_H
+
+#include "DateTime.h"
+#include "Enums.h"
+
+#include <string>
+
+namespace ocpp
+{
+namespace centralsystem
+{
+
+/** @brief Compact representation of a status notification decoded by the fast path */
+struct StatusNotificationInfo
+{
+    /** @brief Id of the connector for which the status is reported */
+    unsigned int connector_id;
+    /** @brief Error code */
+    ocpp::types::ChargePointErrorCode error_code;
+    /** @brief Connector's status */
+    ocpp::types::ChargePointStatus status;
+    /** @brief Time for which the status is reported (0 if not provided) */
+    ocpp::types::DateTime timestamp;
+    /** @brief Additional information related to the error (nullptr if not provided) */
+    const char* info;
+    /** @brief Vendor specific implementation identifier (nullptr if not provided) */
+    const char* vendor_id;
+    /** @brief Vendor specific error code (nullptr if not provided) */
+    const char* vendor_error;
+};
+
+/**
+ * @brief Interface for the fast path processing of the charge points' steady state requests
+ *
+ * The Heartbeat and StatusNotification requests are answered directly from the websocket thread
+ * without going through the messages validation and the RPC worker pool. The notifications are
+ * made from the websocket thread and must not block. They replace the corresponding notifications
+ * of the IChargePointRequestHandler interface.
+ */
+class IChargePointFastPathHandler
+{
+  public:
+    /** @brief Destructor */
+    virtual ~IChargePointFastPathHandler() { }
+
+    /**
+     * @brief Called when an heartbeat has been received
+     * @param chargepoint_id Charge point's identifier
+     */
+    virtual void heartbeat(const std::string& chargepoint_id) { (void)chargepoint_id; }
+
+    /**
+     * @brief Called when a status notification has been received
+     * @param chargepoint_id Charge point's identifier
+     * @param status Status notification (strings are only valid during the call)
+     */
+    virtual void statusNotification(const std::string& chargepoint_id, const StatusNotificationInfo& status) = 0;
+};
+
+} // namespace centralsystem
+} // namespace ocpp
+
+#endif // OPENOCPP_ICHARGEPOINTFASTPATHHANDLER_H
@@ -90,6 +90,7 @@ ChargePoint::ChargePoint(const ocpp::config::IChargePointConfig&          stack_
       m_requests_fifo(m_database),
       m_security_manager(
           m_stack_config, m_ocpp_config, m_database, m_events_handler, *m_worker_pool.get(), m_messages_converter, m_requests_fifo, *this),
+      m_tls_sessions_db(m_database),
       m_reconnect_scheduled(false),
       m_ws_client(),
       m_rpc_client(),
@@ -234,6 +235,14 @@ bool ChargePoint::start()
 
             // Allocate resources
             m_ws_client  = std::unique_ptr<ocpp::websockets::IWebsocketClient>(ocpp::websockets::WebsocketFactory::newClient());
+            m_ws_client->setSendQueueConfig(ocpp::websockets::SendQueueConfig(m_stack_config.webSocketSendQueueMaxMessages(),
+                                                                              m_stack_config.webSocketSendQueueMaxSize(),
+                                                                              m_stack_config.webSocketSendQueuePolicy(),
+                                                                              m_stack_config.webSocketSendQueueBlockTimeout()));
+            if (m_stack_config.tlsSessionResumption())
+            {
+                m_ws_client->setTlsSessionStore(&m_tls_sessions_db);
+            }
             m_rpc_client = std::make_unique<ocpp::rpc::RpcClient>(*m_ws_client, "ocpp1.6");
             m_rpc_client->registerListener(*this);
             m_rpc_client->registerClientListener(*this);
@@ -244,10 +253,17 @@ bool ChargePoint::start()
 
             m_config_manager  = std::make_unique<ConfigManager>(m_ocpp_config, m_messages_converter, *m_msg_dispatcher);
             m_trigger_manager = std::make_unique<TriggerMessageManager>(m_connectors, m_messages_converter, *m_msg_dispatcher);
-            m_authent_manager = std::make_unique<AuthentManager>(
-                m_stack_config, m_ocpp_config, m_database, m_internal_config, m_messages_converter, *m_msg_dispatcher, *m_msg_sender);
+            m_authent_manager = std::make_unique<AuthentManager>(m_stack_config,
+                                                                 m_ocpp_config,
+                                                                 *m_config_manager,
+                                                                 m_database,
+                                                                 m_internal_config,
+                                                                 m_messages_converter,
+                                                                 *m_msg_dispatcher,
+                                                                 *m_msg_sender);
             m_status_manager         = std::make_unique<StatusManager>(m_stack_config,
                                                                m_ocpp_config,
+                                                               *m_config_manager,
                                                                m_events_handler,
                                                                m_internal_config,
                                                                *m_timer_pool,
@@ -303,6 +319,7 @@ bool ChargePoint::start()
             m_maintenance_manager = std::make_unique<MaintenanceManager>(m_stack_config,
                                                                          m_internal_config,
                                                                          m_events_handler,
+                                                                         *m_timer_pool,
                                                                          *m_worker_pool,
                                                                          m_messages_converter,
                                                                          *m_msg_dispatcher,
@@ -311,7 +328,7 @@ bool ChargePoint::start()
                                                                          *m_trigger_manager,
                                                                          m_security_manager);
 
-            m_requests_fifo_manager = std::make_unique<RequestFifoManager>(m_ocpp_config,
+            m_requests_fifo_manager = std::make_unique<RequestFifoManager>(*m_config_manager,
                                                                            m_events_handler,
                                                                            *m_timer_pool,
                                                                            *m_worker_pool,
@@ -425,6 +442,41 @@ bool ChargePoint::reconnect()
 
     return ret;
 }
+
+/** @copydoc ocpp::websockets::TlsStats IChargePoint::getTlsStats() const */
+ocpp::websockets::TlsStats ChargePoint::getTlsStats() const
+{
+    ocpp::websockets::TlsStats stats;
+
+    if (m_ws_client)
+    {
+        stats = m_ws_client->tlsStats();
+    }
+
+    return stats;
+}
+
+/** @copydoc bool IChargePoint::refreshConfiguration() */
+bool ChargePoint::refreshConfiguration()
+{
+    bool ret = false;
+
+    // Check if it has been started
+    if (m_config_manager)
+    {
+        // Rebuild the configuration snapshot
+        LOG_INFO << "Configuration refresh triggered";
+        m_config_manager->refreshSnapshot();
+        ret = true;
+    }
+    else
+    {
+        LOG_ERROR << "Stack stopped";
+    }
+
+    return ret;
+}
+
 /** @copydoc ocpp::types::RegistrationStatus IChargePoint::getRegistrationStatus() */
 ocpp::types::RegistrationStatus ChargePoint::getRegistrationStatus()
 {
@@ -670,6 +722,31 @@ bool ChargePoint::getSetpoint(unsigned int
     return ret;
 }
 
+/** @copydoc bool IChargePoint::getSetpoint(unsigned int,
+                                            ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>&,
+                                            ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>&,
+                                            ocpp::types::DateTime&,
+                                            ocpp::types::ChargingRateUnitType) */
+bool ChargePoint::getSetpoint(unsigned int                                               connector_id,
+                              ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& charge_point_setpoint,
+                              ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& connector_setpoint,
+                              ocpp::types::DateTime&                                     next_change,
+                              ocpp::types::ChargingRateUnitType                          unit)
+{
+    bool ret = false;
+
+    if (m_smart_charging_manager)
+    {
+        ret = m_smart_charging_manager->getSetpoint(connector_id, charge_point_setpoint, connector_setpoint, next_change, unit);
+    }
+    else
+    {
+        LOG_ERROR << "Stack is not started";
+    }
+
+    return ret;
+}
+
 /** @copydoc bool IChargePoint::notifyFirmwareUpdateStatus(bool) */
 bool ChargePoint::notifyFirmwareUpdateStatus(bool success)
 {
@@ -1026,6 +1103,7 @@ void ChargePoint::initDatabase()
     m_connectors.initDatabaseTable();
     m_requests_fifo.initDatabaseTable();
     m_security_manager.initDatabaseTable();
+    m_tls_sessions_db.initDatabaseTable();
 
     // Internal keys
     if (!m_internal_config.keyExist(STACK_VERSION_KEY))
@@ -1100,10 +1178,10 @@ void ChargePoint::processUptime()
 /** @brief Save the uptime counter in database */
 void ChargePoint::saveUptime()
 {
-    m_internal_config.setKey(UPTIME_KEY, std::to_string(m_uptime));
-    m_internal_config.setKey(DISCONNECTED_TIME_KEY, std::to_string(m_disconnected_time));
-    m_internal_config.setKey(TOTAL_UPTIME_KEY, std::to_string(m_total_uptime));
-    m_internal_config.setKey(TOTAL_DISCONNECTED_TIME_KEY, std::to_string(m_total_disconnected_time));
+    m_internal_config.setKeys({{UPTIME_KEY, std::to_string(m_uptime)},
+                               {DISCONNECTED_TIME_KEY, std::to_string(m_disconnected_time)},
+                               {TOTAL_UPTIME_KEY, std::to_string(m_total_uptime)},
+                               {TOTAL_DISCONNECTED_TIME_KEY, std::to_string(m_total_disconnected_time)}});
 }
 
 /** @brief Schedule a reconnection to the Central System */
@@ -30,6 +30,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "RpcClient.h"
 #include "SecurityManager.h"
 #include "Timer.h"
+#include "TlsSessionsDatabase.h"
 
 #include <memory>
 
@@ -105,6 +106,12 @@ class ChargePoint : public IChargePoint,
     /** @copydoc bool IChargePoint::reconnect() */
     bool reconnect() override;
 
+    /** @copydoc ocpp::websockets::TlsStats IChargePoint::getTlsStats() const */
+    ocpp::websockets::TlsStats getTlsStats() const override;
+
+    /** @copydoc bool IChargePoint::refreshConfiguration() */
+    bool refreshConfiguration() override;
+
     /** @copydoc ocpp::types::RegistrationStatus IChargePoint::getRegistrationStatus() */
     ocpp::types::RegistrationStatus getRegistrationStatus() override;
 
@@ -156,6 +163,17 @@ class ChargePoint : public IChargePoint,
                      ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& connector_setpoint,
                      ocpp::types::ChargingRateUnitType                          unit) override;
 
+    /** @copydoc bool IChargePoint::getSetpoint(unsigned int,
+                                                ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>&,
+                                                ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>&,
+                                                ocpp::types::DateTime&,
+                                                ocpp::types::ChargingRateUnitType) */
+    bool getSetpoint(unsigned int                                               connector_id,
+                     ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& charge_point_setpoint,
+                     ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& connector_setpoint,
+                     ocpp::types::DateTime&                                     next_change,
+                     ocpp::types::ChargingRateUnitType                          unit) override;
+
     /** @copydoc bool IChargePoint::notifyFirmwareUpdateStatus(bool) */
     bool notifyFirmwareUpdateStatus(bool success) override;
 
@@ -269,6 +287,8 @@ class ChargePoint : public IChargePoint,
     RequestFifo m_requests_fifo;
     /** @brief Security manager */
     SecurityManager m_security_manager;
+    /** @brief TLS sessions database */
+    TlsSessionsDatabase m_tls_sessions_db;
     /** @brief Indicate that a reconnection process has been scheduled */
     bool m_reconnect_scheduled;
 
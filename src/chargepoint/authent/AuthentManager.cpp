@@ -23,6 +23,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "Connectors.h"
 #include "GenericMessageSender.h"
 #include "IChargePointConfig.h"
+#include "IConfigManager.h"
 #include "IOcppConfig.h"
 #include "Logger.h"
 
@@ -37,12 +38,13 @@ namespace chargepoint
 /** @brief Constructor */
 AuthentManager::AuthentManager(const ocpp::config::IChargePointConfig&         stack_config,
                                ocpp::config::IOcppConfig&                      ocpp_config,
+                               const IConfigManager&                           config_manager,
                                ocpp::database::Database&                       database,
                                ocpp::config::IInternalConfigManager&           internal_config,
                                const ocpp::messages::GenericMessagesConverter& messages_converter,
                                ocpp::messages::IMessageDispatcher&             msg_dispatcher,
                                ocpp::messages::GenericMessageSender&           msg_sender)
-    : m_ocpp_config(ocpp_config),
+    : m_config_manager(config_manager),
       m_msg_sender(msg_sender),
       m_cache(*new AuthentCache(stack_config, ocpp_config, database, messages_converter, msg_dispatcher)),
       m_local_list(*new AuthentLocalList(ocpp_config, database, internal_config, messages_converter, msg_dispatcher))
@@ -65,6 +67,9 @@ ocpp::types::AuthorizationStatus AuthentManager::authorize(const std::string& id
     // Check connection status
     bool is_connected = m_msg_sender.isConnected();
 
+    // Get configuration
+    auto config = m_config_manager.snapshot();
+
     // Authorize procedure
     parent_id = "";
     do
@@ -76,11 +81,11 @@ ocpp::types::AuthorizationStatus AuthentManager::authorize(const std::string& id
         status = AuthorizationStatus::Invalid;
 
         // Check if local authorization is enabled
-        if ((is_connected && m_ocpp_config.localPreAuthorize()) || (!is_connected && m_ocpp_config.localAuthorizeOffline()))
+        if ((is_connected && config->localPreAuthorize) || (!is_connected && config->localAuthorizeOffline))
         {
             // Check local authorization list
             IdTagInfo tag_info;
-            if (m_ocpp_config.localAuthListEnabled())
+            if (config->localAuthListEnabled)
             {
                 found = m_local_list.check(id_tag, tag_info);
                 if (found)
@@ -94,7 +99,7 @@ ocpp::types::AuthorizationStatus AuthentManager::authorize(const std::string& id
             // Check local cache
             if (!found)
             {
-                if (m_ocpp_config.authorizationCacheEnabled())
+                if (config->authorizationCacheEnabled)
                 {
                     found = m_cache.check(id_tag, tag_info);
                     if (found)
@@ -152,7 +157,7 @@ ocpp::types::AuthorizationStatus AuthentManager::authorize(const std::string& id
             else
             {
                 // Check if unknown ids are allowed when offline
-                if (m_ocpp_config.allowOfflineTxForUnknownId())
+                if (config->allowOfflineTxForUnknownId)
                 {
                     status    = AuthorizationStatus::Accepted;
                     parent_id = "";
@@ -172,11 +177,12 @@ ocpp::types::AuthorizationStatus AuthentManager::authorize(const std::string& id
 void AuthentManager::update(const std::string& id_tag, const ocpp::types::IdTagInfo& tag_info)
 {
     // Check if the cache is enabled
-    if (m_ocpp_config.authorizationCacheEnabled())
+    auto config = m_config_manager.snapshot();
+    if (config->authorizationCacheEnabled)
     {
         // Check local authorization list
         bool in_local_list = false;
-        if (m_ocpp_config.localAuthListEnabled())
+        if (config->localAuthListEnabled)
         {
             IdTagInfo unused_tag_info;
             in_local_list = m_local_list.check(id_tag, unused_tag_info);
@@ -195,13 +201,14 @@ ocpp::types::AuthorizationStatus AuthentManager::iso15118Authorize(const std::st
     AuthorizationStatus status = AuthorizationStatus::Invalid;
 
     // Check if local authorization is enabled
-    if (m_ocpp_config.localAuthorizeOffline())
+    auto config = m_config_manager.snapshot();
+    if (config->localAuthorizeOffline)
     {
         bool found = false;
 
         // Check local authorization list
         IdTagInfo tag_info;
-        if (m_ocpp_config.localAuthListEnabled())
+        if (config->localAuthListEnabled)
         {
             found = m_local_list.check(token_id, tag_info);
             if (found)
@@ -214,7 +221,7 @@ ocpp::types::AuthorizationStatus AuthentManager::iso15118Authorize(const std::st
         // Check local cache
         if (!found)
         {
-            if (m_ocpp_config.authorizationCacheEnabled())
+            if (config->authorizationCacheEnabled)
             {
                 found = m_cache.check(token_id, tag_info);
                 if (found)
@@ -228,7 +235,7 @@ ocpp::types::AuthorizationStatus AuthentManager::iso15118Authorize(const std::st
         // Check if unknown ids are allowed when offline
         if (!found)
         {
-            if (m_ocpp_config.allowOfflineTxForUnknownId())
+            if (config->allowOfflineTxForUnknownId)
             {
                 status = AuthorizationStatus::Accepted;
 
@@ -246,11 +253,12 @@ ocpp::types::AuthorizationStatus AuthentManager::iso15118Authorize(const std::st
 void AuthentManager::iso15118Update(const std::string& token_id, const ocpp::types::IdTokenInfoType& token_info)
 {
     // Check if the cache is enabled
-    if (m_ocpp_config.authorizationCacheEnabled())
+    auto config = m_config_manager.snapshot();
+    if (config->authorizationCacheEnabled)
     {
         // Check local authorization list
         bool in_local_list = false;
-        if (m_ocpp_config.localAuthListEnabled())
+        if (config->localAuthListEnabled)
         {
             IdTagInfo unused_tag_info;
             in_local_list = m_local_list.check(token_id, unused_tag_info);
@@ -47,6 +47,7 @@ namespace chargepoint
 
 class AuthentCache;
 class AuthentLocalList;
+class IConfigManager;
 
 /** @brief Handle charge point authentication requests */
 class AuthentManager : public IAuthentManager
@@ -55,6 +56,7 @@ class AuthentManager : public IAuthentManager
     /** @brief Constructor */
     AuthentManager(const ocpp::config::IChargePointConfig&         stack_config,
                    ocpp::config::IOcppConfig&                      ocpp_config,
+                   const IConfigManager&                           config_manager,
                    ocpp::database::Database&                       database,
                    ocpp::config::IInternalConfigManager&           internal_config,
                    const ocpp::messages::GenericMessagesConverter& messages_converter,
@@ -77,8 +79,8 @@ class AuthentManager : public IAuthentManager
     void iso15118Update(const std::string& token_id, const ocpp::types::IdTokenInfoType& token_info) override;
 
   private:
-    /** @brief Standard OCPP configuration */
-    ocpp::config::IOcppConfig& m_ocpp_config;
+    /** @brief Configuration manager */
+    const IConfigManager& m_config_manager;
     /** @brief Message sender */
     ocpp::messages::GenericMessageSender& m_msg_sender;
 
@@ -35,7 +35,10 @@ ConfigManager::ConfigManager(ocpp::config::IOcppConfig&                      ocp
       GenericMessageHandler<ChangeConfigurationReq, ChangeConfigurationConf>(CHANGE_CONFIGURATION_ACTION, messages_converter),
       m_ocpp_config(ocpp_config),
       m_specific_checks(),
-      m_listeners()
+      m_listeners(),
+      m_snapshot_listeners(),
+      m_snapshot(std::make_shared<const OcppConfigSnapshot>(ocpp_config)),
+      m_snapshot_mutex()
 {
     msg_dispatcher.registerHandler(GET_CONFIGURATION_ACTION,
                                    *dynamic_cast<GenericMessageHandler<GetConfigurationReq, GetConfigurationConf>*>(this));
@@ -60,6 +63,18 @@ void ConfigManager::registerConfigChangedListener(const std::string& key, IConfi
     m_listeners[lower_case_key] = &listener;
 }
 
+/** @copydoc void IConfigManager::registerConfigSnapshotListener(IConfigSnapshotListener&) */
+void ConfigManager::registerConfigSnapshotListener(IConfigSnapshotListener& listener)
+{
+    m_snapshot_listeners.push_back(&listener);
+}
+
+/** @copydoc std::shared_ptr<const OcppConfigSnapshot> IConfigManager::snapshot() const */
+std::shared_ptr<const OcppConfigSnapshot> ConfigManager::snapshot() const
+{
+    return std::atomic_load(&m_snapshot);
+}
+
 /** @copydoc bool GenericMessageHandler<RequestType, ResponseType>::handleMessage(const RequestType& request,
  *                                                                                ResponseType& response,
  *                                                                                std::string& error_code,
@@ -107,6 +122,9 @@ bool ConfigManager::handleMessage(const ocpp::messages::ChangeConfigurationReq&
         response.status = m_ocpp_config.setConfiguration(request.key, request.value);
         if (response.status == ConfigurationStatus::Accepted)
         {
+            // Rebuild snapshot
+            refreshSnapshot();
+
             // Notify change
             auto iter = m_listeners.find(lower_case_key);
             if (iter != m_listeners.end())
@@ -118,5 +136,28 @@ bool ConfigManager::handleMessage(const ocpp::messages::ChangeConfigurationReq&
     return true;
 }
 
+/** @copydoc void IConfigManager::refreshSnapshot() */
+void ConfigManager::refreshSnapshot()
+{
+    // Rebuilds can be requested concurrently by the Central System and the user application
+    std::lock_guard<std::mutex> lock(m_snapshot_mutex);
+
+    // Build the new snapshot and publish it, readers still holding
+    // the previous one will release it when they are done
+    auto previous = std::atomic_load(&m_snapshot);
+    auto current  = std::make_shared<const OcppConfigSnapshot>(m_ocpp_config);
+    std::atomic_store(&m_snapshot, current);
+
+    // Notify the changed values
+    std::vector<std::string> changed_keys = current->diff(*previous);
+    if (!changed_keys.empty())
+    {
+        for (auto& listener : m_snapshot_listeners)
+        {
+            listener->configurationSnapshotChanged(*previous, *current, changed_keys);
+        }
+    }
+}
+
 } // namespace chargepoint
 } // namespace ocpp
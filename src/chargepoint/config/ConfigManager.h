@@ -25,7 +25,9 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "GetConfiguration.h"
 #include "IConfigManager.h"
 
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 namespace ocpp
 {
@@ -62,6 +64,15 @@ class ConfigManager
     /** @copydoc void IConfigManager::registerConfigChangedListener(const std::string&, IConfigChangedListener&) */
     void registerConfigChangedListener(const std::string& key, IConfigChangedListener& listener) override;
 
+    /** @copydoc void IConfigManager::registerConfigSnapshotListener(IConfigSnapshotListener&) */
+    void registerConfigSnapshotListener(IConfigSnapshotListener& listener) override;
+
+    /** @copydoc std::shared_ptr<const OcppConfigSnapshot> IConfigManager::snapshot() const */
+    std::shared_ptr<const OcppConfigSnapshot> snapshot() const override;
+
+    /** @copydoc void IConfigManager::refreshSnapshot() */
+    void refreshSnapshot() override;
+
     // GenericMessageHandler interface
 
     /** @copydoc bool GenericMessageHandler<RequestType, ResponseType>::handleMessage(const RequestType& request,
@@ -91,6 +102,12 @@ class ConfigManager
     std::unordered_map<std::string, ConfigurationValueCheckFunc> m_specific_checks;
     /** @brief Configuration listeners */
     std::unordered_map<std::string, IConfigChangedListener*> m_listeners;
+    /** @brief Configuration snapshot listeners */
+    std::vector<IConfigSnapshotListener*> m_snapshot_listeners;
+    /** @brief Current configuration snapshot (accessed only through std::atomic_load/std::atomic_store) */
+    std::shared_ptr<const OcppConfigSnapshot> m_snapshot;
+    /** @brief Serialize the rebuilds of the configuration snapshot */
+    std::mutex m_snapshot_mutex;
 };
 
 } // namespace chargepoint
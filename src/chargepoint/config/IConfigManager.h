@@ -20,8 +20,10 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #define OPENOCPP_ICONFIGMANAGER_H
 
 #include "Enums.h"
+#include "OcppConfigSnapshot.h"
 
 #include <functional>
+#include <memory>
 #include <string>
 
 namespace ocpp
@@ -35,6 +37,7 @@ class IConfigManager
   public:
     // Forward declarations
     class IConfigChangedListener;
+    class IConfigSnapshotListener;
 
     /** @brief Destructor */
     virtual ~IConfigManager() { }
@@ -56,6 +59,25 @@ class IConfigManager
      */
     virtual void registerConfigChangedListener(const std::string& key, IConfigChangedListener& listener) = 0;
 
+    /**
+     * @brief Register a listener to be notified when the configuration snapshot has been rebuilt
+     * @param listener Listener to register
+     */
+    virtual void registerConfigSnapshotListener(IConfigSnapshotListener& listener) = 0;
+
+    /**
+     * @brief Get the current snapshot of the standard OCPP configuration values
+     *        (lock-free, the returned snapshot is never modified)
+     * @return Current configuration snapshot
+     */
+    virtual std::shared_ptr<const OcppConfigSnapshot> snapshot() const = 0;
+
+    /**
+     * @brief Rebuild the configuration snapshot from the standard OCPP configuration
+     *        (needed when the values have been modified outside of a ChangeConfiguration request)
+     */
+    virtual void refreshSnapshot() = 0;
+
     /** @brief Interface for the configuration changed listeners */
     class IConfigChangedListener
     {
@@ -69,6 +91,24 @@ class IConfigManager
          */
         virtual void configurationValueChanged(const std::string& key) = 0;
     };
+
+    /** @brief Interface for the configuration snapshot listeners */
+    class IConfigSnapshotListener
+    {
+      public:
+        /** @brief Destructor */
+        virtual ~IConfigSnapshotListener() { }
+
+        /**
+         * @brief Called when the configuration snapshot has been rebuilt with different values
+         * @param previous Previous snapshot
+         * @param current New snapshot
+         * @param changed_keys Names of the configuration keys which have changed
+         */
+        virtual void configurationSnapshotChanged(const OcppConfigSnapshot&       previous,
+                                                  const OcppConfigSnapshot&       current,
+                                                  const std::vector<std::string>& changed_keys) = 0;
+    };
 };
 
 } // namespace chargepoint
@@ -0,0 +1,107 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "OcppConfigSnapshot.h"
+#include "IOcppConfig.h"
+
+namespace ocpp
+{
+namespace chargepoint
+{
+
+/** @brief Default constructor : all the values are set to 0 or false */
+OcppConfigSnapshot::OcppConfigSnapshot()
+    : allowOfflineTxForUnknownId(false),
+      authorizationCacheEnabled(false),
+      clockAlignedDataInterval(0),
+      localAuthListEnabled(false),
+      localAuthorizeOffline(false),
+      localPreAuthorize(false),
+      meterValueSampleInterval(0),
+      minimumStatusDuration(0),
+      transactionMessageAttempts(0),
+      transactionMessageRetryInterval(0)
+{
+}
+
+/** @brief Constructor, read all the values from the standard OCPP configuration */
+OcppConfigSnapshot::OcppConfigSnapshot(const ocpp::config::IOcppConfig& ocpp_config)
+    : allowOfflineTxForUnknownId(ocpp_config.allowOfflineTxForUnknownId()),
+      authorizationCacheEnabled(ocpp_config.authorizationCacheEnabled()),
+      clockAlignedDataInterval(ocpp_config.clockAlignedDataInterval()),
+      localAuthListEnabled(ocpp_config.localAuthListEnabled()),
+      localAuthorizeOffline(ocpp_config.localAuthorizeOffline()),
+      localPreAuthorize(ocpp_config.localPreAuthorize()),
+      meterValueSampleInterval(ocpp_config.meterValueSampleInterval()),
+      minimumStatusDuration(ocpp_config.minimumStatusDuration()),
+      transactionMessageAttempts(ocpp_config.transactionMessageAttempts()),
+      transactionMessageRetryInterval(ocpp_config.transactionMessageRetryInterval())
+{
+}
+
+/** @brief Compute the list of the configuration keys whose value differs from another snapshot */
+std::vector<std::string> OcppConfigSnapshot::diff(const OcppConfigSnapshot& other) const
+{
+    std::vector<std::string> ret;
+
+    if (allowOfflineTxForUnknownId != other.allowOfflineTxForUnknownId)
+    {
+        ret.push_back("AllowOfflineTxForUnknownId");
+    }
+    if (authorizationCacheEnabled != other.authorizationCacheEnabled)
+    {
+        ret.push_back("AuthorizationCacheEnabled");
+    }
+    if (clockAlignedDataInterval != other.clockAlignedDataInterval)
+    {
+        ret.push_back("ClockAlignedDataInterval");
+    }
+    if (localAuthListEnabled != other.localAuthListEnabled)
+    {
+        ret.push_back("LocalAuthListEnabled");
+    }
+    if (localAuthorizeOffline != other.localAuthorizeOffline)
+    {
+        ret.push_back("LocalAuthorizeOffline");
+    }
+    if (localPreAuthorize != other.localPreAuthorize)
+    {
+        ret.push_back("LocalPreAuthorize");
+    }
+    if (meterValueSampleInterval != other.meterValueSampleInterval)
+    {
+        ret.push_back("MeterValueSampleInterval");
+    }
+    if (minimumStatusDuration != other.minimumStatusDuration)
+    {
+        ret.push_back("MinimumStatusDuration");
+    }
+    if (transactionMessageAttempts != other.transactionMessageAttempts)
+    {
+        ret.push_back("TransactionMessageAttempts");
+    }
+    if (transactionMessageRetryInterval != other.transactionMessageRetryInterval)
+    {
+        ret.push_back("TransactionMessageRetryInterval");
+    }
+
+    return ret;
+}
+
+} // namespace chargepoint
+} // namespace ocpp
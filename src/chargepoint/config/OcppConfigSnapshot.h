@@ -0,0 +1,82 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPENOCPP_OCPPCONFIGSNAPSHOT_H
+#define OPENOCPP_OCPPCONFIGSNAPSHOT_H
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+namespace ocpp
+{
+// Forward declarations
+namespace config
+{
+class IOcppConfig;
+} // namespace config
+
+// Main namespace
+namespace chargepoint
+{
+
+/** @brief Typed copy of the standard OCPP configuration values which are read on the hot paths of the stack */
+struct OcppConfigSnapshot
+{
+    /** @brief Default constructor : all the values are set to 0 or false */
+    OcppConfigSnapshot();
+
+    /**
+     * @brief Constructor, read all the values from the standard OCPP configuration
+     * @param ocpp_config Standard OCPP configuration
+     */
+    OcppConfigSnapshot(const ocpp::config::IOcppConfig& ocpp_config);
+
+    /**
+     * @brief Compute the list of the configuration keys whose value differs from another snapshot
+     * @param other Snapshot to compare with
+     * @return Names of the configuration keys which have a different value
+     */
+    std::vector<std::string> diff(const OcppConfigSnapshot& other) const;
+
+    /** @brief AllowOfflineTxForUnknownId */
+    bool allowOfflineTxForUnknownId;
+    /** @brief AuthorizationCacheEnabled */
+    bool authorizationCacheEnabled;
+    /** @brief ClockAlignedDataInterval */
+    std::chrono::seconds clockAlignedDataInterval;
+    /** @brief LocalAuthListEnabled */
+    bool localAuthListEnabled;
+    /** @brief LocalAuthorizeOffline */
+    bool localAuthorizeOffline;
+    /** @brief LocalPreAuthorize */
+    bool localPreAuthorize;
+    /** @brief MeterValueSampleInterval */
+    std::chrono::seconds meterValueSampleInterval;
+    /** @brief MinimumStatusDuration */
+    std::chrono::seconds minimumStatusDuration;
+    /** @brief TransactionMessageAttempts */
+    unsigned int transactionMessageAttempts;
+    /** @brief TransactionMessageRetryInterval */
+    std::chrono::seconds transactionMessageRetryInterval;
+};
+
+} // namespace chargepoint
+} // namespace ocpp
+
+#endif // OPENOCPP_OCPPCONFIGSNAPSHOT_H
@@ -26,6 +26,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "OcspRequestDataType.h"
 #include "SecurityEvent.h"
 #include "SmartChargingSetpoint.h"
+#include "TlsSession.h"
 
 #include <memory>
 
@@ -115,6 +116,20 @@ class IChargePoint
      */
     virtual bool reconnect() = 0;
 
+    /**
+     * @brief Get the statistics of the TLS handshakes of the connection to the Central System
+     * @return Statistics of the TLS handshakes
+     */
+    virtual ocpp::websockets::TlsStats getTlsStats() const = 0;
+
+    /**
+     * @brief Notify the stack that the standard OCPP configuration values have been modified by the application
+     *        through its IOcppConfig implementation (the values modified by a ChangeConfiguration request
+     *        are taken into account automatically)
+     * @return true if the new values have been taken into account, false otherwise
+     */
+    virtual bool refreshConfiguration() = 0;
+
     /**
      * @brief Get the registration status of the charge point
      * @return Registration of the charge point
@@ -207,6 +222,23 @@ class IChargePoint
                              ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& connector_setpoint,
                              ocpp::types::ChargingRateUnitType                          unit = ocpp::types::ChargingRateUnitType::A) = 0;
 
+    /**
+     * @brief Get the smart charging setpoints for a connector and the whole charge point
+     *        along with the next point in time where they may change
+     * @param connector_id Id of the connector
+     * @param charge_point_setpoint Setpoint of the whole charge point (not set if no active profile)
+     * @param connector_setpoint Setpoint of the given connector (not set if no active profile)
+     * @param next_change Point in time until which the setpoints are guaranteed to stay the same
+     *                    unless the charging profiles or the transaction of the connector change
+     * @param unit Setpoint unit (A or W)
+     * @return true if the setpoints have been computed, false otherwise
+     */
+    virtual bool getSetpoint(unsigned int                                               connector_id,
+                             ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& charge_point_setpoint,
+                             ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& connector_setpoint,
+                             ocpp::types::DateTime&                                     next_change,
+                             ocpp::types::ChargingRateUnitType                          unit = ocpp::types::ChargingRateUnitType::A) = 0;
+
     /**
      * @brief Notify the end of a firmware update operation
      * @param success Set to true if the firmware has been installed,
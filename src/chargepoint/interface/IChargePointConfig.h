@@ -77,6 +77,16 @@ class IChargePointConfig
     /** @brief Skip server name check in certificates for TLS connections
      *         (Warning : enabling this feature is not recommended in production) */
     virtual bool tlsSkipServerNameCheck() const = 0;
+    /** @brief Persist the TLS session in the database to resume it on the next connections */
+    virtual bool tlsSessionResumption() const = 0;
+    /** @brief Maximum number of messages waiting to be sent on the websocket connection (0 = no limit) */
+    virtual unsigned int webSocketSendQueueMaxMessages() const = 0;
+    /** @brief Maximum size in bytes of the messages waiting to be sent on the websocket connection (0 = no limit) */
+    virtual unsigned int webSocketSendQueueMaxSize() const = 0;
+    /** @brief Behavior when the websocket send queue is full : fail, block or disconnect */
+    virtual std::string webSocketSendQueuePolicy() const = 0;
+    /** @brief Maximum wait time for room in the websocket send queue when using the block policy */
+    virtual std::chrono::milliseconds webSocketSendQueueBlockTimeout() const = 0;
 
     // Charge point identification
 
@@ -103,6 +113,10 @@ class IChargePointConfig
 
     /** @brief Nominal operating voltage (needed for Watt to Amp conversions in smart charging profiles) */
     virtual float operatingVoltage() const = 0;
+    /** @brief Local load balancing policy between the connectors : none, proportional, priority or minrate */
+    virtual std::string loadBalancingPolicy() const = 0;
+    /** @brief Interval between 2 refreshes of the connectors consumption for the local load balancing (0 = no periodic refresh) */
+    virtual std::chrono::milliseconds loadBalancingInterval() const = 0;
 
     // Authent
 
@@ -114,6 +128,12 @@ class IChargePointConfig
     /** @brief Maximum number of entries in the log (0 = no logs in database) */
     virtual unsigned int logMaxEntriesCount() const = 0;
 
+    // Maintenance
+
+    /** @brief Maximum bandwidth of the firmware downloads in bytes per second (0 = no limit),
+     *         only applies when IChargePointEventsHandler::downloadFileStreamed() is overridden */
+    virtual unsigned int transferMaxBandwidth() const = 0;
+
     // Security
 
     /** @brief Enable internal certificate management : the certificates will be managed by Open OCPP only */
@@ -122,6 +142,8 @@ class IChargePointConfig
     virtual bool securityEventNotificationEnabled() const = 0;
     /** @brief Maximum number of entries in the security log (0 = no security logs in database) */
     virtual unsigned int securityLogMaxEntriesCount() const = 0;
+    /** @brief Compression of the security log exports : none or gzip */
+    virtual std::string securityLogExportCompression() const = 0;
     /** @brief Hash type for certificate request generation : sha256, sha384 or sha512 */
     virtual std::string clientCertificateRequestHashType() const = 0;
     /** @brief Key type for certificate request generation : ec or rsa */
@@ -133,6 +155,9 @@ class IChargePointConfig
      *         if ec has been selected for key type : prime256v1, secp256k1, secp384r1, secp521r1,
      *         brainpoolP256t1, brainpoolP384t1 or brainpoolP512t1 */
     virtual std::string clientCertificateRequestEcCurve() const = 0;
+    /** @brief Number of private keys generated in advance in background for certificate request generation
+     *         (0 = keys are generated on demand) */
+    virtual unsigned int clientCertificateRequestKeyPoolSize() const = 0;
     /** @brief Country for the subject field of certificate request generation (can be left empty) */
     virtual std::string clientCertificateRequestSubjectCountry() const = 0;
     /** @brief State for the subject field of certificate request generation (can be left empty) */
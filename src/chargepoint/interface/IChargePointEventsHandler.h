@@ -24,7 +24,9 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "DateTime.h"
 #include "Enums.h"
 #include "MeterValue.h"
+#include "SmartChargingSetpoint.h"
 
+#include <functional>
 #include <tuple>
 
 namespace ocpp
@@ -147,6 +149,25 @@ class IChargePointEventsHandler
      */
     virtual bool getLocalLimitationsSchedule(unsigned int connector_id, unsigned int duration, ocpp::types::ChargingSchedule& schedule) = 0;
 
+    /**
+     * @brief Called when the smart charging setpoints of a connector have changed
+     *        (start of a new schedule period, charging profiles installed or cleared, transaction started or stopped)
+     * @param connector_id Id of the concerned connector
+     * @param charge_point_setpoint New setpoint of the whole charge point in A (not set if no active profile)
+     * @param connector_setpoint New setpoint of the connector in A (not set if no active profile)
+     */
+    virtual void setpointChanged(unsigned int                                                     connector_id,
+                                 const ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& charge_point_setpoint,
+                                 const ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& connector_setpoint) = 0;
+
+    /**
+     * @brief Called to get the current consumption of a connector for the local load balancing
+     * @param connector_id Id of the concerned connector
+     * @param current Measured current in A
+     * @return true if the consumption has been measured, false otherwise
+     */
+    virtual bool getConnectorConsumption(unsigned int connector_id, float& current) = 0;
+
     /**
      * @brief Called on a reset request from the Central System
      * @param reset_type Type of reset
@@ -203,6 +224,38 @@ class IChargePointEventsHandler
      */
     virtual bool downloadFile(const std::string& url, const std::string& file) = 0;
 
+    /**
+     * @brief Called to download a firmware from the a given URL, the received data must be given in order
+     *        to the stack which saves them into the file and computes the firmware's digest during the download.
+     *        An overriding implementation must not write the file by itself and must restart the download from
+     *        its beginning on each call (no resume) so that the digest covers exactly the installed firmware.
+     *        (the default implementation calls downloadFile() and the digest is then computed from the saved file,
+     *        the download is then neither throttled with the TransferMaxBandwidth setting nor reported with downloadProgress())
+     * @param url URL from where to download the file
+     * @param file Path where the file is saved (only written by the default implementation through downloadFile())
+     * @param data_received Function to call with each block of received data
+     * @return true if the file has been downloaded, false otherwise
+     */
+    virtual bool downloadFileStreamed(const std::string&                       url,
+                                      const std::string&                       file,
+                                      std::function<void(const void*, size_t)> data_received)
+    {
+        (void)data_received;
+        return downloadFile(url, file);
+    }
+
+    /**
+     * @brief Called periodically during a streamed download to report its progress
+     *        (the default implementation does nothing)
+     * @param file Path where the downloaded file is saved
+     * @param received Number of bytes received since the start of the download
+     */
+    virtual void downloadProgress(const std::string& file, size_t received)
+    {
+        (void)file;
+        (void)received;
+    }
+
     // Security extensions
 
     /**
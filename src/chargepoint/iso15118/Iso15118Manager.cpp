@@ -65,7 +65,8 @@ Iso15118Manager::Iso15118Manager(ocpp::config::IOcppConfig&
       m_security_manager(security_manager),
       m_last_csr(),
       m_csr_sign_retries(0),
-      m_csr_timer(timer_pool, "ISO15118 CSR timer")
+      m_csr_timer(timer_pool, "ISO15118 CSR timer"),
+      m_ocsp_cache()
 {
     datatransfer_manager.registerHandler(ISO15118_VENDOR_ID, *this);
 }
@@ -175,17 +176,32 @@ ocpp::types::GetCertificateStatusEnumType Iso15118Manager::getCertificateStatus(
 
     GetCertificateStatusEnumType result = GetCertificateStatusEnumType::Failed;
 
-    // Prepare request
-    GetCertificateStatusReq request;
-    request.ocspRequestData = ocsp_request;
-
-    // Send request
-    GetCertificateStatusConf response;
-    if (send("GetCertificateStatus", GET_CERTIFICATE_STATUS_ACTION, request, response))
+    // Look for a response which is still valid
+    if (m_ocsp_cache.get(ocsp_request, ocsp_result))
     {
-        // Extract response
-        ocsp_result = response.ocspResult.value();
-        result      = response.status;
+        LOG_INFO << "[ISO15118] Get certificate status : response found in cache";
+        result = GetCertificateStatusEnumType::Accepted;
+    }
+    else
+    {
+        // Prepare request
+        GetCertificateStatusReq request;
+        request.ocspRequestData = ocsp_request;
+
+        // Send request
+        GetCertificateStatusConf response;
+        if (send("GetCertificateStatus", GET_CERTIFICATE_STATUS_ACTION, request, response))
+        {
+            // Extract response
+            ocsp_result = response.ocspResult.value();
+            result      = response.status;
+
+            // Keep the response until its next update
+            if (result == GetCertificateStatusEnumType::Accepted)
+            {
+                m_ocsp_cache.add(ocsp_request, ocsp_result);
+            }
+        }
     }
 
     LOG_INFO << "[ISO15118] Get certificate status : " << GetCertificateStatusEnumTypeHelper.toString(result);
@@ -28,6 +28,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "IdTokenInfoType.h"
 #include "Iso15118.h"
 #include "Logger.h"
+#include "OcspCache.h"
 #include "OcspRequestDataType.h"
 #include "Timer.h"
 #include "json.h"
@@ -160,6 +161,8 @@ class Iso15118Manager : public IDataTransferManager::IDataTransferHandler
     unsigned int m_csr_sign_retries;
     /** @brief Timer for sign certificate operations */
     ocpp::helpers::Timer m_csr_timer;
+    /** @brief Cache of the OCSP responses */
+    OcspCache m_ocsp_cache;
 
     /**
      * @brief Generic ISO15118 request sender
@@ -0,0 +1,155 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "OcspCache.h"
+#include "Ocsp.h"
+#include "StringHelpers.h"
+
+using namespace ocpp::types;
+
+namespace ocpp
+{
+namespace chargepoint
+{
+
+/** @brief Constructor */
+OcspCache::OcspCache(size_t max_entries) : m_mutex(), m_max_entries(max_entries), m_entries() { }
+
+/** @brief Destructor */
+OcspCache::~OcspCache() { }
+
+/** @brief Look for a valid response in the cache */
+bool OcspCache::get(const ocpp::types::OcspRequestDataType& ocsp_request, std::string& ocsp_result)
+{
+    bool ret = false;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto                        it = m_entries.find(key(ocsp_request));
+    if (it != m_entries.end())
+    {
+        if (std::chrono::steady_clock::now() < it->second.expiry)
+        {
+            ocsp_result = it->second.ocsp_result;
+            ret         = true;
+        }
+        else
+        {
+            // Outdated response
+            m_entries.erase(it);
+        }
+    }
+
+    return ret;
+}
+
+/** @brief Add a response to the cache, its validity is extracted from its nextUpdate field */
+bool OcspCache::add(const ocpp::types::OcspRequestDataType& ocsp_request, const std::string& ocsp_result)
+{
+    return add(ocsp_request, ocsp_result, ocpp::x509::ocsp::remainingValidity(ocsp_result));
+}
+
+/** @brief Add a response to the cache with an explicit validity */
+bool OcspCache::add(const ocpp::types::OcspRequestDataType& ocsp_request,
+                    const std::string&                      ocsp_result,
+                    std::chrono::milliseconds               validity)
+{
+    bool ret = false;
+
+    if ((m_max_entries != 0) && (validity.count() > 0))
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        auto        now       = std::chrono::steady_clock::now();
+        std::string entry_key = key(ocsp_request);
+        if (m_entries.find(entry_key) == m_entries.end())
+        {
+            makeRoom(now);
+        }
+        Entry& entry      = m_entries[entry_key];
+        entry.ocsp_result = ocsp_result;
+        entry.expiry      = now + validity;
+        ret               = true;
+    }
+
+    return ret;
+}
+
+/** @brief Remove all the responses from the cache */
+void OcspCache::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+}
+
+/** @brief Get the number of responses in the cache */
+size_t OcspCache::size() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+/** @brief Compute the cache key of a request */
+std::string OcspCache::key(const ocpp::types::OcspRequestDataType& ocsp_request)
+{
+    std::string ret = HashAlgorithmEnumTypeHelper.toString(ocsp_request.hashAlgorithm);
+    ret.reserve(ret.size() + ocsp_request.issuerNameHash.size() + ocsp_request.issuerKeyHash.size() + ocsp_request.serialNumber.size() +
+                ocsp_request.responderURL.size() + 4u);
+    ret += '|';
+    ret += ocpp::helpers::tolower(ocsp_request.issuerNameHash.str());
+    ret += '|';
+    ret += ocpp::helpers::tolower(ocsp_request.issuerKeyHash.str());
+    ret += '|';
+    ret += ocpp::helpers::tolower(ocsp_request.serialNumber.str());
+    ret += '|';
+    ret += ocpp::helpers::tolower(ocsp_request.responderURL.str());
+    return ret;
+}
+
+/** @brief Remove the expired responses and the oldest ones to make room for a new response */
+void OcspCache::makeRoom(std::chrono::steady_clock::time_point now)
+{
+    // Remove expired responses
+    for (auto it = m_entries.begin(); it != m_entries.end();)
+    {
+        if (it->second.expiry <= now)
+        {
+            it = m_entries.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    // Remove the responses which expire first
+    while (m_entries.size() >= m_max_entries)
+    {
+        auto first = m_entries.begin();
+        for (auto it = m_entries.begin(); it != m_entries.end(); ++it)
+        {
+            if (it->second.expiry < first->second.expiry)
+            {
+                first = it;
+            }
+        }
+        m_entries.erase(first);
+    }
+}
+
+} // namespace chargepoint
+} // namespace ocpp
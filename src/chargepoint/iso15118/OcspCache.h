@@ -0,0 +1,116 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPENOCPP_OCSPCACHE_H
+#define OPENOCPP_OCSPCACHE_H
+
+#include "OcspRequestDataType.h"
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace ocpp
+{
+namespace chargepoint
+{
+
+/** @brief Cache of the OCSP responses retrieved from the Central System, valid until their nextUpdate date */
+class OcspCache
+{
+  public:
+    /**
+     * @brief Constructor
+     * @param max_entries Maximum number of responses in the cache
+     */
+    OcspCache(size_t max_entries = 64u);
+    /** @brief Destructor */
+    virtual ~OcspCache();
+
+    /**
+     * @brief Look for a valid response in the cache
+     * @param ocsp_request Certificate of which the status is requested
+     * @param ocsp_result Cached OCSP response, base64 encoded
+     * @return true if a valid response has been found, false otherwise
+     */
+    bool get(const ocpp::types::OcspRequestDataType& ocsp_request, std::string& ocsp_result);
+
+    /**
+     * @brief Add a response to the cache, its validity is extracted from its nextUpdate field
+     *        (responses without nextUpdate field are not cached)
+     * @param ocsp_request Certificate of which the status has been requested
+     * @param ocsp_result OCSP response, base64 encoded
+     * @return true if the response has been cached, false otherwise
+     */
+    bool add(const ocpp::types::OcspRequestDataType& ocsp_request, const std::string& ocsp_result);
+
+    /**
+     * @brief Add a response to the cache with an explicit validity
+     * @param ocsp_request Certificate of which the status has been requested
+     * @param ocsp_result OCSP response, base64 encoded
+     * @param validity Validity of the response
+     * @return true if the response has been cached, false otherwise
+     */
+    bool add(const ocpp::types::OcspRequestDataType& ocsp_request, const std::string& ocsp_result, std::chrono::milliseconds validity);
+
+    /** @brief Remove all the responses from the cache */
+    void clear();
+
+    /**
+     * @brief Get the number of responses in the cache
+     * @return Number of responses in the cache
+     */
+    size_t size() const;
+
+  private:
+    /** @brief Cached response */
+    struct Entry
+    {
+        /** @brief OCSP response, base64 encoded */
+        std::string ocsp_result;
+        /** @brief Expiry date */
+        std::chrono::steady_clock::time_point expiry;
+    };
+
+    /** @brief Mutex to protect the cache */
+    mutable std::mutex m_mutex;
+    /** @brief Maximum number of responses in the cache */
+    const size_t m_max_entries;
+    /** @brief Cached responses */
+    std::unordered_map<std::string, Entry> m_entries;
+
+    /**
+     * @brief Compute the cache key of a request (all the fields are case insensitive)
+     * @param ocsp_request OCSP request
+     * @return Cache key
+     */
+    static std::string key(const ocpp::types::OcspRequestDataType& ocsp_request);
+
+    /**
+     * @brief Remove the expired responses and the oldest ones to make room for a new response
+     *        (must be called with the mutex locked)
+     * @param now Current date
+     */
+    void makeRoom(std::chrono::steady_clock::time_point now);
+};
+
+} // namespace chargepoint
+} // namespace ocpp
+
+#endif // OPENOCPP_OCSPCACHE_H
@@ -21,6 +21,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "Certificate.h"
 #include "Connectors.h"
 #include "DiagnosticsStatusNotification.h"
+#include "ExportFile.h"
 #include "FirmwareStatusNotification.h"
 #include "GenericMessageSender.h"
 #include "IChargePointConfig.h"
@@ -35,8 +36,10 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "WorkerThreadPool.h"
 
 #include <filesystem>
+#include <fstream>
 
 using namespace ocpp::types;
+using namespace ocpp::helpers;
 using namespace ocpp::messages;
 using namespace ocpp::x509;
 
@@ -49,6 +52,7 @@ namespace chargepoint
 MaintenanceManager::MaintenanceManager(const ocpp::config::IChargePointConfig&         stack_config,
                                        ocpp::config::IInternalConfigManager&           internal_config,
                                        IChargePointEventsHandler&                      events_handler,
+                                       ocpp::helpers::ITimerPool&                      timer_pool,
                                        ocpp::helpers::WorkerThreadPool&                worker_pool,
                                        const ocpp::messages::GenericMessagesConverter& messages_converter,
                                        ocpp::messages::IMessageDispatcher&             msg_dispatcher,
@@ -69,14 +73,18 @@ MaintenanceManager::MaintenanceManager(const ocpp::config::IChargePointConfig&
       m_msg_sender(msg_sender),
       m_connectors(connectors),
       m_security_manager(security_manager),
-      m_diagnostics_thread(nullptr),
       m_diagnostics_status(DiagnosticsStatus::Idle),
       m_logs_status(UploadLogStatusEnumType::Idle),
       m_logs_request_id(),
-      m_firmware_thread(nullptr),
       m_firmware_status(FirmwareStatus::Idle),
       m_signed_firmware_status(FirmwareStatusEnumType::Idle),
-      m_firmware_request_id()
+      m_firmware_request_id(),
+      m_diagnostics_trigger_timer(timer_pool, "Diagnostics trigger"),
+      m_firmware_trigger_timer(timer_pool, "Firmware trigger"),
+      m_logs_trigger_timer(timer_pool, "Logs trigger"),
+      m_signed_firmware_trigger_timer(timer_pool, "Signed firmware trigger"),
+      m_upload_scheduler(timer_pool, "Upload scheduler", 0u),
+      m_firmware_scheduler(timer_pool, "Firmware scheduler", stack_config.transferMaxBandwidth())
 {
     msg_dispatcher.registerHandler(RESET_ACTION, *dynamic_cast<GenericMessageHandler<ResetReq, ResetConf>*>(this));
     msg_dispatcher.registerHandler(UNLOCK_CONNECTOR_ACTION,
@@ -93,6 +101,15 @@ MaintenanceManager::MaintenanceManager(const ocpp::config::IChargePointConfig&
     trigger_manager.registerHandler(MessageTriggerEnumType::LogStatusNotification, *this);
     trigger_manager.registerHandler(MessageTriggerEnumType::FirmwareStatusNotification, *this);
 
+    // The triggered notifications are sent once the trigger message reply has been sent
+    m_diagnostics_trigger_timer.setCallback(
+        [this] { m_worker_pool.run<void>(std::bind(&MaintenanceManager::sendDiagnosticStatusNotification, this)); });
+    m_firmware_trigger_timer.setCallback(
+        [this] { m_worker_pool.run<void>(std::bind(&MaintenanceManager::sendFirmwareStatusNotification, this)); });
+    m_logs_trigger_timer.setCallback([this] { m_worker_pool.run<void>(std::bind(&MaintenanceManager::sendLogStatusNotification, this)); });
+    m_signed_firmware_trigger_timer.setCallback(
+        [this] { m_worker_pool.run<void>(std::bind(&MaintenanceManager::sendSignedFirmwareStatusNotification, this)); });
+
     // Get current signed firmware update request id
     if (!m_internal_config.keyExist(SIGNED_FW_UPDATE_ID_KEY))
     {
@@ -118,7 +135,13 @@ MaintenanceManager::MaintenanceManager(const ocpp::config::IChargePointConfig&
 }
 
 /** @brief Destructor */
-MaintenanceManager::~MaintenanceManager() { }
+MaintenanceManager::~MaintenanceManager()
+{
+    m_diagnostics_trigger_timer.stop();
+    m_firmware_trigger_timer.stop();
+    m_logs_trigger_timer.stop();
+    m_signed_firmware_trigger_timer.stop();
+}
 
 /**
      * @brief Notify the end of a firmware update operation
@@ -171,25 +194,15 @@ bool MaintenanceManager::onTriggerMessage(ocpp::types::MessageTrigger message, c
     {
         case MessageTrigger::DiagnosticsStatusNotification:
         {
-            m_worker_pool.run<void>(
-                [this]
-                {
-                    // To let some time for the trigger message reply
-                    std::this_thread::sleep_for(std::chrono::milliseconds(250u));
-                    sendDiagnosticStatusNotification();
-                });
+            // To let some time for the trigger message reply
+            m_diagnostics_trigger_timer.restart(std::chrono::milliseconds(250u), true);
         }
         break;
 
         case MessageTrigger::FirmwareStatusNotification:
         {
-            m_worker_pool.run<void>(
-                [this]
-                {
-                    // To let some time for the trigger message reply
-                    std::this_thread::sleep_for(std::chrono::milliseconds(250u));
-                    sendFirmwareStatusNotification();
-                });
+            // To let some time for the trigger message reply
+            m_firmware_trigger_timer.restart(std::chrono::milliseconds(250u), true);
         }
         break;
 
@@ -213,25 +226,15 @@ bool MaintenanceManager::onTriggerMessage(ocpp::types::MessageTriggerEnumType
     {
         case MessageTriggerEnumType::LogStatusNotification:
         {
-            m_worker_pool.run<void>(
-                [this]
-                {
-                    // To let some time for the trigger message reply
-                    std::this_thread::sleep_for(std::chrono::milliseconds(250u));
-                    sendLogStatusNotification();
-                });
+            // To let some time for the trigger message reply
+            m_logs_trigger_timer.restart(std::chrono::milliseconds(250u), true);
         }
         break;
 
         case MessageTriggerEnumType::FirmwareStatusNotification:
         {
-            m_worker_pool.run<void>(
-                [this]
-                {
-                    // To let some time for the trigger message reply
-                    std::this_thread::sleep_for(std::chrono::milliseconds(250u));
-                    sendSignedFirmwareStatusNotification();
-                });
+            // To let some time for the trigger message reply
+            m_signed_firmware_trigger_timer.restart(std::chrono::milliseconds(250u), true);
         }
         break;
 
@@ -321,7 +324,7 @@ bool MaintenanceManager::handleMessage(const ocpp::messages::GetDiagnosticsReq&
     (void)error_message;
 
     // Check if a request is already in progress
-    if (!m_diagnostics_thread)
+    if (m_upload_scheduler.acquire())
     {
         // Notify request
         std::string local_diagnostic_file = m_events_handler.getDiagnostics(request.startTime, request.stopTime);
@@ -331,18 +334,18 @@ bool MaintenanceManager::handleMessage(const ocpp::messages::GetDiagnosticsReq&
             std::filesystem::path diag_file(local_diagnostic_file);
             response.fileName.assign(diag_file.filename().string());
 
-            // Create a separate thread since the operation can be time consuming
-            m_diagnostics_thread = new std::thread(std::bind(&MaintenanceManager::processGetDiagnostics,
-                                                             this,
-                                                             request.location,
-                                                             request.retries,
-                                                             request.retryInterval,
-                                                             local_diagnostic_file));
-            m_diagnostics_thread->detach();
+            // Upload from the scheduler since the operation can be time consuming
+            m_upload_scheduler.run(std::bind(&MaintenanceManager::processGetDiagnostics,
+                                             this,
+                                             request.location,
+                                             request.retries,
+                                             request.retryInterval,
+                                             local_diagnostic_file));
         }
         else
         {
             LOG_WARNING << "GetDiagnostics : No diagnostics available";
+            m_upload_scheduler.release();
         }
     }
     else
@@ -370,16 +373,14 @@ bool MaintenanceManager::handleMessage(const ocpp::messages::UpdateFirmwareReq&
     LOG_INFO << "Firmare update requested : location = " << request.location << " - retrieveDate = " << request.retrieveDate.str();
 
     // Check if a request is already in progress
-    if (!m_firmware_thread)
+    if (m_firmware_scheduler.acquire())
     {
-        // Create a separate thread since the operation can be time consuming
-        m_firmware_thread = new std::thread(std::bind(&MaintenanceManager::processUpdateFirmware,
-                                                      this,
-                                                      request.location,
-                                                      request.retries,
-                                                      request.retryInterval,
-                                                      request.retrieveDate));
-        m_firmware_thread->detach();
+        // Wait for the retrieve date without blocking any thread
+        LOG_INFO << "UpdateFirmware : Waiting until retrieve date (" << request.retrieveDate.timestamp() << ") from now ("
+                 << DateTime::now() << ")";
+        m_firmware_scheduler.runAt(
+            request.retrieveDate,
+            std::bind(&MaintenanceManager::downloadFirmware, this, request.location, request.retries, request.retryInterval));
     }
     else
     {
@@ -408,49 +409,65 @@ bool MaintenanceManager::handleMessage(const ocpp::messages::GetLogReq& request,
     response.status = LogStatusEnumType::Rejected;
 
     // Check if a request is already in progress
-    if (!m_diagnostics_thread)
+    if (m_upload_scheduler.acquire())
     {
         // Notify request
         std::string local_log_file = m_events_handler.getLog(request.logType, request.log.oldestTimestamp, request.log.latestTimestamp);
         if (!local_log_file.empty())
         {
+            // The security log export is generated by the stack
             std::filesystem::path log_file(local_log_file);
-
-            // Generate the log file
+            bool                  export_security_logs = false;
             if ((request.logType == LogEnumType::SecurityLog) && (m_stack_config.securityLogMaxEntriesCount() > 0))
             {
-                log_file /= "security_logs.csv";
-                LOG_INFO << "Generate security logs export : " << log_file;
-                if (m_security_manager.exportSecurityEvents(log_file.string(), request.log.oldestTimestamp, request.log.latestTimestamp))
-                {
-                    local_log_file = log_file.string();
-                }
-                else
-                {
-                    local_log_file = "";
-                }
+                auto compression = ExportFile::compression(m_stack_config.securityLogExportCompression());
+                log_file /= std::string("security_logs.csv") + ExportFile::extension(compression);
+                local_log_file       = log_file.string();
+                export_security_logs = true;
             }
-            if (!local_log_file.empty())
-            {
-                // Extract filename for the response
-                response.fileName.assign(log_file.filename().string());
-                response.status = LogStatusEnumType::Accepted;
 
-                // Create a separate thread since the operation can be time consuming
-                m_logs_request_id    = request.requestId;
-                m_diagnostics_thread = new std::thread(std::bind(&MaintenanceManager::processGetLog,
-                                                                 this,
-                                                                 request.logType,
-                                                                 request.log.remoteLocation,
-                                                                 request.retries,
-                                                                 request.retryInterval,
-                                                                 local_log_file));
-                m_diagnostics_thread->detach();
-            }
+            // Extract filename for the response
+            response.fileName.assign(log_file.filename().string());
+            response.status = LogStatusEnumType::Accepted;
+
+            // Generate and upload from the scheduler since the operation can be time consuming
+            m_logs_request_id = request.requestId;
+            m_upload_scheduler.run(
+                [this,
+                 export_security_logs,
+                 local_log_file,
+                 type             = request.logType,
+                 location         = request.log.remoteLocation.str(),
+                 retries          = request.retries,
+                 retry_interval   = request.retryInterval,
+                 oldest_timestamp = request.log.oldestTimestamp,
+                 latest_timestamp = request.log.latestTimestamp]
+                {
+                    bool success = true;
+                    if (export_security_logs)
+                    {
+                        LOG_INFO << "Generate security logs export : " << local_log_file;
+                        success = m_security_manager.exportSecurityEvents(local_log_file, oldest_timestamp, latest_timestamp);
+                    }
+                    if (success)
+                    {
+                        processGetLog(type, location, retries, retry_interval, local_log_file);
+                    }
+                    else
+                    {
+                        LOG_ERROR << "GetLog : unable to generate the security logs export";
+                        m_logs_status = UploadLogStatusEnumType::UploadFailure;
+                        sendLogStatusNotification();
+                        m_logs_status = UploadLogStatusEnumType::Idle;
+                        m_logs_request_id.clear();
+                        m_upload_scheduler.release();
+                    }
+                });
         }
         else
         {
             LOG_WARNING << "GetLog : No logs available";
+            m_upload_scheduler.release();
         }
     }
     else
@@ -481,7 +498,7 @@ bool MaintenanceManager::handleMessage(const ocpp::messages::SignedUpdateFirmwar
     response.status = UpdateFirmwareStatusEnumType::Rejected;
 
     // Check if a request is already in progress
-    if (!m_firmware_thread)
+    if (m_firmware_scheduler.acquire())
     {
         // Check signing certificate
         std::time_t now = DateTime::now().timestamp();
@@ -518,16 +535,27 @@ bool MaintenanceManager::handleMessage(const ocpp::messages::SignedUpdateFirmwar
                 // Create a separate thread since the operation can be time consuming
                 m_firmware_request_id = request.requestId;
                 m_internal_config.setKey(SIGNED_FW_UPDATE_ID_KEY, std::to_string(request.requestId));
-                m_firmware_thread = new std::thread(std::bind(&MaintenanceManager::processSignedUpdateFirmware,
-                                                              this,
-                                                              request.firmware.location,
-                                                              request.retries,
-                                                              request.retryInterval,
-                                                              request.firmware.retrieveDateTime,
-                                                              request.firmware.installDateTime,
-                                                              signing_certificate,
-                                                              request.firmware.signature));
-                m_firmware_thread->detach();
+
+                // Wait for the retrieve date without blocking any thread
+                auto download = std::bind(&MaintenanceManager::downloadSignedFirmware,
+                                          this,
+                                          request.firmware.location.str(),
+                                          request.retries,
+                                          request.retryInterval,
+                                          request.firmware.installDateTime,
+                                          signing_certificate,
+                                          request.firmware.signature.str());
+                if (request.firmware.retrieveDateTime > DateTime::now())
+                {
+                    m_firmware_scheduler.run(
+                        [this]
+                        {
+                            LOG_INFO << "SignedUpdateFirmware : Waiting until retrieve date";
+                            m_signed_firmware_status = FirmwareStatusEnumType::DownloadScheduled;
+                            sendSignedFirmwareStatusNotification();
+                        });
+                }
+                m_firmware_scheduler.runAt(request.firmware.retrieveDateTime, download);
             }
         }
         if (response.status == UpdateFirmwareStatusEnumType::InvalidCertificate)
@@ -535,6 +563,10 @@ bool MaintenanceManager::handleMessage(const ocpp::messages::SignedUpdateFirmwar
             // Send a security event
             m_security_manager.logSecurityEvent(SECEVT_INVALID_FIRMWARE_SIGNING_CERT, "");
         }
+        if (response.status != UpdateFirmwareStatusEnumType::Accepted)
+        {
+            m_firmware_scheduler.release();
+        }
     }
     else
     {
@@ -544,23 +576,118 @@ bool MaintenanceManager::handleMessage(const ocpp::messages::SignedUpdateFirmwar
     return true;
 }
 
-/** @brief Process the upload of the diagnostics */
-void MaintenanceManager::processGetDiagnostics(std::string                         location,
-                                               ocpp::types::Optional<unsigned int> retries,
-                                               ocpp::types::Optional<unsigned int> retry_interval,
-                                               std::string                         local_diagnostic_file)
+/** @brief Get the retries configuration of a transfer */
+static void getRetries(const ocpp::types::Optional<unsigned int>& retries,
+                       const ocpp::types::Optional<unsigned int>& retry_interval,
+                       unsigned int&                              nb_retries,
+                       std::chrono::seconds&                      retry_interval_s)
 {
-    // Configure retries
-    unsigned int nb_retries = 1u;
+    nb_retries = 1u;
     if (retries.isSet())
     {
         nb_retries = retries;
     }
-    std::chrono::seconds retry_interval_s(1u);
+    retry_interval_s = std::chrono::seconds(1u);
     if (retry_interval.isSet())
     {
         retry_interval_s = std::chrono::seconds(retry_interval.value());
     }
+}
+
+/** @brief Firmware file written by the stack with the data received during a streamed download */
+class StreamedFirmware
+{
+  public:
+    /** @brief Constructor */
+    StreamedFirmware(const std::string& path) : m_path(path), m_file(), m_sha(Sha2::Type::SHA256), m_size(0), m_error(false) { }
+
+    /** @brief Path to the firmware file */
+    const std::string& path() const { return m_path; }
+
+    /** @brief Prepare a new download attempt */
+    void reset()
+    {
+        if (m_file.is_open())
+        {
+            m_file.close();
+        }
+        m_sha.init();
+        m_size  = 0;
+        m_error = false;
+    }
+
+    /** @brief Save a block of received data and include it in the digest */
+    void write(const void* data, size_t size)
+    {
+        // The file is truncated on the first block so that a download never resumes from a previous attempt
+        if (!m_file.is_open() && !m_error)
+        {
+            m_file.open(m_path, std::fstream::out | std::fstream::binary | std::fstream::trunc);
+            m_error = !m_file.is_open();
+        }
+        if (!m_error)
+        {
+            m_file.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(size));
+            m_error = !m_file.good();
+            m_sha.update(data, size);
+            m_size += size;
+        }
+    }
+
+    /** @brief End of the download attempt, return false if the received data could not be saved */
+    bool close()
+    {
+        if (m_file.is_open())
+        {
+            m_file.close();
+            m_error = m_error || m_file.fail();
+        }
+        return !m_error;
+    }
+
+    /**
+     * @brief Indicate if the digest covers exactly the content of the file : the whole file has been
+     *        written by the stack (the default implementation of downloadFileStreamed() writes the file
+     *        by itself without streaming the data)
+     */
+    bool isDigestValid() const
+    {
+        bool            ret = false;
+        std::error_code err;
+        auto            file_size = std::filesystem::file_size(m_path, err);
+        if (!err)
+        {
+            ret = !m_error && (m_size != 0) && (m_size == file_size);
+        }
+        return ret;
+    }
+
+    /** @brief Digest of the received data */
+    std::vector<uint8_t> digest() { return m_sha.finalize(); }
+
+  private:
+    /** @brief Path to the firmware file */
+    const std::string m_path;
+    /** @brief Firmware file */
+    std::fstream m_file;
+    /** @brief Digest of the received data */
+    Sha2 m_sha;
+    /** @brief Number of bytes written to the file */
+    size_t m_size;
+    /** @brief Indicate if an error occured while saving the data */
+    bool m_error;
+};
+
+/** @brief Process the upload of the diagnostics */
+void MaintenanceManager::processGetDiagnostics(std::string                         location,
+                                               ocpp::types::Optional<unsigned int> retries,
+                                               ocpp::types::Optional<unsigned int> retry_interval,
+                                               std::string                         local_diagnostic_file)
+{
+    // Configure retries
+    unsigned int         nb_retries;
+    std::chrono::seconds retry_interval_s;
+    getRetries(retries, retry_interval, nb_retries, retry_interval_s);
 
     // Compute URL
     std::string url = location;
@@ -578,51 +705,33 @@ void MaintenanceManager::processGetDiagnostics(std::string
     m_diagnostics_status = DiagnosticsStatus::Uploading;
     sendDiagnosticStatusNotification();
 
-    // Upload loop
-    bool success = true;
-    do
-    {
-        success = m_events_handler.uploadFile(local_diagnostic_file, url);
-        if (!success)
+    // Upload, the retries are scheduled by the transfer scheduler
+    m_upload_scheduler.transfer(
+        "GetDiagnostics : upload",
+        nb_retries,
+        retry_interval_s,
+        [this, local_diagnostic_file, url](TransferProgress&) { return m_events_handler.uploadFile(local_diagnostic_file, url); },
+        [this](bool success)
         {
-            // Next retry
-            if (nb_retries > 0)
+            // Notify end of operation
+            if (success)
             {
-                nb_retries--;
-                if (nb_retries != 0)
-                {
-                    LOG_WARNING << "GetDiagnostics : upload failed (" << nb_retries << " retrie(s) left - next retry in "
-                                << retry_interval_s.count() << "s)";
-                    std::this_thread::sleep_for(retry_interval_s);
-                }
-                else
-                {
-                    LOG_WARNING << "GetDiagnostics : upload failed no retries left";
-                }
+                m_diagnostics_status = DiagnosticsStatus::Uploaded;
+                LOG_INFO << "GetDiagnostics : success";
             }
-        }
-
-    } while (!success && (nb_retries != 0));
-
-    // Notify end of operation
-    if (success)
-    {
-        m_diagnostics_status = DiagnosticsStatus::Uploaded;
-        LOG_INFO << "GetDiagnostics : success";
-    }
-    else
-    {
-        m_diagnostics_status = DiagnosticsStatus::UploadFailed;
-        LOG_ERROR << "GetDiagnostics : failed";
-    }
-    sendDiagnosticStatusNotification();
+            else
+            {
+                m_diagnostics_status = DiagnosticsStatus::UploadFailed;
+                LOG_ERROR << "GetDiagnostics : failed";
+            }
+            sendDiagnosticStatusNotification();
 
-    // Reset status
-    m_diagnostics_status = DiagnosticsStatus::Idle;
+            // Reset status
+            m_diagnostics_status = DiagnosticsStatus::Idle;
 
-    // Release thread to allow new diagnostics requests
-    delete m_diagnostics_thread;
-    m_diagnostics_thread = nullptr;
+            // Allow new diagnostics requests
+            m_upload_scheduler.release();
+        });
 }
 
 /** @brief Send a diagnostic status notification */
@@ -636,93 +745,74 @@ void MaintenanceManager::sendDiagnosticStatusNotification()
     m_msg_sender.call(DIAGNOSTIC_STATUS_NOTIFICATION_ACTION, status_req, status_conf);
 }
 
-/** @brief Process the firmware update */
-void MaintenanceManager::processUpdateFirmware(std::string                         location,
-                                               ocpp::types::Optional<unsigned int> retries,
-                                               ocpp::types::Optional<unsigned int> retry_interval,
-                                               ocpp::types::DateTime               retrieve_date)
+/** @brief Download the firmware */
+void MaintenanceManager::downloadFirmware(std::string                         location,
+                                          ocpp::types::Optional<unsigned int> retries,
+                                          ocpp::types::Optional<unsigned int> retry_interval)
 {
-
-    LOG_INFO << "UpdateFirmware : Waiting until retrieve date (" << retrieve_date.timestamp() << ") from now (" << DateTime::now() << ")";
-
-    // Check retrieve date
-    if (retrieve_date > DateTime::now())
-    {
-        std::this_thread::sleep_until(std::chrono::system_clock::from_time_t(retrieve_date.timestamp()));
-    }
-
     // Notify start of download
     std::string local_firmware_file = m_events_handler.updateFirmwareRequested();
     m_firmware_status               = FirmwareStatus::Downloading;
     sendFirmwareStatusNotification();
 
     // Configure retries
-    unsigned int nb_retries = 1u;
-    if (retries.isSet())
-    {
-        nb_retries = retries;
-    }
-    std::chrono::seconds retry_interval_s(1u);
-    if (retry_interval.isSet())
-    {
-        retry_interval_s = std::chrono::seconds(retry_interval.value());
-    }
-
-    // Download loop
-    bool success = true;
-    do
-    {
-        success = m_events_handler.downloadFile(location, local_firmware_file);
-        if (!success)
+    unsigned int         nb_retries;
+    std::chrono::seconds retry_interval_s;
+    getRetries(retries, retry_interval, nb_retries, retry_interval_s);
+
+    // The received data are saved by the stack
+    auto firmware = std::make_shared<StreamedFirmware>(local_firmware_file);
+
+    // Download, the retries are scheduled by the transfer scheduler
+    m_firmware_scheduler.transfer(
+        "FirmwareUpdate : download",
+        nb_retries,
+        retry_interval_s,
+        [this, location, firmware](TransferProgress& progress)
+        {
+            firmware->reset();
+            bool ret = m_events_handler.downloadFileStreamed(location,
+                                                             firmware->path(),
+                                                             [&progress, firmware](const void* data, size_t size)
+                                                             {
+                                                                 firmware->write(data, size);
+                                                                 progress.update(size);
+                                                             });
+            bool saved = firmware->close();
+            return (ret && saved);
+        },
+        [this, local_firmware_file](bool success)
         {
-            // Next retry
-            if (nb_retries > 0)
+            // Notify end of operation
+            if (success)
             {
-                nb_retries--;
-                if (nb_retries != 0)
-                {
-                    LOG_WARNING << "FirmwareUpdate : download failed (" << nb_retries << " retrie(s) left - next retry in "
-                                << retry_interval_s.count() << "s)";
-                    std::this_thread::sleep_for(retry_interval_s);
-                }
-                else
-                {
-                    LOG_WARNING << "FirmwareUpdate : download failed no retries left";
-                }
+                m_firmware_status = FirmwareStatus::Downloaded;
+                LOG_INFO << "FirmwareUpdate download : success";
             }
-        }
-
-    } while (!success && (nb_retries != 0));
-
-    // Notify end of operation
-    if (success)
-    {
-        m_firmware_status = FirmwareStatus::Downloaded;
-        LOG_INFO << "FirmwareUpdate download : success";
-    }
-    else
-    {
-        m_firmware_status = FirmwareStatus::DownloadFailed;
-        LOG_ERROR << "FirmwareUpdate download : failed";
-    }
-    sendFirmwareStatusNotification();
+            else
+            {
+                m_firmware_status = FirmwareStatus::DownloadFailed;
+                LOG_ERROR << "FirmwareUpdate download : failed";
+            }
+            sendFirmwareStatusNotification();
 
-    if (success)
-    {
-        // Notify that firmware is ready to be installed
-        m_firmware_status = FirmwareStatus::Installing;
-        sendFirmwareStatusNotification();
-        m_events_handler.installFirmware(local_firmware_file);
-    }
-    else
-    {
-        // Reset status
-        m_firmware_status = FirmwareStatus::Idle;
-    }
+            if (success)
+            {
+                // Notify that firmware is ready to be installed
+                m_firmware_status = FirmwareStatus::Installing;
+                sendFirmwareStatusNotification();
+                m_events_handler.installFirmware(local_firmware_file);
+            }
+            else
+            {
+                // Reset status
+                m_firmware_status = FirmwareStatus::Idle;
+            }
 
-    // Release thread to allow new firmware update requests
-    delete m_firmware_thread;
-    m_firmware_thread = nullptr;
+            // Allow new firmware update requests
+            m_firmware_scheduler.release();
+        },
+        [this, local_firmware_file](size_t received) { m_events_handler.downloadProgress(local_firmware_file, received); });
 }
 
 /** @brief Send a firmware status notification */
@@ -747,16 +837,9 @@ void MaintenanceManager::processGetLog(ocpp::types::LogEnumType            type,
                                        std::string                         local_log_file)
 {
     // Configure retries
-    unsigned int nb_retries = 1u;
-    if (retries.isSet())
-    {
-        nb_retries = retries;
-    }
-    std::chrono::seconds retry_interval_s(1u);
-    if (retry_interval.isSet())
-    {
-        retry_interval_s = std::chrono::seconds(retry_interval.value());
-    }
+    unsigned int         nb_retries;
+    std::chrono::seconds retry_interval_s;
+    getRetries(retries, retry_interval, nb_retries, retry_interval_s);
 
     // Compute URL
     std::string url = location;
@@ -775,52 +858,34 @@ void MaintenanceManager::processGetLog(ocpp::types::LogEnumType            type,
     m_logs_status = UploadLogStatusEnumType::Uploading;
     sendLogStatusNotification();
 
-    // Upload loop
-    bool success = true;
-    do
-    {
-        success = m_events_handler.uploadFile(local_log_file, url);
-        if (!success)
+    // Upload, the retries are scheduled by the transfer scheduler
+    m_upload_scheduler.transfer(
+        "GetLog : upload",
+        nb_retries,
+        retry_interval_s,
+        [this, local_log_file, url](TransferProgress&) { return m_events_handler.uploadFile(local_log_file, url); },
+        [this](bool success)
         {
-            // Next retry
-            if (nb_retries > 0)
+            // Notify end of operation
+            if (success)
             {
-                nb_retries--;
-                if (nb_retries != 0)
-                {
-                    LOG_WARNING << "GetLog : upload failed (" << nb_retries << " retrie(s) left - next retry in "
-                                << retry_interval_s.count() << "s)";
-                    std::this_thread::sleep_for(retry_interval_s);
-                }
-                else
-                {
-                    LOG_WARNING << "GetLog : upload failed retries left";
-                }
+                m_logs_status = UploadLogStatusEnumType::Uploaded;
+                LOG_INFO << "GetLog : success";
             }
-        }
-
-    } while (!success && (nb_retries != 0));
-
-    // Notify end of operation
-    if (success)
-    {
-        m_logs_status = UploadLogStatusEnumType::Uploaded;
-        LOG_INFO << "GetLog : success";
-    }
-    else
-    {
-        m_logs_status = UploadLogStatusEnumType::UploadFailure;
-        LOG_ERROR << "GetLog : failed";
-    }
-    sendLogStatusNotification();
+            else
+            {
+                m_logs_status = UploadLogStatusEnumType::UploadFailure;
+                LOG_ERROR << "GetLog : failed";
+            }
+            sendLogStatusNotification();
 
-    // Reset status
-    m_logs_status = UploadLogStatusEnumType::Idle;
-    m_logs_request_id.clear();
+            // Reset status
+            m_logs_status = UploadLogStatusEnumType::Idle;
+            m_logs_request_id.clear();
 
-    // Release thread to allow new diagnostics requests
-    delete m_diagnostics_thread;
-    m_diagnostics_thread = nullptr;
+            // Allow new logs requests
+            m_upload_scheduler.release();
+        });
 }
 
 /** @brief Send a log status notification */
@@ -835,127 +900,127 @@ void MaintenanceManager::sendLogStatusNotification()
     m_msg_sender.call(LOG_STATUS_NOTIFICATION_ACTION, status_req, status_conf);
 }
 
-/** @brief Process the signed firmware update */
-void MaintenanceManager::processSignedUpdateFirmware(std::string                                  location,
-                                                     ocpp::types::Optional<unsigned int>          retries,
-                                                     ocpp::types::Optional<unsigned int>          retry_interval,
-                                                     ocpp::types::DateTime                        retrieve_date,
-                                                     ocpp::types::Optional<ocpp::types::DateTime> install_date,
-                                                     ocpp::x509::Certificate                      signing_certificate,
-                                                     std::string                                  signature)
+/** @brief Download the signed firmware */
+void MaintenanceManager::downloadSignedFirmware(std::string                                  location,
+                                                ocpp::types::Optional<unsigned int>          retries,
+                                                ocpp::types::Optional<unsigned int>          retry_interval,
+                                                ocpp::types::Optional<ocpp::types::DateTime> install_date,
+                                                ocpp::x509::Certificate                      signing_certificate,
+                                                std::string                                  signature)
 {
-    // Check retrieve date
-    if (retrieve_date > DateTime::now())
-    {
-        LOG_INFO << "SignedUpdateFirmware : Waiting until retrieve date";
-        m_signed_firmware_status = FirmwareStatusEnumType::DownloadScheduled;
-        sendSignedFirmwareStatusNotification();
-        std::this_thread::sleep_until(std::chrono::system_clock::from_time_t(retrieve_date.timestamp()));
-    }
-
     // Notify start of download
     std::string local_firmware_file = m_events_handler.updateFirmwareRequested();
     m_signed_firmware_status        = FirmwareStatusEnumType::Downloading;
     sendSignedFirmwareStatusNotification();
 
     // Configure retries
-    unsigned int nb_retries = 1u;
-    if (retries.isSet())
-    {
-        nb_retries = retries;
-    }
-    std::chrono::seconds retry_interval_s(1u);
-    if (retry_interval.isSet())
-    {
-        retry_interval_s = std::chrono::seconds(retry_interval.value());
-    }
-
-    // Download loop
-    bool success = true;
-    do
-    {
-        success = m_events_handler.downloadFile(location, local_firmware_file);
-        if (!success)
+    unsigned int         nb_retries;
+    std::chrono::seconds retry_interval_s;
+    getRetries(retries, retry_interval, nb_retries, retry_interval_s);
+
+    // The received data are saved by the stack and the digest is computed while the firmware is received
+    auto firmware = std::make_shared<StreamedFirmware>(local_firmware_file);
+
+    // Download, the retries are scheduled by the transfer scheduler
+    m_firmware_scheduler.transfer(
+        "SignedUpdateFirmware : download",
+        nb_retries,
+        retry_interval_s,
+        [this, location, firmware](TransferProgress& progress)
+        {
+            firmware->reset();
+            bool ret = m_events_handler.downloadFileStreamed(location,
+                                                             firmware->path(),
+                                                             [&progress, firmware](const void* data, size_t size)
+                                                             {
+                                                                 firmware->write(data, size);
+                                                                 progress.update(size);
+                                                             });
+            bool saved = firmware->close();
+            return (ret && saved);
+        },
+        [this, local_firmware_file, install_date, signing_certificate, signature, firmware](bool success) mutable
         {
-            // Next retry
-            if (nb_retries > 0)
+            // Notify end of operation
+            if (success)
             {
-                nb_retries--;
-                if (nb_retries != 0)
+                m_signed_firmware_status = FirmwareStatusEnumType::Downloaded;
+                LOG_INFO << "SignedUpdateFirmware download : success";
+            }
+            else
+            {
+                m_signed_firmware_status = FirmwareStatusEnumType::DownloadFailed;
+                LOG_ERROR << "SignedUpdateFirmware download : failed";
+            }
+            sendSignedFirmwareStatusNotification();
+
+            if (success)
+            {
+                // Verify signature, the file is read again if the digest computed during the download
+                // does not cover exactly its content
+                std::vector<uint8_t> decoded_signature = base64::decode(signature);
+                if (firmware->isDigestValid())
                 {
-                    LOG_WARNING << "SignedUpdateFirmware : download failed (" << nb_retries << " retrie(s) left - next retry in "
-                                << retry_interval_s.count() << "s)";
-                    std::this_thread::sleep_for(retry_interval_s);
+                    success = signing_certificate.verifyDigest(decoded_signature, firmware->digest(), Sha2::Type::SHA256);
                 }
                 else
                 {
-                    LOG_WARNING << "SignedUpdateFirmware : download failed no retries left";
+                    success = signing_certificate.verify(decoded_signature, local_firmware_file, Sha2::Type::SHA256);
                 }
-            }
-        }
-
-    } while (!success && (nb_retries != 0));
-
-    // Notify end of operation
-    if (success)
-    {
-        m_signed_firmware_status = FirmwareStatusEnumType::Downloaded;
-        LOG_INFO << "SignedUpdateFirmware download : success";
-    }
-    else
-    {
-        m_signed_firmware_status = FirmwareStatusEnumType::DownloadFailed;
-        LOG_ERROR << "SignedUpdateFirmware download : failed";
-    }
-    sendSignedFirmwareStatusNotification();
-
-    if (success)
-    {
-        // Verify signature
-        std::vector<uint8_t> decoded_signature = base64::decode(signature);
-        success                                = signing_certificate.verify(decoded_signature, local_firmware_file, Sha2::Type::SHA256);
-
-        // Notify end of operation
-        if (success)
-        {
-            m_signed_firmware_status = FirmwareStatusEnumType::SignatureVerified;
-            LOG_INFO << "SignedUpdateFirmware verify : success";
-        }
-        else
-        {
-            m_signed_firmware_status = FirmwareStatusEnumType::InvalidSignature;
-            LOG_ERROR << "SignedUpdateFirmware verify : failed";
-        }
-        sendSignedFirmwareStatusNotification();
 
-        if (success)
-        {
-            // Check install date
-            if (install_date.isSet() && (install_date.value() > DateTime::now()))
-            {
-                LOG_INFO << "SignedUpdateFirmware : Waiting until install date";
-                m_signed_firmware_status = FirmwareStatusEnumType::InstallScheduled;
+                // Notify end of operation
+                if (success)
+                {
+                    m_signed_firmware_status = FirmwareStatusEnumType::SignatureVerified;
+                    LOG_INFO << "SignedUpdateFirmware verify : success";
+                }
+                else
+                {
+                    m_signed_firmware_status = FirmwareStatusEnumType::InvalidSignature;
+                    LOG_ERROR << "SignedUpdateFirmware verify : failed";
+                }
                 sendSignedFirmwareStatusNotification();
-                std::this_thread::sleep_until(std::chrono::system_clock::from_time_t(install_date.value().timestamp()));
             }
+            if (success)
+            {
+                // Check install date
+                if (install_date.isSet() && (install_date.value() > DateTime::now()))
+                {
+                    LOG_INFO << "SignedUpdateFirmware : Waiting until install date";
+                    m_signed_firmware_status = FirmwareStatusEnumType::InstallScheduled;
+                    sendSignedFirmwareStatusNotification();
+                    m_firmware_scheduler.runAt(install_date.value(),
+                                               std::bind(&MaintenanceManager::installSignedFirmware, this, local_firmware_file));
+                }
+                else
+                {
+                    installSignedFirmware(local_firmware_file);
+                }
+            }
+            else
+            {
+                // Reset status
+                m_signed_firmware_status = FirmwareStatusEnumType::Idle;
+                m_firmware_request_id.clear();
+                m_internal_config.setKey(SIGNED_FW_UPDATE_ID_KEY, "");
 
-            // Notify that firmware is ready to be installed
-            m_signed_firmware_status = FirmwareStatusEnumType::Installing;
-            sendSignedFirmwareStatusNotification();
-            m_events_handler.installFirmware(local_firmware_file);
-        }
-    }
-    if (!success)
-    {
-        // Reset status
-        m_signed_firmware_status = FirmwareStatusEnumType::Idle;
-        m_firmware_request_id.clear();
-        m_internal_config.setKey(SIGNED_FW_UPDATE_ID_KEY, "");
-    }
+                // Allow new firmware update requests
+                m_firmware_scheduler.release();
+            }
+        },
+        [this, local_firmware_file](size_t received) { m_events_handler.downloadProgress(local_firmware_file, received); });
+}
+
+/** @brief Install the signed firmware */
+void MaintenanceManager::installSignedFirmware(std::string local_firmware_file)
+{
+    // Notify that firmware is ready to be installed
+    m_signed_firmware_status = FirmwareStatusEnumType::Installing;
+    sendSignedFirmwareStatusNotification();
+    m_events_handler.installFirmware(local_firmware_file);
 
-    // Release thread to allow new firmware update requests
-    delete m_firmware_thread;
-    m_firmware_thread = nullptr;
+    // Allow new firmware update requests
+    m_firmware_scheduler.release();
 }
 
 /** @brief Send a signed firmware status notification */
@@ -26,11 +26,11 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "ITriggerMessageManager.h"
 #include "Reset.h"
 #include "SignedUpdateFirmware.h"
+#include "Timer.h"
+#include "TransferScheduler.h"
 #include "UnlockConnector.h"
 #include "UpdateFirmware.h"
 
-#include <thread>
-
 namespace ocpp
 {
 // Forward declarations
@@ -79,6 +79,7 @@ class MaintenanceManager
     MaintenanceManager(const ocpp::config::IChargePointConfig&         stack_config,
                        ocpp::config::IInternalConfigManager&           internal_config,
                        IChargePointEventsHandler&                      events_handler,
+                       ocpp::helpers::ITimerPool&                      timer_pool,
                        ocpp::helpers::WorkerThreadPool&                worker_pool,
                        const ocpp::messages::GenericMessagesConverter& messages_converter,
                        ocpp::messages::IMessageDispatcher&             msg_dispatcher,
@@ -193,8 +194,6 @@ class MaintenanceManager
     /** @brief Security manager */
     ISecurityManager& m_security_manager;
 
-    /** @brief Diagnostics thread */
-    std::thread* m_diagnostics_thread;
     /** @brief Diagnostics status */
     ocpp::types::DiagnosticsStatus m_diagnostics_status;
     /** @brief Logs status */
@@ -202,8 +201,6 @@ class MaintenanceManager
     /** @brief Logs request id */
     ocpp::types::Optional<int> m_logs_request_id;
 
-    /** @brief Firmware update thread */
-    std::thread* m_firmware_thread;
     /** @brief Firmware update status */
     ocpp::types::FirmwareStatus m_firmware_status;
     /** @brief Signed firmware update status */
@@ -211,6 +208,20 @@ class MaintenanceManager
     /** @brief Signed firmware update request id */
     ocpp::types::Optional<int> m_firmware_request_id;
 
+    /** @brief Timer to send the triggered diagnostics status notification after the trigger message reply */
+    ocpp::helpers::Timer m_diagnostics_trigger_timer;
+    /** @brief Timer to send the triggered firmware status notification after the trigger message reply */
+    ocpp::helpers::Timer m_firmware_trigger_timer;
+    /** @brief Timer to send the triggered log status notification after the trigger message reply */
+    ocpp::helpers::Timer m_logs_trigger_timer;
+    /** @brief Timer to send the triggered signed firmware status notification after the trigger message reply */
+    ocpp::helpers::Timer m_signed_firmware_trigger_timer;
+
+    /** @brief Scheduler of the diagnostics and logs uploads (uploads are done by a single call to uploadFile() and are not throttled) */
+    TransferScheduler m_upload_scheduler;
+    /** @brief Scheduler of the firmware updates */
+    TransferScheduler m_firmware_scheduler;
+
     /** @brief Process the upload of the diagnostics */
     void processGetDiagnostics(std::string                         location,
                                ocpp::types::Optional<unsigned int> retries,
@@ -220,11 +231,10 @@ class MaintenanceManager
     /** @brief Send a diagnostic status notification */
     void sendDiagnosticStatusNotification();
 
-    /** @brief Process the firmware update */
-    void processUpdateFirmware(std::string                         location,
-                               ocpp::types::Optional<unsigned int> retries,
-                               ocpp::types::Optional<unsigned int> retry_interval,
-                               ocpp::types::DateTime               retrieve_date);
+    /** @brief Download the firmware */
+    void downloadFirmware(std::string                         location,
+                          ocpp::types::Optional<unsigned int> retries,
+                          ocpp::types::Optional<unsigned int> retry_interval);
 
     /** @brief Send a firmware status notification */
     bool sendFirmwareStatusNotification();
@@ -241,14 +251,16 @@ class MaintenanceManager
     /** @brief Send a log status notification */
     void sendLogStatusNotification();
 
-    /** @brief Process the signed firmware update */
-    void processSignedUpdateFirmware(std::string                                  location,
-                                     ocpp::types::Optional<unsigned int>          retries,
-                                     ocpp::types::Optional<unsigned int>          retry_interval,
-                                     ocpp::types::DateTime                        retrieve_date,
-                                     ocpp::types::Optional<ocpp::types::DateTime> install_date,
-                                     ocpp::x509::Certificate                      signing_certificate,
-                                     std::string                                  signature);
+    /** @brief Download the signed firmware */
+    void downloadSignedFirmware(std::string                                  location,
+                                ocpp::types::Optional<unsigned int>          retries,
+                                ocpp::types::Optional<unsigned int>          retry_interval,
+                                ocpp::types::Optional<ocpp::types::DateTime> install_date,
+                                ocpp::x509::Certificate                      signing_certificate,
+                                std::string                                  signature);
+
+    /** @brief Install the signed firmware */
+    void installSignedFirmware(std::string local_firmware_file);
 
     /** @brief Send a signed firmware status notification */
     bool sendSignedFirmwareStatusNotification();
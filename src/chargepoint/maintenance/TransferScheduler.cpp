@@ -0,0 +1,202 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "TransferScheduler.h"
+#include "Logger.h"
+
+#include <thread>
+
+using namespace ocpp::types;
+
+namespace ocpp
+{
+namespace chargepoint
+{
+
+/** @brief Interval between 2 progress notifications */
+static constexpr std::chrono::seconds PROGRESS_NOTIFICATION_INTERVAL = std::chrono::seconds(1);
+
+/** @brief Constructor */
+TransferProgress::TransferProgress(unsigned int max_bandwidth, std::function<void(size_t)> progress)
+    : m_max_bandwidth(max_bandwidth), m_progress(progress), m_transferred(0), m_start(), m_last_notification()
+{
+}
+
+/** @brief Restart the progress for a new attempt */
+void TransferProgress::restart()
+{
+    m_transferred       = 0;
+    m_start             = std::chrono::steady_clock::now();
+    m_last_notification = m_start;
+}
+
+/** @brief Account for a block of transferred data */
+void TransferProgress::update(size_t size)
+{
+    m_transferred += size;
+
+    // Holding back the data callback slows the peer down through the
+    // flow control of the transport so that the transfer does not
+    // compete with the OCPP traffic
+    if (m_max_bandwidth != 0)
+    {
+        auto expected_duration = std::chrono::microseconds((static_cast<uint64_t>(m_transferred) * 1000000u) / m_max_bandwidth);
+        auto duration          = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - m_start);
+        if (expected_duration > duration)
+        {
+            std::this_thread::sleep_for(expected_duration - duration);
+        }
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    if (m_progress && ((now - m_last_notification) >= PROGRESS_NOTIFICATION_INTERVAL))
+    {
+        m_progress(m_transferred);
+        m_last_notification = now;
+    }
+}
+
+/** @brief Constructor */
+TransferScheduler::TransferScheduler(ocpp::helpers::ITimerPool& timer_pool, const char* name, unsigned int max_bandwidth)
+    : m_max_bandwidth(max_bandwidth),
+      m_busy(false),
+      m_stopped(false),
+      m_mutex(),
+      m_pending_step(),
+      m_timer(timer_pool, name),
+      m_worker(1u)
+{
+    m_timer.setCallback(
+        [this]
+        {
+            std::function<void()> step;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                step.swap(m_pending_step);
+            }
+            if (step)
+            {
+                run(step);
+            }
+        });
+}
+
+/** @brief Destructor */
+TransferScheduler::~TransferScheduler()
+{
+    // Pending steps are dropped, the step in progress
+    // is completed when the worker thread is stopped
+    m_stopped = true;
+    m_timer.stop();
+}
+
+/** @brief Reserve the scheduler for a new operation */
+bool TransferScheduler::acquire()
+{
+    bool expected = false;
+    return m_busy.compare_exchange_strong(expected, true);
+}
+
+/** @brief Release the scheduler at the end of an operation */
+void TransferScheduler::release()
+{
+    m_busy = false;
+}
+
+/** @brief Run a step of the operation as soon as possible */
+void TransferScheduler::run(std::function<void()> step)
+{
+    if (!m_stopped)
+    {
+        m_worker.run<void>(step);
+    }
+}
+
+/** @brief Run a step of the operation at a given date */
+void TransferScheduler::runAt(const ocpp::types::DateTime& date, std::function<void()> step)
+{
+    std::chrono::milliseconds delay(0);
+    DateTime                  now = DateTime::now();
+    if (date > now)
+    {
+        delay = std::chrono::seconds(date.timestamp() - now.timestamp());
+    }
+    runAfter(delay, step);
+}
+
+/** @brief Run a transfer step with retries */
+void TransferScheduler::transfer(const std::string&                     name,
+                                 unsigned int                           attempts,
+                                 std::chrono::seconds                   retry_interval,
+                                 std::function<bool(TransferProgress&)> attempt,
+                                 std::function<void(bool)>              completed,
+                                 std::function<void(size_t)>            progress)
+{
+    if (attempts == 0)
+    {
+        attempts = 1u;
+    }
+    auto transfer = std::make_shared<Transfer>(name, attempts, retry_interval, attempt, completed, m_max_bandwidth, progress);
+    run([this, transfer] { runAttempt(transfer); });
+}
+
+/** @brief Run a step after a delay */
+void TransferScheduler::runAfter(std::chrono::milliseconds delay, std::function<void()> step)
+{
+    if (delay.count() > 0)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_pending_step = step;
+        }
+        if (!m_stopped)
+        {
+            m_timer.restart(delay, true);
+        }
+    }
+    else
+    {
+        run(step);
+    }
+}
+
+/** @brief Run an attempt of a transfer */
+void TransferScheduler::runAttempt(std::shared_ptr<Transfer> transfer)
+{
+    transfer->progress.restart();
+    bool success = transfer->attempt(transfer->progress);
+    if (!success && (transfer->attempts > 1u) && !m_stopped)
+    {
+        // Next retry
+        transfer->attempts--;
+        LOG_WARNING << transfer->name << " failed (" << transfer->attempts << " retrie(s) left - next retry in "
+                    << transfer->retry_interval.count() << "s)";
+        runAfter(transfer->retry_interval, [this, transfer] { runAttempt(transfer); });
+    }
+    else
+    {
+        if (!success)
+        {
+            LOG_WARNING << transfer->name << " failed no retries left";
+        }
+        transfer->completed(success);
+    }
+}
+
+} // namespace chargepoint
+} // namespace ocpp
@@ -0,0 +1,192 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPENOCPP_TRANSFERSCHEDULER_H
+#define OPENOCPP_TRANSFERSCHEDULER_H
+
+#include "DateTime.h"
+#include "Timer.h"
+#include "WorkerThreadPool.h"
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace ocpp
+{
+namespace chargepoint
+{
+
+/** @brief Progress of a file transfer */
+class TransferProgress
+{
+  public:
+    /**
+     * @brief Constructor
+     * @param max_bandwidth Maximum bandwidth of the transfer in bytes per second (0 = no limit)
+     * @param progress Function called periodically with the number of bytes transferred
+     */
+    TransferProgress(unsigned int max_bandwidth, std::function<void(size_t)> progress);
+
+    /** @brief Restart the progress for a new attempt */
+    void restart();
+
+    /**
+     * @brief Account for a block of transferred data, this function returns late enough
+     *        for the transfer to stay under the maximum bandwidth
+     * @param size Size of the block in bytes
+     */
+    void update(size_t size);
+
+    /**
+     * @brief Get the number of bytes transferred since the start of the current attempt
+     * @return Number of bytes transferred
+     */
+    size_t transferred() const { return m_transferred; }
+
+  private:
+    /** @brief Maximum bandwidth in bytes per second */
+    const unsigned int m_max_bandwidth;
+    /** @brief Progress notification */
+    std::function<void(size_t)> m_progress;
+    /** @brief Number of bytes transferred */
+    size_t m_transferred;
+    /** @brief Start of the current attempt */
+    std::chrono::steady_clock::time_point m_start;
+    /** @brief Last progress notification */
+    std::chrono::steady_clock::time_point m_last_notification;
+};
+
+/** @brief Schedule the steps of a maintenance operation (one at a time) on a dedicated thread,
+ *         the waits between the steps are handled by a timer so that no thread is blocked */
+class TransferScheduler
+{
+  public:
+    /**
+     * @brief Constructor
+     * @param timer_pool Timer pool
+     * @param name Name of the scheduler
+     * @param max_bandwidth Maximum bandwidth of the transfers in bytes per second (0 = no limit)
+     */
+    TransferScheduler(ocpp::helpers::ITimerPool& timer_pool, const char* name, unsigned int max_bandwidth);
+
+    /** @brief Destructor */
+    virtual ~TransferScheduler();
+
+    /**
+     * @brief Reserve the scheduler for a new operation
+     * @return true if the scheduler has been reserved, false if an operation is already in progress
+     */
+    bool acquire();
+
+    /** @brief Release the scheduler at the end of an operation */
+    void release();
+
+    /**
+     * @brief Run a step of the operation as soon as possible
+     * @param step Step to run
+     */
+    void run(std::function<void()> step);
+
+    /**
+     * @brief Run a step of the operation at a given date
+     * @param date Date of the step (the step is run immediatly if the date has elapsed)
+     * @param step Step to run
+     */
+    void runAt(const ocpp::types::DateTime& date, std::function<void()> step);
+
+    /**
+     * @brief Run a transfer step with retries
+     * @param name Name of the transfer (for the logs)
+     * @param attempts Maximum number of attempts
+     * @param retry_interval Interval between 2 attempts
+     * @param attempt Transfer attempt, must return true if the transfer succeeded
+     * @param completed Called at the end of the transfer with its result
+     * @param progress Called periodically with the number of bytes transferred
+     */
+    void transfer(const std::string&                     name,
+                  unsigned int                           attempts,
+                  std::chrono::seconds                   retry_interval,
+                  std::function<bool(TransferProgress&)> attempt,
+                  std::function<void(bool)>              completed,
+                  std::function<void(size_t)>            progress = std::function<void(size_t)>());
+
+  private:
+    /** @brief Transfer in progress */
+    struct Transfer
+    {
+        /** @brief Constructor */
+        Transfer(const std::string&                     _name,
+                 unsigned int                           _attempts,
+                 std::chrono::seconds                   _retry_interval,
+                 std::function<bool(TransferProgress&)> _attempt,
+                 std::function<void(bool)>              _completed,
+                 unsigned int                           max_bandwidth,
+                 std::function<void(size_t)>            progress)
+            : name(_name),
+              attempts(_attempts),
+              retry_interval(_retry_interval),
+              attempt(_attempt),
+              completed(_completed),
+              progress(max_bandwidth, progress)
+        {
+        }
+
+        /** @brief Name */
+        const std::string name;
+        /** @brief Remaining attempts */
+        unsigned int attempts;
+        /** @brief Interval between 2 attempts */
+        const std::chrono::seconds retry_interval;
+        /** @brief Transfer attempt */
+        std::function<bool(TransferProgress&)> attempt;
+        /** @brief End of transfer notification */
+        std::function<void(bool)> completed;
+        /** @brief Progress */
+        TransferProgress progress;
+    };
+
+    /** @brief Maximum bandwidth of the transfers in bytes per second */
+    const unsigned int m_max_bandwidth;
+    /** @brief Indicate that an operation is in progress */
+    std::atomic<bool> m_busy;
+    /** @brief Indicate that the scheduler is being destroyed */
+    std::atomic<bool> m_stopped;
+    /** @brief Mutex to protect the pending step */
+    std::mutex m_mutex;
+    /** @brief Step waiting for the timer */
+    std::function<void()> m_pending_step;
+    /** @brief Timer to wait before the next step */
+    ocpp::helpers::Timer m_timer;
+    /** @brief Thread running the steps */
+    ocpp::helpers::WorkerThreadPool m_worker;
+
+    /** @brief Run a step after a delay */
+    void runAfter(std::chrono::milliseconds delay, std::function<void()> step);
+
+    /** @brief Run an attempt of a transfer */
+    void runAttempt(std::shared_ptr<Transfer> transfer);
+};
+
+} // namespace chargepoint
+} // namespace ocpp
+
+#endif // OPENOCPP_TRANSFERSCHEDULER_H
@@ -0,0 +1,148 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "MeterValuesBuilder.h"
+#include "StringHelpers.h"
+
+using namespace ocpp::types;
+
+namespace ocpp
+{
+namespace chargepoint
+{
+
+/** @brief Add an optional enum value to a JSON object without copying its string representation */
+template <typename EnumType>
+static void addEnum(rapidjson::Value&                       json,
+                    const char*                             name,
+                    const Optional<EnumType>&               value,
+                    const EnumToStringFromString<EnumType>& helper,
+                    rapidjson::MemoryPoolAllocator<>&       allocator)
+{
+    if (value.isSet())
+    {
+        const std::string& value_str = helper.toString(value);
+        json.AddMember(rapidjson::StringRef(name),
+                       rapidjson::StringRef(value_str.c_str(), static_cast<rapidjson::SizeType>(value_str.size())),
+                       allocator);
+    }
+}
+
+/** @brief Constructor */
+MeterValuesBuilder::MeterValuesBuilder(size_t pool_size)
+    : m_pool(new char[pool_size]),
+      m_allocator(m_pool.get(), pool_size),
+      m_document(&m_allocator),
+      m_string_buffer(),
+      m_writer(m_string_buffer),
+      m_meter_value()
+{
+}
+
+/** @brief Destructor */
+MeterValuesBuilder::~MeterValuesBuilder() { }
+
+/** @brief Build a MeterValues request payload containing the meter value */
+const rapidjson::Document& MeterValuesBuilder::buildRequest(unsigned int connector_id, const ocpp::types::Optional<int>& transaction_id)
+{
+    reset();
+
+    m_document.MemberReserve(3u, m_allocator);
+    m_document.AddMember(rapidjson::StringRef("connectorId"), connector_id, m_allocator);
+    if (transaction_id.isSet())
+    {
+        m_document.AddMember(rapidjson::StringRef("transactionId"), transaction_id.value(), m_allocator);
+    }
+
+    rapidjson::Value meter_values(rapidjson::kArrayType);
+    rapidjson::Value meter_value;
+    fill(meter_value);
+    meter_values.Reserve(1u, m_allocator);
+    meter_values.PushBack(meter_value.Move(), m_allocator);
+    m_document.AddMember(rapidjson::StringRef("meterValue"), meter_values.Move(), m_allocator);
+
+    return m_document;
+}
+
+/** @brief Serialize the meter value to a JSON string */
+const char* MeterValuesBuilder::serialize()
+{
+    reset();
+
+    rapidjson::Value meter_value;
+    fill(meter_value);
+
+    m_string_buffer.Clear();
+    m_writer.Reset(m_string_buffer);
+    meter_value.Accept(m_writer);
+
+    return m_string_buffer.GetString();
+}
+
+/** @brief Release the JSON values of the previous build */
+void MeterValuesBuilder::reset()
+{
+    // Values are not freed by the memory pool allocator,
+    // the whole pool is released at once
+    m_document.SetObject();
+    m_allocator.Clear();
+}
+
+/** @brief Fill a JSON object with the meter value */
+void MeterValuesBuilder::fill(rapidjson::Value& json)
+{
+    json.SetObject();
+    json.MemberReserve(2u, m_allocator);
+
+    char             timestamp_str[DateTime::MAX_STR_SIZE];
+    size_t           len = m_meter_value.timestamp.format(timestamp_str);
+    rapidjson::Value timestamp(timestamp_str, static_cast<rapidjson::SizeType>(len), m_allocator);
+    json.AddMember(rapidjson::StringRef("timestamp"), timestamp.Move(), m_allocator);
+
+    rapidjson::Value sampled_values(rapidjson::kArrayType);
+    sampled_values.Reserve(static_cast<rapidjson::SizeType>(m_meter_value.sampledValue.size()), m_allocator);
+    for (const SampledValue& sampled_value : m_meter_value.sampledValue)
+    {
+        rapidjson::Value sampled(rapidjson::kObjectType);
+        rapidjson::Value value;
+        if (sampled_value.serializeNumber())
+        {
+            // Format the numeric value only now
+            char   number[ocpp::helpers::MAX_DECIMAL_STR_SIZE];
+            size_t len = ocpp::helpers::formatDecimal(number, sampled_value.number, static_cast<unsigned int>(sampled_value.scale));
+            value.SetString(number, static_cast<rapidjson::SizeType>(len), m_allocator);
+        }
+        else
+        {
+            value.SetString(sampled_value.value.c_str(), static_cast<rapidjson::SizeType>(sampled_value.value.size()), m_allocator);
+        }
+        sampled.MemberReserve(7u, m_allocator);
+        sampled.AddMember(rapidjson::StringRef("value"), value.Move(), m_allocator);
+        addEnum(sampled, "context", sampled_value.context, ReadingContextHelper, m_allocator);
+        addEnum(sampled, "format", sampled_value.format, ValueFormatHelper, m_allocator);
+        addEnum(sampled, "measurand", sampled_value.measurand, MeasurandHelper, m_allocator);
+        addEnum(sampled, "phase", sampled_value.phase, PhaseHelper, m_allocator);
+        addEnum(sampled, "location", sampled_value.location, LocationHelper, m_allocator);
+        addEnum(sampled, "unit", sampled_value.unit, UnitOfMeasureHelper, m_allocator);
+        sampled_values.PushBack(sampled.Move(), m_allocator);
+    }
+    json.AddMember(rapidjson::StringRef("sampledValue"), sampled_values.Move(), m_allocator);
+}
+
+} // namespace chargepoint
+} // namespace ocpp
@@ -0,0 +1,89 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPENOCPP_METERVALUESBUILDER_H
+#define OPENOCPP_METERVALUESBUILDER_H
+
+#include "MeterValue.h"
+#include "json.h"
+
+#include <memory>
+
+namespace ocpp
+{
+namespace chargepoint
+{
+
+/** @brief Build MeterValues requests and serialized meter values into reusable buffers */
+class MeterValuesBuilder
+{
+  public:
+    /** @brief Default size in bytes of the JSON memory pool (enough for 20 measurands on 3 phases) */
+    static constexpr size_t DEFAULT_POOL_SIZE = 32768u;
+
+    /** @brief Constructor */
+    MeterValuesBuilder(size_t pool_size = DEFAULT_POOL_SIZE);
+    /** @brief Destructor */
+    virtual ~MeterValuesBuilder();
+
+    /**
+     * @brief Get the meter value to fill before building a request,
+     *        its storage is reused from one request to another
+     * @return Meter value
+     */
+    ocpp::types::MeterValue& meterValue() { return m_meter_value; }
+
+    /**
+     * @brief Build a MeterValues request payload containing the meter value
+     * @param connector_id Id of the connector
+     * @param transaction_id Id of the transaction in progress on the connector
+     * @return MeterValues request payload (valid until the next call to the builder)
+     */
+    const rapidjson::Document& buildRequest(unsigned int connector_id, const ocpp::types::Optional<int>& transaction_id);
+
+    /**
+     * @brief Serialize the meter value to a JSON string
+     * @return Serialized meter value (valid until the next call to the builder)
+     */
+    const char* serialize();
+
+  private:
+    /** @brief Memory pool buffer */
+    std::unique_ptr<char[]> m_pool;
+    /** @brief Allocator working on the memory pool */
+    rapidjson::MemoryPoolAllocator<> m_allocator;
+    /** @brief Request payload */
+    rapidjson::Document m_document;
+    /** @brief Serialization buffer */
+    rapidjson::StringBuffer m_string_buffer;
+    /** @brief Serialization writer */
+    rapidjson::Writer<rapidjson::StringBuffer> m_writer;
+    /** @brief Meter value */
+    ocpp::types::MeterValue m_meter_value;
+
+    /** @brief Release the JSON values of the previous build */
+    void reset();
+
+    /** @brief Fill a JSON object with the meter value */
+    void fill(rapidjson::Value& json);
+};
+
+} // namespace chargepoint
+} // namespace ocpp
+
+#endif // OPENOCPP_METERVALUESBUILDER_H
@@ -61,11 +61,23 @@ MeterValuesManager::MeterValuesManager(ocpp::config::IOcppConfig&            ocp
       m_clock_aligned_timer(timer_pool, CLOCK_ALIGNED_TIMER_NAME),
       m_find_query(nullptr),
       m_delete_query(nullptr),
-      m_insert_query(nullptr)
+      m_insert_query(nullptr),
+      m_builders(),
+      m_sampled_measurands(),
+      m_stop_txn_sampled_measurands(),
+      m_aligned_measurands(),
+      m_stop_txn_aligned_measurands()
 {
     // Initialize database
     initDatabaseTable();
 
+    // Allocate the meter values builders once for all
+    for (unsigned int i = 0; i <= m_connectors.getCount(); i++)
+    {
+        m_builders.emplace_back(new ConnectorBuilder());
+    }
+    updateMeasurandLists();
+
     // Register messages handlers
     trigger_manager.registerHandler(MessageTrigger::MeterValues, *this);
     trigger_manager.registerHandler(MessageTriggerEnumType::MeterValues, *this);
@@ -73,6 +85,10 @@ MeterValuesManager::MeterValuesManager(ocpp::config::IOcppConfig&            ocp
 
     // Register configuration change handler
     config_manager.registerConfigChangedListener("ClockAlignedDataInterval", *this);
+    config_manager.registerConfigChangedListener("MeterValuesAlignedData", *this);
+    config_manager.registerConfigChangedListener("MeterValuesSampledData", *this);
+    config_manager.registerConfigChangedListener("StopTxnAlignedData", *this);
+    config_manager.registerConfigChangedListener("StopTxnSampledData", *this);
 
     // Start clock aligned and sample timers
     configureClockAlignedTimer();
@@ -235,22 +251,27 @@ bool MeterValuesManager::onTriggerMessage(ocpp::types::MessageTriggerEnumType
 /** @copydoc void IConfigChangedListener::configurationValueChanged(const std::string&) */
 void MeterValuesManager::configurationValueChanged(const std::string& key)
 {
-    // No need to check key, only ClockAlignedDataInterval is monitored
-    (void)key;
-
-    // Check new value
-    std::chrono::seconds interval = m_ocpp_config.clockAlignedDataInterval();
-    if (interval == std::chrono::seconds(0))
+    if (ocpp::helpers::tolower(key) == "clockaligneddatainterval")
     {
-        // Disable clock aligned values
-        m_clock_aligned_timer.stop();
+        // Check new value
+        std::chrono::seconds interval = m_ocpp_config.clockAlignedDataInterval();
+        if (interval == std::chrono::seconds(0))
+        {
+            // Disable clock aligned values
+            m_clock_aligned_timer.stop();
 
-        LOG_INFO << "Clock aligned meter values disabled";
+            LOG_INFO << "Clock aligned meter values disabled";
+        }
+        else
+        {
+            // Reconfigure clock aligned timer
+            configureClockAlignedTimer();
+        }
     }
     else
     {
-        // Reconfigure clock aligned timer
-        configureClockAlignedTimer();
+        // Measurands configuration has changed
+        updateMeasurandLists();
     }
 }
 
@@ -304,42 +325,28 @@ void MeterValuesManager::processClockAligned(void)
             [this]
             {
                 // Process meter value configuration
-                std::string  meter_values        = m_ocpp_config.meterValuesAlignedData();
-                unsigned int measurands_max_size = m_ocpp_config.meterValuesAlignedDataMaxLength();
-                auto         measurands          = computeMeasurandList(meter_values, measurands_max_size);
-                if (!measurands.empty())
+                auto measurands = std::atomic_load(&m_aligned_measurands);
+                if (!measurands->empty())
                 {
-                    LOG_DEBUG << "Clock aligned meter values : " << meter_values;
+                    LOG_DEBUG << "Clock aligned meter values : " << measurands->size() << " measurands";
 
                     // For each connector
                     for (const Connector* connector : m_connectors.getConnectors())
                     {
-                        sendMeterValues(connector->id, measurands, ReadingContext::SampleClock);
+                        sendMeterValues(connector->id, *measurands, ReadingContext::SampleClock);
                     }
 
                     // Process transaction sampled meter value configuration
-                    meter_values        = m_ocpp_config.stopTxnAlignedData();
-                    measurands_max_size = m_ocpp_config.stopTxnAlignedDataMaxLength();
-                    measurands          = computeMeasurandList(meter_values, measurands_max_size);
-                    if (!measurands.empty() && m_insert_query)
+                    measurands = std::atomic_load(&m_stop_txn_aligned_measurands);
+                    if (!measurands->empty())
                     {
-                        LOG_DEBUG << "Clock aligned transaction meter values : " << meter_values;
+                        LOG_DEBUG << "Clock aligned transaction meter values : " << measurands->size() << " measurands";
 
-                        // Fill meter value
-                        MeterValue meter_value;
                         for (const Connector* connector : m_connectors.getConnectors())
                         {
-                            if ((connector->transaction_id != 0) &&
-                                fillMeterValue(connector->id, measurands, meter_value, ReadingContext::SampleClock))
+                            if (connector->transaction_id != 0)
                             {
-                                // Serialize value
-                                std::string meter_value_str = serialize(meter_value);
-
-                                // Store into database
-                                m_insert_query->bind(0u, connector->transaction_id);
-                                m_insert_query->bind(1u, meter_value_str);
-                                m_insert_query->exec();
-                                m_insert_query->reset();
+                                storeMeterValues(connector->id, *measurands, ReadingContext::SampleClock);
                             }
                         }
                     }
@@ -356,41 +363,25 @@ void MeterValuesManager::processSampled(unsigned int connector_id)
         [this, connector_id]
         {
             // Process sampled meter value configuration
-            std::string  meter_values        = m_ocpp_config.meterValuesSampledData();
-            unsigned int measurands_max_size = m_ocpp_config.meterValuesSampledDataMaxLength();
-            auto         measurands          = computeMeasurandList(meter_values, measurands_max_size);
-            if (!measurands.empty())
+            auto measurands = std::atomic_load(&m_sampled_measurands);
+            if (!measurands->empty())
             {
-                LOG_DEBUG << "Sampled meter values : " << meter_values;
+                LOG_DEBUG << "Sampled meter values : " << measurands->size() << " measurands";
 
                 // Get connector
                 Connector* connector = m_connectors.getConnector(connector_id);
                 if (connector)
                 {
                     // Send sampled meter values
-                    sendMeterValues(connector->id, measurands, ReadingContext::SamplePeriodic, connector->transaction_id);
+                    sendMeterValues(connector->id, *measurands, ReadingContext::SamplePeriodic, connector->transaction_id);
 
                     // Process transaction sampled meter value configuration
-                    meter_values        = m_ocpp_config.stopTxnSampledData();
-                    measurands_max_size = m_ocpp_config.stopTxnSampledDataMaxLength();
-                    measurands          = computeMeasurandList(meter_values, measurands_max_size);
-                    if (!measurands.empty() && m_insert_query)
+                    measurands = std::atomic_load(&m_stop_txn_sampled_measurands);
+                    if (!measurands->empty())
                     {
-                        LOG_DEBUG << "Sampled transaction meter values : " << meter_values;
+                        LOG_DEBUG << "Sampled transaction meter values : " << measurands->size() << " measurands";
 
-                        // Fill meter value
-                        MeterValue meter_value;
-                        if (fillMeterValue(connector_id, measurands, meter_value, ReadingContext::SamplePeriodic))
-                        {
-                            // Serialize value
-                            std::string meter_value_str = serialize(meter_value);
-
-                            // Store into database
-                            m_insert_query->bind(0u, connector->transaction_id);
-                            m_insert_query->bind(1u, meter_value_str);
-                            m_insert_query->exec();
-                            m_insert_query->reset();
-                        }
+                        storeMeterValues(connector->id, *measurands, ReadingContext::SamplePeriodic);
                     }
                 }
             }
@@ -408,55 +399,90 @@ void MeterValuesManager::processTriggered(unsigned int connector_id)
             std::this_thread::sleep_for(std::chrono::milliseconds(250u));
 
             // Process meter value configuration
-            std::string  meter_values        = m_ocpp_config.meterValuesSampledData();
-            unsigned int measurands_max_size = m_ocpp_config.meterValuesSampledDataMaxLength();
-            auto         measurands          = computeMeasurandList(meter_values, measurands_max_size);
-            if (!measurands.empty())
+            auto measurands = std::atomic_load(&m_sampled_measurands);
+            if (!measurands->empty())
             {
-                LOG_INFO << "Triggered meter values : " << meter_values;
+                LOG_INFO << "Triggered meter values : " << measurands->size() << " measurands";
 
                 // Get connector
                 Connector* connector = m_connectors.getConnector(connector_id);
                 if (connector)
                 {
-                    sendMeterValues(connector->id, measurands, ReadingContext::Trigger);
+                    sendMeterValues(connector->id, *measurands, ReadingContext::Trigger);
                 }
             }
         });
 }
 
+/** @brief Compute the measurand lists from the configuration */
+void MeterValuesManager::updateMeasurandLists()
+{
+    std::atomic_store(&m_sampled_measurands,
+                      std::make_shared<const MeasurandList>(computeMeasurandList(m_ocpp_config.meterValuesSampledData(),
+                                                                                 m_ocpp_config.meterValuesSampledDataMaxLength())));
+    std::atomic_store(&m_stop_txn_sampled_measurands,
+                      std::make_shared<const MeasurandList>(
+                          computeMeasurandList(m_ocpp_config.stopTxnSampledData(), m_ocpp_config.stopTxnSampledDataMaxLength())));
+    std::atomic_store(&m_aligned_measurands,
+                      std::make_shared<const MeasurandList>(computeMeasurandList(m_ocpp_config.meterValuesAlignedData(),
+                                                                                 m_ocpp_config.meterValuesAlignedDataMaxLength())));
+    std::atomic_store(&m_stop_txn_aligned_measurands,
+                      std::make_shared<const MeasurandList>(
+                          computeMeasurandList(m_ocpp_config.stopTxnAlignedData(), m_ocpp_config.stopTxnAlignedDataMaxLength())));
+}
+
 /** @brief Send a meter value request for a given measurand list on a connector */
-void MeterValuesManager::sendMeterValues(unsigned int                                              connector_id,
-                                         const std::vector<std::pair<Measurand, Optional<Phase>>>& measurands,
-                                         ocpp::types::ReadingContext                               context,
-                                         const ocpp::types::Optional<int>&                         transaction_id)
+void MeterValuesManager::sendMeterValues(unsigned int                      connector_id,
+                                         const MeasurandList&              measurands,
+                                         ocpp::types::ReadingContext       context,
+                                         const ocpp::types::Optional<int>& transaction_id)
 {
-    // Prepare request
-    MeterValuesReq meter_values_req;
-    meter_values_req.connectorId   = connector_id;
-    meter_values_req.transactionId = transaction_id;
-    meter_values_req.meterValue.emplace_back();
-    MeterValue& meter_value = meter_values_req.meterValue.back();
-
-    // Fill meter value
-    if (fillMeterValue(connector_id, measurands, meter_value, context))
+    if (connector_id < m_builders.size())
     {
-        // Don't use FIFO for triggered values
-        IRequestFifo* fifo = &m_requests_fifo;
-        if (context == ReadingContext::Trigger)
+        // Fill meter value
+        std::lock_guard<std::mutex> lock(m_builders[connector_id]->mutex);
+        MeterValuesBuilder&         builder = m_builders[connector_id]->builder;
+        if (fillMeterValue(connector_id, measurands, builder.meterValue(), context))
         {
-            fifo = nullptr;
+            // Don't use FIFO for triggered values
+            IRequestFifo* fifo = &m_requests_fifo;
+            if (context == ReadingContext::Trigger)
+            {
+                fifo = nullptr;
+            }
+
+            // Send request
+            MeterValuesConf            meter_values_conf;
+            std::string                error;
+            std::string                message;
+            const rapidjson::Document& request = builder.buildRequest(connector_id, transaction_id);
+            m_msg_sender.call(METER_VALUES_ACTION, request, meter_values_conf, error, message, fifo, connector_id);
         }
+    }
+}
 
-        // Send request
-        MeterValuesConf meter_values_conf;
-        m_msg_sender.call(METER_VALUES_ACTION, meter_values_req, meter_values_conf, fifo, connector_id);
+/** @brief Store a meter value for a given measurand list on a connector into the transaction meter values */
+void MeterValuesManager::storeMeterValues(unsigned int connector_id, const MeasurandList& measurands, ocpp::types::ReadingContext context)
+{
+    Connector* connector = m_connectors.getConnector(connector_id);
+    if (connector && (connector_id < m_builders.size()) && m_insert_query)
+    {
+        // Fill meter value
+        std::lock_guard<std::mutex> lock(m_builders[connector_id]->mutex);
+        MeterValuesBuilder&         builder = m_builders[connector_id]->builder;
+        if (fillMeterValue(connector_id, measurands, builder.meterValue(), context))
+        {
+            // Store into database
+            m_insert_query->bind(0u, connector->transaction_id);
+            m_insert_query->bind(1u, builder.serialize());
+            m_insert_query->exec();
+            m_insert_query->reset();
+        }
     }
 }
 
 /** @brief Compute the measurand list from a CSL configuration string */
-std::vector<std::pair<ocpp::types::Measurand, ocpp::types::Optional<ocpp::types::Phase>>> MeterValuesManager::computeMeasurandList(
-    const std::string& meter_values, const unsigned int max_count)
+MeterValuesManager::MeasurandList MeterValuesManager::computeMeasurandList(const std::string& meter_values, const unsigned int max_count)
 {
     std::string trimmed_meter_values(meter_values);
     ocpp::helpers::replace(trimmed_meter_values, " ", "");
@@ -465,7 +491,7 @@ std::vector<std::pair<ocpp::types::Measurand, ocpp::types::Optional<ocpp::types:
     {
         measurands.resize(max_count);
     }
-    std::vector<std::pair<Measurand, Optional<Phase>>> measurands_list;
+    MeasurandList measurands_list;
     for (const std::string& measurand_str : measurands)
     {
         bool                     phase_done      = false;
@@ -502,11 +528,10 @@ std::vector<std::pair<ocpp::types::Measurand, ocpp::types::Optional<ocpp::types:
 }
 
 /** @brief Fill a metervalue element */
-bool MeterValuesManager::fillMeterValue(
-    unsigned int                                                                                     connector_id,
-    const std::vector<std::pair<ocpp::types::Measurand, ocpp::types::Optional<ocpp::types::Phase>>>& measurands,
-    ocpp::types::MeterValue&                                                                         meter_value,
-    ocpp::types::ReadingContext                                                                      context)
+bool MeterValuesManager::fillMeterValue(unsigned int                connector_id,
+                                        const MeasurandList&        measurands,
+                                        ocpp::types::MeterValue&    meter_value,
+                                        ocpp::types::ReadingContext context)
 {
     meter_value.timestamp = DateTime::now();
     meter_value.sampledValue.clear();
@@ -582,24 +607,6 @@ void MeterValuesManager::initDatabaseTable()
     }
 }
 
-/** @brief Serialize a meter value to a string */
-std::string MeterValuesManager::serialize(const ocpp::types::MeterValue& meter_value)
-{
-    std::string meter_value_str;
-
-    rapidjson::Document meter_value_json;
-    meter_value_json.Parse("{}");
-    MeterValueConverter meter_value_converter;
-    meter_value_converter.setAllocator(&meter_value_json.GetAllocator());
-    meter_value_converter.toJson(meter_value, meter_value_json);
-
-    rapidjson::StringBuffer                    buffer;
-    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
-    meter_value_json.Accept(writer);
-    meter_value_str = buffer.GetString();
-    return meter_value_str;
-}
-
 /** @brief Deserialize a meter value from a string */
 bool MeterValuesManager::deserialize(const std::string& meter_value_str, ocpp::types::MeterValue& meter_value)
 {
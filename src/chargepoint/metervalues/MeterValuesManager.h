@@ -24,8 +24,13 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "IConfigManager.h"
 #include "IMeterValuesManager.h"
 #include "ITriggerMessageManager.h"
+#include "MeterValuesBuilder.h"
 #include "Timer.h"
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 namespace ocpp
 {
 // Forward declarations
@@ -107,6 +112,18 @@ class MeterValuesManager : public IMeterValuesManager,
     static constexpr const char* CLOCK_ALIGNED_TIMER_NAME = "Clock Aligned";
 
   private:
+    /** @brief List of measurands with their optional phase */
+    typedef std::vector<std::pair<ocpp::types::Measurand, ocpp::types::Optional<ocpp::types::Phase>>> MeasurandList;
+
+    /** @brief Meter values builder of a connector */
+    struct ConnectorBuilder
+    {
+        /** @brief Protect simultaneous use of the builder */
+        std::mutex mutex;
+        /** @brief Builder */
+        MeterValuesBuilder builder;
+    };
+
     /** @brief Standard OCPP configuration */
     ocpp::config::IOcppConfig& m_ocpp_config;
     /** @brief Charge point's database */
@@ -134,6 +151,17 @@ class MeterValuesManager : public IMeterValuesManager,
     /** @brief Query to insert a meter value associated to a transaction */
     std::unique_ptr<ocpp::database::Database::Query> m_insert_query;
 
+    /** @brief Meter values builders indexed by connector id */
+    std::vector<std::unique_ptr<ConnectorBuilder>> m_builders;
+    /** @brief Measurands of MeterValuesSampledData (accessed with atomic operations) */
+    std::shared_ptr<const MeasurandList> m_sampled_measurands;
+    /** @brief Measurands of StopTxnSampledData (accessed with atomic operations) */
+    std::shared_ptr<const MeasurandList> m_stop_txn_sampled_measurands;
+    /** @brief Measurands of MeterValuesAlignedData (accessed with atomic operations) */
+    std::shared_ptr<const MeasurandList> m_aligned_measurands;
+    /** @brief Measurands of StopTxnAlignedData (accessed with atomic operations) */
+    std::shared_ptr<const MeasurandList> m_stop_txn_aligned_measurands;
+
     /** @brief Configure clock-aligned timer */
     void configureClockAlignedTimer(void);
     /** @brief Process clock-aligned meter values */
@@ -143,26 +171,29 @@ class MeterValuesManager : public IMeterValuesManager,
     /** @brief Process triggered meter values for a given connector */
     void processTriggered(unsigned int connector_id);
 
+    /** @brief Compute the measurand lists from the configuration */
+    void updateMeasurandLists();
+
     /** @brief Send a meter value request for a given measurand list on a connector */
-    void sendMeterValues(unsigned int                                                                                     connector_id,
-                         const std::vector<std::pair<ocpp::types::Measurand, ocpp::types::Optional<ocpp::types::Phase>>>& measurands,
-                         ocpp::types::ReadingContext                                                                      context,
+    void sendMeterValues(unsigned int                      connector_id,
+                         const MeasurandList&              measurands,
+                         ocpp::types::ReadingContext       context,
                          const ocpp::types::Optional<int>& transaction_id = ocpp::types::Optional<int>());
 
+    /** @brief Store a meter value for a given measurand list on a connector into the transaction meter values */
+    void storeMeterValues(unsigned int connector_id, const MeasurandList& measurands, ocpp::types::ReadingContext context);
+
     /** @brief Compute the measurand list from a CSL configuration string */
-    std::vector<std::pair<ocpp::types::Measurand, ocpp::types::Optional<ocpp::types::Phase>>> computeMeasurandList(
-        const std::string& meter_values, const unsigned int max_count);
+    MeasurandList computeMeasurandList(const std::string& meter_values, const unsigned int max_count);
 
     /** @brief Fill a meter value element */
-    bool fillMeterValue(unsigned int                                                                                     connector_id,
-                        const std::vector<std::pair<ocpp::types::Measurand, ocpp::types::Optional<ocpp::types::Phase>>>& measurands,
-                        ocpp::types::MeterValue&                                                                         meter_value,
-                        ocpp::types::ReadingContext                                                                      context);
+    bool fillMeterValue(unsigned int                connector_id,
+                        const MeasurandList&        measurands,
+                        ocpp::types::MeterValue&    meter_value,
+                        ocpp::types::ReadingContext context);
 
     /** @brief Initialize the database table */
     void initDatabaseTable();
-    /** @brief Serialize a meter value to a string */
-    std::string serialize(const ocpp::types::MeterValue& meter_value);
     /** @brief Deserialize a meter value from a string */
     bool deserialize(const std::string& meter_value_str, ocpp::types::MeterValue& meter_value);
 };
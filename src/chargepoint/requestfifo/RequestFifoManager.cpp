@@ -21,7 +21,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "GenericMessageSender.h"
 #include "IAuthentManager.h"
 #include "IChargePointEventsHandler.h"
-#include "IOcppConfig.h"
+#include "IConfigManager.h"
 #include "IStatusManager.h"
 #include "Logger.h"
 #include "MeterValues.h"
@@ -39,7 +39,7 @@ namespace chargepoint
 {
 
 /** @brief Constructor */
-RequestFifoManager::RequestFifoManager(ocpp::config::IOcppConfig&            ocpp_config,
+RequestFifoManager::RequestFifoManager(const IConfigManager&                 config_manager,
                                        IChargePointEventsHandler&            events_handler,
                                        ocpp::helpers::ITimerPool&            timer_pool,
                                        ocpp::helpers::WorkerThreadPool&      worker_pool,
@@ -48,7 +48,7 @@ RequestFifoManager::RequestFifoManager(ocpp::config::IOcppConfig&            ocp
                                        ocpp::messages::IRequestFifo&         requests_fifo,
                                        IStatusManager&                       status_manager,
                                        IAuthentManager&                      authent_manager)
-    : m_ocpp_config(ocpp_config),
+    : m_config_manager(config_manager),
       m_events_handler(events_handler),
       m_worker_pool(worker_pool),
       m_connectors(connectors),
@@ -91,8 +91,9 @@ void RequestFifoManager::requestQueued()
     if (m_msg_sender.isConnected() && !m_request_retry_timer.isStarted())
     {
         // Start processing FIFO requests
-        LOG_DEBUG << "Request failed, next retry in " << m_ocpp_config.transactionMessageRetryInterval().count() << "second(s)";
-        m_request_retry_timer.restart(std::chrono::seconds(m_ocpp_config.transactionMessageRetryInterval()), true);
+        auto config = m_config_manager.snapshot();
+        LOG_DEBUG << "Request failed, next retry in " << config->transactionMessageRetryInterval.count() << "second(s)";
+        m_request_retry_timer.restart(config->transactionMessageRetryInterval, true);
     }
 }
 
@@ -113,8 +114,9 @@ void RequestFifoManager::processFifoRequest()
                 unsigned int        connector_id;
                 if (m_requests_fifo.front(connector_id, action, payload))
                 {
+                    auto config = m_config_manager.snapshot();
                     LOG_DEBUG << "Request FIFO processing " << action << " retries : " << m_request_retry_count << "/"
-                              << m_ocpp_config.transactionMessageAttempts();
+                              << config->transactionMessageAttempts;
 
                     // Send request
                     CallResult res;
@@ -228,7 +230,7 @@ void RequestFifoManager::processFifoRequest()
                     {
                         // Update retry count
                         m_request_retry_count++;
-                        if (m_request_retry_count > m_ocpp_config.transactionMessageAttempts())
+                        if (m_request_retry_count > config->transactionMessageAttempts)
                         {
                             // Drop message from the FIFO
                             LOG_DEBUG << "Request failed, drop message";
@@ -240,9 +242,9 @@ void RequestFifoManager::processFifoRequest()
                             // Schedule next retry
                             if (m_msg_sender.isConnected())
                             {
-                                LOG_DEBUG << "Request failed, next retry in " << m_ocpp_config.transactionMessageRetryInterval().count()
+                                LOG_DEBUG << "Request failed, next retry in " << config->transactionMessageRetryInterval.count()
                                           << "second(s)";
-                                m_request_retry_timer.restart(std::chrono::seconds(m_ocpp_config.transactionMessageRetryInterval()), true);
+                                m_request_retry_timer.restart(config->transactionMessageRetryInterval, true);
                             }
                         }
                     }
@@ -25,10 +25,6 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 namespace ocpp
 {
 // Forward declarations
-namespace config
-{
-class IOcppConfig;
-} // namespace config
 namespace messages
 {
 class GenericMessageSender;
@@ -43,6 +39,7 @@ namespace chargepoint
 {
 
 class IAuthentManager;
+class IConfigManager;
 class Connectors;
 class IStatusManager;
 class IChargePointEventsHandler;
@@ -52,7 +49,7 @@ class RequestFifoManager : public ocpp::messages::IRequestFifo::IListener
 {
   public:
     /** @brief Constructor */
-    RequestFifoManager(ocpp::config::IOcppConfig&            ocpp_config,
+    RequestFifoManager(const IConfigManager&                 config_manager,
                        IChargePointEventsHandler&            events_handler,
                        ocpp::helpers::ITimerPool&            timer_pool,
                        ocpp::helpers::WorkerThreadPool&      worker_pool,
@@ -77,8 +74,8 @@ class RequestFifoManager : public ocpp::messages::IRequestFifo::IListener
     void requestQueued() override;
 
   private:
-    /** @brief Standard OCPP configuration */
-    ocpp::config::IOcppConfig& m_ocpp_config;
+    /** @brief Configuration manager */
+    const IConfigManager& m_config_manager;
     /** @brief User defined events handler */
     IChargePointEventsHandler& m_events_handler;
     /** @brief Worker thread pool */
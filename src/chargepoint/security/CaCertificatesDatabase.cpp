@@ -22,7 +22,6 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "IChargePointConfig.h"
 #include "Logger.h"
 
-#include <limits>
 #include <sstream>
 
 using namespace ocpp::database;
@@ -38,11 +37,12 @@ namespace chargepoint
 CaCertificatesDatabase::CaCertificatesDatabase(const ocpp::config::IChargePointConfig& stack_config, ocpp::database::Database& database)
     : m_stack_config(stack_config),
       m_database(database),
-      m_list_query(),
-      m_count_query(),
-      m_find_query(),
       m_delete_query(),
-      m_insert_query()
+      m_insert_query(),
+      m_load_query(),
+      m_mutex(),
+      m_cache(),
+      m_cache_valid(false)
 {
 }
 
@@ -52,6 +52,8 @@ CaCertificatesDatabase::~CaCertificatesDatabase() { }
 /** @brief Initialize the database table */
 void CaCertificatesDatabase::initDatabaseTable()
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
     if (m_stack_config.internalCertificateManagementEnabled())
     {
         // Create database
@@ -76,22 +78,21 @@ void CaCertificatesDatabase::initDatabaseTable()
         }
 
         // Create parametrized queries
-        m_list_query = m_database.query("SELECT * FROM CaCertificates WHERE type = ? AND validity_from <= ? AND validity_to >= ?;");
-        m_count_query =
-            m_database.query("SELECT count(id) FROM CaCertificates WHERE type = ? AND validity_from <= ? AND validity_to >= ?;");
-        m_find_query   = m_database.query("SELECT * FROM CaCertificates WHERE issuer_hash = ? AND pub_key_hash = ? AND serial = ?;");
         m_delete_query = m_database.query("DELETE FROM CaCertificates WHERE id = ?;");
         m_insert_query = m_database.query("INSERT INTO CaCertificates VALUES (NULL, ?, ?, ?, ?, ?, ?, ?, ?, ?);");
+        m_load_query   = m_database.query("SELECT * FROM CaCertificates;");
     }
     else
     {
         // Disable certificates management
-        m_list_query.reset();
-        m_count_query.reset();
-        m_find_query.reset();
         m_delete_query.reset();
         m_insert_query.reset();
+        m_load_query.reset();
     }
+
+    // Cache will be loaded on first access
+    m_cache.clear();
+    m_cache_valid = false;
 }
 
 /** @brief Delete an installed CA certificate */
@@ -100,18 +101,18 @@ ocpp::types::DeleteCertificateStatusEnumType CaCertificatesDatabase::deleteCerti
 {
     DeleteCertificateStatusEnumType ret = DeleteCertificateStatusEnumType::NotFound;
 
+    std::lock_guard<std::mutex> lock(m_mutex);
     if (m_delete_query)
     {
         // Look for the requested certificate
-        bool         in_use = false;
-        unsigned int id     = 0;
-        if (findCertificate(certificate, id, in_use))
+        const CachedCertificate* cached = findCertificate(certificate);
+        if (cached)
         {
             // Check if the certificate is in use
-            if (!in_use)
+            if (!cached->in_use)
             {
                 // Delete the requested certificate
-                m_delete_query->bind(0, id);
+                m_delete_query->bind(0, cached->id);
                 if (m_delete_query->exec())
                 {
                     ret = DeleteCertificateStatusEnumType::Accepted;
@@ -124,6 +125,9 @@ ocpp::types::DeleteCertificateStatusEnumType CaCertificatesDatabase::deleteCerti
 
                 // Reset all queries
                 m_delete_query->reset();
+
+                // Invalidate cache
+                m_cache_valid = false;
             }
             else
             {
@@ -140,28 +144,16 @@ ocpp::types::DeleteCertificateStatusEnumType CaCertificatesDatabase::deleteCerti
 void CaCertificatesDatabase::getCertificateList(ocpp::types::CertificateUseEnumType                type,
                                                 std::vector<ocpp::types::CertificateHashDataType>& certificates)
 {
-    if (m_list_query)
+    std::lock_guard<std::mutex> lock(m_mutex);
+    loadCache();
+
+    // List certificates
+    for (const auto& cached : m_cache)
     {
-        // List certificates
-        m_list_query->bind(0, static_cast<unsigned int>(type));
-        m_list_query->bind(1, static_cast<int64_t>(std::numeric_limits<std::time_t>::max()));
-        m_list_query->bind(2, 0);
-        if (m_list_query->exec() && m_list_query->hasRows())
+        if (cached.type == type)
         {
-            // Read data
-            do
-            {
-                certificates.emplace_back();
-                CertificateHashDataType& certificate = certificates.back();
-                certificate.hashAlgorithm            = HashAlgorithmEnumType::SHA256;
-                certificate.issuerNameHash.assign(m_list_query->getString(4));
-                certificate.issuerKeyHash.assign(m_list_query->getString(5));
-                certificate.serialNumber.assign(m_list_query->getString(6));
-            } while (m_list_query->next());
+            certificates.push_back(cached.hash_data);
         }
-
-        // Reset query
-        m_list_query->reset();
     }
 }
 
@@ -170,23 +162,17 @@ std::string CaCertificatesDatabase::getCertificateListPem(ocpp::types::Certifica
 {
     std::string ca_certificates_pem;
 
-    if (m_list_query)
+    std::lock_guard<std::mutex> lock(m_mutex);
+    loadCache();
+
+    // List valid certificates
+    std::time_t now = DateTime::now().timestamp();
+    for (const auto& cached : m_cache)
     {
-        // List certificates
-        m_list_query->bind(0, static_cast<unsigned int>(type));
-        m_list_query->bind(1, static_cast<int64_t>(DateTime::now().timestamp()));
-        m_list_query->bind(2, static_cast<int64_t>(DateTime::now().timestamp()));
-        if (m_list_query->exec() && m_list_query->hasRows())
+        if ((cached.type == type) && (cached.validity_from <= now) && (cached.validity_to >= now))
         {
-            // Read data
-            do
-            {
-                ca_certificates_pem += m_list_query->getString(7) + "\n";
-            } while (m_list_query->next());
+            ca_certificates_pem += cached.pem + "\n";
         }
-
-        // Reset query
-        m_list_query->reset();
     }
 
     return ca_certificates_pem;
@@ -197,32 +183,17 @@ unsigned int CaCertificatesDatabase::getCertificateCount(ocpp::types::Certificat
 {
     unsigned int ret = 0;
 
-    if (m_count_query)
+    std::lock_guard<std::mutex> lock(m_mutex);
+    loadCache();
+
+    // Count certificates
+    std::time_t now = DateTime::now().timestamp();
+    for (const auto& cached : m_cache)
     {
-        // Count certificates
-        std::time_t validity_from;
-        std::time_t validity_to;
-        if (check_validity)
-        {
-            validity_from = DateTime::now().timestamp();
-            validity_to   = DateTime::now().timestamp();
-        }
-        else
-        {
-            validity_from = std::numeric_limits<std::time_t>::max();
-            validity_to   = 0;
-        }
-        m_count_query->bind(0, static_cast<unsigned int>(type));
-        m_count_query->bind(1, static_cast<int64_t>(validity_from));
-        m_count_query->bind(2, static_cast<int64_t>(validity_to));
-        if (m_count_query->exec() && m_count_query->hasRows())
+        if ((cached.type == type) && (!check_validity || ((cached.validity_from <= now) && (cached.validity_to >= now))))
         {
-            // Read count
-            ret = m_count_query->getUInt32(0);
+            ret++;
         }
-
-        // Reset query
-        m_count_query->reset();
     }
 
     return ret;
@@ -235,12 +206,11 @@ bool CaCertificatesDatabase::addCertificate(ocpp::types::CertificateUseEnumType
 {
     bool ret = false;
 
+    std::lock_guard<std::mutex> lock(m_mutex);
     if (m_insert_query)
     {
         // Look for the certificate
-        bool         in_use = false;
-        unsigned int id     = 0;
-        if (!findCertificate(hash_data, id, in_use))
+        if (!findCertificate(hash_data))
         {
             // Add certificate
             m_insert_query->bind(0, static_cast<unsigned int>(type));
@@ -260,6 +230,9 @@ bool CaCertificatesDatabase::addCertificate(ocpp::types::CertificateUseEnumType
 
             // Reset query
             m_insert_query->reset();
+
+            // Invalidate cache
+            m_cache_valid = false;
         }
         else
         {
@@ -271,30 +244,57 @@ bool CaCertificatesDatabase::addCertificate(ocpp::types::CertificateUseEnumType
     return ret;
 }
 
-/** @brief Look for a certificate */
-bool CaCertificatesDatabase::findCertificate(const ocpp::types::CertificateHashDataType& certificate, unsigned int& id, bool& in_use)
+/** @brief Load the cache from the database if needed (must be called with the mutex locked) */
+void CaCertificatesDatabase::loadCache()
 {
-    bool found = false;
-
-    if (m_find_query)
+    if (!m_cache_valid && m_load_query)
     {
-        // Look for the requested certificate
-        m_find_query->bind(0, certificate.issuerNameHash);
-        m_find_query->bind(1, certificate.issuerKeyHash);
-        m_find_query->bind(2, certificate.serialNumber);
-        if (m_find_query->exec() && m_find_query->hasRows())
+        // Read all the certificates
+        m_cache.clear();
+        if (m_load_query->exec() && m_load_query->hasRows())
         {
-            // Read data
-            id     = m_find_query->getUInt32(0);
-            in_use = m_find_query->getBool(8);
-            found  = true;
+            do
+            {
+                m_cache.emplace_back();
+                CachedCertificate& cached      = m_cache.back();
+                cached.id                      = m_load_query->getUInt32(0);
+                cached.type                    = static_cast<CertificateUseEnumType>(m_load_query->getUInt32(1));
+                cached.validity_from           = static_cast<std::time_t>(m_load_query->getInt64(2));
+                cached.validity_to             = static_cast<std::time_t>(m_load_query->getInt64(3));
+                cached.hash_data.hashAlgorithm = HashAlgorithmEnumType::SHA256;
+                cached.hash_data.issuerNameHash.assign(m_load_query->getString(4));
+                cached.hash_data.issuerKeyHash.assign(m_load_query->getString(5));
+                cached.hash_data.serialNumber.assign(m_load_query->getString(6));
+                cached.pem    = m_load_query->getString(7);
+                cached.in_use = m_load_query->getBool(8);
+            } while (m_load_query->next());
         }
 
-        // Reset all queries
-        m_find_query->reset();
+        // Reset query
+        m_load_query->reset();
+        m_cache_valid = true;
+    }
+}
+
+/** @brief Look for a certificate in the cache (must be called with the mutex locked) */
+const CaCertificatesDatabase::CachedCertificate* CaCertificatesDatabase::findCertificate(
+    const ocpp::types::CertificateHashDataType& certificate)
+{
+    const CachedCertificate* ret = nullptr;
+
+    loadCache();
+    for (const auto& cached : m_cache)
+    {
+        if ((cached.hash_data.issuerNameHash.str() == certificate.issuerNameHash.str()) &&
+            (cached.hash_data.issuerKeyHash.str() == certificate.issuerKeyHash.str()) &&
+            (cached.hash_data.serialNumber.str() == certificate.serialNumber.str()))
+        {
+            ret = &cached;
+            break;
+        }
     }
 
-    return found;
+    return ret;
 }
 
 } // namespace chargepoint
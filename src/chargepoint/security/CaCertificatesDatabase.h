@@ -22,7 +22,10 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "CertificateHashDataType.h"
 #include "Database.h"
 
+#include <ctime>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 namespace ocpp
 {
@@ -103,19 +106,43 @@ class CaCertificatesDatabase
     /** @brief Charge point's database */
     ocpp::database::Database& m_database;
 
-    /** @brief Query to list certificates */
-    std::unique_ptr<ocpp::database::Database::Query> m_list_query;
-    /** @brief Query to count certificates */
-    std::unique_ptr<ocpp::database::Database::Query> m_count_query;
-    /** @brief Query to look for a certificate */
-    std::unique_ptr<ocpp::database::Database::Query> m_find_query;
     /** @brief Query to delete a certificate */
     std::unique_ptr<ocpp::database::Database::Query> m_delete_query;
     /** @brief Query to insert a certificate */
     std::unique_ptr<ocpp::database::Database::Query> m_insert_query;
-
-    /** @brief Look for a certificate */
-    bool findCertificate(const ocpp::types::CertificateHashDataType& certificate, unsigned int& id, bool& in_use);
+    /** @brief Query to load all the certificates */
+    std::unique_ptr<ocpp::database::Database::Query> m_load_query;
+
+    /** @brief Installed certificate as stored in the in-memory cache */
+    struct CachedCertificate
+    {
+        /** @brief Id in the database */
+        unsigned int id;
+        /** @brief Type of certificate */
+        ocpp::types::CertificateUseEnumType type;
+        /** @brief Start of the validity window */
+        std::time_t validity_from;
+        /** @brief End of the validity window */
+        std::time_t validity_to;
+        /** @brief Precomputed certificate hashes */
+        ocpp::types::CertificateHashDataType hash_data;
+        /** @brief Certificate in PEM encoded data format */
+        std::string pem;
+        /** @brief Indicate if the certificate is in use */
+        bool in_use;
+    };
+
+    /** @brief Mutex to protect the cache and the queries */
+    std::mutex m_mutex;
+    /** @brief In-memory cache of the installed certificates */
+    std::vector<CachedCertificate> m_cache;
+    /** @brief Indicate if the cache reflects the database content */
+    bool m_cache_valid;
+
+    /** @brief Load the cache from the database if needed (must be called with the mutex locked) */
+    void loadCache();
+    /** @brief Look for a certificate in the cache (must be called with the mutex locked) */
+    const CachedCertificate* findCertificate(const ocpp::types::CertificateHashDataType& certificate);
 };
 
 } // namespace chargepoint
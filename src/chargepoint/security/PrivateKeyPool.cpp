@@ -0,0 +1,177 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PrivateKeyPool.h"
+#include "Logger.h"
+
+#include <functional>
+
+#ifndef _MSC_VER
+#include <sys/resource.h>
+#endif // _MSC_VER
+
+using namespace ocpp::x509;
+
+namespace ocpp
+{
+namespace chargepoint
+{
+
+/** @brief Constructor */
+PrivateKeyPool::PrivateKeyPool()
+    : m_mutex(),
+      m_cond(),
+      m_thread(nullptr),
+      m_end(false),
+      m_size(0),
+      m_type(PrivateKey::Type::EC),
+      m_param(0),
+      m_passphrase(),
+      m_generation(0),
+      m_keys()
+{
+}
+
+/** @brief Destructor */
+PrivateKeyPool::~PrivateKeyPool()
+{
+    if (m_thread)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_end = true;
+            m_cond.notify_one();
+        }
+        m_thread->join();
+        delete m_thread;
+    }
+}
+
+/** @brief Configure the keys to generate and start their generation */
+void PrivateKeyPool::configure(unsigned int size, ocpp::x509::PrivateKey::Type type, unsigned int param, const std::string& passphrase)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Discard the keys generated with other parameters
+    if ((type != m_type) || (param != m_param) || (passphrase != m_passphrase))
+    {
+        m_keys = std::queue<std::unique_ptr<PrivateKey>>();
+        m_generation++;
+    }
+    while (m_keys.size() > size)
+    {
+        m_keys.pop();
+    }
+    m_size       = size;
+    m_type       = type;
+    m_param      = param;
+    m_passphrase = passphrase;
+
+    // Start generation
+    if ((m_size != 0) && !m_thread)
+    {
+        m_thread = new std::thread(std::bind(&PrivateKeyPool::process, this));
+    }
+    m_cond.notify_one();
+}
+
+/** @brief Get a private key */
+std::unique_ptr<ocpp::x509::PrivateKey> PrivateKeyPool::get(ocpp::x509::PrivateKey::Type type,
+                                                            unsigned int                 param,
+                                                            const std::string&           passphrase)
+{
+    std::unique_ptr<PrivateKey> ret;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if ((type == m_type) && (param == m_param) && (passphrase == m_passphrase) && !m_keys.empty())
+        {
+            // Use a ready key and generate a new one in background
+            ret = std::move(m_keys.front());
+            m_keys.pop();
+            m_cond.notify_one();
+        }
+    }
+    if (!ret)
+    {
+        // No ready key, generate it now
+        LOG_DEBUG << "No private key ready, generating a new one";
+        ret = std::make_unique<PrivateKey>(type, param, passphrase);
+    }
+
+    return ret;
+}
+
+/** @brief Get the number of keys which are ready */
+size_t PrivateKeyPool::available() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_keys.size();
+}
+
+/** @brief Generation thread */
+void PrivateKeyPool::process()
+{
+#ifndef _MSC_VER
+    // Key generation must not compete with the stack threads
+    // (on Linux the priority applies to the calling thread only)
+    if (setpriority(PRIO_PROCESS, 0, 19) != 0)
+    {
+        LOG_WARNING << "Unable to lower the priority of the private key generation thread";
+    }
+#endif // _MSC_VER
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_end)
+    {
+        if (m_keys.size() < m_size)
+        {
+            // Generate a key without holding the lock
+            PrivateKey::Type type       = m_type;
+            unsigned int     param      = m_param;
+            std::string      passphrase = m_passphrase;
+            unsigned int     generation = m_generation;
+            lock.unlock();
+            auto key = std::make_unique<PrivateKey>(type, param, passphrase);
+            lock.lock();
+
+            if (!key->isValid())
+            {
+                // Stop the generation until the next configuration
+                LOG_ERROR << "Unable to generate a private key for the pool";
+                if (generation == m_generation)
+                {
+                    m_size = 0;
+                }
+            }
+            else if ((generation == m_generation) && (m_keys.size() < m_size))
+            {
+                // Keys generated before a configuration change are discarded
+                m_keys.push(std::move(key));
+                LOG_DEBUG << "Private key ready, " << m_keys.size() << "/" << m_size << " key(s) in the pool";
+            }
+        }
+        else
+        {
+            m_cond.wait(lock);
+        }
+    }
+}
+
+} // namespace chargepoint
+} // namespace ocpp
@@ -0,0 +1,100 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPENOCPP_PRIVATEKEYPOOL_H
+#define OPENOCPP_PRIVATEKEYPOOL_H
+
+#include "PrivateKey.h"
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+namespace ocpp
+{
+namespace chargepoint
+{
+
+/** @brief Pool of private keys generated in advance by a low priority background thread */
+class PrivateKeyPool
+{
+  public:
+    /** @brief Constructor */
+    PrivateKeyPool();
+    /** @brief Destructor */
+    virtual ~PrivateKeyPool();
+
+    /**
+     * @brief Configure the keys to generate and start their generation
+     *        (keys generated with other parameters are discarded)
+     * @param size Number of keys to keep ready (0 = disable the pool)
+     * @param type Type of key
+     * @param param Generation parameter (see PrivateKey constructor)
+     * @param passphrase Passphrase to encrypt the key in PEM format (empty = no encryption)
+     */
+    void configure(unsigned int size, ocpp::x509::PrivateKey::Type type, unsigned int param, const std::string& passphrase);
+
+    /**
+     * @brief Get a private key : a ready key is returned if it has been generated with the same parameters,
+     *        otherwise a new key is generated immediately
+     *        Each key is returned only once
+     * @param type Type of key
+     * @param param Generation parameter (see PrivateKey constructor)
+     * @param passphrase Passphrase to encrypt the key in PEM format (empty = no encryption)
+     * @return Private key
+     */
+    std::unique_ptr<ocpp::x509::PrivateKey> get(ocpp::x509::PrivateKey::Type type, unsigned int param, const std::string& passphrase);
+
+    /**
+     * @brief Get the number of keys which are ready
+     * @return Number of keys which are ready
+     */
+    size_t available() const;
+
+  private:
+    /** @brief Mutex to protect the pool */
+    mutable std::mutex m_mutex;
+    /** @brief Condition variable to wakeup the generation thread */
+    std::condition_variable m_cond;
+    /** @brief Generation thread */
+    std::thread* m_thread;
+    /** @brief Indicate the end of processing to the generation thread */
+    bool m_end;
+    /** @brief Number of keys to keep ready */
+    unsigned int m_size;
+    /** @brief Type of the keys */
+    ocpp::x509::PrivateKey::Type m_type;
+    /** @brief Generation parameter of the keys */
+    unsigned int m_param;
+    /** @brief Passphrase of the keys */
+    std::string m_passphrase;
+    /** @brief Configuration generation, incremented on each configuration change */
+    unsigned int m_generation;
+    /** @brief Ready keys */
+    std::queue<std::unique_ptr<ocpp::x509::PrivateKey>> m_keys;
+
+    /** @brief Generation thread */
+    void process();
+};
+
+} // namespace chargepoint
+} // namespace ocpp
+
+#endif // OPENOCPP_PRIVATEKEYPOOL_H
@@ -18,12 +18,14 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 
 #include "SecurityLogsDatabase.h"
 #include "IChargePointConfig.h"
+#include "ExportFile.h"
 #include "Logger.h"
 
-#include <fstream>
+#include <limits>
 #include <sstream>
 
 using namespace ocpp::database;
+using namespace ocpp::helpers;
 using namespace ocpp::types;
 
 namespace ocpp
@@ -33,7 +35,7 @@ namespace chargepoint
 
 /** @brief Constructor */
 SecurityLogsDatabase::SecurityLogsDatabase(const ocpp::config::IChargePointConfig& stack_config, ocpp::database::Database& database)
-    : m_stack_config(stack_config), m_database(database), m_clear_query(), m_insert_query()
+    : m_stack_config(stack_config), m_database(database), m_clear_query(), m_insert_query(), m_export_query()
 {
 }
 
@@ -87,59 +89,63 @@ bool SecurityLogsDatabase::exportSecurityEvents(const std::string&
 {
     bool ret = false;
 
-    // Create export file
-    std::fstream export_file(filepath, std::fstream::out);
-    if (export_file.is_open())
+    if (m_export_query)
     {
-        // Create export request
-        std::stringstream select_query;
-        select_query << "SELECT * FROM SecurityLogs WHERE ";
-        if (start_time.isSet() && stop_time.isSet())
+        // Create export file
+        ExportFile export_file(filepath, ExportFile::compression(m_stack_config.securityLogExportCompression()));
+        if (export_file.isOpen())
         {
-            select_query << "timestamp >= " << start_time.value().timestamp() << " AND ";
-            select_query << "timestamp <= " << stop_time.value().timestamp() << ";";
-        }
-        else if (start_time.isSet())
-        {
-            select_query << "timestamp >= " << start_time.value().timestamp() << ";";
-        }
-        else if (stop_time.isSet())
-        {
-            select_query << "timestamp <= " << stop_time.value().timestamp() << ";";
-        }
-        else
-        {
-            select_query << "TRUE;";
-        }
-        auto query = m_database.query(select_query.str());
-        if (query && query->exec())
-        {
-            // Header
-            export_file << "Timestamp,Type,Message" << std::endl;
-
-            // Logs
-            if (query->hasRows())
+            // Select the time range, the bounds are always given so that the timestamp index is used
+            int64_t start_timestamp = std::numeric_limits<int64_t>::min();
+            if (start_time.isSet())
             {
-                do
-                {
-                    time_t      timestamp = query->getInt64(1);
-                    std::string type      = query->getString(2);
-                    std::string message   = query->getString(3);
-                    export_file << timestamp << "," << type << "," << message << std::endl;
-                } while (query->next());
+                start_timestamp = static_cast<int64_t>(start_time.value().timestamp());
             }
+            int64_t stop_timestamp = std::numeric_limits<int64_t>::max();
+            if (stop_time.isSet())
+            {
+                stop_timestamp = static_cast<int64_t>(stop_time.value().timestamp());
+            }
+            m_export_query->bind(0, start_timestamp);
+            m_export_query->bind(1, stop_timestamp);
+            if (m_export_query->exec())
+            {
+                // Header
+                export_file.write("Timestamp,Type,Message\n");
 
-            ret = true;
+                // Logs
+                if (m_export_query->hasRows())
+                {
+                    std::string line;
+                    do
+                    {
+                        line = std::to_string(m_export_query->getInt64(0));
+                        line += ",";
+                        line += m_export_query->getString(1);
+                        line += ",";
+                        line += m_export_query->getString(2);
+                        line += "\n";
+                        export_file.write(line);
+                    } while (m_export_query->next());
+                }
+
+                ret = export_file.close();
+                if (!ret)
+                {
+                    LOG_ERROR << "Unable to write export file : " << filepath;
+                }
+            }
+            else
+            {
+                LOG_ERROR << "Unable to retrieve logs : " << m_export_query->lastError();
+            }
+            m_export_query->reset();
         }
         else
         {
-            LOG_ERROR << "Unable to retrieve logs : " << (query ? query->lastError() : m_database.lastError());
+            LOG_ERROR << "Unable to create export file : " << filepath;
         }
     }
-    else
-    {
-        LOG_ERROR << "Unable to create export file : " << filepath;
-    }
 
     return ret;
 }
@@ -164,6 +170,14 @@ void SecurityLogsDatabase::initDatabaseTable()
                 LOG_ERROR << "Could not create security logs table  : " << query->lastError();
             }
         }
+        query = m_database.query("CREATE INDEX IF NOT EXISTS SecurityLogs_timestamp ON SecurityLogs([timestamp]);");
+        if (query.get())
+        {
+            if (!query->exec())
+            {
+                LOG_ERROR << "Could not create security logs index  : " << query->lastError();
+            }
+        }
         std::stringstream trigger_query;
         trigger_query << "CREATE TRIGGER delete_oldest_SecurityLogs AFTER INSERT ON SecurityLogs WHEN "
                          " ((SELECT count() FROM SecurityLogs) > ";
@@ -182,12 +196,15 @@ void SecurityLogsDatabase::initDatabaseTable()
         // Create parametrized queries
         m_clear_query  = m_database.query("DELETE FROM SecurityLogs WHERE TRUE;");
         m_insert_query = m_database.query("INSERT INTO SecurityLogs VALUES (NULL, ?, ?, ?, ?);");
+        m_export_query =
+            m_database.query("SELECT [timestamp], [type], [message] FROM SecurityLogs WHERE [timestamp] >= ? AND [timestamp] <= ?;");
     }
     else
     {
         // Disable logging
         m_clear_query.reset();
         m_insert_query.reset();
+        m_export_query.reset();
     }
 }
 
@@ -71,6 +71,7 @@ class SecurityLogsDatabase
 
     /**
      * @brief Export security events into a file
+     *        (compressed according to the SecurityLogExportCompression configuration)
      * @param filepath Path of the log file to generated
      * @param start_time If set, contains the date and time of the oldest logging information to
      *                   include in the log file
@@ -92,6 +93,8 @@ class SecurityLogsDatabase
     std::unique_ptr<ocpp::database::Database::Query> m_clear_query;
     /** @brief Query to insert a security log */
     std::unique_ptr<ocpp::database::Database::Query> m_insert_query;
+    /** @brief Query to export the security logs of a time range */
+    std::unique_ptr<ocpp::database::Database::Query> m_export_query;
 };
 
 } // namespace chargepoint
@@ -103,6 +103,7 @@ SecurityManager::SecurityManager(const ocpp::config::IChargePointConfig&
       m_security_logs_db(stack_config, database),
       m_ca_certificates_db(stack_config, database),
       m_cp_certificates_db(stack_config, database),
+      m_key_pool(),
       m_msg_sender(nullptr)
 {
 }
@@ -152,6 +153,18 @@ bool SecurityManager::start(ocpp::messages::GenericMessageSender& msg_sender,
             "SecurityProfile",
             std::bind(&SecurityManager::checkSecurityProfileParameter, this, std::placeholders::_1, std::placeholders::_2));
 
+        // Prepare the private keys of the next certificate requests
+        if (m_stack_config.internalCertificateManagementEnabled())
+        {
+            PrivateKey::Type key_type;
+            unsigned int     param;
+            getCertificateRequestKeyParameters(key_type, param);
+            m_key_pool.configure(m_stack_config.clientCertificateRequestKeyPoolSize(),
+                                 key_type,
+                                 param,
+                                 m_stack_config.tlsClientCertificatePrivateKeyPassphrase());
+        }
+
         ret = true;
     }
 
@@ -216,33 +229,12 @@ bool SecurityManager::generateCertificateRequest()
 {
     LOG_INFO << "Generating new certificate request";
 
-    // Generate a private key
-    unsigned int     param    = 0;
-    PrivateKey::Type key_type = PrivateKey::Type::EC;
-    if (m_stack_config.clientCertificateRequestKeyType() == "rsa")
-    {
-        key_type = PrivateKey::Type::RSA;
-        param    = m_stack_config.clientCertificateRequestRsaKeyLength();
-        if (param < 2048u)
-        {
-            param = 2048u;
-        }
-    }
-    else
-    {
-        std::string curve      = m_stack_config.clientCertificateRequestEcCurve();
-        const auto& iter_curve = s_ec_curves.find(curve);
-        if (iter_curve != s_ec_curves.end())
-        {
-            param = iter_curve->second;
-        }
-        else
-        {
-            param = s_ec_curves.at("prime256v1");
-        }
-    }
-    std::string passphrase = m_stack_config.tlsClientCertificatePrivateKeyPassphrase();
-    PrivateKey  private_key(key_type, param, passphrase);
+    // Get a private key, generated in advance if the pool is enabled
+    PrivateKey::Type key_type;
+    unsigned int     param;
+    getCertificateRequestKeyParameters(key_type, param);
+    std::unique_ptr<PrivateKey> key         = m_key_pool.get(key_type, param, m_stack_config.tlsClientCertificatePrivateKeyPassphrase());
+    const PrivateKey&           private_key = *key;
 
     // Generate a certificate request
     CertificateRequest::Subject subject;
@@ -269,6 +261,34 @@ bool SecurityManager::generateCertificateRequest()
     return signCertificate(certificate_request);
 }
 
+/** @brief Get the parameters of the private keys for certificate request generation */
+void SecurityManager::getCertificateRequestKeyParameters(ocpp::x509::PrivateKey::Type& type, unsigned int& param) const
+{
+    if (m_stack_config.clientCertificateRequestKeyType() == "rsa")
+    {
+        type  = PrivateKey::Type::RSA;
+        param = m_stack_config.clientCertificateRequestRsaKeyLength();
+        if (param < 2048u)
+        {
+            param = 2048u;
+        }
+    }
+    else
+    {
+        type                   = PrivateKey::Type::EC;
+        std::string curve      = m_stack_config.clientCertificateRequestEcCurve();
+        const auto& iter_curve = s_ec_curves.find(curve);
+        if (iter_curve != s_ec_curves.end())
+        {
+            param = iter_curve->second;
+        }
+        else
+        {
+            param = s_ec_curves.at("prime256v1");
+        }
+    }
+}
+
 /** @brief Get the installed Charge Point certificate as PEM encoded data */
 std::string SecurityManager::getChargePointCertificate(std::string& private_key)
 {
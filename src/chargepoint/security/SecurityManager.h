@@ -29,6 +29,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "ISecurityManager.h"
 #include "ITriggerMessageManager.h"
 #include "InstallCertificate.h"
+#include "PrivateKeyPool.h"
 #include "SecurityLogsDatabase.h"
 
 namespace ocpp
@@ -200,6 +201,8 @@ class SecurityManager
     CaCertificatesDatabase m_ca_certificates_db;
     /** @brief CP certificates database */
     CpCertificatesDatabase m_cp_certificates_db;
+    /** @brief Pool of private keys for certificate request generation */
+    PrivateKeyPool m_key_pool;
 
     /** @brief Message sender */
     ocpp::messages::GenericMessageSender* m_msg_sender;
@@ -209,6 +212,9 @@ class SecurityManager
     /** @brief Specific configuration check for parameter : SecurityProfile */
     ocpp::types::ConfigurationStatus checkSecurityProfileParameter(const std::string& key, const std::string& value);
 
+    /** @brief Get the parameters of the private keys for certificate request generation */
+    void getCertificateRequestKeyParameters(ocpp::x509::PrivateKey::Type& type, unsigned int& param) const;
+
     /** @brief Fill the hash information of a certificat */
     void fillHashInfo(const ocpp::x509::Certificate& certificate, ocpp::types::CertificateHashDataType& info);
 };
@@ -0,0 +1,108 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "TlsSessionsDatabase.h"
+#include "Logger.h"
+
+namespace ocpp
+{
+namespace chargepoint
+{
+
+/** @brief Constructor */
+TlsSessionsDatabase::TlsSessionsDatabase(ocpp::database::Database& database)
+    : m_database(database), m_mutex(), m_find_query(), m_delete_query(), m_insert_query()
+{
+}
+
+/** @brief Destructor */
+TlsSessionsDatabase::~TlsSessionsDatabase() { }
+
+/** @brief Initialize the database table */
+void TlsSessionsDatabase::initDatabaseTable()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Create database
+    auto query = m_database.query("CREATE TABLE IF NOT EXISTS TlsSessions ("
+                                  "[tag] VARCHAR(256),"
+                                  "[session] BLOB,"
+                                  "PRIMARY KEY([tag]));");
+    if (query.get())
+    {
+        if (!query->exec())
+        {
+            LOG_ERROR << "Could not create TLS sessions table  : " << query->lastError();
+        }
+    }
+
+    // Create parametrized queries
+    m_find_query   = m_database.query("SELECT session FROM TlsSessions WHERE tag = ?;");
+    m_delete_query = m_database.query("DELETE FROM TlsSessions;");
+    m_insert_query = m_database.query("INSERT INTO TlsSessions VALUES (?, ?);");
+}
+
+/** @copydoc bool ITlsSessionStore::loadTlsSession(const std::string&, std::vector<uint8_t>&) */
+bool TlsSessionsDatabase::loadTlsSession(const std::string& key, std::vector<uint8_t>& session)
+{
+    bool ret = false;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_find_query)
+    {
+        // Look for the session
+        m_find_query->bind(0, key);
+        if (m_find_query->exec() && m_find_query->hasRows())
+        {
+            session = m_find_query->getBlob(0);
+            ret     = true;
+        }
+
+        // Reset query
+        m_find_query->reset();
+    }
+
+    return ret;
+}
+
+/** @copydoc void ITlsSessionStore::saveTlsSession(const std::string&, const std::vector<uint8_t>&) */
+void TlsSessionsDatabase::saveTlsSession(const std::string& key, const std::vector<uint8_t>& session)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_delete_query && m_insert_query)
+    {
+        // Only the session of the current server and credentials is kept
+        if (!m_delete_query->exec())
+        {
+            LOG_ERROR << "Could not delete the TLS sessions : " << m_delete_query->lastError();
+        }
+        m_delete_query->reset();
+
+        // Save session
+        m_insert_query->bind(0, key);
+        m_insert_query->bind(1, session);
+        if (!m_insert_query->exec())
+        {
+            LOG_ERROR << "Could not save the TLS session : " << m_insert_query->lastError();
+        }
+        m_insert_query->reset();
+    }
+}
+
+} // namespace chargepoint
+} // namespace ocpp
@@ -0,0 +1,71 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPENOCPP_TLSSESSIONSDATABASE_H
+#define OPENOCPP_TLSSESSIONSDATABASE_H
+
+#include "Database.h"
+#include "TlsSession.h"
+
+#include <memory>
+#include <mutex>
+
+namespace ocpp
+{
+namespace chargepoint
+{
+
+/** @brief Handle persistency of the TLS session of the connection to the Central System */
+class TlsSessionsDatabase : public ocpp::websockets::ITlsSessionStore
+{
+  public:
+    /** @brief Constructor */
+    TlsSessionsDatabase(ocpp::database::Database& database);
+
+    /** @brief Destructor */
+    virtual ~TlsSessionsDatabase();
+
+    /** @brief Initialize the database table */
+    void initDatabaseTable();
+
+    // ITlsSessionStore interface
+
+    /** @copydoc bool ITlsSessionStore::loadTlsSession(const std::string&, std::vector<uint8_t>&) */
+    bool loadTlsSession(const std::string& key, std::vector<uint8_t>& session) override;
+
+    /** @copydoc void ITlsSessionStore::saveTlsSession(const std::string&, const std::vector<uint8_t>&) */
+    void saveTlsSession(const std::string& key, const std::vector<uint8_t>& session) override;
+
+  private:
+    /** @brief Charge point's database */
+    ocpp::database::Database& m_database;
+    /** @brief Mutex to protect the queries (sessions are saved from the websocket thread) */
+    std::mutex m_mutex;
+
+    /** @brief Query to look for a session */
+    std::unique_ptr<ocpp::database::Database::Query> m_find_query;
+    /** @brief Query to delete the sessions */
+    std::unique_ptr<ocpp::database::Database::Query> m_delete_query;
+    /** @brief Query to insert a session */
+    std::unique_ptr<ocpp::database::Database::Query> m_insert_query;
+};
+
+} // namespace chargepoint
+} // namespace ocpp
+
+#endif // OPENOCPP_TLSSESSIONSDATABASE_H
@@ -47,6 +47,23 @@ class ISmartChargingManager
                              ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& connector_setpoint,
                              ocpp::types::ChargingRateUnitType                          unit = ocpp::types::ChargingRateUnitType::A) = 0;
 
+    /**
+     * @brief Get the smart charging setpoints for a connector and the whole charge point
+     *        along with the next point in time where they may change
+     * @param connector_id Id of the connector
+     * @param charge_point_setpoint Setpoint of the whole charge point (not set if no active profile)
+     * @param connector_setpoint Setpoint of the given connector (not set if no active profile)
+     * @param next_change Point in time until which the setpoints are guaranteed to stay the same
+     *                    unless the charging profiles or the transaction of the connector change
+     * @param unit Setpoint unit (A or W)
+     * @return true if the setpoints have been computed, false otherwise
+     */
+    virtual bool getSetpoint(unsigned int                                               connector_id,
+                             ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& charge_point_setpoint,
+                             ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& connector_setpoint,
+                             ocpp::types::DateTime&                                     next_change,
+                             ocpp::types::ChargingRateUnitType                          unit = ocpp::types::ChargingRateUnitType::A) = 0;
+
     /**
      * @brief Install a TxProfile charging profile on a connector
      * @param connector_id Id of the connector targeted by the charging profile
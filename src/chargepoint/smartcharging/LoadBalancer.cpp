@@ -0,0 +1,275 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "LoadBalancer.h"
+
+#include <algorithm>
+
+using namespace ocpp::types;
+
+namespace ocpp
+{
+namespace chargepoint
+{
+
+/** @brief Tolerance on the currents in A */
+static constexpr float CURRENT_TOLERANCE = 0.001f;
+
+/** @brief Constructor */
+LoadBalancer::LoadBalancer() : m_policy(LoadBalancingPolicy::None), m_total_current(0.f), m_connectors(), m_allocations() { }
+
+/** @brief Destructor */
+LoadBalancer::~LoadBalancer() { }
+
+/** @brief Get the policy corresponding to its name in the configuration */
+LoadBalancingPolicy LoadBalancer::parsePolicy(const std::string& policy)
+{
+    LoadBalancingPolicy ret = LoadBalancingPolicy::None;
+    if (policy == "proportional")
+    {
+        ret = LoadBalancingPolicy::Proportional;
+    }
+    else if (policy == "priority")
+    {
+        ret = LoadBalancingPolicy::Priority;
+    }
+    else if (policy == "minrate")
+    {
+        ret = LoadBalancingPolicy::MinRate;
+    }
+    else
+    {
+        // No load balancing
+    }
+    return ret;
+}
+
+/** @brief Set the load balancing policy */
+void LoadBalancer::setPolicy(LoadBalancingPolicy policy)
+{
+    m_policy      = policy;
+    m_allocations = allocate();
+}
+
+/** @brief Update the charge point setpoint and the state of the connectors */
+bool LoadBalancer::update(float total_current, const std::vector<ConnectorState>& connectors)
+{
+    bool ret = false;
+
+    // Only compute if an input has changed
+    if ((total_current != m_total_current) || (connectors != m_connectors))
+    {
+        m_total_current = total_current;
+        m_connectors    = connectors;
+
+        std::vector<Optional<float>> allocations = allocate();
+        if (allocations.size() != m_allocations.size())
+        {
+            ret = true;
+        }
+        else
+        {
+            for (size_t i = 0; (i < allocations.size()) && !ret; i++)
+            {
+                ret = ((allocations[i].isSet() != m_allocations[i].isSet()) ||
+                       (allocations[i].isSet() && (allocations[i].value() != m_allocations[i].value())));
+            }
+        }
+        m_allocations = std::move(allocations);
+    }
+
+    return ret;
+}
+
+/** @brief Reset the allocations */
+void LoadBalancer::clear()
+{
+    m_total_current = 0.f;
+    m_connectors.clear();
+    m_allocations.clear();
+}
+
+/** @brief Compute the allocations with the current policy */
+std::vector<ocpp::types::Optional<float>> LoadBalancer::allocate() const
+{
+    std::vector<Optional<float>> allocations(m_connectors.size());
+    if (m_policy != LoadBalancingPolicy::None)
+    {
+        std::vector<size_t> active = activeConnectors();
+        std::vector<float>  allocated(active.size(), 0.f);
+        float               total = std::max(m_total_current, 0.f);
+        switch (m_policy)
+        {
+            case LoadBalancingPolicy::Proportional:
+            {
+                // Connectors which are not consuming yet are weighted with an equal share of the setpoint
+                // (or their minimum charging rate if greater) so that they can start drawing current
+                std::vector<float> weights(active.size(), 0.f);
+                bool               no_weight   = true;
+                float              start_share = (active.empty() ? 0.f : (total / static_cast<float>(active.size())));
+                for (size_t i = 0; i < active.size(); i++)
+                {
+                    const ConnectorState& connector = m_connectors[active[i]];
+                    if (connector.consumption > CURRENT_TOLERANCE)
+                    {
+                        weights[i] = std::max(connector.consumption, connector.min_current);
+                    }
+                    else
+                    {
+                        weights[i] = std::max(start_share, connector.min_current);
+                    }
+                    if (weights[i] > CURRENT_TOLERANCE)
+                    {
+                        no_weight = false;
+                    }
+                }
+                if (no_weight)
+                {
+                    // Equal sharing
+                    std::fill(weights.begin(), weights.end(), 1.f);
+                }
+                share(total, active, weights, allocated);
+            }
+            break;
+
+            case LoadBalancingPolicy::Priority:
+            {
+                // Serve the connectors in order
+                for (size_t i = 0; i < active.size(); i++)
+                {
+                    allocated[i] = std::min(std::max(m_connectors[active[i]].max_current, 0.f), total);
+                    total -= allocated[i];
+                }
+            }
+            break;
+
+            case LoadBalancingPolicy::MinRate:
+            {
+                // Guarantee the minimum charging rate in priority order,
+                // the connectors which cannot get it are not served
+                std::vector<float> weights(active.size(), 0.f);
+                for (size_t i = 0; i < active.size(); i++)
+                {
+                    const ConnectorState& connector   = m_connectors[active[i]];
+                    float                 min_current = std::min(std::max(connector.min_current, 0.f), connector.max_current);
+                    if (min_current <= (total + CURRENT_TOLERANCE))
+                    {
+                        allocated[i] = min_current;
+                        weights[i]   = 1.f;
+                        total        = std::max(total - min_current, 0.f);
+                    }
+                }
+
+                // Share equally the remaining current between the served connectors
+                share(total, active, weights, allocated);
+            }
+            break;
+
+            case LoadBalancingPolicy::None:
+            // Intended fallthrough
+            default:
+                break;
+        }
+
+        for (size_t i = 0; i < active.size(); i++)
+        {
+            allocations[active[i]] = allocated[i];
+        }
+    }
+    return allocations;
+}
+
+/** @brief Get the active connectors ordered by priority */
+std::vector<size_t> LoadBalancer::activeConnectors() const
+{
+    std::vector<size_t> active;
+    for (size_t i = 0; i < m_connectors.size(); i++)
+    {
+        if (m_connectors[i].active)
+        {
+            active.push_back(i);
+        }
+    }
+    std::stable_sort(active.begin(),
+                     active.end(),
+                     [this](size_t lhs, size_t rhs) { return (m_connectors[lhs].priority < m_connectors[rhs].priority); });
+    return active;
+}
+
+/** @brief Share a current between connectors according to their weights without exceeding their maximum */
+void LoadBalancer::share(float                      current,
+                         const std::vector<size_t>& connectors,
+                         std::vector<float>&        weights,
+                         std::vector<float>&        allocated) const
+{
+    // Connectors which can receive current
+    std::vector<size_t> open;
+    for (size_t i = 0; i < connectors.size(); i++)
+    {
+        if ((weights[i] > 0.f) && ((m_connectors[connectors[i]].max_current - allocated[i]) > CURRENT_TOLERANCE))
+        {
+            open.push_back(i);
+        }
+    }
+
+    // Water filling : the connectors reaching their maximum are saturated
+    // and the remaining current is shared again between the other ones
+    float remaining = current;
+    while ((remaining > CURRENT_TOLERANCE) && !open.empty())
+    {
+        float total_weight = 0.f;
+        for (size_t i : open)
+        {
+            total_weight += weights[i];
+        }
+
+        std::vector<size_t> still_open;
+        float               saturated_current = 0.f;
+        for (size_t i : open)
+        {
+            float room = m_connectors[connectors[i]].max_current - allocated[i];
+            if ((remaining * weights[i] / total_weight) >= room)
+            {
+                allocated[i] += room;
+                saturated_current += room;
+            }
+            else
+            {
+                still_open.push_back(i);
+            }
+        }
+        if (saturated_current > 0.f)
+        {
+            // Share again the remaining current
+            remaining -= saturated_current;
+            open = std::move(still_open);
+        }
+        else
+        {
+            // No saturation, final sharing
+            for (size_t i : open)
+            {
+                allocated[i] += remaining * weights[i] / total_weight;
+            }
+            remaining = 0.f;
+        }
+    }
+}
+
+} // namespace chargepoint
+} // namespace ocpp
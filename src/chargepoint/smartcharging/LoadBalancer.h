@@ -0,0 +1,138 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPENOCPP_LOADBALANCER_H
+#define OPENOCPP_LOADBALANCER_H
+
+#include "Optional.h"
+
+#include <ctime>
+#include <string>
+#include <vector>
+
+namespace ocpp
+{
+namespace chargepoint
+{
+
+/** @brief Policies to share the charge point setpoint between the connectors */
+enum class LoadBalancingPolicy
+{
+    /** @brief No local load balancing */
+    None,
+    /** @brief Share the setpoint in proportion of the measured consumption of the connectors
+     *         (connectors which are not consuming yet start with an equal share) */
+    Proportional,
+    /** @brief Serve the connectors in the order of the start of their transactions */
+    Priority,
+    /** @brief Share the setpoint equally while guaranteeing the minimum charging rate of the served connectors */
+    MinRate
+};
+
+/** @brief Share the charge point setpoint between the connectors with an active transaction */
+class LoadBalancer
+{
+  public:
+    /** @brief State of a connector */
+    struct ConnectorState
+    {
+        /** @brief Indicate if the connector has a transaction in progress */
+        bool active;
+        /** @brief Measured current in A */
+        float consumption;
+        /** @brief Minimum current in A which can be allocated (0 if none) */
+        float min_current;
+        /** @brief Maximum current in A which can be allocated */
+        float max_current;
+        /** @brief Priority of the connector, lower is higher (start of the transaction) */
+        std::time_t priority;
+
+        /** @brief Comparison operator */
+        bool operator==(const ConnectorState& state) const
+        {
+            return ((active == state.active) && (consumption == state.consumption) && (min_current == state.min_current) &&
+                    (max_current == state.max_current) && (priority == state.priority));
+        }
+    };
+
+    /** @brief Constructor */
+    LoadBalancer();
+    /** @brief Destructor */
+    virtual ~LoadBalancer();
+
+    /**
+     * @brief Get the policy corresponding to its name in the configuration
+     * @param policy Name of the policy : none, proportional, priority or minrate
+     * @return Corresponding policy (None if unknown)
+     */
+    static LoadBalancingPolicy parsePolicy(const std::string& policy);
+
+    /**
+     * @brief Set the load balancing policy
+     * @param policy Load balancing policy
+     */
+    void setPolicy(LoadBalancingPolicy policy);
+
+    /**
+     * @brief Get the load balancing policy
+     * @return Load balancing policy
+     */
+    LoadBalancingPolicy policy() const { return m_policy; }
+
+    /**
+     * @brief Update the charge point setpoint and the state of the connectors,
+     *        the allocations are only computed again if one of them has changed
+     * @param total_current Setpoint of the whole charge point in A
+     * @param connectors State of the connectors indexed by connector id
+     * @return true if the allocations have changed, false otherwise
+     */
+    bool update(float total_current, const std::vector<ConnectorState>& connectors);
+
+    /** @brief Reset the allocations */
+    void clear();
+
+    /**
+     * @brief Get the current allocated to each connector
+     * @return Allocated current in A indexed by connector id (not set if the connector is not active)
+     */
+    const std::vector<ocpp::types::Optional<float>>& allocations() const { return m_allocations; }
+
+  private:
+    /** @brief Load balancing policy */
+    LoadBalancingPolicy m_policy;
+    /** @brief Setpoint of the whole charge point used for the last computation */
+    float m_total_current;
+    /** @brief Connectors states used for the last computation */
+    std::vector<ConnectorState> m_connectors;
+    /** @brief Current allocated to each connector */
+    std::vector<ocpp::types::Optional<float>> m_allocations;
+
+    /** @brief Compute the allocations with the current policy */
+    std::vector<ocpp::types::Optional<float>> allocate() const;
+
+    /** @brief Get the active connectors ordered by priority */
+    std::vector<size_t> activeConnectors() const;
+
+    /** @brief Share a current between connectors according to their weights without exceeding their maximum */
+    void share(float current, const std::vector<size_t>& connectors, std::vector<float>& weights, std::vector<float>& allocated) const;
+};
+
+} // namespace chargepoint
+} // namespace ocpp
+
+#endif // OPENOCPP_LOADBALANCER_H
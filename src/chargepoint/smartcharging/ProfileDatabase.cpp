@@ -23,6 +23,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "IOcppConfig.h"
 
 #include <algorithm>
+#include <limits>
 #include <sstream>
 #include <vector>
 
@@ -43,7 +44,9 @@ ProfileDatabase::ProfileDatabase(ocpp::config::IOcppConfig& ocpp_config, ocpp::d
       m_insert_query(),
       m_chargepoint_max_profiles(),
       m_txdefault_profiles(),
-      m_tx_profiles()
+      m_tx_profiles(),
+      m_profiles_by_id(),
+      m_profiles_by_connector()
 {
     initDatabaseTable();
     load();
@@ -65,12 +68,14 @@ bool ProfileDatabase::clear(ocpp::types::Optional<int>
     if (!id.isSet() && !connector_id.isSet() && !purpose.isSet() && !level.isSet())
     {
         // Check existing profiles
-        if (!m_chargepoint_max_profiles.empty() || !m_txdefault_profiles.empty() || !m_tx_profiles.empty())
+        if (!m_profiles_by_id.empty())
         {
             // Clear lists
             m_chargepoint_max_profiles.clear();
             m_txdefault_profiles.clear();
             m_tx_profiles.clear();
+            m_profiles_by_id.clear();
+            m_profiles_by_connector.clear();
 
             // Clear database
             auto query = m_database.query("DELETE FROM ChargingProfiles WHERE TRUE;");
@@ -85,26 +90,10 @@ bool ProfileDatabase::clear(ocpp::types::Optional<int>
     else if (id.isSet())
     {
         // Clear selected profile only
-        for (ChargingProfileList* profiles_list : {&m_chargepoint_max_profiles, &m_txdefault_profiles, &m_tx_profiles})
+        if (m_profiles_by_id.find(id) != m_profiles_by_id.end())
         {
-            auto iter = std::find_if(profiles_list->begin(),
-                                     profiles_list->end(),
-                                     [&id](const ChargingProfileInfo& profile) { return (profile.second.chargingProfileId == id); });
-            if (iter != profiles_list->end())
-            {
-                // Erase from list
-                profiles_list->erase(iter);
-
-                // Erase from database
-                if (m_delete_query)
-                {
-                    m_delete_query->bind(0, id);
-                    m_delete_query->exec();
-                    m_delete_query->reset();
-                }
-                ret = true;
-                break;
-            }
+            eraseProfile(id);
+            ret = true;
         }
     }
     else
@@ -113,58 +102,74 @@ bool ProfileDatabase::clear(ocpp::types::Optional<int>
         std::vector<ChargingProfileList*> profiles_lists;
         if (purpose.isSet())
         {
-            switch (purpose)
-            {
-                case ChargingProfilePurposeType::ChargePointMaxProfile:
-                    profiles_lists.push_back(&m_chargepoint_max_profiles);
-                    break;
-
-                case ChargingProfilePurposeType::TxDefaultProfile:
-                    profiles_lists.push_back(&m_txdefault_profiles);
-                    break;
-
-                case ChargingProfilePurposeType::TxProfile:
-                // Intended fallthrough
-                default:
-                    profiles_lists.push_back(&m_tx_profiles);
-                    break;
-            }
+            profiles_lists.push_back(&profilesList(purpose));
         }
         else
         {
             profiles_lists = {&m_chargepoint_max_profiles, &m_txdefault_profiles, &m_tx_profiles};
         }
 
-        // Search into selected lists
-        for (ChargingProfileList* profiles_list : profiles_lists)
+        // Select profiles
+        std::vector<int> profiles_to_erase;
+        if (connector_id.isSet())
         {
-            // Select profiles
-            std::vector<ChargingProfileList::iterator> profiles_to_erase;
-            for (auto iter = profiles_list->begin(); iter != profiles_list->end(); iter++)
+            auto iter_connector = m_profiles_by_connector.find(connector_id);
+            if (iter_connector != m_profiles_by_connector.end())
             {
-                bool match_connector = (!connector_id.isSet() || (iter->first == connector_id));
-                bool match_level     = (!level.isSet() || (iter->second.stackLevel == level));
-                if (match_connector && match_level)
+                for (ChargingProfileList* profiles_list : profiles_lists)
                 {
-                    profiles_to_erase.push_back(iter);
-                    ret = true;
+                    if (level.isSet())
+                    {
+                        // Direct lookup of the stack level
+                        auto iter = profiles_list->find(ChargingProfileKey{level, connector_id});
+                        if (iter != profiles_list->end())
+                        {
+                            profiles_to_erase.push_back(iter->second.chargingProfileId);
+                        }
+                    }
+                    else
+                    {
+                        // All the profiles of the connector
+                        for (int profile_id : iter_connector->second)
+                        {
+                            if (m_profiles_by_id[profile_id].profiles_list == profiles_list)
+                            {
+                                profiles_to_erase.push_back(profile_id);
+                            }
+                        }
+                    }
                 }
             }
-
-            // Erase profiles
-            for (auto& iter : profiles_to_erase)
+        }
+        else
+        {
+            for (ChargingProfileList* profiles_list : profiles_lists)
             {
-                // Erase in database
-                if (m_delete_query)
+                auto first = profiles_list->begin();
+                auto last  = profiles_list->end();
+                if (level.isSet())
+                {
+                    // All the profiles of the stack level
+                    first = profiles_list->lower_bound(ChargingProfileKey{level, std::numeric_limits<unsigned int>::max()});
+                    last  = profiles_list->upper_bound(ChargingProfileKey{level, 0});
+                }
+                for (auto iter = first; iter != last; ++iter)
                 {
-                    m_delete_query->bind(0, iter->second.chargingProfileId);
-                    m_delete_query->exec();
-                    m_delete_query->reset();
+                    profiles_to_erase.push_back(iter->second.chargingProfileId);
                 }
+            }
+        }
 
-                // Erase in list
-                profiles_list->erase(iter);
+        // Erase profiles
+        if (!profiles_to_erase.empty())
+        {
+            m_database.beginTransaction();
+            for (int profile_id : profiles_to_erase)
+            {
+                eraseProfile(profile_id);
             }
+            m_database.commitTransaction();
+            ret = true;
         }
     }
 
@@ -174,109 +179,43 @@ bool ProfileDatabase::clear(ocpp::types::Optional<int>
 /** @brief Install a charging profile */
 bool ProfileDatabase::install(unsigned int connector_id, const ocpp::types::ChargingProfile& profile)
 {
-    bool ret = false;
-
-    // Get the profiles list
-    ChargingProfileList* profiles_list;
-    switch (profile.chargingProfilePurpose)
-    {
-        case ChargingProfilePurposeType::ChargePointMaxProfile:
-        {
-            profiles_list = &m_chargepoint_max_profiles;
-        }
-        break;
-
-        case ChargingProfilePurposeType::TxDefaultProfile:
-        {
-            profiles_list = &m_txdefault_profiles;
-        }
-        break;
-
-        case ChargingProfilePurposeType::TxProfile:
-        // Intended fallthrough
-        default:
-        {
-            profiles_list = &m_tx_profiles;
-        }
-        break;
-    }
-
-    // Check if a profile with the same connector and stack level exists
-    auto iter_profile =
-        std::find_if(profiles_list->begin(),
-                     profiles_list->end(),
-                     [connector_id, &profile](const ChargingProfileInfo& profile_info)
-                     { return ((profile_info.first == connector_id) && (profile_info.second.stackLevel == profile.stackLevel)); });
-    if (iter_profile != profiles_list->end())
-    {
-        // Erase existing profile
-        if (m_delete_query)
-        {
-            m_delete_query->bind(0, iter_profile->second.chargingProfileId);
-            m_delete_query->exec();
-            m_delete_query->reset();
-        }
-        profiles_list->erase(iter_profile);
-    }
-
-    // Check maximum number of installed profiles
-    size_t installed_profiles_count = m_chargepoint_max_profiles.size() + m_txdefault_profiles.size() + m_tx_profiles.size();
-    if (installed_profiles_count < m_ocpp_config.maxChargingProfilesInstalled())
-    {
-        // Insert into list
-        profiles_list->insert({connector_id, profile});
-
-        // Insert into database
-        if (m_insert_query)
-        {
-            // Serialize profile
-            std::string profile_str = serialize(profile);
-
-            // Insert
-            m_insert_query->bind(0, profile.chargingProfileId);
-            m_insert_query->bind(1, connector_id);
-            m_insert_query->bind(2, profile_str);
-            m_insert_query->exec();
-            m_insert_query->reset();
-        }
-
-        ret = true;
-    }
-
+    m_database.beginTransaction();
+    bool ret = installProfile(connector_id, profile);
+    m_database.commitTransaction();
     return ret;
 }
 
 /** @brief Assign the pending TxProfile of a connector to a transaction */
 void ProfileDatabase::assignPendingTxProfiles(unsigned int connector_id, int transaction_id)
 {
-    std::vector<int> profiles_to_remove;
-
     // Look for pending profiles
+    std::vector<ChargingProfileInfo> pending_profiles;
     for (const auto& profile : m_tx_profiles)
     {
         if (((profile.first == Connectors::CONNECTOR_ID_CHARGE_POINT) || (profile.first == connector_id)) &&
             !profile.second.transactionId.isSet())
+        {
+            pending_profiles.push_back(profile);
+        }
+    }
+
+    if (!pending_profiles.empty())
+    {
+        m_database.beginTransaction();
+        for (auto& profile : pending_profiles)
         {
             // If no connector set, remove the profile completly
             // so that it won't be used again
             if (profile.first == Connectors::CONNECTOR_ID_CHARGE_POINT)
             {
-                profiles_to_remove.push_back(profile.second.chargingProfileId);
+                eraseProfile(profile.second.chargingProfileId);
             }
 
-            // Assign transaction to a new profile
-            ChargingProfile assigned_profile = profile.second;
-            assigned_profile.transactionId   = transaction_id;
-
-            // Replace existing with assigned profile
-            install(connector_id, assigned_profile);
+            // Assign transaction to the profile and replace the existing one
+            profile.second.transactionId = transaction_id;
+            installProfile(connector_id, profile.second);
         }
-    }
-
-    // Remove profiles
-    for (int profile_id : profiles_to_remove)
-    {
-        clear(profile_id);
+        m_database.commitTransaction();
     }
 }
 
@@ -296,14 +235,15 @@ void ProfileDatabase::initDatabaseTable()
 
     // Create parametrized queries
     m_delete_query = m_database.query("DELETE FROM ChargingProfiles WHERE id=?;");
-    m_insert_query = m_database.query("INSERT INTO ChargingProfiles VALUES (?, ?, ?);");
+    m_insert_query = m_database.query("INSERT OR REPLACE INTO ChargingProfiles VALUES (?, ?, ?);");
 }
 
 /** @brief Load profiles from the database */
 void ProfileDatabase::load()
 {
     // Query all stored profiles
-    auto query = m_database.query("SELECT * FROM ChargingProfiles WHERE TRUE;");
+    std::vector<int> invalid_profiles;
+    auto             query = m_database.query("SELECT * FROM ChargingProfiles WHERE TRUE;");
     if (query.get())
     {
         if (query->exec() && query->hasRows())
@@ -318,35 +258,148 @@ void ProfileDatabase::load()
                 // Deserialize profile
                 ChargingProfileInfo profile;
                 profile.first = connector;
-                if (deserialize(profile_str, profile.second) && (profile.second.chargingProfileId == id))
+                if (!deserialize(profile_str, profile.second) || (profile.second.chargingProfileId != id) ||
+                    !insertProfile(profilesList(profile.second.chargingProfilePurpose), profile))
                 {
-                    // Add the profile to the corresponding list
-                    switch (profile.second.chargingProfilePurpose)
-                    {
-                        case ChargingProfilePurposeType::ChargePointMaxProfile:
-                        {
-                            m_chargepoint_max_profiles.insert(profile);
-                        }
-                        break;
-
-                        case ChargingProfilePurposeType::TxDefaultProfile:
-                        {
-                            m_txdefault_profiles.insert(profile);
-                        }
-                        break;
-
-                        case ChargingProfilePurposeType::TxProfile:
-                        // Intended fallthrough
-                        default:
-                        {
-                            m_tx_profiles.insert(profile);
-                        }
-                        break;
-                    }
+                    // Invalid or duplicate profile
+                    invalid_profiles.push_back(id);
                 }
             } while (query->next());
         }
     }
+
+    // Remove invalid profiles from the database
+    if (m_delete_query)
+    {
+        for (int id : invalid_profiles)
+        {
+            m_delete_query->bind(0, id);
+            m_delete_query->exec();
+            m_delete_query->reset();
+        }
+    }
+}
+
+/** @brief Get the stack corresponding to a charging profile purpose */
+ProfileDatabase::ChargingProfileList& ProfileDatabase::profilesList(ocpp::types::ChargingProfilePurposeType purpose)
+{
+    ChargingProfileList* profiles_list;
+    switch (purpose)
+    {
+        case ChargingProfilePurposeType::ChargePointMaxProfile:
+        {
+            profiles_list = &m_chargepoint_max_profiles;
+        }
+        break;
+
+        case ChargingProfilePurposeType::TxDefaultProfile:
+        {
+            profiles_list = &m_txdefault_profiles;
+        }
+        break;
+
+        case ChargingProfilePurposeType::TxProfile:
+        // Intended fallthrough
+        default:
+        {
+            profiles_list = &m_tx_profiles;
+        }
+        break;
+    }
+    return *profiles_list;
+}
+
+/** @brief Insert a profile into a stack and its indexes */
+bool ProfileDatabase::insertProfile(ChargingProfileList& profiles_list, const ChargingProfileInfo& profile_info)
+{
+    bool ret = false;
+
+    // Profile ids are unique
+    int id = profile_info.second.chargingProfileId;
+    if (m_profiles_by_id.find(id) == m_profiles_by_id.end())
+    {
+        auto result = profiles_list.insert(profile_info);
+        if (result.second)
+        {
+            m_profiles_by_id[id] = {&profiles_list, result.first};
+            m_profiles_by_connector[profile_info.first].insert(id);
+            ret = true;
+        }
+    }
+
+    return ret;
+}
+
+/** @brief Remove a profile from its stack, its indexes and the database */
+void ProfileDatabase::eraseProfile(int id)
+{
+    auto iter = m_profiles_by_id.find(id);
+    if (iter != m_profiles_by_id.end())
+    {
+        // Erase from indexes
+        unsigned int connector_id   = iter->second.profile->first;
+        auto         iter_connector = m_profiles_by_connector.find(connector_id);
+        if (iter_connector != m_profiles_by_connector.end())
+        {
+            iter_connector->second.erase(id);
+            if (iter_connector->second.empty())
+            {
+                m_profiles_by_connector.erase(iter_connector);
+            }
+        }
+
+        // Erase from list
+        iter->second.profiles_list->erase(iter->second.profile);
+        m_profiles_by_id.erase(iter);
+
+        // Erase from database
+        if (m_delete_query)
+        {
+            m_delete_query->bind(0, id);
+            m_delete_query->exec();
+            m_delete_query->reset();
+        }
+    }
+}
+
+/** @brief Install a charging profile (must be called inside a transaction) */
+bool ProfileDatabase::installProfile(unsigned int connector_id, const ocpp::types::ChargingProfile& profile)
+{
+    bool ret = false;
+
+    // Get the profiles list
+    ChargingProfileList& profiles_list = profilesList(profile.chargingProfilePurpose);
+
+    // Replace the profile with the same id or the same connector and stack level
+    eraseProfile(profile.chargingProfileId);
+    auto iter_profile = profiles_list.find(ChargingProfileKey{profile.stackLevel, connector_id});
+    if (iter_profile != profiles_list.end())
+    {
+        eraseProfile(iter_profile->second.chargingProfileId);
+    }
+
+    // Check maximum number of installed profiles
+    if (m_profiles_by_id.size() < m_ocpp_config.maxChargingProfilesInstalled())
+    {
+        // Insert into list
+        ret = insertProfile(profiles_list, {connector_id, profile});
+
+        // Insert into database
+        if (ret && m_insert_query)
+        {
+            // Serialize profile
+            std::string profile_str = serialize(profile);
+
+            // Insert
+            m_insert_query->bind(0, profile.chargingProfileId);
+            m_insert_query->bind(1, connector_id);
+            m_insert_query->bind(2, profile_str);
+            m_insert_query->exec();
+            m_insert_query->reset();
+        }
+    }
+
+    return ret;
 }
 
 /** @brief Serialize a profile to a string */
@@ -24,6 +24,8 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 
 #include <memory>
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace ocpp
 {
@@ -51,16 +53,39 @@ class ProfileDatabase
 
     /** @brief Stores a profile alongside its target connector */
     typedef std::pair<unsigned int, ocpp::types::ChargingProfile> ChargingProfileInfo;
-    /** @brief Allow sorting of profiles by stack level and connector id*/
+    /** @brief Position of a profile in a stack : stack level and connector id */
+    struct ChargingProfileKey
+    {
+        /** @brief Stack level */
+        unsigned int stack_level;
+        /** @brief Connector id */
+        unsigned int connector_id;
+    };
+    /** @brief Allow sorting of profiles by decreasing stack level then decreasing connector id */
     struct ChargingProfileInfoLess
     {
+        /** @brief Allow lookups with a ChargingProfileKey */
+        typedef void is_transparent;
+
         bool operator()(const ChargingProfileInfo& lhs, const ChargingProfileInfo& rhs) const
         {
-            return ((lhs.second.stackLevel > rhs.second.stackLevel) || (lhs.first > rhs.first));
+            return less(lhs.second.stackLevel, lhs.first, rhs.second.stackLevel, rhs.first);
+        }
+        bool operator()(const ChargingProfileInfo& lhs, const ChargingProfileKey& rhs) const
+        {
+            return less(lhs.second.stackLevel, lhs.first, rhs.stack_level, rhs.connector_id);
+        }
+        bool operator()(const ChargingProfileKey& lhs, const ChargingProfileInfo& rhs) const
+        {
+            return less(lhs.stack_level, lhs.connector_id, rhs.second.stackLevel, rhs.first);
+        }
+        static bool less(unsigned int lhs_level, unsigned int lhs_connector, unsigned int rhs_level, unsigned int rhs_connector)
+        {
+            return ((lhs_level > rhs_level) || ((lhs_level == rhs_level) && (lhs_connector > rhs_connector)));
         }
     };
-    /** @brief List of charging profiles stored by stack level */
-    typedef std::multiset<ChargingProfileInfo, ChargingProfileInfoLess> ChargingProfileList;
+    /** @brief List of charging profiles stored by stack level (only 1 profile per stack level and connector) */
+    typedef std::set<ChargingProfileInfo, ChargingProfileInfoLess> ChargingProfileList;
 
     /**
      * @brief Clear one or multiple charging profiles with match criteria
@@ -109,7 +134,7 @@ class ProfileDatabase
 
     /** @brief Query to delete a profile */
     std::unique_ptr<ocpp::database::Database::Query> m_delete_query;
-    /** @brief Query to insert a profile */
+    /** @brief Query to insert or replace a profile */
     std::unique_ptr<ocpp::database::Database::Query> m_insert_query;
 
     /** @brief ChargePointMaxProfile stack */
@@ -119,12 +144,35 @@ class ProfileDatabase
     /** @brief TxProfile stack */
     ChargingProfileList m_tx_profiles;
 
+    /** @brief Location of a profile in the stacks */
+    struct ProfileLocation
+    {
+        /** @brief Stack of the profile */
+        ChargingProfileList* profiles_list;
+        /** @brief Profile in the stack */
+        ChargingProfileList::iterator profile;
+    };
+    /** @brief Profiles indexed by id */
+    std::unordered_map<int, ProfileLocation> m_profiles_by_id;
+    /** @brief Ids of the profiles indexed by connector id */
+    std::unordered_map<unsigned int, std::unordered_set<int>> m_profiles_by_connector;
+
     /** @brief Initialize the database table */
     void initDatabaseTable();
 
     /** @brief Load profiles from the database */
     void load();
 
+    /** @brief Get the stack corresponding to a charging profile purpose */
+    ChargingProfileList& profilesList(ocpp::types::ChargingProfilePurposeType purpose);
+
+    /** @brief Insert a profile into a stack and its indexes */
+    bool insertProfile(ChargingProfileList& profiles_list, const ChargingProfileInfo& profile_info);
+    /** @brief Remove a profile from its stack, its indexes and the database */
+    void eraseProfile(int id);
+    /** @brief Install a charging profile (must be called inside a transaction) */
+    bool installProfile(unsigned int connector_id, const ocpp::types::ChargingProfile& profile);
+
     /** @brief Serialize a profile to a string */
     std::string serialize(const ocpp::types::ChargingProfile& profile);
     /** @brief Deserialize a profile from a string */
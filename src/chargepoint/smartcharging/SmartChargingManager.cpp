@@ -26,6 +26,8 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "WorkerThreadPool.h"
 
 #include <algorithm>
+#include <limits>
+#include <map>
 
 using namespace ocpp::types;
 using namespace ocpp::messages;
@@ -55,7 +57,14 @@ SmartChargingManager::SmartChargingManager(const ocpp::config::IChargePointConfi
       m_connectors(connectors),
       m_profile_db(ocpp_config, database),
       m_mutex(),
-      m_cleanup_timer(timer_pool, "Profile cleanup")
+      m_cleanup_timer(timer_pool, "Profile cleanup"),
+      m_timelines(connectors.getCount() + 1u),
+      m_notify_mutex(),
+      m_notify_timer(timer_pool, "Setpoint notification"),
+      m_notified_setpoints(connectors.getCount() + 1u),
+      m_load_balancer(),
+      m_allocations(),
+      m_balancing_timer(timer_pool, "Load balancing")
 {
     msg_dispatcher.registerHandler(CLEAR_CHARGING_PROFILE_ACTION,
                                    *dynamic_cast<GenericMessageHandler<ClearChargingProfileReq, ClearChargingProfileConf>*>(this));
@@ -67,6 +76,18 @@ SmartChargingManager::SmartChargingManager(const ocpp::config::IChargePointConfi
     // Periodic timer to cleanup profiles
     m_cleanup_timer.setCallback([this] { this->m_worker_pool.run<void>(std::bind(&SmartChargingManager::cleanupProfiles, this)); });
     m_cleanup_timer.start(std::chrono::minutes(1u));
+
+    // Single shot timer to notify the setpoint changes on the next period boundary
+    m_notify_timer.setCallback([this] { this->m_worker_pool.run<void>(std::bind(&SmartChargingManager::notifySetpoints, this)); });
+
+    // Periodic timer to refresh the consumption of the connectors for the local load balancing
+    m_load_balancer.setPolicy(LoadBalancer::parsePolicy(m_stack_config.loadBalancingPolicy()));
+    if ((m_load_balancer.policy() != LoadBalancingPolicy::None) && (m_stack_config.loadBalancingInterval() != std::chrono::milliseconds(0)))
+    {
+        m_balancing_timer.setCallback([this] { this->m_worker_pool.run<void>(std::bind(&SmartChargingManager::notifySetpoints, this)); });
+        m_balancing_timer.start(m_stack_config.loadBalancingInterval());
+    }
+
     cleanupProfiles();
 }
 
@@ -82,35 +103,75 @@ bool SmartChargingManager::getSetpoint(unsigned int
                                        ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& connector_setpoint,
                                        ocpp::types::ChargingRateUnitType                          unit)
 {
-    bool ret = false;
+    DateTime next_change;
+    return getSetpoint(connector_id, charge_point_setpoint, connector_setpoint, next_change, unit);
+}
 
-    // Lock profiles
-    std::lock_guard<std::mutex> lock(m_mutex);
+/** @copydoc bool ISmartChargingManager::getSetpoint(unsigned int,
+                                                     ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>&,
+                                                     ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>&,
+                                                     ocpp::types::DateTime&,
+                                                     ocpp::types::ChargingRateUnitType) */
+bool SmartChargingManager::getSetpoint(unsigned int                                               connector_id,
+                                       ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& charge_point_setpoint,
+                                       ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& connector_setpoint,
+                                       ocpp::types::DateTime&                                     next_change,
+                                       ocpp::types::ChargingRateUnitType                          unit)
+{
+    bool ret = lookupSetpoint(connector_id, charge_point_setpoint, connector_setpoint, next_change, unit);
+    if (ret)
+    {
+        applyAllocation(connector_id, charge_point_setpoint, connector_setpoint, unit);
+    }
+    return ret;
+}
+
+/** @brief Get the setpoints of a connector from its compiled timeline */
+bool SmartChargingManager::lookupSetpoint(unsigned int                                               connector_id,
+                                          ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& charge_point_setpoint,
+                                          ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& connector_setpoint,
+                                          ocpp::types::DateTime&                                     next_change,
+                                          ocpp::types::ChargingRateUnitType                          unit)
+{
+    bool ret = false;
 
     // Check connector
     Connector* connector = m_connectors.getConnector(connector_id);
-    if (connector)
+    if (connector && (connector_id < m_timelines.size()))
     {
+        // All the profiles are evaluated at the same time point
+        time_t now = DateTime::now().timestamp();
+
+        // Get the compiled timeline of the connector
+        std::shared_ptr<const SetpointTimeline> timeline = std::atomic_load(&m_timelines[connector_id]);
+        if (!timeline || (now < timeline->segments.front().start) || (now >= timeline->end) ||
+            (timeline->transaction_id != connector->transaction_id) || (timeline->transaction_start != connector->transaction_start))
+        {
+            // Timeline is outdated, compile a new one
+            std::lock_guard<std::mutex> lock(m_mutex);
+            timeline = compileTimeline(connector, now);
+            std::atomic_store(&m_timelines[connector_id], timeline);
+        }
+
+        // Look for the segment containing the current time point
+        auto segment = std::upper_bound(timeline->segments.begin(),
+                                        timeline->segments.end(),
+                                        now,
+                                        [](time_t time_point, const TimelineSegment& seg) { return (time_point < seg.start); });
+        segment--;
+
         // Compute charge point setpoint
         charge_point_setpoint.clear();
-        for (const auto& profile : m_profile_db.chargePointMaxProfiles())
+        if (segment->charge_point.isSet())
         {
-            // Check if the profile is active
-            size_t period = 0;
-            if (isProfileActive(connector, profile.second, period, DateTime::now()))
-            {
-                // Apply setpoint
-                fillSetpoint(charge_point_setpoint, unit, profile.second, profile.second.chargingSchedule.chargingSchedulePeriod[period]);
-                break;
-            }
+            fillSetpoint(charge_point_setpoint, unit, segment->charge_point);
         }
 
         // Compute connector setpoint
         connector_setpoint.clear();
-        computeSetpoint(connector, connector_setpoint, unit, m_profile_db.txProfiles());
-        if (!connector_setpoint.isSet())
+        if (segment->connector.isSet())
         {
-            computeSetpoint(connector, connector_setpoint, unit, m_profile_db.txDefaultProfiles());
+            fillSetpoint(connector_setpoint, unit, segment->connector);
         }
 
         // Connector setpoint cannot be greater than charge point setpoint
@@ -123,12 +184,61 @@ bool SmartChargingManager::getSetpoint(unsigned int
             }
         }
 
+        // Next change
+        segment++;
+        if (segment != timeline->segments.end())
+        {
+            next_change = segment->start;
+        }
+        else
+        {
+            next_change = timeline->end;
+        }
+
         ret = true;
     }
 
     return ret;
 }
 
+/** @brief Limit the connector setpoint to the current allocated by the load balancer */
+void SmartChargingManager::applyAllocation(unsigned int                                                     connector_id,
+                                           const ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& charge_point_setpoint,
+                                           ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>&       connector_setpoint,
+                                           ocpp::types::ChargingRateUnitType                                unit)
+{
+    auto allocations = std::atomic_load(&m_allocations);
+    if (allocations && (connector_id < allocations->size()) && (*allocations)[connector_id].isSet())
+    {
+        // Convert the allocated current to the requested unit
+        unsigned int number_phases = 3u;
+        if (connector_setpoint.isSet())
+        {
+            number_phases = connector_setpoint.value().number_phases;
+        }
+        else if (charge_point_setpoint.isSet())
+        {
+            number_phases = charge_point_setpoint.value().number_phases;
+        }
+        float allocation = (*allocations)[connector_id];
+        if (unit != ChargingRateUnitType::A)
+        {
+            allocation = convertToUnit(allocation, unit, number_phases);
+        }
+
+        // Connector setpoint cannot be greater than its allocation
+        if (!connector_setpoint.isSet())
+        {
+            connector_setpoint.value().number_phases = number_phases;
+            connector_setpoint.value().value         = allocation;
+        }
+        else if (allocation < connector_setpoint.value().value)
+        {
+            connector_setpoint.value().value = allocation;
+        }
+    }
+}
+
 /** @copydoc bool ISmartChargingManager::installTxProfile(unsigned int, const ocpp::types::ChargingProfile&) */
 bool SmartChargingManager::installTxProfile(unsigned int connector_id, const ocpp::types::ChargingProfile& profile)
 {
@@ -144,6 +254,10 @@ bool SmartChargingManager::installTxProfile(unsigned int connector_id, const ocp
     {
         // Install profile
         ret = m_profile_db.install(connector_id, profile);
+        if (ret)
+        {
+            compileTimelines();
+        }
     }
 
     return ret;
@@ -159,6 +273,7 @@ void SmartChargingManager::assignPendingTxProfiles(unsigned int connector_id, in
 
     // Assign profile
     m_profile_db.assignPendingTxProfiles(connector_id, transaction_id);
+    compileTimelines();
 }
 
 /** @copydoc void ISmartChargingManager::clearTxProfiles(unsigned int) */
@@ -171,6 +286,7 @@ void SmartChargingManager::clearTxProfiles(unsigned int connector_id)
 
     // Clear Tx profiles
     m_profile_db.clear(Optional<int>(), connector_id, ChargingProfilePurposeType::TxProfile);
+    compileTimelines();
 }
 
 /** @copydoc bool GenericMessageHandler<RequestType, ResponseType>::handleMessage(const RequestType& request,
@@ -199,6 +315,7 @@ bool SmartChargingManager::handleMessage(const ocpp::messages::ClearChargingProf
     // Clear profiles
     if (m_profile_db.clear(request.id, request.connectorId, request.chargingProfilePurpose, request.stackLevel))
     {
+        compileTimelines();
         response.status = ClearChargingProfileStatus::Accepted;
     }
     else
@@ -307,7 +424,11 @@ bool SmartChargingManager::handleMessage(const ocpp::messages::SetChargingProfil
                         {
                             // Install profile
                             ret = m_profile_db.install(request.connectorId, request.csChargingProfiles);
-                            if (!ret)
+                            if (ret)
+                            {
+                                compileTimelines();
+                            }
+                            else
                             {
                                 error_message = "Number of charging profiles exceeds MaxChargingProfilesInstalled";
                             }
@@ -406,10 +527,9 @@ bool SmartChargingManager::handleMessage(const ocpp::messages::GetCompositeSched
         }
         profile_lists.push_back(&m_profile_db.txDefaultProfiles());
 
-        // Compute periods
-        std::vector<Period> periods;
-        bool                error = false;
-        DateTime            now   = DateTime::now();
+        // Get the periods of the applicable profiles by decreasing priority
+        std::vector<std::vector<Period>> profiles_periods;
+        DateTime                         now = DateTime::now();
         for (auto& profile_list : profile_lists)
         {
             unsigned int stack_level = std::numeric_limits<unsigned int>::max();
@@ -420,26 +540,22 @@ bool SmartChargingManager::handleMessage(const ocpp::messages::GetCompositeSched
                 if ((profile.first == request.connectorId) || ((profile.first == 0u) && (stack_level != profile.second.stackLevel)))
                 {
                     std::vector<Period> profile_periods = getProfilePeriods(connector, profile.second, now, request.duration);
-                    periods                             = mergeProfilePeriods(periods, profile_periods);
-                    stack_level                         = profile.second.stackLevel;
-                    if (periods.empty())
+                    if (!profile_periods.empty())
                     {
-                        error = true;
+                        profiles_periods.emplace_back(std::move(profile_periods));
                     }
+                    stack_level = profile.second.stackLevel;
                 }
             }
-            if (error)
-            {
-                break;
-            }
         }
-        if (periods.empty())
+        if (profiles_periods.empty())
         {
             LOG_INFO << "No charging profiles for the requested period";
         }
 
         // Get local limitations
-        ChargingProfile local_profile;
+        std::vector<Period> local_periods;
+        ChargingProfile     local_profile;
         local_profile.chargingProfileId      = 0;
         local_profile.chargingProfileKind    = ChargingProfileKindType::Absolute;
         local_profile.chargingProfilePurpose = ChargingProfilePurposeType::TxDefaultProfile;
@@ -452,15 +568,16 @@ bool SmartChargingManager::handleMessage(const ocpp::messages::GetCompositeSched
             local_profile.chargingSchedule.startSchedule = now;
             local_profile.chargingSchedule.duration      = static_cast<int>(request.duration);
 
-            // Merge periods
-            std::vector<Period> local_periods = getProfilePeriods(connector, local_profile, now, request.duration);
-            periods                           = mergeLocalPeriods(periods, local_periods);
+            local_periods = getProfilePeriods(connector, local_profile, now, request.duration);
         }
         else
         {
             LOG_INFO << "No local limitations for the requested period";
         }
 
+        // Merge periods
+        std::vector<Period> periods = computeCompositePeriods(profiles_periods, local_periods);
+
         // Create response
         if (!periods.empty())
         {
@@ -559,25 +676,332 @@ void SmartChargingManager::cleanupProfiles()
     {
         m_profile_db.clear(profile);
     }
+
+    // Slide the timelines
+    compileTimelines();
+}
+
+/** @brief Compile the setpoint timelines of all the connectors (must be called with the mutex locked) */
+void SmartChargingManager::compileTimelines()
+{
+    time_t now = DateTime::now().timestamp();
+    for (Connector* connector : m_connectors.getConnectors())
+    {
+        if (connector->id < m_timelines.size())
+        {
+            std::atomic_store(&m_timelines[connector->id], compileTimeline(connector, now));
+        }
+    }
+
+    // Notify the changes outside of the lock
+    m_worker_pool.run<void>(std::bind(&SmartChargingManager::notifySetpoints, this));
+}
+
+/** @brief Notify the setpoint changes and schedule the next notification */
+void SmartChargingManager::notifySetpoints()
+{
+    std::lock_guard<std::mutex> lock(m_notify_mutex);
+
+    // Update the allocations of the connectors
+    if (m_load_balancer.policy() != LoadBalancingPolicy::None)
+    {
+        balanceLoad();
+    }
+
+    // Check the setpoints of all the connectors
+    time_t next_change = std::numeric_limits<time_t>::max();
+    for (unsigned int connector_id = 0; connector_id < m_notified_setpoints.size(); connector_id++)
+    {
+        Optional<SmartChargingSetpoint> charge_point_setpoint;
+        Optional<SmartChargingSetpoint> connector_setpoint;
+        DateTime                        connector_next_change;
+        if (getSetpoint(connector_id, charge_point_setpoint, connector_setpoint, connector_next_change, ChargingRateUnitType::A))
+        {
+            auto& notified_setpoints = m_notified_setpoints[connector_id];
+            if (!isSameSetpoint(charge_point_setpoint, notified_setpoints.first) ||
+                !isSameSetpoint(connector_setpoint, notified_setpoints.second))
+            {
+                LOG_DEBUG << "Setpoint changed on connector " << connector_id;
+
+                notified_setpoints.first  = charge_point_setpoint;
+                notified_setpoints.second = connector_setpoint;
+                m_events_handler.setpointChanged(connector_id, charge_point_setpoint, connector_setpoint);
+            }
+            if (connector_next_change.timestamp() < next_change)
+            {
+                next_change = connector_next_change.timestamp();
+            }
+        }
+    }
+
+    // Wake up on the next change
+    if (next_change != std::numeric_limits<time_t>::max())
+    {
+        time_t now   = DateTime::now().timestamp();
+        time_t delay = 1;
+        if (next_change > now)
+        {
+            delay = next_change - now;
+        }
+        m_notify_timer.restart(std::chrono::seconds(delay), true);
+    }
+}
+
+/** @brief Share the charge point setpoint between the connectors (must be called with the notify mutex locked) */
+void SmartChargingManager::balanceLoad()
+{
+    bool changed = false;
+
+    // Setpoint of the whole charge point
+    Optional<SmartChargingSetpoint> charge_point_setpoint;
+    Optional<SmartChargingSetpoint> connector_setpoint;
+    DateTime                        next_change;
+    if (lookupSetpoint(0, charge_point_setpoint, connector_setpoint, next_change, ChargingRateUnitType::A) &&
+        charge_point_setpoint.isSet())
+    {
+        // State of the connectors
+        float                                     total_current = charge_point_setpoint.value().value;
+        std::vector<LoadBalancer::ConnectorState> states(m_connectors.getCount() + 1u);
+        for (Connector* connector : m_connectors.getConnectors())
+        {
+            if ((connector->id != 0) && (connector->id < states.size()) &&
+                lookupSetpoint(connector->id, charge_point_setpoint, connector_setpoint, next_change, ChargingRateUnitType::A))
+            {
+                LoadBalancer::ConnectorState& state = states[connector->id];
+                state.active                        = (connector->transaction_id != 0);
+                state.consumption                   = 0.f;
+                state.min_current                   = 0.f;
+                state.max_current                   = total_current;
+                state.priority                      = connector->transaction_start;
+                if (state.active)
+                {
+                    m_events_handler.getConnectorConsumption(connector->id, state.consumption);
+                }
+                if (connector_setpoint.isSet())
+                {
+                    state.max_current = connector_setpoint.value().value;
+                    if (connector_setpoint.value().min_charging_rate.isSet())
+                    {
+                        state.min_current = connector_setpoint.value().min_charging_rate;
+                    }
+                }
+            }
+        }
+
+        // Compute the allocations
+        changed = m_load_balancer.update(total_current, states);
+    }
+    else
+    {
+        // No setpoint to share
+        changed = !m_load_balancer.allocations().empty();
+        m_load_balancer.clear();
+    }
+    if (changed)
+    {
+        LOG_DEBUG << "Load balancing allocations changed";
+
+        std::atomic_store(&m_allocations, std::make_shared<const std::vector<Optional<float>>>(m_load_balancer.allocations()));
+    }
+}
+
+/** @brief Indicate if 2 setpoints are identical */
+bool SmartChargingManager::isSameSetpoint(const ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& setpoint1,
+                                          const ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& setpoint2)
+{
+    bool ret = false;
+    if (setpoint1.isSet() && setpoint2.isSet())
+    {
+        ret = (setpoint1.value() == setpoint2.value());
+    }
+    else
+    {
+        ret = (setpoint1.isSet() == setpoint2.isSet());
+    }
+    return ret;
+}
+
+/** @brief Compile the setpoint timeline of a connector (must be called with the mutex locked) */
+std::shared_ptr<const SmartChargingManager::SetpointTimeline> SmartChargingManager::compileTimeline(Connector* connector, time_t begin)
+{
+    auto timeline               = std::make_shared<SetpointTimeline>();
+    timeline->end               = begin + TIMELINE_HORIZON;
+    timeline->transaction_id    = connector->transaction_id;
+    timeline->transaction_start = connector->transaction_start;
+
+    // List the points in time where a setpoint may change
+    std::vector<time_t> breakpoints;
+    breakpoints.push_back(begin);
+    for (const auto& profile : m_profile_db.chargePointMaxProfiles())
+    {
+        addProfileBreakpoints(connector, profile.second, begin, timeline->end, breakpoints);
+    }
+    for (const auto profiles_list : {&m_profile_db.txProfiles(), &m_profile_db.txDefaultProfiles()})
+    {
+        for (const auto& profile : (*profiles_list))
+        {
+            if ((profile.first == connector->id) || (profile.first == 0))
+            {
+                addProfileBreakpoints(connector, profile.second, begin, timeline->end, breakpoints);
+            }
+        }
+    }
+    std::sort(breakpoints.begin(), breakpoints.end());
+    breakpoints.erase(std::unique(breakpoints.begin(), breakpoints.end()), breakpoints.end());
+
+    // Evaluate the profiles on each point in time, the setpoints are constant in between
+    for (time_t breakpoint : breakpoints)
+    {
+        if ((breakpoint >= begin) && (breakpoint < timeline->end))
+        {
+            TimelineSegment segment;
+            segment.start = breakpoint;
+
+            DateTime time_point(breakpoint);
+            computeSetpoint(connector, segment.charge_point, m_profile_db.chargePointMaxProfiles(), false, time_point);
+            computeSetpoint(connector, segment.connector, m_profile_db.txProfiles(), true, time_point);
+            if (!segment.connector.isSet())
+            {
+                computeSetpoint(connector, segment.connector, m_profile_db.txDefaultProfiles(), true, time_point);
+            }
+
+            // Merge with the previous segment if the setpoints are the same
+            if (timeline->segments.empty() || !isSameSetpoint(timeline->segments.back().charge_point, segment.charge_point) ||
+                !isSameSetpoint(timeline->segments.back().connector, segment.connector))
+            {
+                timeline->segments.push_back(segment);
+            }
+        }
+    }
+
+    return timeline;
 }
 
-/** @brief Compute the setpoint of a given connector with a profile list */
-void SmartChargingManager::computeSetpoint(Connector*                                                 connector,
-                                           ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& connector_setpoint,
-                                           ocpp::types::ChargingRateUnitType                          unit,
-                                           const ProfileDatabase::ChargingProfileList&                profiles_list)
+/** @brief Add the points in time where the setpoint of a charging profile may change */
+void SmartChargingManager::addProfileBreakpoints(Connector*                          connector,
+                                                 const ocpp::types::ChargingProfile& profile,
+                                                 time_t                              begin,
+                                                 time_t                              end,
+                                                 std::vector<time_t>&                breakpoints)
+{
+    // Validity
+    if (profile.validFrom.isSet())
+    {
+        breakpoints.push_back(profile.validFrom.value().timestamp());
+    }
+    if (profile.validTo.isSet())
+    {
+        breakpoints.push_back(profile.validTo.value().timestamp() + 1);
+    }
+
+    // Schedule
+    ChargingProfileKindType kind = getProfileKind(profile);
+    switch (kind)
+    {
+        case ChargingProfileKindType::Recurring:
+        {
+            // The start of a recurring schedule only changes with the local day,
+            // the day containing the end of the horizon is included so that the
+            // last recurrence starting inside the horizon is always taken into account
+            time_t day = begin;
+            while (day <= end)
+            {
+                std::tm tm_day;
+#ifdef _MSC_VER
+                localtime_s(&tm_day, &day);
+#else  // _MSC_VER
+                localtime_r(&day, &tm_day);
+#endif // _MSC_VER
+                tm_day.tm_hour  = 0;
+                tm_day.tm_min   = 0;
+                tm_day.tm_sec   = 0;
+                tm_day.tm_isdst = -1;
+                breakpoints.push_back(mktime(&tm_day));
+
+                DateTime start_of_schedule = getProfileStartTime(connector, profile, kind, DateTime(day));
+                addScheduleBreakpoints(profile.chargingSchedule, start_of_schedule.timestamp(), breakpoints);
+
+                // Next day
+                tm_day.tm_mday++;
+                tm_day.tm_isdst = -1;
+                time_t next_day = mktime(&tm_day);
+                if (next_day <= day)
+                {
+                    next_day = day + 86400; // 86400 = 3600 * 24 = Number of seconds in a day
+                }
+                day = next_day;
+            }
+        }
+        break;
+
+        case ChargingProfileKindType::Relative:
+        {
+            // Without transaction, the schedule starts on the evaluation time point
+            // so the setpoint is always the one of the first period
+            if (connector->transaction_id != 0)
+            {
+                addScheduleBreakpoints(profile.chargingSchedule, connector->transaction_start.timestamp(), breakpoints);
+            }
+        }
+        break;
+
+        case ChargingProfileKindType::Absolute:
+        // Intended fallthrough
+        default:
+        {
+            DateTime start_of_schedule = getProfileStartTime(connector, profile, kind, DateTime(begin));
+            addScheduleBreakpoints(profile.chargingSchedule, start_of_schedule.timestamp(), breakpoints);
+        }
+        break;
+    }
+}
+
+/** @brief Add the points in time where the setpoint of a charging schedule may change */
+void SmartChargingManager::addScheduleBreakpoints(const ocpp::types::ChargingSchedule& schedule,
+                                                  time_t                               start,
+                                                  std::vector<time_t>&                 breakpoints)
+{
+    breakpoints.push_back(start);
+    for (const auto& period : schedule.chargingSchedulePeriod)
+    {
+        breakpoints.push_back(start + period.startPeriod);
+    }
+    if (schedule.duration.isSet())
+    {
+        breakpoints.push_back(start + schedule.duration.value() + 1);
+    }
+}
+
+/** @brief Look for the setpoint of the highest applicable profile of a list */
+void SmartChargingManager::computeSetpoint(Connector*                                  connector,
+                                           ocpp::types::Optional<ProfileSetpoint>&     setpoint,
+                                           const ProfileDatabase::ChargingProfileList& profiles_list,
+                                           bool                                        check_connector,
+                                           const ocpp::types::DateTime&                time_point)
 {
     for (const auto& profile : profiles_list)
     {
         // Check connector
-        if ((profile.first == connector->id) || (profile.first == 0))
+        if (!check_connector || (profile.first == connector->id) || (profile.first == 0))
         {
             // Check if the profile is active
             size_t period = 0;
-            if (isProfileActive(connector, profile.second, period, DateTime::now()))
+            if (isProfileActive(connector, profile.second, period, time_point))
             {
-                // Apply setpoint
-                fillSetpoint(connector_setpoint, unit, profile.second, profile.second.chargingSchedule.chargingSchedulePeriod[period]);
+                // Extract setpoint
+                const ChargingSchedulePeriod& schedule_period = profile.second.chargingSchedule.chargingSchedulePeriod[period];
+                ProfileSetpoint&              value           = setpoint.value();
+                value.limit                                   = schedule_period.limit;
+                value.unit                                    = profile.second.chargingSchedule.chargingRateUnit;
+                value.min_charging_rate                       = profile.second.chargingSchedule.minChargingRate;
+                if (schedule_period.numberPhases.isSet())
+                {
+                    value.number_phases = schedule_period.numberPhases;
+                }
+                else
+                {
+                    value.number_phases = 3u; // Default, if not set is 3 phases charging
+                }
 
                 // Highest applicable profile found
                 break;
@@ -628,28 +1052,40 @@ bool SmartChargingManager::isProfileActive(Connector*                          c
     return ret;
 }
 
-/** @brief Fill a setpoint structure with a charging profile and a charging schedule period */
-void SmartChargingManager::fillSetpoint(ocpp::types::SmartChargingSetpoint&        setpoint,
-                                        ocpp::types::ChargingRateUnitType          unit,
-                                        const ocpp::types::ChargingProfile&        profile,
-                                        const ocpp::types::ChargingSchedulePeriod& period)
+/** @brief Indicate if 2 profile setpoints are identical */
+bool SmartChargingManager::isSameSetpoint(const ocpp::types::Optional<ProfileSetpoint>& setpoint1,
+                                          const ocpp::types::Optional<ProfileSetpoint>& setpoint2)
 {
-    setpoint.min_charging_rate = profile.chargingSchedule.minChargingRate;
-    if (period.numberPhases.isSet())
+    bool ret = false;
+    if (setpoint1.isSet() && setpoint2.isSet())
     {
-        setpoint.number_phases = period.numberPhases;
+        const ProfileSetpoint& value1 = setpoint1;
+        const ProfileSetpoint& value2 = setpoint2;
+        ret = (value1.limit == value2.limit) && (value1.unit == value2.unit) && (value1.number_phases == value2.number_phases) &&
+              (value1.min_charging_rate.isSet() == value2.min_charging_rate.isSet()) &&
+              (!value1.min_charging_rate.isSet() || (value1.min_charging_rate.value() == value2.min_charging_rate.value()));
     }
     else
     {
-        setpoint.number_phases = 3u; // Default, if not set is 3 phases charging
+        ret = (setpoint1.isSet() == setpoint2.isSet());
     }
-    if (profile.chargingSchedule.chargingRateUnit == unit)
+    return ret;
+}
+
+/** @brief Fill a setpoint structure with a profile setpoint */
+void SmartChargingManager::fillSetpoint(ocpp::types::SmartChargingSetpoint& setpoint,
+                                        ocpp::types::ChargingRateUnitType   unit,
+                                        const ProfileSetpoint&              profile_setpoint)
+{
+    setpoint.min_charging_rate = profile_setpoint.min_charging_rate;
+    setpoint.number_phases     = profile_setpoint.number_phases;
+    if (profile_setpoint.unit == unit)
     {
-        setpoint.value = period.limit;
+        setpoint.value = profile_setpoint.limit;
     }
     else
     {
-        setpoint.value = convertToUnit(period.limit, unit, setpoint.number_phases);
+        setpoint.value = convertToUnit(profile_setpoint.limit, unit, setpoint.number_phases);
         if (setpoint.min_charging_rate.isSet())
         {
             setpoint.min_charging_rate = convertToUnit(setpoint.min_charging_rate, unit, setpoint.number_phases);
@@ -890,249 +1326,116 @@ std::vector<SmartChargingManager::Period> SmartChargingManager::getProfilePeriod
     return periods;
 }
 
-/** @brief Merge charging profiles periods */
-std::vector<SmartChargingManager::Period> SmartChargingManager::mergeProfilePeriods(const std::vector<Period>& ref_periods,
-                                                                                    const std::vector<Period>& new_periods)
+/** @brief Compute the composite schedule periods from the periods of the applicable profiles and of the local limitations */
+std::vector<SmartChargingManager::Period> SmartChargingManager::computeCompositePeriods(
+    const std::vector<std::vector<Period>>& profiles_periods, const std::vector<Period>& local_periods)
 {
-    std::vector<Period> merged_periods;
-
-    // Check if a merge is needed
-    if (ref_periods.empty())
+    // Start or end of a period
+    struct Boundary
     {
-        merged_periods = new_periods;
-    }
-    else
+        /** @brief Point in time */
+        time_t time;
+        /** @brief Indicate if it is the start of the period */
+        bool start;
+        /** @brief Priority of the profile, lower is higher (local limitations have the lowest priority) */
+        size_t priority;
+        /** @brief Period */
+        const Period* period;
+    };
+
+    // List the boundaries of all the periods
+    std::vector<Boundary> boundaries;
+    const size_t          local_priority = profiles_periods.size();
+    for (size_t priority = 0; priority <= local_priority; priority++)
     {
-        bool   error            = false;
-        size_t ref_period_index = 0;
-        for (size_t i = 0; (i < new_periods.size()) && !error; i++)
+        const std::vector<Period>& layer_periods = ((priority == local_priority) ? local_periods : profiles_periods[priority]);
+        for (const Period& period : layer_periods)
         {
-            // Check if there are reference periods left
-            if (ref_period_index != ref_periods.size())
+            if (period.duration > 0)
             {
-                // Check if the new period is beginning before the reference period
-                if (new_periods[i].start < ref_periods[ref_period_index].start)
-                {
-                    if ((new_periods[i].start + new_periods[i].duration) < ref_periods[ref_period_index].start)
-                    {
-                        // The whole period is before the reference period
-                        merged_periods.push_back(new_periods[i]);
-                    }
-                    else
-                    {
-                        // A part of the period which overlapse the reference period
-                        Period p;
-                        p.start     = new_periods[i].start;
-                        p.duration  = ref_periods[ref_period_index].start - new_periods[i].start;
-                        p.setpoint  = new_periods[i].setpoint;
-                        p.unit      = new_periods[i].unit;
-                        p.nb_phases = new_periods[i].nb_phases;
-                        merged_periods.push_back(p);
-
-                        // Add all following consecutive reference periods
-                        const Period* previous = &p;
-                        while (ref_period_index != ref_periods.size())
-                        {
-                            const Period& ref_period = ref_periods[ref_period_index];
-                            if (ref_period.start == (previous->start + previous->duration))
-                            {
-                                merged_periods.push_back(ref_period);
-                                previous = &merged_periods.back();
-                                ref_period_index++;
-                            }
-                            else
-                            {
-                                // Non consecutive period
-                                error = true;
-                                break;
-                            }
-                        }
-
-                        // Check if the new period is still enabled
-                        if ((new_periods[i].start + new_periods[i].duration) > (previous->start + previous->duration))
-                        {
-                            // Restart computation for this period
-                            i--;
-                        }
-                    }
-                }
-                else
-                {
-                    // Add all following consecutive reference periods
-                    const Period* previous = nullptr;
-                    while (ref_period_index != ref_periods.size())
-                    {
-                        const Period& ref_period = ref_periods[ref_period_index];
-                        if (!previous || (ref_period.start == (previous->start + previous->duration)))
-                        {
-                            merged_periods.push_back(ref_period);
-                            previous = &merged_periods.back();
-                            ref_period_index++;
-                        }
-                        else
-                        {
-                            // Non consecutive period
-                            error = true;
-                            break;
-                        }
-                    }
-
-                    // Check if the new period is still enabled
-                    if (previous)
-                    {
-                        if ((new_periods[i].start + new_periods[i].duration) > (previous->start + previous->duration))
-                        {
-                            // Restart computation for this period
-                            i--;
-                        }
-                    }
-                }
-            }
-            else
-            {
-                // No more reference periods, add the new periods at the end
-                const Period* last_period = &merged_periods.back();
-                if (((new_periods[i].start + new_periods[i].duration) > (last_period->start + last_period->duration)) &&
-                    ((new_periods[i].start < last_period->start) || (new_periods[i].start < (last_period->start + last_period->duration))))
-                {
-                    // Add the susbset of period after the last period
-                    Period p;
-                    p.start     = last_period->start + last_period->duration;
-                    p.duration  = new_periods[i].duration - (p.start - new_periods[i].start);
-                    p.setpoint  = new_periods[i].setpoint;
-                    p.unit      = new_periods[i].unit;
-                    p.nb_phases = new_periods[i].nb_phases;
-                    merged_periods.push_back(p);
-                }
-                else
-                {
-                    // Add the whole period
-                    if (new_periods[i].start == (last_period->start + last_period->duration))
-                    {
-                        merged_periods.push_back(new_periods[i]);
-                    }
-                    else
-                    {
-                        if (new_periods[i].start > (last_period->start + last_period->duration))
-                        {
-                            // Non consecutive period
-                            error = true;
-                        }
-                    }
-                }
+                boundaries.push_back({period.start, true, priority, &period});
+                boundaries.push_back({period.start + period.duration, false, priority, &period});
             }
         }
-        if (error || (ref_period_index != ref_periods.size()))
-        {
-            LOG_WARNING << "Unable to compute the composite schedule due to non continuous profiles periods";
-            merged_periods.clear();
-        }
     }
 
-    return merged_periods;
-}
-
-/** @brief Merge local limitations periods */
-std::vector<SmartChargingManager::Period> SmartChargingManager::mergeLocalPeriods(const std::vector<Period>& profiles_periods,
-                                                                                  const std::vector<Period>& local_periods)
-{
-    std::vector<Period> merged_periods;
-
-    // Check if a merge is needed
-    if (profiles_periods.empty())
-    {
-        merged_periods = local_periods;
-    }
-    else
+    // Sort them in time, the end of a period comes before the start of the following one
+    std::sort(boundaries.begin(),
+              boundaries.end(),
+              [](const Boundary& lhs, const Boundary& rhs)
+              { return ((lhs.time < rhs.time) || ((lhs.time == rhs.time) && !lhs.start && rhs.start)); });
+
+    // Sweep the boundaries, at each point in time the highest priority profile period
+    // gives the setpoint which is then limited by the local limitation period if any
+    std::vector<Period>             periods;
+    std::map<size_t, const Period*> active_profiles;
+    const Period*                   active_local = nullptr;
+    bool                            error        = false;
+    size_t                          index        = 0;
+    while ((index < boundaries.size()) && !error)
     {
-        bool   offset                    = false;
-        time_t local_period_start        = 0;
-        time_t local_period_start_offset = 0;
-        size_t profiles_period_index     = 0;
-        for (size_t i = 0; i < local_periods.size(); i++)
+        // Apply all the boundaries at the current point in time
+        time_t time = boundaries[index].time;
+        while ((index < boundaries.size()) && (boundaries[index].time == time))
         {
-            // Compute start of current local period
-            if (offset)
+            const Boundary& boundary = boundaries[index];
+            if (boundary.priority == local_priority)
             {
-                offset = false;
+                active_local = (boundary.start ? boundary.period : nullptr);
+            }
+            else if (boundary.start)
+            {
+                active_profiles[boundary.priority] = boundary.period;
             }
             else
             {
-                local_period_start        = local_periods[i].start;
-                local_period_start_offset = 0;
+                active_profiles.erase(boundary.priority);
             }
+            index++;
+        }
 
-            time_t local_period_end = local_period_start + (local_periods[i].duration - local_period_start_offset);
-            // Check if there are profiles periods left
-            if (profiles_period_index != profiles_periods.size())
+        // Compute the period until the next boundary
+        if (index < boundaries.size())
+        {
+            Period p;
+            p.start    = time;
+            p.duration = boundaries[index].time - time;
+            if (!active_profiles.empty())
             {
-                if (local_period_end <= profiles_periods[profiles_period_index].start)
+                const Period& profile_period = *active_profiles.begin()->second;
+                if (active_local)
                 {
-                    // The whole period is before the profile period
-                    addMergedPeriod(local_periods[i], merged_periods);
-                }
-                else if (local_period_start >= profiles_periods[profiles_period_index].start)
-                {
-                    time_t profiles_period_end =
-                        profiles_periods[profiles_period_index].start + profiles_periods[profiles_period_index].duration;
-                    if (local_period_end <= profiles_period_end)
-                    {
-                        // The whole period is included inside the profile period
-                        Period p;
-                        p.start    = local_period_start;
-                        p.duration = local_periods[i].duration - local_period_start_offset;
-                        mergeSetpoint(profiles_periods[profiles_period_index], local_periods[i], p);
-                        addMergedPeriod(p, merged_periods);
-                    }
-                    else
-                    {
-                        // The period is across profile periods
-                        Period p;
-                        p.start    = local_period_start;
-                        p.duration = profiles_period_end - local_period_start;
-                        mergeSetpoint(profiles_periods[profiles_period_index], local_periods[i], p);
-                        addMergedPeriod(p, merged_periods);
-
-                        // Next profiles period but keep working on the same local period
-                        local_period_start        = p.start + p.duration;
-                        local_period_start_offset = local_period_start - local_periods[i].start;
-                        offset                    = true;
-                        profiles_period_index++;
-                        i--;
-                    }
+                    mergeSetpoint(profile_period, *active_local, p);
                 }
                 else
                 {
-                    // A part of the local period which overlapse the profile period
-                    Period p;
-                    p.start     = local_periods[i].start;
-                    p.duration  = profiles_periods[profiles_period_index].start - local_periods[i].start;
-                    p.setpoint  = local_periods[i].setpoint;
-                    p.unit      = local_periods[i].unit;
-                    p.nb_phases = local_periods[i].nb_phases;
-                    addMergedPeriod(p, merged_periods);
-
-                    // Keep working on the same local period
-                    local_period_start        = p.start + p.duration;
-                    local_period_start_offset = local_period_start - local_periods[i].start;
-                    offset                    = true;
-                    i--;
+                    p.setpoint  = profile_period.setpoint;
+                    p.unit      = profile_period.unit;
+                    p.nb_phases = profile_period.nb_phases;
                 }
+                addMergedPeriod(p, periods);
+            }
+            else if (active_local)
+            {
+                p.setpoint  = active_local->setpoint;
+                p.unit      = active_local->unit;
+                p.nb_phases = active_local->nb_phases;
+                addMergedPeriod(p, periods);
             }
             else
             {
-                // A local period without merge
-                Period p;
-                p.start     = local_period_start;
-                p.duration  = local_periods[i].duration - local_period_start_offset;
-                p.setpoint  = local_periods[i].setpoint;
-                p.unit      = local_periods[i].unit;
-                p.nb_phases = local_periods[i].nb_phases;
-                addMergedPeriod(p, merged_periods);
+                // Hole in the schedule
+                error = !periods.empty();
             }
         }
     }
-    return merged_periods;
+    if (error)
+    {
+        LOG_WARNING << "Unable to compute the composite schedule due to non continuous profiles periods";
+        periods = computeCompositePeriods(std::vector<std::vector<Period>>(), local_periods);
+    }
+
+    return periods;
 }
 
 /** @brief Merge the setpoint of a local limitation and a profile limitation */
@@ -26,9 +26,12 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "ISmartChargingManager.h"
 #include "ProfileDatabase.h"
 #include "SetChargingProfile.h"
+#include "LoadBalancer.h"
 #include "Timer.h"
 
+#include <memory>
 #include <mutex>
+#include <vector>
 
 namespace ocpp
 {
@@ -90,6 +93,17 @@ class SmartChargingManager
                      ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& connector_setpoint,
                      ocpp::types::ChargingRateUnitType                          unit) override;
 
+    /** @copydoc bool ISmartChargingManager::getSetpoint(unsigned int,
+                                                         ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>&,
+                                                         ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>&,
+                                                         ocpp::types::DateTime&,
+                                                         ocpp::types::ChargingRateUnitType) */
+    bool getSetpoint(unsigned int                                               connector_id,
+                     ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& charge_point_setpoint,
+                     ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& connector_setpoint,
+                     ocpp::types::DateTime&                                     next_change,
+                     ocpp::types::ChargingRateUnitType                          unit) override;
+
     /** @copydoc bool ISmartChargingManager::installTxProfile(unsigned int, const ocpp::types::ChargingProfile&) */
     bool installTxProfile(unsigned int connector_id, const ocpp::types::ChargingProfile& profile) override;
 
@@ -132,6 +146,46 @@ class SmartChargingManager
                        std::string&                                   error_message) override;
 
   private:
+    /** @brief Duration in seconds covered by a setpoint timeline */
+    static constexpr time_t TIMELINE_HORIZON = 86400;
+
+    /** @brief Setpoint of a charging profile period, in the unit of the profile */
+    struct ProfileSetpoint
+    {
+        /** @brief Limit */
+        float limit;
+        /** @brief Unit of the limit */
+        ocpp::types::ChargingRateUnitType unit;
+        /** @brief Number of phases */
+        unsigned int number_phases;
+        /** @brief Minimum charging rate */
+        ocpp::types::Optional<float> min_charging_rate;
+    };
+
+    /** @brief Part of a setpoint timeline where the setpoints are constant */
+    struct TimelineSegment
+    {
+        /** @brief Start of the segment */
+        time_t start;
+        /** @brief Setpoint of the whole charge point */
+        ocpp::types::Optional<ProfileSetpoint> charge_point;
+        /** @brief Setpoint of the connector */
+        ocpp::types::Optional<ProfileSetpoint> connector;
+    };
+
+    /** @brief Piecewise constant setpoints of a connector compiled from the installed profiles */
+    struct SetpointTimeline
+    {
+        /** @brief End of validity of the timeline */
+        time_t end;
+        /** @brief Transaction in progress on the connector when the timeline has been compiled */
+        int transaction_id;
+        /** @brief Start of the transaction in progress when the timeline has been compiled */
+        time_t transaction_start;
+        /** @brief Segments ordered by start time */
+        std::vector<TimelineSegment> segments;
+    };
+
     /** @brief Stack configuration */
     const ocpp::config::IChargePointConfig& m_stack_config;
     /** @brief Standard OCPP configuration */
@@ -150,6 +204,22 @@ class SmartChargingManager
     std::mutex m_mutex;
     /** @brief Profile cleanup timer */
     ocpp::helpers::Timer m_cleanup_timer;
+    /** @brief Setpoint timelines indexed by connector id (accessed with atomic operations) */
+    std::vector<std::shared_ptr<const SetpointTimeline>> m_timelines;
+    /** @brief Protect simultaneous setpoint notifications */
+    std::mutex m_notify_mutex;
+    /** @brief Setpoint change notification timer */
+    ocpp::helpers::Timer m_notify_timer;
+    /** @brief Last notified charge point and connector setpoints indexed by connector id */
+    std::vector<std::pair<ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>,
+                          ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>>>
+        m_notified_setpoints;
+    /** @brief Local load balancer */
+    LoadBalancer m_load_balancer;
+    /** @brief Current in A allocated to the connectors by the load balancer (accessed with atomic operations) */
+    std::shared_ptr<const std::vector<ocpp::types::Optional<float>>> m_allocations;
+    /** @brief Load balancing refresh timer */
+    ocpp::helpers::Timer m_balancing_timer;
 
     /** @brief Composite schedule period */
     struct Period
@@ -169,11 +239,51 @@ class SmartChargingManager
     /** @brief Periodically cleanup expired profiles */
     void cleanupProfiles();
 
-    /** @brief Compute the setpoint of a given connector with a profile list */
-    void computeSetpoint(Connector*                                                 connector,
-                         ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& connector_setpoint,
-                         ocpp::types::ChargingRateUnitType                          unit,
-                         const ProfileDatabase::ChargingProfileList&                profiles_list);
+    /** @brief Compile the setpoint timelines of all the connectors (must be called with the mutex locked) */
+    void compileTimelines();
+
+    /** @brief Notify the setpoint changes and schedule the next notification */
+    void notifySetpoints();
+
+    /** @brief Share the charge point setpoint between the connectors (must be called with the notify mutex locked) */
+    void balanceLoad();
+
+    /** @brief Get the setpoints of a connector from its compiled timeline */
+    bool lookupSetpoint(unsigned int                                               connector_id,
+                        ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& charge_point_setpoint,
+                        ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& connector_setpoint,
+                        ocpp::types::DateTime&                                     next_change,
+                        ocpp::types::ChargingRateUnitType                          unit);
+
+    /** @brief Limit the connector setpoint to the current allocated by the load balancer */
+    void applyAllocation(unsigned int                                                     connector_id,
+                         const ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& charge_point_setpoint,
+                         ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>&       connector_setpoint,
+                         ocpp::types::ChargingRateUnitType                                unit);
+
+    /** @brief Indicate if 2 setpoints are identical */
+    bool isSameSetpoint(const ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& setpoint1,
+                        const ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& setpoint2);
+
+    /** @brief Compile the setpoint timeline of a connector (must be called with the mutex locked) */
+    std::shared_ptr<const SetpointTimeline> compileTimeline(Connector* connector, time_t begin);
+
+    /** @brief Add the points in time where the setpoint of a charging profile may change */
+    void addProfileBreakpoints(Connector*                          connector,
+                               const ocpp::types::ChargingProfile& profile,
+                               time_t                              begin,
+                               time_t                              end,
+                               std::vector<time_t>&                breakpoints);
+
+    /** @brief Add the points in time where the setpoint of a charging schedule may change */
+    void addScheduleBreakpoints(const ocpp::types::ChargingSchedule& schedule, time_t start, std::vector<time_t>& breakpoints);
+
+    /** @brief Look for the setpoint of the highest applicable profile of a list */
+    void computeSetpoint(Connector*                                  connector,
+                         ocpp::types::Optional<ProfileSetpoint>&     setpoint,
+                         const ProfileDatabase::ChargingProfileList& profiles_list,
+                         bool                                        check_connector,
+                         const ocpp::types::DateTime&                time_point);
 
     /** @brief Check if the given profile is active */
     bool isProfileActive(Connector*                          connector,
@@ -181,11 +291,13 @@ class SmartChargingManager
                          size_t&                             period,
                          const ocpp::types::DateTime&        time_point);
 
-    /** @brief Fill a setpoint structure with a charging profile and a charging schedule period */
-    void fillSetpoint(ocpp::types::SmartChargingSetpoint&        setpoint,
-                      ocpp::types::ChargingRateUnitType          unit,
-                      const ocpp::types::ChargingProfile&        profile,
-                      const ocpp::types::ChargingSchedulePeriod& period);
+    /** @brief Indicate if 2 profile setpoints are identical */
+    bool isSameSetpoint(const ocpp::types::Optional<ProfileSetpoint>& setpoint1, const ocpp::types::Optional<ProfileSetpoint>& setpoint2);
+
+    /** @brief Fill a setpoint structure with a profile setpoint */
+    void fillSetpoint(ocpp::types::SmartChargingSetpoint& setpoint,
+                      ocpp::types::ChargingRateUnitType   unit,
+                      const ProfileSetpoint&              profile_setpoint);
 
     /** @brief Convert charging rate units */
     float convertToUnit(float value, ocpp::types::ChargingRateUnitType unit, unsigned int number_phases);
@@ -208,11 +320,9 @@ class SmartChargingManager
                                           const ocpp::types::DateTime&        time_point,
                                           unsigned int                        duration);
 
-    /** @brief Merge charging profiles periods */
-    std::vector<Period> mergeProfilePeriods(const std::vector<Period>& ref_periods, const std::vector<Period>& new_periods);
-
-    /** @brief Merge local limitations periods */
-    std::vector<Period> mergeLocalPeriods(const std::vector<Period>& profiles_periods, const std::vector<Period>& local_periods);
+    /** @brief Compute the composite schedule periods from the periods of the applicable profiles and of the local limitations */
+    std::vector<Period> computeCompositePeriods(const std::vector<std::vector<Period>>& profiles_periods,
+                                                const std::vector<Period>&              local_periods);
 
     /** @brief Merge the setpoint of a local limitation and a profile limitation */
     void mergeSetpoint(const Period& profile_period, const Period& local_period, Period& merged_period);
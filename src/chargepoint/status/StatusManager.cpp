@@ -23,6 +23,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "Heartbeat.h"
 #include "IChargePointConfig.h"
 #include "IChargePointEventsHandler.h"
+#include "IConfigManager.h"
 #include "IInternalConfigManager.h"
 #include "IOcppConfig.h"
 #include "InternalConfigKeys.h"
@@ -44,6 +45,7 @@ namespace chargepoint
 /** @brief Constructor */
 StatusManager::StatusManager(const ocpp::config::IChargePointConfig&         stack_config,
                              ocpp::config::IOcppConfig&                      ocpp_config,
+                             const IConfigManager&                           config_manager,
                              IChargePointEventsHandler&                      events_handler,
                              ocpp::config::IInternalConfigManager&           internal_config,
                              ocpp::helpers::ITimerPool&                      timer_pool,
@@ -57,6 +59,7 @@ StatusManager::StatusManager(const ocpp::config::IChargePointConfig&         sta
 
       m_stack_config(stack_config),
       m_ocpp_config(ocpp_config),
+      m_config_manager(config_manager),
       m_events_handler(events_handler),
       m_internal_config(internal_config),
       m_worker_pool(worker_pool),
@@ -165,7 +168,7 @@ bool StatusManager::updateConnectorStatus(unsigned int                      conn
             if (m_registration_status == RegistrationStatus::Accepted)
             {
                 // Check minimum status duration
-                std::chrono::seconds duration = m_ocpp_config.minimumStatusDuration();
+                std::chrono::seconds duration = m_config_manager.snapshot()->minimumStatusDuration;
                 if (duration == std::chrono::seconds(0))
                 {
                     // Notify now
@@ -49,6 +49,7 @@ namespace chargepoint
 
 class Connectors;
 class IChargePointEventsHandler;
+class IConfigManager;
 
 /** @brief Handle charge point status (boot notification, status notification, heartbeat) */
 class StatusManager
@@ -61,6 +62,7 @@ class StatusManager
     /** @brief Constructor */
     StatusManager(const ocpp::config::IChargePointConfig&         stack_config,
                   ocpp::config::IOcppConfig&                      ocpp_config,
+                  const IConfigManager&                           config_manager,
                   IChargePointEventsHandler&                      events_handler,
                   ocpp::config::IInternalConfigManager&           internal_config,
                   ocpp::helpers::ITimerPool&                      timer_pool,
@@ -127,6 +129,8 @@ class StatusManager
     const ocpp::config::IChargePointConfig& m_stack_config;
     /** @brief Standard OCPP configuration */
     ocpp::config::IOcppConfig& m_ocpp_config;
+    /** @brief Configuration manager */
+    const IConfigManager& m_config_manager;
     /** @brief User defined events handler */
     IChargePointEventsHandler& m_events_handler;
     /** @brief Charge point's internal configuration */
@@ -20,6 +20,8 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #define OPENOCPP_IINTERNALCONFIGMANAGER_H
 
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace ocpp
 {
@@ -56,6 +58,13 @@ class IInternalConfigManager
      */
     virtual bool setKey(const std::string& key, const std::string& value) = 0;
 
+    /**
+     * @brief Set the values of multiple configuration keys at once
+     * @param values List of configuration keys and their values
+     * @return true if all the keys have been updated, false otherwise (no key is updated)
+     */
+    virtual bool setKeys(const std::vector<std::pair<std::string, std::string>>& values) = 0;
+
     /**
      * @brief Get the value of a configuration key
      * @param key Configuration key
@@ -25,7 +25,14 @@ namespace config
 {
 
 /** @brief Constructor */
-InternalConfigManager::InternalConfigManager(ocpp::database::Database& database) : m_database(database) { }
+InternalConfigManager::InternalConfigManager(ocpp::database::Database& database)
+    : m_database(database),
+      m_find_query(),
+      m_insert_query(),
+      m_update_query(),
+      m_update_mutex()
+{
+}
 
 /** @brief Destructor */
 InternalConfigManager::~InternalConfigManager() { }
@@ -75,6 +82,51 @@ bool InternalConfigManager::createKey(const std::string& key, const std::string&
 
 /** @copydoc bool IInternalConfigManager::setKey(const std::string&, const std::string&) */
 bool InternalConfigManager::setKey(const std::string& key, const std::string& value)
+{
+    std::lock_guard<std::mutex> lock(m_update_mutex);
+    return updateKey(key, value);
+}
+
+/** @copydoc bool IInternalConfigManager::setKeys(const std::vector<std::pair<std::string, std::string>>&) */
+bool InternalConfigManager::setKeys(const std::vector<std::pair<std::string, std::string>>& values)
+{
+    bool ret = true;
+
+    std::lock_guard<std::mutex> lock(m_update_mutex);
+    if (m_update_query)
+    {
+        // Update all the keys in a single transaction
+        ret = m_database.beginTransaction();
+        if (ret)
+        {
+            for (const auto& value : values)
+            {
+                ret = ret && updateKey(value.first, value.second);
+            }
+            if (ret)
+            {
+                ret = m_database.commitTransaction();
+                if (!ret)
+                {
+                    LOG_ERROR << "Could not commit keys : " << m_database.lastError();
+                }
+            }
+            else
+            {
+                m_database.rollbackTransaction();
+            }
+        }
+        else
+        {
+            LOG_ERROR << "Could not start keys update : " << m_database.lastError();
+        }
+    }
+
+    return ret;
+}
+
+/** @brief Update the value of a configuration key (must be called with the update mutex locked) */
+bool InternalConfigManager::updateKey(const std::string& key, const std::string& value)
 {
     bool ret = true;
 
@@ -142,9 +194,9 @@ void InternalConfigManager::initDatabaseTable()
     }
 
     // Create parametrized queries
-    m_find_query   = m_database.query("SELECT * FROM InternalConfig WHERE key=?;");
-    m_insert_query = m_database.query("INSERT INTO InternalConfig VALUES (NULL, ?, ?);");
-    m_update_query = m_database.query("UPDATE InternalConfig SET [value]=? WHERE key=?;");
+    m_find_query     = m_database.query("SELECT * FROM InternalConfig WHERE key=?;");
+    m_insert_query   = m_database.query("INSERT INTO InternalConfig VALUES (NULL, ?, ?);");
+    m_update_query   = m_database.query("UPDATE InternalConfig SET [value]=? WHERE key=?;");
 
     // List all configuration keys
     query = m_database.query("SELECT * FROM InternalConfig WHERE TRUE;");
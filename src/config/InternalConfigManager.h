@@ -22,6 +22,8 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "Database.h"
 #include "IInternalConfigManager.h"
 
+#include <mutex>
+
 namespace ocpp
 {
 namespace config
@@ -48,6 +50,9 @@ class InternalConfigManager : public IInternalConfigManager
     /** @copydoc bool IInternalConfigManager::setKey(const std::string&, const std::string&) */
     bool setKey(const std::string& key, const std::string& value) override;
 
+    /** @copydoc bool IInternalConfigManager::setKeys(const std::vector<std::pair<std::string, std::string>>&) */
+    bool setKeys(const std::vector<std::pair<std::string, std::string>>& values) override;
+
     /** @copydoc bool IInternalConfigManager::getKey(const std::string&, const std::string&) */
     bool getKey(const std::string& key, std::string& value) override;
 
@@ -66,6 +71,11 @@ class InternalConfigManager : public IInternalConfigManager
     std::unique_ptr<ocpp::database::Database::Query> m_insert_query;
     /** @brief Query to update a key in the configuration */
     std::unique_ptr<ocpp::database::Database::Query> m_update_query;
+    /** @brief Mutex to serialize the updates */
+    std::mutex m_update_mutex;
+
+    /** @brief Update the value of a configuration key (must be called with the update mutex locked) */
+    bool updateKey(const std::string& key, const std::string& value);
 };
 
 } // namespace config
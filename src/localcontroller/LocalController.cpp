@@ -208,8 +208,15 @@ bool LocalController::start()
             credentials.server_certificate_private_key_passphrase = m_stack_config.tlsServerCertificatePrivateKeyPassphrase();
             credentials.server_certificate_ca                     = m_stack_config.tlsServerCertificateCa();
             credentials.client_certificate_authent                = m_stack_config.tlsClientCertificateAuthent();
+            credentials.tls_ticket_key_rotation_interval          = m_stack_config.tlsTicketKeyRotationInterval();
             credentials.encoded_pem_certificates                  = false;
 
+            // Configure websocket send queue
+            m_ws_server->setSendQueueConfig(ocpp::websockets::SendQueueConfig(m_stack_config.webSocketSendQueueMaxMessages(),
+                                                                              m_stack_config.webSocketSendQueueMaxSize(),
+                                                                              m_stack_config.webSocketSendQueuePolicy(),
+                                                                              m_stack_config.webSocketSendQueueBlockTimeout()));
+
             // Start listening
             ret = m_rpc_pool->start(m_stack_config.incomingRequestsFromCsThreadPoolSize());
             ret = ret && m_rpc_server->start(m_stack_config.listenUrl(),
@@ -270,6 +277,19 @@ bool LocalController::stop()
     return ret;
 }
 
+/** @copydoc ocpp::websockets::TlsStats ILocalController::getTlsStats() const */
+ocpp::websockets::TlsStats LocalController::getTlsStats() const
+{
+    ocpp::websockets::TlsStats stats;
+
+    if (m_ws_server)
+    {
+        stats = m_ws_server->tlsStats();
+    }
+
+    return stats;
+}
+
 /** @copydoc bool RpcServer::IListener::rpcAcceptConnection(const char*) */
 bool LocalController::rpcAcceptConnection(const char* ip_address)
 {
@@ -301,12 +321,23 @@ void LocalController::rpcClientConnected(const std::string& chargepoint_id, std:
     // Instanciate proxys
     CentralSystemProxy* centralsystem =
         new CentralSystemProxy(chargepoint_id, m_messages_validator, m_messages_converter, m_stack_config, *m_rpc_pool);
+
+    // Store and forward of the transaction related requests
+    std::unique_ptr<StoreAndForwardManager> store_and_forward;
+    if (m_stack_config.storeAndForward() && m_timer_pool && m_worker_pool)
+    {
+        store_and_forward = std::make_unique<StoreAndForwardManager>(
+            chargepoint_id, m_stack_config, m_database.get(), *m_timer_pool, *m_worker_pool, *centralsystem);
+        store_and_forward->initDatabaseTable();
+    }
+
     std::shared_ptr<IChargePointProxy> chargepoint(new ChargePointProxy(chargepoint_id,
                                                                         client,
                                                                         m_messages_validator,
                                                                         m_messages_converter,
                                                                         m_stack_config,
-                                                                        std::shared_ptr<ICentralSystemProxy>(centralsystem)));
+                                                                        std::shared_ptr<ICentralSystemProxy>(centralsystem),
+                                                                        std::move(store_and_forward)));
     centralsystem->setChargePointProxy(chargepoint);
 
     // Notify connection
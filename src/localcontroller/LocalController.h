@@ -67,6 +67,9 @@ class LocalController : public ILocalController, public ocpp::rpc::RpcServer::IL
     /** @copydoc bool ILocalController::stop() */
     bool stop() override;
 
+    /** @copydoc ocpp::websockets::TlsStats ILocalController::getTlsStats() const */
+    ocpp::websockets::TlsStats getTlsStats() const override;
+
     // RpcServer::IListener interface
 
     /** @copydoc bool RpcServer::IListener::rpcAcceptConnection(const char*) */
@@ -0,0 +1,66 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPENOCPP_RAWMESSAGEHANDLER_H
+#define OPENOCPP_RAWMESSAGEHANDLER_H
+
+#include "IMessageDispatcher.h"
+
+#include <functional>
+
+namespace ocpp
+{
+namespace localcontroller
+{
+
+/** @brief Message handler working directly on the JSON payloads (no conversion to C++ data types) */
+class RawMessageHandler : public ocpp::messages::IMessageDispatcher::IMessageHandler
+{
+  public:
+    /** @brief Message handler function*/
+    typedef std::function<bool(const std::string&, const rapidjson::Value&, rapidjson::Document&, std::string&, std::string&)> HandlerFunc;
+
+    /** @brief Constructor */
+    RawMessageHandler(HandlerFunc handler) : m_handler(handler) { }
+
+    /** @brief Destructor */
+    virtual ~RawMessageHandler() { }
+
+    /** @copydoc bool IMessageDispatcher::IMessageHandler::handle(const std::string&,
+     *                                                            const rapidjson::Value&,
+     *                                                            rapidjson::Document&,
+     *                                                            std::string&,
+     *                                                            std::string&) */
+    bool handle(const std::string&      action,
+                const rapidjson::Value& payload,
+                rapidjson::Document&    response,
+                std::string&            error_code,
+                std::string&            error_message) override
+    {
+        return m_handler(action, payload, response, error_code, error_message);
+    }
+
+  private:
+    /** @brief Handler */
+    HandlerFunc m_handler;
+};
+
+} // namespace localcontroller
+} // namespace ocpp
+
+#endif // OPENOCPP_RAWMESSAGEHANDLER_H
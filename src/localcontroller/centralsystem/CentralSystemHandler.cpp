@@ -31,9 +31,10 @@ namespace localcontroller
 {
 
 /** @brief Constructor */
-CentralSystemHandler::CentralSystemHandler(const std::string&                       identifier,
-                                           const ocpp::messages::MessagesConverter& messages_converter,
-                                           ocpp::messages::MessageDispatcher&       msg_dispatcher)
+CentralSystemHandler::CentralSystemHandler(const std::string&                          identifier,
+                                           const ocpp::messages::MessagesConverter&    messages_converter,
+                                           ocpp::messages::MessageDispatcher&          msg_dispatcher,
+                                           const ocpp::config::ILocalControllerConfig& stack_config)
     : GenericMessageHandler<CancelReservationReq, CancelReservationConf>(CANCEL_RESERVATION_ACTION, messages_converter),
       GenericMessageHandler<ChangeAvailabilityReq, ChangeAvailabilityConf>(CHANGE_AVAILABILITY_ACTION, messages_converter),
       GenericMessageHandler<ChangeConfigurationReq, ChangeConfigurationConf>(CHANGE_CONFIGURATION_ACTION, messages_converter),
@@ -64,7 +65,13 @@ CentralSystemHandler::CentralSystemHandler(const std::string&
       GenericMessageHandler<SignedUpdateFirmwareReq, SignedUpdateFirmwareConf>(SIGNED_UPDATE_FIRMWARE_ACTION, messages_converter),
 
       m_identifier(identifier),
-      m_charge_point()
+      m_charge_point(),
+      m_raw_handler([this](const std::string&      action,
+                           const rapidjson::Value& payload,
+                           rapidjson::Document&    response,
+                           std::string&            error_code,
+                           std::string&            error_message)
+                    { return forwardRaw(action, payload, response, error_code, error_message); })
 {
     msg_dispatcher.registerHandler(CANCEL_RESERVATION_ACTION,
                                    *dynamic_cast<GenericMessageHandler<CancelReservationReq, CancelReservationConf>*>(this));
@@ -115,6 +122,42 @@ CentralSystemHandler::CentralSystemHandler(const std::string&
                                    *dynamic_cast<GenericMessageHandler<InstallCertificateReq, InstallCertificateConf>*>(this));
     msg_dispatcher.registerHandler(SIGNED_UPDATE_FIRMWARE_ACTION,
                                    *dynamic_cast<GenericMessageHandler<SignedUpdateFirmwareReq, SignedUpdateFirmwareConf>*>(this));
+
+    // In transparent forwarding mode, the requests are forwarded without being decoded
+    // (user handlers registered on the proxy will replace the raw handler for their action)
+    if (stack_config.transparentForwarding())
+    {
+        bool validate = stack_config.transparentForwardingValidation();
+        for (const std::string& action : {CANCEL_RESERVATION_ACTION,
+                                          CHANGE_AVAILABILITY_ACTION,
+                                          CHANGE_CONFIGURATION_ACTION,
+                                          CLEAR_CACHE_ACTION,
+                                          CLEAR_CHARGING_PROFILE_ACTION,
+                                          DATA_TRANSFER_ACTION,
+                                          GET_COMPOSITE_SCHEDULE_ACTION,
+                                          GET_CONFIGURATION_ACTION,
+                                          GET_DIAGNOSTICS_ACTION,
+                                          GET_LOCAL_LIST_VERSION_ACTION,
+                                          REMOTE_START_TRANSACTION_ACTION,
+                                          REMOTE_STOP_TRANSACTION_ACTION,
+                                          RESERVE_NOW_ACTION,
+                                          RESET_ACTION,
+                                          SEND_LOCAL_LIST_ACTION,
+                                          SET_CHARGING_PROFILE_ACTION,
+                                          TRIGGER_MESSAGE_ACTION,
+                                          UNLOCK_CONNECTOR_ACTION,
+                                          UPDATE_FIRMWARE_ACTION,
+                                          CERTIFICATE_SIGNED_ACTION,
+                                          DELETE_CERTIFICATE_ACTION,
+                                          EXTENDED_TRIGGER_MESSAGE_ACTION,
+                                          GET_INSTALLED_CERTIFICATE_IDS_ACTION,
+                                          GET_LOG_ACTION,
+                                          INSTALL_CERTIFICATE_ACTION,
+                                          SIGNED_UPDATE_FIRMWARE_ACTION})
+        {
+            msg_dispatcher.registerHandler(action, m_raw_handler, true, validate);
+        }
+    }
 }
 
 /** @brief Destructor */
@@ -462,5 +505,45 @@ bool CentralSystemHandler::handleMessage(const ocpp::messages::SignedUpdateFirmw
     return forward(SIGNED_UPDATE_FIRMWARE_ACTION, request, response, error_code, error_message);
 }
 
+/** @brief Forward a call request to the Charge Point without decoding it */
+bool CentralSystemHandler::forwardRaw(const std::string&      action,
+                                      const rapidjson::Value& payload,
+                                      rapidjson::Document&    response,
+                                      std::string&            error,
+                                      std::string&            message)
+{
+    bool ret = false;
+
+    // Get charge point proxy
+    auto charge_point = m_charge_point.lock();
+    if (charge_point)
+    {
+        // Try to forward message
+        std::string cp_error;
+        std::string cp_message;
+        ret = charge_point->forward(action, payload, response, cp_error, cp_message);
+        if (!ret)
+        {
+            // Check timeout or error response
+            if (cp_error.empty())
+            {
+                LOG_WARNING << "[" << m_identifier << "] - Unable to forward [" << action << "] request";
+            }
+            else
+            {
+                LOG_WARNING << "[" << m_identifier << "] - CallError [" << cp_error << "] received on [" << action << "] request";
+                error   = cp_error.c_str();
+                message = cp_message;
+            }
+        }
+    }
+    else
+    {
+        LOG_WARNING << "[" << m_identifier << "] - Unable to forward [" << action << "] request";
+    }
+
+    return ret;
+}
+
 } // namespace localcontroller
 } // namespace ocpp
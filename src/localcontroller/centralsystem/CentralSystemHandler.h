@@ -39,6 +39,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "IRpc.h"
 #include "InstallCertificate.h"
 #include "Logger.h"
+#include "RawMessageHandler.h"
 #include "RemoteStartTransaction.h"
 #include "RemoteStopTransaction.h"
 #include "ReserveNow.h"
@@ -104,9 +105,10 @@ class CentralSystemHandler
      * @param msg_dispatcher Message dispatcher
      * @param stack_config Stack configuration
      */
-    CentralSystemHandler(const std::string&                       identifier,
-                         const ocpp::messages::MessagesConverter& messages_converter,
-                         ocpp::messages::MessageDispatcher&       msg_dispatcher);
+    CentralSystemHandler(const std::string&                          identifier,
+                         const ocpp::messages::MessagesConverter&    messages_converter,
+                         ocpp::messages::MessageDispatcher&          msg_dispatcher,
+                         const ocpp::config::ILocalControllerConfig& stack_config);
 
     /** @brief Destructor */
     virtual ~CentralSystemHandler();
@@ -386,6 +388,23 @@ class CentralSystemHandler
     const std::string m_identifier;
     /** @brief Proxy to forward requests to the charge point */
     std::weak_ptr<IChargePointProxy> m_charge_point;
+    /** @brief Handler for the transparent forwarding of the requests */
+    RawMessageHandler m_raw_handler;
+
+    /**
+     * @brief Forward a call request to the Charge Point without decoding it
+     * @param action RPC action for the request
+     * @param payload JSON payload of the request
+     * @param response JSON payload of the response
+     * @param error Error code to return to the Central System, empty if no error
+     * @param message Error message to return to the Central System, empty if no error
+     * @return true if the request has been sent and a response has been received, false otherwise
+     */
+    bool forwardRaw(const std::string&      action,
+                    const rapidjson::Value& payload,
+                    rapidjson::Document&    response,
+                    std::string&            error,
+                    std::string&            message);
 
     /**
      * @brief Forward a call request to the Charge Point
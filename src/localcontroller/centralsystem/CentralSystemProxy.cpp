@@ -44,13 +44,18 @@ CentralSystemProxy::CentralSystemProxy(const std::string&
       m_messages_converter(messages_converter),
       m_msg_dispatcher(messages_validator),
       m_msg_sender(m_rpc, messages_converter, messages_validator, stack_config.callRequestTimeout()),
-      m_handler(m_identifier, messages_converter, m_msg_dispatcher),
+      m_handler(m_identifier, messages_converter, m_msg_dispatcher, stack_config),
       m_listener(nullptr),
       m_user_handlers()
 {
     m_rpc.registerSpy(*this);
     m_rpc.registerListener(*this);
     m_rpc.registerClientListener(*this);
+
+    m_websocket->setSendQueueConfig(ocpp::websockets::SendQueueConfig(m_stack_config.webSocketSendQueueMaxMessages(),
+                                                                      m_stack_config.webSocketSendQueueMaxSize(),
+                                                                      m_stack_config.webSocketSendQueuePolicy(),
+                                                                      m_stack_config.webSocketSendQueueBlockTimeout()));
 }
 
 /** @brief Destructor */
@@ -107,6 +112,32 @@ bool CentralSystemProxy::isConnected() const
     return m_rpc.isConnected();
 }
 
+/** @copydoc bool ICentralSystemProxy::forward(const std::string&,
+ *                                               const rapidjson::Value&,
+ *                                               rapidjson::Document&,
+ *                                               std::string&,
+ *                                               std::string&) */
+bool CentralSystemProxy::forward(const std::string&      action,
+                                 const rapidjson::Value& request,
+                                 rapidjson::Document&    response,
+                                 std::string&            error,
+                                 std::string&            message)
+{
+    bool ret = true;
+
+    LOG_DEBUG << "[" << m_identifier << "] - " << action << " (forwarded)";
+
+    ocpp::messages::CallResult res =
+        m_msg_sender.forward(action, request, response, error, message, m_stack_config.transparentForwardingValidation());
+    if (res != ocpp::messages::CallResult::Ok)
+    {
+        LOG_ERROR << "[" << m_identifier << "] - " << action << " => " << (res == ocpp::messages::CallResult::Failed ? "Timeout" : "Error");
+        ret = false;
+    }
+
+    return ret;
+}
+
 /** @copydoc bool ICentralSystemProxy::call(const ocpp::messages::BootNotificationReq&,
  *                                          ocpp::messages::BootNotificationConf&,
  *                                          std::string&,
@@ -101,6 +101,17 @@ class CentralSystemProxy : public ICentralSystemProxy,
     /** @copydoc void ICentralSystemProxy::registerListener(ILocalControllerProxyEventsHandler&) */
     void registerListener(ILocalControllerProxyEventsHandler& listener) override { m_listener = &listener; }
 
+    /** @copydoc bool ICentralSystemProxy::forward(const std::string&,
+     *                                             const rapidjson::Value&,
+     *                                             rapidjson::Document&,
+     *                                             std::string&,
+     *                                             std::string&) */
+    bool forward(const std::string&      action,
+                 const rapidjson::Value& request,
+                 rapidjson::Document&    response,
+                 std::string&            error,
+                 std::string&            message) override;
+
     /** @copydoc bool ICentralSystemProxy::call(const ocpp::messages::BootNotificationReq&,
      *                                          ocpp::messages::BootNotificationConf&,
      *                                          std::string&,
@@ -30,10 +30,12 @@ namespace localcontroller
 {
 
 /** @brief Constructor */
-ChargePointHandler::ChargePointHandler(const std::string&                       identifier,
-                                       const ocpp::messages::MessagesConverter& messages_converter,
-                                       ocpp::messages::MessageDispatcher&       msg_dispatcher,
-                                       ICentralSystemProxy&                     central_system)
+ChargePointHandler::ChargePointHandler(const std::string&                          identifier,
+                                       const ocpp::messages::MessagesConverter&    messages_converter,
+                                       ocpp::messages::MessageDispatcher&          msg_dispatcher,
+                                       const ocpp::config::ILocalControllerConfig& stack_config,
+                                       ICentralSystemProxy&                        central_system,
+                                       std::unique_ptr<StoreAndForwardManager>     store_and_forward)
     : GenericMessageHandler<AuthorizeReq, AuthorizeConf>(AUTHORIZE_ACTION, messages_converter),
       GenericMessageHandler<BootNotificationReq, BootNotificationConf>(BOOT_NOTIFICATION_ACTION, messages_converter),
       GenericMessageHandler<DataTransferReq, DataTransferConf>(DATA_TRANSFER_ACTION, messages_converter),
@@ -54,7 +56,15 @@ ChargePointHandler::ChargePointHandler(const std::string&
       GenericMessageHandler<SignedFirmwareStatusNotificationReq, SignedFirmwareStatusNotificationConf>(
           SIGNED_FIRMWARE_STATUS_NOTIFICATION_ACTION, messages_converter),
       m_identifier(identifier),
-      m_central_system(central_system)
+      m_messages_converter(messages_converter),
+      m_central_system(central_system),
+      m_store_and_forward(std::move(store_and_forward)),
+      m_raw_handler([this](const std::string&      action,
+                           const rapidjson::Value& payload,
+                           rapidjson::Document&    response,
+                           std::string&            error_code,
+                           std::string&            error_message)
+                    { return forwardRaw(action, payload, response, error_code, error_message); })
 {
     msg_dispatcher.registerHandler(AUTHORIZE_ACTION, *dynamic_cast<GenericMessageHandler<AuthorizeReq, AuthorizeConf>*>(this), true);
     msg_dispatcher.registerHandler(
@@ -90,6 +100,30 @@ ChargePointHandler::ChargePointHandler(const std::string&
         SIGNED_FIRMWARE_STATUS_NOTIFICATION_ACTION,
         *dynamic_cast<GenericMessageHandler<SignedFirmwareStatusNotificationReq, SignedFirmwareStatusNotificationConf>*>(this),
         true);
+
+    // In transparent forwarding mode, the requests are forwarded without being decoded
+    // (user handlers registered on the proxy will replace the raw handler for their action)
+    if (stack_config.transparentForwarding())
+    {
+        bool validate = stack_config.transparentForwardingValidation();
+        for (const std::string& action : {AUTHORIZE_ACTION,
+                                          BOOT_NOTIFICATION_ACTION,
+                                          DATA_TRANSFER_ACTION,
+                                          DIAGNOSTIC_STATUS_NOTIFICATION_ACTION,
+                                          FIRMWARE_STATUS_NOTIFICATION_ACTION,
+                                          HEARTBEAT_ACTION,
+                                          METER_VALUES_ACTION,
+                                          START_TRANSACTION_ACTION,
+                                          STATUS_NOTIFICATION_ACTION,
+                                          STOP_TRANSACTION_ACTION,
+                                          LOG_STATUS_NOTIFICATION_ACTION,
+                                          SECURITY_EVENT_NOTIFICATION_ACTION,
+                                          SIGN_CERTIFICATE_ACTION,
+                                          SIGNED_FIRMWARE_STATUS_NOTIFICATION_ACTION})
+        {
+            msg_dispatcher.registerHandler(action, m_raw_handler, true, validate);
+        }
+    }
 }
 /** @brief Destructor */
 ChargePointHandler::~ChargePointHandler() { }
@@ -280,5 +314,44 @@ bool ChargePointHandler::handleMessage(const ocpp::messages::SignedFirmwareStatu
     return forward(SIGNED_FIRMWARE_STATUS_NOTIFICATION_ACTION, request, response, error_code, error_message);
 }
 
+/** @brief Forward a call request to the Central System without decoding it */
+bool ChargePointHandler::forwardRaw(const std::string&      action,
+                                    const rapidjson::Value& payload,
+                                    rapidjson::Document&    response,
+                                    std::string&            error,
+                                    std::string&            message)
+{
+    bool ret = false;
+
+    if (m_store_and_forward && StoreAndForwardManager::isHandled(action))
+    {
+        // Transaction related requests may be stored and acknowledged locally
+        ret = m_store_and_forward->process(action, payload, response, error, message);
+    }
+    else
+    {
+        // Try to forward message
+        std::string cs_error;
+        std::string cs_message;
+        ret = m_central_system.forward(action, payload, response, cs_error, cs_message);
+        if (!ret)
+        {
+            // Check timeout or error response
+            if (cs_error.empty())
+            {
+                LOG_WARNING << "[" << m_identifier << "] - Unable to forward [" << action << "] request";
+            }
+            else
+            {
+                LOG_WARNING << "[" << m_identifier << "] - CallError [" << cs_error << "] received on [" << action << "] request";
+                error   = cs_error.c_str();
+                message = cs_message;
+            }
+        }
+    }
+
+    return ret;
+}
+
 } // namespace localcontroller
 } // namespace ocpp
@@ -30,13 +30,18 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "IRpc.h"
 #include "LogStatusNotification.h"
 #include "Logger.h"
+#include "MessagesConverter.h"
 #include "MeterValues.h"
+#include "RawMessageHandler.h"
 #include "SecurityEventNotification.h"
 #include "SignCertificate.h"
 #include "SignedFirmwareStatusNotification.h"
 #include "StartTransaction.h"
 #include "StatusNotification.h"
 #include "StopTransaction.h"
+#include "StoreAndForwardManager.h"
+
+#include <memory>
 
 namespace ocpp
 {
@@ -47,7 +52,6 @@ class ILocalControllerConfig;
 namespace messages
 {
 class MessageDispatcher;
-class MessagesConverter;
 } // namespace messages
 
 namespace localcontroller
@@ -82,11 +86,15 @@ class ChargePointHandler
      * @param messages_converter Converter from/to OCPP to/from JSON messages
      * @param msg_dispatcher Message dispatcher
      * @param stack_config Stack configuration
+     * @param central_system Proxy to forward requests to the central system
+     * @param store_and_forward Store and forward manager for the transaction related requests (null if disabled)
      */
-    ChargePointHandler(const std::string&                       identifier,
-                       const ocpp::messages::MessagesConverter& messages_converter,
-                       ocpp::messages::MessageDispatcher&       msg_dispatcher,
-                       ICentralSystemProxy&                     central_system);
+    ChargePointHandler(const std::string&                          identifier,
+                       const ocpp::messages::MessagesConverter&    messages_converter,
+                       ocpp::messages::MessageDispatcher&          msg_dispatcher,
+                       const ocpp::config::ILocalControllerConfig& stack_config,
+                       ICentralSystemProxy&                        central_system,
+                       std::unique_ptr<StoreAndForwardManager>     store_and_forward = nullptr);
 
     /** @brief Destructor */
     virtual ~ChargePointHandler();
@@ -238,9 +246,29 @@ class ChargePointHandler
   private:
     /** @brief Charge point's identifier */
     const std::string m_identifier;
-    /** @brief Stack configuration */
+    /** @brief Converter from/to OCPP to/from JSON messages */
+    const ocpp::messages::MessagesConverter& m_messages_converter;
     /** @brief Proxy to forward requests to the central system */
     ICentralSystemProxy& m_central_system;
+    /** @brief Store and forward manager for the transaction related requests */
+    std::unique_ptr<StoreAndForwardManager> m_store_and_forward;
+    /** @brief Handler for the transparent forwarding of the requests */
+    RawMessageHandler m_raw_handler;
+
+    /**
+     * @brief Forward a call request to the Central System without decoding it
+     * @param action RPC action for the request
+     * @param payload JSON payload of the request
+     * @param response JSON payload of the response
+     * @param error Error code to return to the Charge Point, empty if no error
+     * @param message Error message to return to the Charge Point, empty if no error
+     * @return true if the request has been sent and a response has been received, false otherwise
+     */
+    bool forwardRaw(const std::string&      action,
+                    const rapidjson::Value& payload,
+                    rapidjson::Document&    response,
+                    std::string&            error,
+                    std::string&            message);
 
     /**
      * @brief Forward a call request to the Central System
@@ -256,22 +284,67 @@ class ChargePointHandler
     {
         bool ret = false;
 
-        // Try to forward message
-        std::string cs_error;
-        std::string cs_message;
-        ret = m_central_system.call(request, response, cs_error, cs_message);
-        if (!ret)
+        if (m_store_and_forward && StoreAndForwardManager::isHandled(action))
+        {
+            // Transaction related requests may be stored and acknowledged locally
+            ret = storeAndForward(action, request, response, error, message);
+        }
+        else
         {
-            // Check timeout or error response
-            if (cs_error.empty())
+            // Try to forward message
+            std::string cs_error;
+            std::string cs_message;
+            ret = m_central_system.call(request, response, cs_error, cs_message);
+            if (!ret)
             {
-                LOG_WARNING << "[" << m_identifier << "] - Unable to forward [" << action << "] request";
+                // Check timeout or error response
+                if (cs_error.empty())
+                {
+                    LOG_WARNING << "[" << m_identifier << "] - Unable to forward [" << action << "] request";
+                }
+                else
+                {
+                    LOG_WARNING << "[" << m_identifier << "] - CallError [" << cs_error << "] received on [" << action << "] request";
+                    error   = cs_error.c_str();
+                    message = cs_message;
+                }
             }
-            else
+        }
+
+        return ret;
+    }
+
+    /**
+     * @brief Forward a transaction related call request to the Central System, or store it and acknowledge it locally
+     *        if the Central System is unreachable
+     * @param action RPC action for the request
+     * @param request Request payload
+     * @param response Response payload
+     * @param error Error code to return to the Charge Point, empty if no error
+     * @param message Error message to return to the Charge Point, empty if no error
+     * @return true if a response has been received or built locally, false otherwise
+     */
+    template <typename RequestType, typename ResponseType>
+    bool storeAndForward(
+        const std::string& action, const RequestType& request, ResponseType& response, std::string& error, std::string& message)
+    {
+        bool ret = false;
+
+        // Convert request
+        rapidjson::Document payload;
+        payload.Parse("{}");
+        auto req_converter = m_messages_converter.getRequestConverter<RequestType>(action);
+        req_converter->setAllocator(&payload.GetAllocator());
+        if (req_converter->toJson(request, payload))
+        {
+            // Forward or store request
+            rapidjson::Document resp;
+            if (m_store_and_forward->process(action, payload, resp, error, message))
             {
-                LOG_WARNING << "[" << m_identifier << "] - CallError [" << cs_error << "] received on [" << action << "] request";
-                error   = cs_error.c_str();
-                message = cs_message;
+                // Convert response
+                auto resp_converter = m_messages_converter.getResponseConverter<ResponseType>(action);
+                resp_converter->setAllocator(&resp.GetAllocator());
+                ret = resp_converter->fromJson(resp, response, error, message);
             }
         }
 
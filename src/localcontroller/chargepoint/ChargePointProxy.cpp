@@ -70,14 +70,16 @@ ChargePointProxy::ChargePointProxy(const std::string&
                                    const ocpp::messages::MessagesValidator&      messages_validator,
                                    ocpp::messages::MessagesConverter&            messages_converter,
                                    const ocpp::config::ILocalControllerConfig&   stack_config,
-                                   std::shared_ptr<ICentralSystemProxy>          central_system)
+                                   std::shared_ptr<ICentralSystemProxy>          central_system,
+                                   std::unique_ptr<StoreAndForwardManager>       store_and_forward)
     : m_identifier(identifier),
+      m_stack_config(stack_config),
       m_rpc(rpc),
       m_messages_converter(messages_converter),
       m_msg_dispatcher(messages_validator),
       m_msg_sender(*m_rpc, messages_converter, messages_validator, stack_config.callRequestTimeout()),
       m_central_system(central_system),
-      m_handler(m_identifier, messages_converter, m_msg_dispatcher, *central_system.get()),
+      m_handler(m_identifier, messages_converter, m_msg_dispatcher, stack_config, *central_system.get(), std::move(store_and_forward)),
       m_listener(nullptr),
       m_user_handlers()
 {
@@ -103,6 +105,12 @@ const std::string& ChargePointProxy::ipAddress() const
     return m_rpc->ipAddress();
 }
 
+/** @copydoc ocpp::websockets::SendQueueStats IChargePointProxy::sendQueueStats() const */
+ocpp::websockets::SendQueueStats ChargePointProxy::sendQueueStats() const
+{
+    return m_rpc->sendQueueStats();
+}
+
 /** @copydoc void IChargePointProxy::setTimeout(std::chrono::milliseconds) */
 void ChargePointProxy::setTimeout(std::chrono::milliseconds timeout)
 {
@@ -119,6 +127,32 @@ void ChargePointProxy::disconnect()
     m_central_system->disconnect();
 }
 
+/** @copydoc bool IChargePointProxy::forward(const std::string&,
+ *                                             const rapidjson::Value&,
+ *                                             rapidjson::Document&,
+ *                                             std::string&,
+ *                                             std::string&) */
+bool ChargePointProxy::forward(const std::string&      action,
+                               const rapidjson::Value& request,
+                               rapidjson::Document&    response,
+                               std::string&            error,
+                               std::string&            message)
+{
+    bool ret = true;
+
+    LOG_DEBUG << "[" << m_identifier << "] - " << action << " (forwarded)";
+
+    ocpp::messages::CallResult res =
+        m_msg_sender.forward(action, request, response, error, message, m_stack_config.transparentForwardingValidation());
+    if (res != ocpp::messages::CallResult::Ok)
+    {
+        LOG_ERROR << "[" << m_identifier << "] - " << action << " => " << (res == ocpp::messages::CallResult::Failed ? "Timeout" : "Error");
+        ret = false;
+    }
+
+    return ret;
+}
+
 // OCPP operations
 
 /** @copydoc bool IChargePointProxy::call(const ocpp::messages::CancelReservationReq&,
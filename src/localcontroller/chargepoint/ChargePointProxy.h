@@ -49,13 +49,15 @@ class ChargePointProxy : public IChargePointProxy, public ocpp::rpc::IRpc::IList
      * @param messages_converter Converter from/to OCPP to/from JSON messages
      * @param stack_config Stack configuration
      * @param central_system Proxy to forward requests to the central system
+     * @param store_and_forward Store and forward manager for the transaction related requests (null if disabled)
      */
     ChargePointProxy(const std::string&                            identifier,
                      std::shared_ptr<ocpp::rpc::RpcServer::Client> rpc,
                      const ocpp::messages::MessagesValidator&      messages_validator,
                      ocpp::messages::MessagesConverter&            messages_converter,
                      const ocpp::config::ILocalControllerConfig&   stack_config,
-                     std::shared_ptr<ICentralSystemProxy>          central_system);
+                     std::shared_ptr<ICentralSystemProxy>          central_system,
+                     std::unique_ptr<StoreAndForwardManager>       store_and_forward = nullptr);
     /** @brief Destructor */
     virtual ~ChargePointProxy();
 
@@ -64,6 +66,9 @@ class ChargePointProxy : public IChargePointProxy, public ocpp::rpc::IRpc::IList
     /** @copydoc const std::string& IChargePointProxy::ipAddress() const */
     const std::string& ipAddress() const override;
 
+    /** @copydoc ocpp::websockets::SendQueueStats IChargePointProxy::sendQueueStats() const */
+    ocpp::websockets::SendQueueStats sendQueueStats() const override;
+
     /** @copydoc const std::string& IChargePointProxy::identifier() const */
     const std::string& identifier() const override { return m_identifier; }
 
@@ -83,6 +88,17 @@ class ChargePointProxy : public IChargePointProxy, public ocpp::rpc::IRpc::IList
         m_central_system->registerListener(listener);
     }
 
+    /** @copydoc bool IChargePointProxy::forward(const std::string&,
+     *                                           const rapidjson::Value&,
+     *                                           rapidjson::Document&,
+     *                                           std::string&,
+     *                                           std::string&) */
+    bool forward(const std::string&      action,
+                 const rapidjson::Value& request,
+                 rapidjson::Document&    response,
+                 std::string&            error,
+                 std::string&            message) override;
+
     // OCPP operations
 
     /** @copydoc bool IChargePointProxy::call(const ocpp::messages::CancelReservationReq&,
@@ -445,6 +461,8 @@ class ChargePointProxy : public IChargePointProxy, public ocpp::rpc::IRpc::IList
   private:
     /** @brief Charge point's identifier */
     std::string m_identifier;
+    /** @brief Stack configuration */
+    const ocpp::config::ILocalControllerConfig& m_stack_config;
     /** @brief RPC connection */
     std::shared_ptr<ocpp::rpc::RpcServer::Client> m_rpc;
     /** @brief Messages converter */
@@ -0,0 +1,525 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "StoreAndForwardManager.h"
+#include "ICentralSystemProxy.h"
+#include "ILocalControllerConfig.h"
+#include "Logger.h"
+#include "MeterValues.h"
+#include "StartTransaction.h"
+#include "StopTransaction.h"
+#include "WorkerThreadPool.h"
+
+using namespace ocpp::messages;
+
+namespace ocpp
+{
+namespace localcontroller
+{
+
+/** @brief Transaction id saved for a stored StartTransaction request which has been rejected by the Central System */
+constexpr int StoreAndForwardManager::REJECTED_TRANSACTION_ID;
+
+/** @brief Constructor */
+StoreAndForwardManager::StoreAndForwardManager(const std::string&                          identifier,
+                                               const ocpp::config::ILocalControllerConfig& stack_config,
+                                               ocpp::database::Database*                   database,
+                                               ocpp::helpers::ITimerPool&                  timer_pool,
+                                               ocpp::helpers::WorkerThreadPool&            worker_pool,
+                                               ICentralSystemProxy&                        central_system)
+    : m_identifier(identifier),
+      m_stack_config(stack_config),
+      m_database(database),
+      m_worker_pool(worker_pool),
+      m_central_system(central_system),
+      m_insert_query(),
+      m_delete_query(),
+      m_save_transaction_query(),
+      m_delete_transaction_query(),
+      m_mutex(),
+      m_fifo(),
+      m_id(0),
+      m_transaction_ids(),
+      m_next_transaction_id(-1),
+      m_replay_timer(timer_pool, "Store and forward"),
+      m_replay_mutex(),
+      m_replay_end_cond(),
+      m_replay_in_progress(false)
+{
+    m_replay_timer.setCallback(std::bind(&StoreAndForwardManager::scheduleReplay, this));
+}
+
+/** @brief Destructor */
+StoreAndForwardManager::~StoreAndForwardManager()
+{
+    // Wait for the end of the replay in progress
+    m_replay_timer.stop();
+    std::unique_lock<std::mutex> lock(m_replay_mutex);
+    m_replay_end_cond.wait(lock, [this] { return !m_replay_in_progress; });
+}
+
+/** @brief Initialize the database tables and load the requests stored for the Charge Point */
+void StoreAndForwardManager::initDatabaseTable()
+{
+    if (m_database)
+    {
+        // Create tables
+        auto query = m_database->query("CREATE TABLE IF NOT EXISTS StoreAndForward ("
+                                       "[id]	INT UNSIGNED,"
+                                       "[chargepoint] VARCHAR(64),"
+                                       "[action]	VARCHAR(64),"
+                                       "[request] VARCHAR(1024),"
+                                       "[transaction_id] INT,"
+                                       "PRIMARY KEY([chargepoint],[id]));");
+        if (query.get())
+        {
+            query->exec();
+        }
+        query = m_database->query("CREATE TABLE IF NOT EXISTS StoreAndForwardTransactions ("
+                                  "[chargepoint] VARCHAR(64),"
+                                  "[local_id] INT,"
+                                  "[id] INT,"
+                                  "PRIMARY KEY([chargepoint],[local_id]));");
+        if (query.get())
+        {
+            query->exec();
+        }
+
+        // Create parametrized queries
+        m_insert_query             = m_database->query("INSERT INTO StoreAndForward VALUES (?, ?, ?, ?, ?);");
+        m_delete_query             = m_database->query("DELETE FROM StoreAndForward WHERE chargepoint=? AND id=?;");
+        m_save_transaction_query   = m_database->query("INSERT OR REPLACE INTO StoreAndForwardTransactions VALUES (?, ?, ?);");
+        m_delete_transaction_query = m_database->query("DELETE FROM StoreAndForwardTransactions WHERE chargepoint=? AND local_id=?;");
+
+        // Load data
+        load();
+    }
+}
+
+/** @brief Indicate if a request can be stored and acknowledged locally */
+bool StoreAndForwardManager::isHandled(const std::string& action)
+{
+    return ((action == START_TRANSACTION_ACTION) || (action == STOP_TRANSACTION_ACTION) || (action == METER_VALUES_ACTION));
+}
+
+/** @brief Forward a transaction related request to the Central System, or store it and acknowledge it locally */
+bool StoreAndForwardManager::process(const std::string&      action,
+                                     const rapidjson::Value& payload,
+                                     rapidjson::Document&    response,
+                                     std::string&            error,
+                                     std::string&            message)
+{
+    bool ret = false;
+
+    // Replace the local transaction id by the one allocated by the Central System
+    rapidjson::Document request;
+    request.CopyFrom(payload, request.GetAllocator());
+    int  local_transaction_id = 0;
+    bool forward_now          = false;
+    bool rejected             = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        local_transaction_id = updateTransactionId(action, request);
+
+        // Requests of a transaction unknown by the Central System are not forwarded
+        rejected = isRejectedTransaction(local_transaction_id);
+        if (rejected && (action == STOP_TRANSACTION_ACTION))
+        {
+            deleteTransactionId(local_transaction_id);
+        }
+
+        // Requests are forwarded directly only if there are no older requests to replay
+        forward_now = !rejected && m_fifo.empty() && m_central_system.isConnected();
+    }
+
+    // Try to forward message
+    if (rejected)
+    {
+        LOG_WARNING << "[" << m_identifier << "] - [" << action << "] request for transaction " << local_transaction_id
+                    << " rejected by the Central System, request dropped";
+        response.SetObject();
+        ret = true;
+    }
+    else if (forward_now)
+    {
+        std::string cs_error;
+        std::string cs_message;
+        ret = m_central_system.forward(action, request, response, cs_error, cs_message);
+        if (ret)
+        {
+            // End of a transaction started while the Central System was unreachable
+            if ((action == STOP_TRANSACTION_ACTION) && (local_transaction_id != 0))
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                deleteTransactionId(local_transaction_id);
+            }
+        }
+        else if (cs_error.empty())
+        {
+            LOG_WARNING << "[" << m_identifier << "] - Unable to forward [" << action << "] request, storing it";
+        }
+        else
+        {
+            LOG_WARNING << "[" << m_identifier << "] - CallError [" << cs_error << "] received on [" << action << "] request";
+            error   = cs_error.c_str();
+            message = cs_message;
+        }
+    }
+
+    // Store the request and acknowledge it locally
+    if (!ret && error.empty())
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ret = store(action, request, response);
+    }
+
+    return ret;
+}
+
+/** @brief Load the stored requests and transaction ids from the database */
+void StoreAndForwardManager::load()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Clear FIFO
+    while (!m_fifo.empty())
+    {
+        m_fifo.pop();
+    }
+    m_transaction_ids.clear();
+    m_next_transaction_id = -1;
+
+    // Query all stored requests
+    auto query = m_database->query("SELECT id, action, request, transaction_id FROM StoreAndForward WHERE chargepoint=? ORDER BY id ASC;");
+    if (query.get())
+    {
+        query->bind(0, m_identifier);
+        if (query->exec() && query->hasRows())
+        {
+            do
+            {
+                m_fifo.emplace(query->getUInt32(0), query->getString(1), query->getString(2), query->getInt32(3));
+            } while (query->next());
+
+            // Prepare for next entry
+            m_id = m_fifo.back().id + 1u;
+        }
+    }
+
+    // Query all transaction ids
+    query = m_database->query("SELECT local_id, id FROM StoreAndForwardTransactions WHERE chargepoint=?;");
+    if (query.get())
+    {
+        query->bind(0, m_identifier);
+        if (query->exec() && query->hasRows())
+        {
+            do
+            {
+                int local_transaction_id                = query->getInt32(0);
+                m_transaction_ids[local_transaction_id] = query->getInt32(1);
+                if (local_transaction_id <= m_next_transaction_id)
+                {
+                    m_next_transaction_id = local_transaction_id - 1;
+                }
+            } while (query->next());
+        }
+    }
+
+    LOG_INFO << "[" << m_identifier << "] - Store and forward : " << m_fifo.size() << " message(s) pending";
+
+    // Replay as soon as the Central System is reachable
+    if (!m_fifo.empty())
+    {
+        m_replay_timer.start(m_stack_config.storeAndForwardReplayInterval());
+    }
+}
+
+/** @brief Store a request and build its local response (must be called with the mutex locked) */
+bool StoreAndForwardManager::store(const std::string& action, const rapidjson::Document& request, rapidjson::Document& response)
+{
+    bool ret = false;
+
+    // Check the capacity
+    unsigned int max_messages = m_stack_config.storeAndForwardMaxMessages();
+    if ((max_messages == 0) || (m_fifo.size() < max_messages))
+    {
+        LOG_DEBUG << "[" << m_identifier << "] - Store and forward : storing " << action << " request";
+
+        // Build local response
+        int transaction_id = 0;
+        response.SetObject();
+        if (action == START_TRANSACTION_ACTION)
+        {
+            // Allocate a local transaction id, it will be replaced by the one
+            // allocated by the Central System when the request will be replayed
+            transaction_id = m_next_transaction_id;
+            m_next_transaction_id--;
+            saveTransactionId(transaction_id, 0);
+
+            rapidjson::Value id_tag_info(rapidjson::kObjectType);
+            id_tag_info.AddMember("status", "Accepted", response.GetAllocator());
+            response.AddMember("idTagInfo", id_tag_info, response.GetAllocator());
+            response.AddMember("transactionId", transaction_id, response.GetAllocator());
+        }
+
+        // Serialize request
+        rapidjson::StringBuffer                    buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+        request.Accept(writer);
+        std::string request_str = buffer.GetString();
+
+        // Add a new entry to the FIFO
+        m_fifo.emplace(m_id, action, request_str, transaction_id);
+        if (m_insert_query)
+        {
+            m_insert_query->bind(0, m_id);
+            m_insert_query->bind(1, m_identifier);
+            m_insert_query->bind(2, action);
+            m_insert_query->bind(3, request_str);
+            m_insert_query->bind(4, transaction_id);
+            m_insert_query->exec();
+            m_insert_query->reset();
+        }
+        m_id++;
+
+        // Start replay processing
+        if (!m_replay_timer.isStarted())
+        {
+            m_replay_timer.start(m_stack_config.storeAndForwardReplayInterval());
+        }
+
+        ret = true;
+    }
+    else
+    {
+        LOG_WARNING << "[" << m_identifier << "] - Store and forward : FIFO full, " << action << " request rejected";
+    }
+
+    return ret;
+}
+
+/** @brief Replace a local transaction id by the one allocated by the Central System (must be called with the mutex locked) */
+int StoreAndForwardManager::updateTransactionId(const std::string& action, rapidjson::Document& request)
+{
+    int ret = 0;
+
+    if ((action == STOP_TRANSACTION_ACTION) || (action == METER_VALUES_ACTION))
+    {
+        auto it_transaction_id = request.FindMember("transactionId");
+        if ((it_transaction_id != request.MemberEnd()) && it_transaction_id->value.IsInt())
+        {
+            auto it = m_transaction_ids.find(it_transaction_id->value.GetInt());
+            if (it != m_transaction_ids.end())
+            {
+                ret = it->first;
+                if ((it->second != 0) && (it->second != REJECTED_TRANSACTION_ID))
+                {
+                    it_transaction_id->value.SetInt(it->second);
+                }
+            }
+        }
+    }
+
+    return ret;
+}
+
+/** @brief Indicate if the StartTransaction request of a local transaction has been rejected (must be called with the mutex locked) */
+bool StoreAndForwardManager::isRejectedTransaction(int local_transaction_id) const
+{
+    bool ret = false;
+
+    auto it = m_transaction_ids.find(local_transaction_id);
+    if (it != m_transaction_ids.end())
+    {
+        ret = (it->second == REJECTED_TRANSACTION_ID);
+    }
+
+    return ret;
+}
+
+/** @brief Save a transaction id (must be called with the mutex locked) */
+void StoreAndForwardManager::saveTransactionId(int local_transaction_id, int transaction_id)
+{
+    m_transaction_ids[local_transaction_id] = transaction_id;
+    if (m_save_transaction_query)
+    {
+        m_save_transaction_query->bind(0, m_identifier);
+        m_save_transaction_query->bind(1, local_transaction_id);
+        m_save_transaction_query->bind(2, transaction_id);
+        m_save_transaction_query->exec();
+        m_save_transaction_query->reset();
+    }
+}
+
+/** @brief Delete a transaction id (must be called with the mutex locked) */
+void StoreAndForwardManager::deleteTransactionId(int local_transaction_id)
+{
+    m_transaction_ids.erase(local_transaction_id);
+    if (m_delete_transaction_query)
+    {
+        m_delete_transaction_query->bind(0, m_identifier);
+        m_delete_transaction_query->bind(1, local_transaction_id);
+        m_delete_transaction_query->exec();
+        m_delete_transaction_query->reset();
+    }
+}
+
+/** @brief Schedule a replay of the stored requests */
+void StoreAndForwardManager::scheduleReplay()
+{
+    bool start_replay = false;
+    {
+        std::lock_guard<std::mutex> lock(m_replay_mutex);
+        if (!m_replay_in_progress && m_central_system.isConnected())
+        {
+            m_replay_in_progress = true;
+            start_replay         = true;
+        }
+    }
+    if (start_replay)
+    {
+        m_worker_pool.run<void>(std::bind(&StoreAndForwardManager::replay, this));
+    }
+}
+
+/** @brief Replay a batch of stored requests */
+void StoreAndForwardManager::replay()
+{
+    // OCPP-J allows only 1 pending request at a time on a connection, so the requests are replayed
+    // one after the other and the rate is limited by the size of the batches and the interval between them
+    unsigned int batch_size = m_stack_config.storeAndForwardReplayBatchSize();
+    unsigned int count      = 0;
+    bool         stop       = false;
+    while (!stop && ((batch_size == 0) || (count < batch_size)) && m_central_system.isConnected())
+    {
+        // Get the next request
+        std::string         action;
+        rapidjson::Document request;
+        int                 transaction_id       = 0;
+        int                 local_transaction_id = 0;
+        bool                rejected             = false;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_fifo.empty())
+            {
+                const Entry& entry = m_fifo.front();
+                action             = entry.action;
+                transaction_id     = entry.transaction_id;
+                request.Parse(entry.request.c_str());
+                local_transaction_id = updateTransactionId(action, request);
+                rejected             = isRejectedTransaction(local_transaction_id);
+            }
+            else
+            {
+                stop = true;
+            }
+        }
+        if (!stop)
+        {
+            // Send request, unless it belongs to a transaction unknown by the Central System
+            rapidjson::Document response;
+            std::string         error;
+            std::string         message;
+            bool                sent = false;
+            if (!rejected)
+            {
+                sent = m_central_system.forward(action, request, response, error, message);
+            }
+            if (sent || !error.empty() || rejected)
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (sent)
+                {
+                    if (action == START_TRANSACTION_ACTION)
+                    {
+                        // Save the transaction id allocated by the Central System
+                        auto it_transaction_id = response.FindMember("transactionId");
+                        if ((it_transaction_id != response.MemberEnd()) && it_transaction_id->value.IsInt())
+                        {
+                            saveTransactionId(transaction_id, it_transaction_id->value.GetInt());
+                        }
+                    }
+                    else if ((action == STOP_TRANSACTION_ACTION) && (local_transaction_id != 0))
+                    {
+                        // End of the transaction
+                        deleteTransactionId(local_transaction_id);
+                    }
+                }
+                else if (rejected)
+                {
+                    LOG_WARNING << "[" << m_identifier << "] - Stored [" << action << "] request for transaction " << local_transaction_id
+                                << " rejected by the Central System, request dropped";
+                    if (action == STOP_TRANSACTION_ACTION)
+                    {
+                        deleteTransactionId(local_transaction_id);
+                    }
+                }
+                else
+                {
+                    // Replaying the request will not change the Central System's answer
+                    LOG_WARNING << "[" << m_identifier << "] - CallError [" << error << "] received on stored [" << action
+                                << "] request, request dropped";
+                    if (action == START_TRANSACTION_ACTION)
+                    {
+                        // The dependent requests of the transaction must not be sent with its local transaction id
+                        saveTransactionId(transaction_id, REJECTED_TRANSACTION_ID);
+                    }
+                }
+
+                // Remove request from the FIFO and from the database
+                if (m_delete_query)
+                {
+                    m_delete_query->bind(0, m_identifier);
+                    m_delete_query->bind(1, m_fifo.front().id);
+                    m_delete_query->exec();
+                    m_delete_query->reset();
+                }
+                m_fifo.pop();
+                count++;
+            }
+            else
+            {
+                // Retry at next replay
+                stop = true;
+            }
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (count != 0)
+        {
+            LOG_INFO << "[" << m_identifier << "] - Store and forward : " << count << " message(s) replayed, " << m_fifo.size()
+                     << " message(s) pending";
+        }
+
+        // Stop replay processing
+        if (m_fifo.empty())
+        {
+            m_replay_timer.stop();
+        }
+    }
+
+    // End of replay
+    std::lock_guard<std::mutex> lock(m_replay_mutex);
+    m_replay_in_progress = false;
+    m_replay_end_cond.notify_all();
+}
+
+} // namespace localcontroller
+} // namespace ocpp
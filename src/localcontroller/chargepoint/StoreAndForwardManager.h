@@ -0,0 +1,191 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPENOCPP_LC_STOREANDFORWARDMANAGER_H
+#define OPENOCPP_LC_STOREANDFORWARDMANAGER_H
+
+#include "Database.h"
+#include "Timer.h"
+#include "json.h"
+
+#include <condition_variable>
+#include <limits>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <unordered_map>
+
+namespace ocpp
+{
+// Forward declarations
+namespace config
+{
+class ILocalControllerConfig;
+} // namespace config
+namespace helpers
+{
+class WorkerThreadPool;
+} // namespace helpers
+
+// Main namespace
+namespace localcontroller
+{
+
+class ICentralSystemProxy;
+
+/** @brief Acknowledge locally the transaction related requests of a Charge Point while the Central System is unreachable,
+ *         and replay them in order once the connection is back
+ *
+ *  Delivery is at-least-once : a stored request is removed as soon as the Central System has answered it,
+ *  but if the local controller stops between the answer and the removal, the request is replayed again on restart.
+ */
+class StoreAndForwardManager
+{
+  public:
+    /**
+     * @brief Constructor
+     * @param identifier Charge point's identifier
+     * @param stack_config Stack configuration
+     * @param database Local controller's database (can be null, the requests are then only stored in memory)
+     * @param timer_pool Timer pool
+     * @param worker_pool Worker thread pool
+     * @param central_system Proxy to forward requests to the central system
+     */
+    StoreAndForwardManager(const std::string&                          identifier,
+                           const ocpp::config::ILocalControllerConfig& stack_config,
+                           ocpp::database::Database*                   database,
+                           ocpp::helpers::ITimerPool&                  timer_pool,
+                           ocpp::helpers::WorkerThreadPool&            worker_pool,
+                           ICentralSystemProxy&                        central_system);
+
+    /** @brief Destructor */
+    virtual ~StoreAndForwardManager();
+
+    /** @brief Initialize the database tables and load the requests stored for the Charge Point */
+    void initDatabaseTable();
+
+    /**
+     * @brief Indicate if a request can be stored and acknowledged locally
+     * @param action RPC action for the request
+     * @return true for StartTransaction, StopTransaction and MeterValues requests, false otherwise
+     */
+    static bool isHandled(const std::string& action);
+
+    /**
+     * @brief Forward a transaction related request to the Central System, or store it and acknowledge it locally
+     *        if the Central System is unreachable or if older requests are still waiting to be replayed
+     * @param action RPC action for the request
+     * @param payload JSON payload of the request
+     * @param response JSON payload of the response
+     * @param error Error code to return to the Charge Point, empty if no error
+     * @param message Error message to return to the Charge Point, empty if no error
+     * @return true if a response has been received or built locally, false otherwise
+     */
+    bool process(const std::string&      action,
+                 const rapidjson::Value& payload,
+                 rapidjson::Document&    response,
+                 std::string&            error,
+                 std::string&            message);
+
+  private:
+    /** @brief Transaction id saved for a stored StartTransaction request which has been rejected by the Central System */
+    static constexpr int REJECTED_TRANSACTION_ID = std::numeric_limits<int>::min();
+
+    /** @brief FIFO entry */
+    struct Entry
+    {
+        /** @brief Constructor */
+        Entry(unsigned int _id, const std::string& _action, const std::string& _request, int _transaction_id)
+            : id(_id), action(_action), request(_request), transaction_id(_transaction_id)
+        {
+        }
+
+        /** @brief Id */
+        unsigned int id;
+        /** @brief Action */
+        std::string action;
+        /** @brief Request */
+        std::string request;
+        /** @brief Local transaction id allocated for a StartTransaction request */
+        int transaction_id;
+    };
+
+    /** @brief Charge point's identifier */
+    const std::string m_identifier;
+    /** @brief Stack configuration */
+    const ocpp::config::ILocalControllerConfig& m_stack_config;
+    /** @brief Local controller's database */
+    ocpp::database::Database* m_database;
+    /** @brief Worker thread pool */
+    ocpp::helpers::WorkerThreadPool& m_worker_pool;
+    /** @brief Proxy to forward requests to the central system */
+    ICentralSystemProxy& m_central_system;
+
+    /** @brief Query to insert a request */
+    std::unique_ptr<ocpp::database::Database::Query> m_insert_query;
+    /** @brief Query to delete a replayed request */
+    std::unique_ptr<ocpp::database::Database::Query> m_delete_query;
+    /** @brief Query to insert or update a transaction id */
+    std::unique_ptr<ocpp::database::Database::Query> m_save_transaction_query;
+    /** @brief Query to delete a transaction id */
+    std::unique_ptr<ocpp::database::Database::Query> m_delete_transaction_query;
+
+    /** @brief Protect simultaneous access to the FIFO, the transaction ids and the queries */
+    std::mutex m_mutex;
+    /** @brief FIFO of the stored requests */
+    std::queue<Entry> m_fifo;
+    /** @brief Id of the next stored request */
+    unsigned int m_id;
+    /** @brief Transaction ids allocated by the Central System indexed by local transaction id
+     *         (0 = not known yet, REJECTED_TRANSACTION_ID = StartTransaction rejected) */
+    std::unordered_map<int, int> m_transaction_ids;
+    /** @brief Next local transaction id (local transaction ids are negative) */
+    int m_next_transaction_id;
+
+    /** @brief Replay timer */
+    ocpp::helpers::Timer m_replay_timer;
+    /** @brief Protect the replay state */
+    std::mutex m_replay_mutex;
+    /** @brief Signal the end of a replay */
+    std::condition_variable m_replay_end_cond;
+    /** @brief Indicate that a replay is in progress */
+    bool m_replay_in_progress;
+
+    /** @brief Load the stored requests and transaction ids from the database */
+    void load();
+    /** @brief Store a request and build its local response (must be called with the mutex locked) */
+    bool store(const std::string& action, const rapidjson::Document& request, rapidjson::Document& response);
+    /** @brief Replace a local transaction id by the one allocated by the Central System (must be called with the mutex locked)
+     *  @return Replaced local transaction id, 0 if none */
+    int updateTransactionId(const std::string& action, rapidjson::Document& request);
+    /** @brief Indicate if the StartTransaction request of a local transaction has been rejected (must be called with the mutex locked) */
+    bool isRejectedTransaction(int local_transaction_id) const;
+    /** @brief Save a transaction id (must be called with the mutex locked) */
+    void saveTransactionId(int local_transaction_id, int transaction_id);
+    /** @brief Delete a transaction id (must be called with the mutex locked) */
+    void deleteTransactionId(int local_transaction_id);
+    /** @brief Schedule a replay of the stored requests */
+    void scheduleReplay();
+    /** @brief Replay a batch of stored requests */
+    void replay();
+};
+
+} // namespace localcontroller
+} // namespace ocpp
+
+#endif // OPENOCPP_LC_STOREANDFORWARDMANAGER_H
@@ -117,6 +117,21 @@ class ICentralSystemProxy
      */
     virtual void registerListener(ILocalControllerProxyEventsHandler& listener) = 0;
 
+    /**
+     * @brief Forward a request to the central system without decoding it (transparent forwarding)
+     * @param action RPC action for the request
+     * @param request JSON payload of the request
+     * @param response JSON payload of the received response
+     * @param error Error (Empty if not a CallError)
+     * @param message Error message (Empty if not a CallError)
+     * @return true if the request has been sent and a response has been received, false otherwise
+     */
+    virtual bool forward(const std::string&      action,
+                         const rapidjson::Value& request,
+                         rapidjson::Document&    response,
+                         std::string&            error,
+                         std::string&            message) = 0;
+
     /**
      * @brief Notify the startup of the device
      * @param request Request to send
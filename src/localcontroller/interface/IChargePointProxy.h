@@ -83,6 +83,12 @@ class IChargePointProxy
      */
     virtual const std::string& ipAddress() const = 0;
 
+    /**
+     * @brief Get the statistics of the websocket send queue of the charge point
+     * @return Statistics of the websocket send queue
+     */
+    virtual ocpp::websockets::SendQueueStats sendQueueStats() const = 0;
+
     /**
      * @brief Get the charge point identifier
      * @return charge point identifier
@@ -110,6 +116,21 @@ class IChargePointProxy
      */
     virtual void registerListener(ILocalControllerProxyEventsHandler& listener) = 0;
 
+    /**
+     * @brief Forward a request to the charge point without decoding it (transparent forwarding)
+     * @param action RPC action for the request
+     * @param request JSON payload of the request
+     * @param response JSON payload of the received response
+     * @param error Error (Empty if not a CallError)
+     * @param message Error message (Empty if not a CallError)
+     * @return true if the request has been sent and a response has been received, false otherwise
+     */
+    virtual bool forward(const std::string&      action,
+                         const rapidjson::Value& request,
+                         rapidjson::Document&    response,
+                         std::string&            error,
+                         std::string&            message) = 0;
+
     // OCPP operations
 
     /**
@@ -26,6 +26,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "ILocalControllerConfig.h"
 #include "KeyValue.h"
 #include "SecurityEvent.h"
+#include "TlsSession.h"
 
 #include <memory>
 
@@ -110,6 +111,12 @@ class ILocalController
      * @return true if the local controller has been stopped, false otherwise
      */
     virtual bool stop() = 0;
+
+    /**
+     * @brief Get the statistics of the TLS handshakes of the charge point connections
+     * @return Statistics of the TLS handshakes
+     */
+    virtual ocpp::websockets::TlsStats getTlsStats() const = 0;
 };
 
 } // namespace localcontroller
@@ -39,6 +39,20 @@ class ILocalControllerConfig : public ICentralSystemConfig
     virtual unsigned int incomingRequestsFromCsThreadPoolSize() const = 0;
     /** @brief Disconnect from Charge Point on Central System disconnection */
     virtual bool disconnectFromCpWhenCsDisconnected() const = 0;
+    /** @brief Forward the requests between Charge Point and Central System without decoding them
+               (only the requests for which a user handler has been registered are decoded) */
+    virtual bool transparentForwarding() const = 0;
+    /** @brief Validate the JSON payloads of the requests and responses forwarded in transparent mode against the OCPP schemas */
+    virtual bool transparentForwardingValidation() const = 0;
+    /** @brief Acknowledge locally the transaction related requests (StartTransaction, StopTransaction, MeterValues)
+               when the Central System is unreachable, and replay them once the connection is back */
+    virtual bool storeAndForward() const = 0;
+    /** @brief Maximum number of stored requests per Charge Point (0 = no limit) */
+    virtual unsigned int storeAndForwardMaxMessages() const = 0;
+    /** @brief Maximum number of stored requests replayed in a row (0 = no limit) */
+    virtual unsigned int storeAndForwardReplayBatchSize() const = 0;
+    /** @brief Interval between 2 replays of stored requests */
+    virtual std::chrono::milliseconds storeAndForwardReplayInterval() const = 0;
 
     // Unused from Central System configuration interface
 
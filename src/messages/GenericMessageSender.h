@@ -130,9 +130,8 @@ class GenericMessageSender
         CallResult ret = CallResult::Failed;
 
         // Get converters
-        auto req_converter  = m_messages_converter.getRequestConverter<RequestType>(action);
-        auto resp_converter = m_messages_converter.getResponseConverter<ResponseType>(action);
-        if (req_converter && resp_converter)
+        auto req_converter = m_messages_converter.getRequestConverter<RequestType>(action);
+        if (req_converter)
         {
             // Convert request
             rapidjson::Document payload;
@@ -140,117 +139,162 @@ class GenericMessageSender
             req_converter->setAllocator(&payload.GetAllocator());
             if (req_converter->toJson(request, payload))
             {
-                // Check if request_fifo is empty
-                if (!request_fifo || request_fifo->empty())
+                ret = call(action, payload, response, error, message, request_fifo, connector_id);
+            }
+        }
+
+        return ret;
+    }
+
+    /**
+     * @brief Execute a call request on a JSON request
+     * @param action RPC action for the request
+     * @param request JSON request payload
+     * @param response Response payload
+     * @return Result of the call request (See CallResult documentation)
+     */
+    template <typename ResponseType>
+    CallResult call(const std::string& action, const rapidjson::Document& request, ResponseType& response)
+    {
+        std::string error;
+        std::string message;
+        return call(action, request, response, error, message, nullptr, 0);
+    }
+
+    /**
+     * @brief Execute a call request on a JSON request
+     * @param action RPC action for the request
+     * @param request JSON request payload
+     * @param response Response payload
+     * @param error Error (Empty if not a CallError)
+     * @param message Error message (Empty if not a CallError)
+     * @param request_fifo Pointer to the request FIFO to use when messages cannot be sent.
+     * @param connector_id Id of the connector associated to the request.
+     * @return Result of the call request (See CallResult documentation)
+     */
+    template <typename ResponseType>
+    CallResult call(const std::string&         action,
+                    const rapidjson::Document& request,
+                    ResponseType&              response,
+                    std::string&               error,
+                    std::string&               message,
+                    IRequestFifo*              request_fifo,
+                    unsigned int               connector_id)
+    {
+        CallResult ret = CallResult::Failed;
+
+        // Get converter
+        auto resp_converter = m_messages_converter.getResponseConverter<ResponseType>(action);
+        if (resp_converter)
+        {
+            // Check if request_fifo is empty
+            if (!request_fifo || request_fifo->empty())
+            {
+                // Execute call
+                rapidjson::Document rpc_frame;
+                rapidjson::Value    resp;
+                if (m_rpc.call(action, request, rpc_frame, resp, error, message, m_timeout))
                 {
-                    // Execute call
-                    rapidjson::Document rpc_frame;
-                    rapidjson::Value    resp;
-                    if (m_rpc.call(action, payload, rpc_frame, resp, error, message, m_timeout))
+                    // Check error
+                    if (error.empty())
                     {
-                        // Check error
-                        if (error.empty())
+                        // Validate response
+                        ocpp::json::JsonValidator* validator = m_messages_validator.getValidator(action, false);
+                        if (validator)
                         {
-                            // Validate response
-                            ocpp::json::JsonValidator* validator = m_messages_validator.getValidator(action, false);
-                            if (validator)
+                            if (validator->isValid(resp))
                             {
-                                if (validator->isValid(resp))
-                                {
-                                    // Convert response
-                                    std::string error_code;
-                                    std::string error_message;
-                                    resp_converter->setAllocator(&rpc_frame.GetAllocator());
-                                    if (resp_converter->fromJson(resp, response, error_code, error_message))
-                                    {
-                                        ret = CallResult::Ok;
-                                    }
-                                }
-                                else
+                                // Convert response
+                                std::string error_code;
+                                std::string error_message;
+                                resp_converter->setAllocator(&rpc_frame.GetAllocator());
+                                if (resp_converter->fromJson(resp, response, error_code, error_message))
                                 {
-                                    LOG_ERROR << "[" << action << "] - Invalid response : " << validator->lastError();
+                                    ret = CallResult::Ok;
                                 }
                             }
-                        }
-                        else
-                        {
-                            ret = CallResult::Error;
+                            else
+                            {
+                                LOG_ERROR << "[" << action << "] - Invalid response : " << validator->lastError();
+                            }
                         }
                     }
                     else
                     {
-                        // Request cannot be sent or timed out, queue the message inside the FIFO
-                        if (request_fifo)
-                        {
-                            request_fifo->push(connector_id, action, payload);
-                            ret = CallResult::Delayed;
-                        }
+                        ret = CallResult::Error;
                     }
                 }
                 else
                 {
-                    // FIFO is not empty, queue the message inside the FIFO to ensure the order of the messages
-                    request_fifo->push(connector_id, action, payload);
-                    ret = CallResult::Delayed;
+                    // Request cannot be sent or timed out, queue the message inside the FIFO
+                    if (request_fifo)
+                    {
+                        request_fifo->push(connector_id, action, request);
+                        ret = CallResult::Delayed;
+                    }
                 }
             }
+            else
+            {
+                // FIFO is not empty, queue the message inside the FIFO to ensure the order of the messages
+                request_fifo->push(connector_id, action, request);
+                ret = CallResult::Delayed;
+            }
         }
 
         return ret;
     }
 
     /**
-     * @brief Execute a call request on a JSON request
+     * @brief Execute a call request on a JSON request and retrieve the JSON response without any conversion
      * @param action RPC action for the request
      * @param request JSON request payload
-     * @param response Response payload
+     * @param response JSON response payload
+     * @param error Error (Empty if not a CallError)
+     * @param message Error message (Empty if not a CallError)
+     * @param validate Indicate if the response must be validated against the JSON schema of the action
      * @return Result of the call request (See CallResult documentation)
      */
-    template <typename ResponseType>
-    CallResult call(const std::string& action, const rapidjson::Document& request, ResponseType& response)
+    CallResult forward(const std::string&      action,
+                       const rapidjson::Value& request,
+                       rapidjson::Document&    response,
+                       std::string&            error,
+                       std::string&            message,
+                       bool                    validate)
     {
         CallResult ret = CallResult::Failed;
 
-        // Get converter
-        auto resp_converter = m_messages_converter.getResponseConverter<ResponseType>(action);
-        if (resp_converter)
+        // Execute call
+        rapidjson::Document rpc_frame;
+        rapidjson::Value    resp;
+        if (m_rpc.call(action, request, rpc_frame, resp, error, message, m_timeout))
         {
-            // Execute call
-            rapidjson::Document rpc_frame;
-            rapidjson::Value    resp;
-            std::string         error;
-            std::string         message;
-            if (m_rpc.call(action, request, rpc_frame, resp, error, message, m_timeout))
+            // Check error
+            if (error.empty())
             {
-                // Check error
-                if (error.empty())
+                // Validate response
+                bool valid = resp.IsObject();
+                if (valid && validate)
                 {
-                    // Validate response
                     ocpp::json::JsonValidator* validator = m_messages_validator.getValidator(action, false);
-                    if (validator)
+                    valid                                = (validator && validator->isValid(resp));
+                    if (validator && !valid)
                     {
-                        if (validator->isValid(resp))
-                        {
-                            // Convert response
-                            std::string error_code;
-                            std::string error_message;
-                            resp_converter->setAllocator(&rpc_frame.GetAllocator());
-                            if (resp_converter->fromJson(resp, response, error_code, error_message))
-                            {
-                                ret = CallResult::Ok;
-                            }
-                        }
-                        else
-                        {
-                            LOG_ERROR << "[" << action << "] - Invalid response : " << validator->lastError();
-                        }
+                        LOG_ERROR << "[" << action << "] - Invalid response : " << validator->lastError();
                     }
                 }
-                else
+                if (valid)
                 {
-                    ret = CallResult::Error;
+                    // Take the ownership of the received frame to avoid copying the response
+                    response.Swap(rpc_frame);
+                    static_cast<rapidjson::Value&>(response).Swap(resp);
+                    ret = CallResult::Ok;
                 }
             }
+            else
+            {
+                ret = CallResult::Error;
+            }
         }
 
         return ret;
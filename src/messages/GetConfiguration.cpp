@@ -106,10 +106,12 @@ bool GetConfigurationConfConverter::toJson(const GetConfigurationConf& data, rap
     {
         rapidjson::Value                    configurationKey(rapidjson::kArrayType);
         rapidjson::Document::AllocatorType& _allocator = json.GetAllocator();
+        configurationKey.Reserve(static_cast<rapidjson::SizeType>(data.configurationKey.value().size()), _allocator);
         for (const KeyValue& key : data.configurationKey.value())
         {
-            rapidjson::Document value;
-            value.Parse("{}");
+            // Build the key/readonly/value object directly in the response allocator
+            rapidjson::Value value(rapidjson::kObjectType);
+            value.MemberReserve(3u, _allocator);
             fill(value, "key", key.key);
             fill(value, "readonly", key.readonly);
             fill(value, "value", key.value);
@@ -122,6 +124,7 @@ bool GetConfigurationConfConverter::toJson(const GetConfigurationConf& data, rap
     {
         rapidjson::Value                    unknownKey(rapidjson::kArrayType);
         rapidjson::Document::AllocatorType& _allocator = json.GetAllocator();
+        unknownKey.Reserve(static_cast<rapidjson::SizeType>(data.unknownKey.value().size()), _allocator);
         for (const auto& key : data.unknownKey.value())
         {
             unknownKey.PushBack(rapidjson::Value(key.c_str(), static_cast<rapidjson::SizeType>(key.str().size()), _allocator).Move(),
@@ -122,7 +122,14 @@ class IMessageConverter
      * @param field Name of the field to fill
      * @param value Date and time value to fill
      */
-    void fill(rapidjson::Value& json, const char* name, const ocpp::types::DateTime& value) { fill(json, name, value.str()); }
+    void fill(rapidjson::Value& json, const char* name, const ocpp::types::DateTime& value)
+    {
+        char   buffer[ocpp::types::DateTime::MAX_STR_SIZE];
+        size_t len = value.format(buffer);
+        json.AddMember(rapidjson::StringRef(name),
+                       rapidjson::Value(buffer, static_cast<rapidjson::SizeType>(len), *allocator).Move(),
+                       *allocator);
+    }
 
     /**
      * @brief Helper function to fill a boolean value in a JSON object
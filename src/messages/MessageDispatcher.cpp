@@ -39,27 +39,44 @@ MessageDispatcher::~MessageDispatcher() { }
 
 /** @copydoc bool IMessageDispatcher::registerHandler(const std::string&, IMessageHandler&, bool) */
 bool MessageDispatcher::registerHandler(const std::string& action, IMessageHandler& handler, bool allow_replace)
+{
+    return registerHandler(action, handler, allow_replace, true);
+}
+
+/** @brief Register a message handler for a specific action */
+bool MessageDispatcher::registerHandler(const std::string& action, IMessageHandler& handler, bool allow_replace, bool validate)
 {
     bool ret = false;
 
     // Check if handler exists for this action
     if (allow_replace || (m_handlers.find(action) == m_handlers.end()))
     {
-        // Get the payload validator
-        ocpp::json::JsonValidator* validator = m_messages_validator.getValidator(action, true);
-        if (validator)
+        if (validate)
         {
-            LOG_DEBUG << "[" << action << "] Validator loaded";
-
-            // Add handler
-            std::pair<ocpp::json::JsonValidator*, IMessageHandler*> handler_data(validator, &handler);
-
-            m_handlers[action] = handler_data;
-            ret                = true;
+            // Get the payload validator
+            ocpp::json::JsonValidator* validator = m_messages_validator.getValidator(action, true);
+            if (validator)
+            {
+                LOG_DEBUG << "[" << action << "] Validator loaded";
+
+                // Add handler
+                std::pair<ocpp::json::JsonValidator*, IMessageHandler*> handler_data(validator, &handler);
+
+                m_handlers[action] = handler_data;
+                ret                = true;
+            }
+            else
+            {
+                LOG_ERROR << "[" << action << "] Unable to load validator";
+            }
         }
         else
         {
-            LOG_ERROR << "[" << action << "] Unable to load validator";
+            // Add handler without validator
+            std::pair<ocpp::json::JsonValidator*, IMessageHandler*> handler_data(nullptr, &handler);
+
+            m_handlers[action] = handler_data;
+            ret                = true;
         }
     }
 
@@ -86,17 +103,32 @@ bool MessageDispatcher::dispatchMessage(const std::string&      action,
         // Check payload
         auto&                      handler_data = it->second;
         ocpp::json::JsonValidator* validator    = handler_data.first;
-        if (validator && validator->isValid(payload))
+        if (validator)
+        {
+            if (validator->isValid(payload))
+            {
+                // Call handler
+                IMessageHandler* handler = handler_data.second;
+                ret                      = handler->handle(action, payload, response, error_code, error_message);
+            }
+            else
+            {
+                // Invalid payload
+                error_code    = ocpp::rpc::IRpc::RPC_ERROR_TYPE_CONSTRAINT_VIOLATION;
+                error_message = validator->lastError();
+            }
+        }
+        else if (payload.IsObject())
         {
-            // Call handler
+            // Call handler without validation
             IMessageHandler* handler = handler_data.second;
             ret                      = handler->handle(action, payload, response, error_code, error_message);
         }
         else
         {
             // Invalid payload
-            error_code    = ocpp::rpc::IRpc::RPC_ERROR_TYPE_CONSTRAINT_VIOLATION;
-            error_message = validator->lastError();
+            error_code    = ocpp::rpc::IRpc::RPC_ERROR_FORMATION_VIOLATION;
+            error_message = "Payload is not a JSON object";
         }
     }
     else
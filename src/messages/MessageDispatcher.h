@@ -50,6 +50,17 @@ class MessageDispatcher : public IMessageDispatcher
     /** @copydoc bool IMessageDispatcher::registerHandler(const std::string&, IMessageHandler&, bool) */
     bool registerHandler(const std::string& action, IMessageHandler& handler, bool allow_replace = false) override;
 
+    /**
+     * @brief Register a message handler for a specific action
+     * @param action Action
+     * @param handler Message handler
+     * @param allow_replace Indicate if the replacement of an already registered is allowed
+     * @param validate Indicate if the payloads must be validated against the JSON schema of the action,
+     *                 if false only the JSON type of the payload is checked
+     * @return false if a handler is already registered for this action, true otherwise
+     */
+    bool registerHandler(const std::string& action, IMessageHandler& handler, bool allow_replace, bool validate);
+
     /** @copydoc bool IMessageDispatcher::dispatchMessage(const std::string&,
                                                           const rapidjson::Value&,
                                                           rapidjson::Document&,
@@ -64,7 +75,7 @@ class MessageDispatcher : public IMessageDispatcher
   private:
     /** @brief JSON schemas needed to validate payloads */
     const MessagesValidator& m_messages_validator;
-    /** @brief Handlers */
+    /** @brief Handlers (a null validator means that the payloads are not validated) */
     std::unordered_map<std::string, std::pair<ocpp::json::JsonValidator*, IMessageHandler*>> m_handlers;
 };
 
@@ -18,6 +18,9 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 
 #include "MeterValueConverter.h"
 #include "IRpc.h"
+#include "StringHelpers.h"
+
+#include <cstring>
 
 using namespace ocpp::types;
 
@@ -43,7 +46,6 @@ bool MeterValueConverter::fromJson(const rapidjson::Value&  json,
         data.sampledValue.emplace_back();
         SampledValue& sampled_value = data.sampledValue.back();
 
-        extract(*it_sampled, "value", sampled_value.value);
         if ((*it_sampled).HasMember("context"))
         {
             sampled_value.context = ReadingContextHelper.fromString((*it_sampled)["context"].GetString());
@@ -68,6 +70,31 @@ bool MeterValueConverter::fromJson(const rapidjson::Value&  json,
         {
             sampled_value.unit = UnitOfMeasureHelper.fromString((*it_sampled)["unit"].GetString());
         }
+
+        // Only one representation of the value is filled : the numeric one, parsed directly from the JSON buffer,
+        // if it gives back exactly the received string when formatted, the string one otherwise
+        const rapidjson::Value& value   = (*it_sampled)["value"];
+        bool                    numeric = false;
+        if (value.IsString() && !(sampled_value.format == ValueFormat::SignedData))
+        {
+            double       number = 0.;
+            unsigned int scale  = 0;
+            if (ocpp::helpers::parseDecimal(value.GetString(), value.GetStringLength(), number, scale))
+            {
+                char   formatted[ocpp::helpers::MAX_DECIMAL_STR_SIZE];
+                size_t len = ocpp::helpers::formatDecimal(formatted, number, scale);
+                if ((len == value.GetStringLength()) && (memcmp(formatted, value.GetString(), len) == 0))
+                {
+                    sampled_value.number = number;
+                    sampled_value.scale  = static_cast<int>(scale);
+                    numeric              = true;
+                }
+            }
+        }
+        if (!numeric)
+        {
+            extract(*it_sampled, "value", sampled_value.value);
+        }
     }
     if (!ret)
     {
@@ -88,7 +115,18 @@ bool MeterValueConverter::toJson(const ocpp::types::MeterValue& data, rapidjson:
     {
         rapidjson::Document sampled;
         sampled.Parse("{}");
-        fill(sampled, "value", sampled_value.value);
+        if (sampled_value.serializeNumber())
+        {
+            char   number[ocpp::helpers::MAX_DECIMAL_STR_SIZE];
+            size_t len = ocpp::helpers::formatDecimal(number, sampled_value.number, static_cast<unsigned int>(sampled_value.scale));
+            sampled.AddMember(rapidjson::StringRef("value"),
+                              rapidjson::Value(number, static_cast<rapidjson::SizeType>(len), *allocator).Move(),
+                              *allocator);
+        }
+        else
+        {
+            fill(sampled, "value", sampled_value.value);
+        }
         if (sampled_value.context.isSet())
         {
             fill(sampled, "context", ReadingContextHelper.toString(sampled_value.context));
@@ -58,7 +58,7 @@ class IRpc
      * @return true if a response has been received, false otherwise
      */
     virtual bool call(const std::string&         action,
-                      const rapidjson::Document& payload,
+                      const rapidjson::Value&    payload,
                       rapidjson::Document&       rpc_frame,
                       rapidjson::Value&          response,
                       std::string&               error,
@@ -19,6 +19,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "RpcBase.h"
 #include "RpcPool.h"
 
+#include <cstring>
 #include <functional>
 #include <sstream>
 
@@ -39,6 +40,7 @@ RpcBase::RpcBase(RpcPool* pool)
     : m_pool(pool),
       m_rpc_listener(nullptr),
       m_spies(),
+      m_fast_path_handler(nullptr),
       m_transaction_id(0),
       m_call_mutex(),
       m_requests_queue(),
@@ -54,10 +56,10 @@ RpcBase::~RpcBase()
     stop();
 }
 
-/** @copydoc bool IRpc::call(const std::string&, const rapidjson::Document&, rapidjson::Document&, rapidjson::Value&,
+/** @copydoc bool IRpc::call(const std::string&, const rapidjson::Value&, rapidjson::Document&, rapidjson::Value&,
  *                           std::string&, std::string&, std::chrono::milliseconds) */
 bool RpcBase::call(const std::string&         action,
-                   const rapidjson::Document& payload,
+                   const rapidjson::Value&    payload,
                    rapidjson::Document&       rpc_frame,
                    rapidjson::Value&          response,
                    std::string&               error,
@@ -172,6 +174,12 @@ void RpcBase::unregisterSpy(IRpc::ISpy& spy)
     m_spies.erase(&spy);
 }
 
+/** @brief Register a fast path handler for the incoming CALL messages */
+void RpcBase::registerFastPathHandler(IFastPathHandler& handler)
+{
+    m_fast_path_handler = &handler;
+}
+
 // RpcBase interface
 
 /** @brief Process an incoming RPC request */
@@ -190,16 +198,8 @@ void RpcBase::processIncomingRequest(std::shared_ptr<RpcMessage>& rpc_message)
         writer.SetMaxDecimalPlaces(1); // OCPP decimals have 1 digit precision
         response.Accept(writer);
 
-        std::stringstream serialized_message;
-        serialized_message << "[";
-        serialized_message << CALLRESULT << ", ";
-        serialized_message << "\"" << rpc_message->unique_id << "\", ";
-        serialized_message << buffer.GetString();
-        serialized_message << "]";
-
         // Send message
-        std::string msg = serialized_message.str();
-        send(msg);
+        sendCallResult(rpc_message->unique_id, buffer.GetString());
     }
     else
     {
@@ -413,20 +413,30 @@ bool RpcBase::decodeCall(const std::string&      unique_id,
     // Check types
     if (action.IsString() && payload.IsObject())
     {
-        // Create request
-        auto msg = std::make_shared<RpcMessage>(unique_id, action.GetString(), rpc_frame, payload);
-
-        // Check if a pool has been configured
-        if (m_pool)
+        // Check if the request can be handled immediately
+        std::string response;
+        if (m_fast_path_handler && m_fast_path_handler->rpcFastCallReceived(action.GetString(), payload, response))
         {
-            // Add request to the pool
-            msg->owner = m_rpc_owner;
-            m_pool->getRequestQueue().push(std::move(msg));
+            // Send response
+            sendCallResult(unique_id, response.c_str());
         }
         else
         {
-            // Add request to the queue
-            m_requests_queue.push(std::move(msg));
+            // Create request
+            auto msg = std::make_shared<RpcMessage>(unique_id, action.GetString(), rpc_frame, payload);
+
+            // Check if a pool has been configured
+            if (m_pool)
+            {
+                // Add request to the pool
+                msg->owner = m_rpc_owner;
+                m_pool->getRequestQueue().push(std::move(msg));
+            }
+            else
+            {
+                // Add request to the queue
+                m_requests_queue.push(std::move(msg));
+            }
         }
 
         ret = true;
@@ -475,6 +485,24 @@ bool RpcBase::decodeCallError(const std::string&   unique_id,
     return ret;
 }
 
+/** @brief Send a CALLRESULT message */
+void RpcBase::sendCallResult(const std::string& unique_id, const char* payload)
+{
+    // Serialize message
+    std::string msg;
+    msg.reserve(unique_id.size() + strlen(payload) + 10u);
+    msg += "[";
+    msg += CALLRESULT;
+    msg += ", \"";
+    msg += unique_id;
+    msg += "\", ";
+    msg += payload;
+    msg += "]";
+
+    // Send message
+    send(msg);
+}
+
 /** @brief Send a CALLERROR message */
 void RpcBase::sendCallError(const std::string& unique_id, const char* error, const std::string& message)
 {
@@ -47,10 +47,10 @@ class RpcBase : public IRpc
 
     // IRpc interface
 
-    /** @copydoc bool IRpc::call(const std::string&, const rapidjson::Document&, rapidjson::Document&, rapidjson::Value&,
+    /** @copydoc bool IRpc::call(const std::string&, const rapidjson::Value&, rapidjson::Document&, rapidjson::Value&,
      *                           std::string&, std::string&, std::chrono::milliseconds) */
     bool call(const std::string&         action,
-              const rapidjson::Document& payload,
+              const rapidjson::Value&    payload,
               rapidjson::Document&       rpc_frame,
               rapidjson::Value&          response,
               std::string&               error,
@@ -66,6 +66,31 @@ class RpcBase : public IRpc
     /** @copydoc void IRpc::unregisterSpy(ISpy&) */
     void unregisterSpy(IRpc::ISpy& spy) override;
 
+    /** @brief Interface for the RPC fast path handlers */
+    class IFastPathHandler
+    {
+      public:
+        /** @brief Destructor */
+        virtual ~IFastPathHandler() { }
+
+        /**
+         * @brief Called from the reception context when a CALL message has been received,
+         *        before it is queued for processing (must not block)
+         * @param action Action
+         * @param payload JSON payload for the action
+         * @param response Serialized JSON response payload to send
+         * @return true if the call has been handled, false to process it through the standard path
+         */
+        virtual bool rpcFastCallReceived(const char* action, const rapidjson::Value& payload, std::string& response) = 0;
+    };
+
+    /**
+     * @brief Register a fast path handler for the incoming CALL messages
+     *        (must be done before any message reception)
+     * @param handler Fast path handler
+     */
+    void registerFastPathHandler(IFastPathHandler& handler);
+
     /** @brief RPC message owner */
     struct RpcMessageOwner
     {
@@ -154,6 +179,8 @@ class RpcBase : public IRpc
     IRpc::IListener* m_rpc_listener;
     /** @brief RPC spies */
     std::unordered_set<IRpc::ISpy*> m_spies;
+    /** @brief RPC fast path handler */
+    IFastPathHandler* m_fast_path_handler;
     /** @brief Transaction id */
     int m_transaction_id;
     /** @brief Mutex for concurrent call access */
@@ -186,6 +213,9 @@ class RpcBase : public IRpc
                          rapidjson::Value&    message,
                          rapidjson::Value&    payload);
 
+    /** @brief Send a CALLRESULT message */
+    void sendCallResult(const std::string& unique_id, const char* payload);
+
     /** @brief Send a CALLERROR message */
     void sendCallError(const std::string& unique_id, const char* error, const std::string& message);
 
@@ -160,6 +160,12 @@ const std::string& RpcServer::Client::ipAddress() const
     return m_websocket->ipAddress();
 }
 
+/** @brief Get the statistics of the send queue of the client */
+ocpp::websockets::SendQueueStats RpcServer::Client::sendQueueStats() const
+{
+    return m_websocket->sendQueueStats();
+}
+
 /** @brief Disconnect the client */
 bool RpcServer::Client::disconnect(bool notify_disconnected)
 {
@@ -139,6 +139,12 @@ class RpcServer : public ocpp::websockets::IWebsocketServer::IListener
          */
         const std::string& ipAddress() const;
 
+        /**
+         * @brief Get the statistics of the send queue of the client
+         * @return Statistics of the send queue
+         */
+        ocpp::websockets::SendQueueStats sendQueueStats() const;
+
         /**
          * @brief Disconnect the client
          * @param notify_disconnected Indicate if the listener must be notified when disconnected
@@ -27,7 +27,7 @@ namespace database
 {
 
 /** @brief Constructor */
-Database::Database() : m_db(nullptr) { }
+Database::Database() : m_db(nullptr), m_mutex(std::make_shared<std::recursive_mutex>()), m_transaction_owner() { }
 /** @brief Destructor */
 Database::~Database()
 {
@@ -98,6 +98,64 @@ std::unique_ptr<Database::Query> Database::query(const std::string& sql)
     return query;
 }
 
+/** @brief Start a transaction */
+bool Database::beginTransaction()
+{
+    bool ret = false;
+
+    // The lock is kept until the end of the transaction
+    m_mutex->lock();
+    if (m_db && (m_transaction_owner != std::this_thread::get_id()))
+    {
+        ret = (sqlite3_exec(m_db, "BEGIN TRANSACTION;", nullptr, nullptr, nullptr) == SQLITE_OK);
+    }
+    if (ret)
+    {
+        m_transaction_owner = std::this_thread::get_id();
+    }
+    else
+    {
+        m_mutex->unlock();
+    }
+
+    return ret;
+}
+
+/** @brief Commit the transaction started by the calling thread */
+bool Database::commitTransaction()
+{
+    bool ret = false;
+
+    if (m_transaction_owner == std::this_thread::get_id())
+    {
+        ret = (sqlite3_exec(m_db, "COMMIT TRANSACTION;", nullptr, nullptr, nullptr) == SQLITE_OK);
+        if (!ret)
+        {
+            // Do not leave the transaction opened for the other threads
+            sqlite3_exec(m_db, "ROLLBACK TRANSACTION;", nullptr, nullptr, nullptr);
+        }
+        m_transaction_owner = std::thread::id();
+        m_mutex->unlock();
+    }
+
+    return ret;
+}
+
+/** @brief Rollback the transaction started by the calling thread */
+bool Database::rollbackTransaction()
+{
+    bool ret = false;
+
+    if (m_transaction_owner == std::this_thread::get_id())
+    {
+        ret                 = (sqlite3_exec(m_db, "ROLLBACK TRANSACTION;", nullptr, nullptr, nullptr) == SQLITE_OK);
+        m_transaction_owner = std::thread::id();
+        m_mutex->unlock();
+    }
+
+    return ret;
+}
+
 /** @brief Get the string explaining the last error */
 std::string Database::lastError() const
 {
@@ -112,7 +170,10 @@ std::string Database::lastError() const
 // Database::Query
 
 /** @brief Constructor */
-Database::Query::Query(Database& database, sqlite3_stmt* stmt) : m_database(database), m_stmt(stmt), m_has_rows(false) { }
+Database::Query::Query(Database& database, sqlite3_stmt* stmt)
+    : m_database(database), m_mutex(database.m_mutex), m_stmt(stmt), m_has_rows(false)
+{
+}
 /** @brief Destructor */
 Database::Query::~Query()
 {
@@ -249,7 +310,8 @@ bool Database::Query::exec()
     m_has_rows = false;
 
     // Execute query
-    int result = sqlite3_step(m_stmt);
+    std::lock_guard<std::recursive_mutex> lock(*m_mutex);
+    int                                   result = sqlite3_step(m_stmt);
     if (result == SQLITE_DONE)
     {
         ret = true;
@@ -277,7 +339,8 @@ bool Database::Query::next()
     bool ret = false;
 
     // Execute next step
-    int result = sqlite3_step(m_stmt);
+    std::lock_guard<std::recursive_mutex> lock(*m_mutex);
+    int                                   result = sqlite3_step(m_stmt);
     if (result == SQLITE_ROW)
     {
         ret = true;
@@ -19,9 +19,12 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #ifndef OPENOCPP_DATABASE_H
 #define OPENOCPP_DATABASE_H
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 // Forward declarations
@@ -65,6 +68,25 @@ class Database
      */
     std::unique_ptr<Query> query(const std::string& sql);
 
+    /**
+     * @brief Start a transaction : the queries from the other threads are blocked until
+     *        the transaction is committed or rolled back (transactions can't be nested)
+     * @return true if the transaction has been started, false otherwise
+     */
+    bool beginTransaction();
+
+    /**
+     * @brief Commit the transaction started by the calling thread (it is rolled back if the commit fails)
+     * @return true if the transaction has been committed, false otherwise (or if no transaction has been started by the calling thread)
+     */
+    bool commitTransaction();
+
+    /**
+     * @brief Rollback the transaction started by the calling thread
+     * @return true if the transaction has been rolled back, false otherwise (or if no transaction has been started by the calling thread)
+     */
+    bool rollbackTransaction();
+
     /**
      * @brief Get the string explaining the last error
      * @return String explaining the last error
@@ -252,6 +274,8 @@ class Database
       private:
         /** @brief Associated database */
         Database& m_database;
+        /** @brief Database mutex (shared since a query can outlive its database) */
+        std::shared_ptr<std::recursive_mutex> m_mutex;
         /** @brief Statement handle */
         sqlite3_stmt* m_stmt;
         /** @brief Indicate if the query result has rows to extract data */
@@ -261,6 +285,11 @@ class Database
   private:
     /** @brief Database handle */
     sqlite3* m_db;
+    /** @brief Serialize the transactions with the queries of the other threads
+     *         (the connection is shared and SQLite only serializes single statements) */
+    std::shared_ptr<std::recursive_mutex> m_mutex;
+    /** @brief Thread which has started the current transaction */
+    std::atomic<std::thread::id> m_transaction_owner;
 };
 
 } // namespace database
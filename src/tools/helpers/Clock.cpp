@@ -0,0 +1,86 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Clock.h"
+
+#include <chrono>
+#include <cstring>
+#include <mutex>
+
+using namespace ocpp::types;
+
+namespace ocpp
+{
+namespace helpers
+{
+
+/** @brief Size of the ISO-8601 representation without the sub-second part and the timezone designator */
+static constexpr size_t SECONDS_STR_SIZE = 19u;
+
+/** @brief Mutex to protect the cached representation */
+static std::mutex s_mutex;
+/** @brief Second of the cached representation */
+static std::time_t s_cached_second = -1;
+/** @brief Cached representation */
+static char s_cached_str[DateTime::MAX_STR_SIZE];
+
+/** @brief Write the ISO-8601 representation of the current date and time in UTC into a buffer */
+size_t Clock::format(char* buffer, bool milliseconds)
+{
+    // Get current time
+    auto        now    = std::chrono::system_clock::now();
+    std::time_t second = std::chrono::system_clock::to_time_t(now);
+
+    // Refresh the cached representation once per second
+    {
+        std::lock_guard<std::mutex> lock(s_mutex);
+        if (second != s_cached_second)
+        {
+            DateTime(second).format(s_cached_str);
+            s_cached_second = second;
+        }
+        memcpy(buffer, s_cached_str, SECONDS_STR_SIZE);
+    }
+
+    // Add sub-second part and timezone designator
+    size_t len = SECONDS_STR_SIZE;
+    if (milliseconds)
+    {
+        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now - std::chrono::system_clock::from_time_t(second)).count();
+
+        buffer[len++] = '.';
+        buffer[len++] = static_cast<char>('0' + (ms / 100) % 10);
+        buffer[len++] = static_cast<char>('0' + (ms / 10) % 10);
+        buffer[len++] = static_cast<char>('0' + ms % 10);
+    }
+    buffer[len++] = 'Z';
+    buffer[len]   = 0;
+
+    return len;
+}
+
+/** @brief Get the ISO-8601 representation of the current date and time in UTC */
+std::string Clock::str(bool milliseconds)
+{
+    char   buffer[DateTime::MAX_STR_SIZE];
+    size_t len = format(buffer, milliseconds);
+    return std::string(buffer, len);
+}
+
+} // namespace helpers
+} // namespace ocpp
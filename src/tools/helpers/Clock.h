@@ -0,0 +1,63 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPENOCPP_CLOCK_H
+#define OPENOCPP_CLOCK_H
+
+#include "DateTime.h"
+
+#include <string>
+
+namespace ocpp
+{
+namespace helpers
+{
+
+/**
+ * @brief Coalesced clock source : the ISO-8601 representation of the current
+ *        date and time is only formatted once per second and shared by all the callers
+ */
+class Clock
+{
+  public:
+    /**
+     * @brief Get the current date and time
+     * @return Current date and time
+     */
+    static ocpp::types::DateTime now() { return ocpp::types::DateTime::now(); }
+
+    /**
+     * @brief Write the ISO-8601 representation of the current date and time in UTC into a buffer
+     * @param buffer Buffer to write into (at least ocpp::types::DateTime::MAX_STR_SIZE bytes)
+     * @param milliseconds Indicate if the representation must have a millisecond precision
+     * @return Number of characters written (not including the null terminating character)
+     */
+    static size_t format(char* buffer, bool milliseconds = false);
+
+    /**
+     * @brief Get the ISO-8601 representation of the current date and time in UTC
+     * @param milliseconds Indicate if the representation must have a millisecond precision
+     * @return ISO-8601 representation of the current date and time
+     */
+    static std::string str(bool milliseconds = false);
+};
+
+} // namespace helpers
+} // namespace ocpp
+
+#endif // OPENOCPP_CLOCK_H
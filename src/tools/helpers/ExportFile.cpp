@@ -0,0 +1,145 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "ExportFile.h"
+
+#ifdef WITH_ZLIB
+#include <zlib.h>
+#endif // WITH_ZLIB
+
+namespace ocpp
+{
+namespace helpers
+{
+
+/** @brief Constructor */
+ExportFile::ExportFile(const std::string& path, Compression compression, size_t buffer_size)
+    : m_compression(compression), m_file(nullptr), m_gz_file(nullptr), m_buffer(), m_buffer_size(buffer_size), m_error(false)
+{
+    m_buffer.reserve(m_buffer_size);
+#ifdef WITH_ZLIB
+    if (m_compression == Compression::Gzip)
+    {
+        gzFile gz_file = gzopen(path.c_str(), "wb");
+        if (gz_file)
+        {
+            gzbuffer(gz_file, static_cast<unsigned int>(m_buffer_size));
+            m_gz_file = gz_file;
+        }
+    }
+    else
+#endif // WITH_ZLIB
+    {
+        m_file = fopen(path.c_str(), "wb");
+    }
+}
+
+/** @brief Destructor */
+ExportFile::~ExportFile()
+{
+    close();
+}
+
+/** @brief Indicate if the file is opened */
+bool ExportFile::isOpen() const
+{
+    return (m_file || m_gz_file);
+}
+
+/** @brief Write data into the file */
+void ExportFile::write(const void* data, size_t size)
+{
+    if ((m_buffer.size() + size) > m_buffer_size)
+    {
+        flush();
+    }
+    m_buffer.append(reinterpret_cast<const char*>(data), size);
+}
+
+/** @brief Flush the pending data and close the file */
+bool ExportFile::close()
+{
+    bool ret = isOpen();
+    if (ret)
+    {
+        flush();
+        if (m_file)
+        {
+            m_error = (fclose(m_file) != 0) || m_error;
+            m_file  = nullptr;
+        }
+#ifdef WITH_ZLIB
+        if (m_gz_file)
+        {
+            m_error   = (gzclose(reinterpret_cast<gzFile>(m_gz_file)) != Z_OK) || m_error;
+            m_gz_file = nullptr;
+        }
+#endif // WITH_ZLIB
+        ret = !m_error;
+    }
+    return ret;
+}
+
+/** @brief Get the compression corresponding to a configuration string */
+ExportFile::Compression ExportFile::compression(const std::string& compression)
+{
+    Compression ret = Compression::None;
+#ifdef WITH_ZLIB
+    if (compression == "gzip")
+    {
+        ret = Compression::Gzip;
+    }
+#else
+    (void)compression;
+#endif // WITH_ZLIB
+    return ret;
+}
+
+/** @brief Get the file name extension corresponding to a compression */
+const char* ExportFile::extension(Compression compression)
+{
+    const char* ret = "";
+    if (compression == Compression::Gzip)
+    {
+        ret = ".gz";
+    }
+    return ret;
+}
+
+/** @brief Write the content of the buffer into the file */
+void ExportFile::flush()
+{
+    if (!m_buffer.empty())
+    {
+        if (m_file)
+        {
+            m_error = (fwrite(m_buffer.c_str(), 1u, m_buffer.size(), m_file) != m_buffer.size()) || m_error;
+        }
+#ifdef WITH_ZLIB
+        if (m_gz_file)
+        {
+            int size = static_cast<int>(m_buffer.size());
+            m_error  = (gzwrite(reinterpret_cast<gzFile>(m_gz_file), m_buffer.c_str(), static_cast<unsigned int>(size)) != size) || m_error;
+        }
+#endif // WITH_ZLIB
+        m_buffer.clear();
+    }
+}
+
+} // namespace helpers
+} // namespace ocpp
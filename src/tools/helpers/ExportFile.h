@@ -0,0 +1,114 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPENOCPP_EXPORTFILE_H
+#define OPENOCPP_EXPORTFILE_H
+
+#include <cstdio>
+#include <string>
+
+namespace ocpp
+{
+namespace helpers
+{
+
+/** @brief File in which data are exported, the writes are buffered and the data can be compressed on the fly */
+class ExportFile
+{
+  public:
+    /** @brief Compression of the file */
+    enum class Compression
+    {
+        /** @brief No compression */
+        None,
+        /** @brief gzip compression */
+        Gzip
+    };
+
+    /**
+     * @brief Constructor
+     * @param path Path of the file to create
+     * @param compression Compression of the file
+     * @param buffer_size Size of the write buffer in bytes
+     */
+    ExportFile(const std::string& path, Compression compression = Compression::None, size_t buffer_size = 64u * 1024u);
+
+    /** @brief Destructor */
+    virtual ~ExportFile();
+
+    /**
+     * @brief Indicate if the file is opened
+     * @return true if the file is opened, false otherwise
+     */
+    bool isOpen() const;
+
+    /**
+     * @brief Write data into the file
+     * @param data Data to write
+     * @param size Size of the data in bytes
+     */
+    void write(const void* data, size_t size);
+
+    /**
+     * @brief Write a string into the file
+     * @param str String to write
+     */
+    void write(const std::string& str) { write(str.c_str(), str.size()); }
+
+    /**
+     * @brief Flush the pending data and close the file
+     * @return true if all the data have been written, false otherwise
+     */
+    bool close();
+
+    /**
+     * @brief Get the compression corresponding to a configuration string
+     * @param compression Configuration string : none or gzip
+     * @return Corresponding compression (None if the string is unknown or if the compression is not supported)
+     */
+    static Compression compression(const std::string& compression);
+
+    /**
+     * @brief Get the file name extension corresponding to a compression
+     * @param compression Compression
+     * @return File name extension
+     */
+    static const char* extension(Compression compression);
+
+  private:
+    /** @brief Compression */
+    const Compression m_compression;
+    /** @brief Uncompressed file */
+    FILE* m_file;
+    /** @brief Compressed file */
+    void* m_gz_file;
+    /** @brief Write buffer */
+    std::string m_buffer;
+    /** @brief Size of the write buffer */
+    const size_t m_buffer_size;
+    /** @brief Indicate that a write has failed */
+    bool m_error;
+
+    /** @brief Write the content of the buffer into the file */
+    void flush();
+};
+
+} // namespace helpers
+} // namespace ocpp
+
+#endif // OPENOCPP_EXPORTFILE_H
@@ -19,8 +19,17 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "IniFile.h"
 
 #include <cctype>
+#include <cstdio>
+#include <filesystem>
 #include <fstream>
+#include <functional>
 #include <sstream>
+#ifdef _MSC_VER
+#include <io.h>
+#else  // _MSC_VER
+#include <fcntl.h>
+#include <unistd.h>
+#endif // _MSC_VER
 
 namespace ocpp
 {
@@ -28,21 +37,53 @@ namespace helpers
 {
 
 /** @brief Default constructor */
-IniFile::IniFile() : m_file(), m_sync(false), m_data() { }
+IniFile::IniFile()
+    : m_file(),
+      m_sync(false),
+      m_write_behind_delay(0),
+      m_mutex(),
+      m_store_mutex(),
+      m_flush_cond(),
+      m_flush_thread(nullptr),
+      m_end(false),
+      m_dirty(false),
+      m_dirty_since(),
+      m_data()
+{
+}
 /** @brief Load constructor */
-IniFile::IniFile(const std::string& path, bool sync) : m_file(), m_sync(false), m_data()
+IniFile::IniFile(const std::string& path, bool sync)
+    : m_file(),
+      m_sync(false),
+      m_write_behind_delay(0),
+      m_mutex(),
+      m_store_mutex(),
+      m_flush_cond(),
+      m_flush_thread(nullptr),
+      m_end(false),
+      m_dirty(false),
+      m_dirty_since(),
+      m_data()
 {
     load(path, sync);
 }
 /** @brief Destructor */
-IniFile::~IniFile() { }
+IniFile::~IniFile()
+{
+    stopFlushThread();
+    flush();
+}
 
 /** @brief Load a file in INI format */
 bool IniFile::load(const std::string& path, bool sync)
 {
     bool ret = false;
 
-    std::fstream file(path, std::fstream::in);
+    // Pending modifications belong to the previous file
+    flush();
+
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    std::fstream                        file(path, std::fstream::in);
     if (file.is_open())
     {
         std::string line;
@@ -118,51 +159,82 @@ bool IniFile::load(const std::string& path, bool sync)
     return ret;
 }
 
-/** @brief Store the data in INI format to the same file which has been used to load data */
-bool IniFile::store() const
+/** @brief Delay the automatic sync to filesystem */
+void IniFile::setWriteBehind(std::chrono::milliseconds delay)
 {
-    bool ret = false;
+    stopFlushThread();
+    flush();
 
-    if (!m_file.empty())
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    m_write_behind_delay = delay;
+    if (m_write_behind_delay > std::chrono::milliseconds(0))
+    {
+        m_end          = false;
+        m_flush_thread = new std::thread(std::bind(&IniFile::flushThread, this));
+    }
+}
+
+/** @brief Store the modifications which are pending because of the write-behind delay */
+bool IniFile::flush()
+{
+    bool        ret   = true;
+    bool        dirty = false;
+    std::string path;
+    {
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        dirty   = m_dirty;
+        path    = m_file;
+        m_dirty = false;
+    }
+    if (dirty)
+    {
+        ret = storeData(path, true);
+    }
+    else
     {
-        ret = store(m_file);
+        // Wait for the end of a store which may be in progress in the write-behind thread
+        std::lock_guard<std::mutex> store_lock(m_store_mutex);
     }
 
     return ret;
 }
 
-/** @brief Store the data in INI format to file in the filesystem */
-bool IniFile::store(const std::string& path) const
+/** @brief Store the data in INI format to the same file which has been used to load data */
+bool IniFile::store() const
 {
     bool ret = false;
 
-    std::fstream file(path, std::fstream::trunc | std::fstream::out);
-    if (file.is_open())
+    std::string path;
     {
-        for (const auto& section : m_data)
-        {
-            file << "[" << section.first << "]" << std::endl;
-            for (const auto& param : section.second)
-            {
-                file << param.first << "=" << param.second << std::endl;
-            }
-        }
-
-        ret = true;
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        path = m_file;
+    }
+    if (!path.empty())
+    {
+        ret = storeData(path, true);
     }
 
     return ret;
 }
 
+/** @brief Store the data in INI format to file in the filesystem */
+bool IniFile::store(const std::string& path) const
+{
+    return storeData(path, true);
+}
+
 /** @brief Clear the data */
 void IniFile::clear()
 {
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
     m_data.clear();
 }
 
 /** @brief Get the list of the sections */
 std::vector<std::string> IniFile::sections() const
 {
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+
     std::vector<std::string> sections;
     sections.reserve(m_data.size());
     for (const auto& pair : m_data)
@@ -175,6 +247,8 @@ std::vector<std::string> IniFile::sections() const
 /** @brief Get the list of the parameters of the selected section */
 std::vector<std::string> IniFile::operator[](const std::string& section) const
 {
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+
     std::vector<std::string> params;
     auto                     it = m_data.find(section);
     if (it != m_data.end())
@@ -193,7 +267,8 @@ IniFile::Value IniFile::get(const std::string& section, const std::string& name,
 {
     Value ret(default_value);
 
-    auto it_section = m_data.find(section);
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    auto                                it_section = m_data.find(section);
     if (it_section != m_data.end())
     {
         auto it_param = it_section->second.find(name);
@@ -209,28 +284,179 @@ IniFile::Value IniFile::get(const std::string& section, const std::string& name,
 /** @brief Set the value of a parameter */
 void IniFile::set(const std::string& section, const std::string& name, const Value& value)
 {
-    auto it_section = m_data.find(section);
-    if (it_section != m_data.end())
+    bool        store_now = false;
+    std::string path;
     {
-        auto it_param = it_section->second.find(name);
-        if (it_param != it_section->second.end())
+        std::unique_lock<std::shared_mutex> lock(m_mutex);
+        auto                                it_section = m_data.find(section);
+        if (it_section != m_data.end())
         {
-            it_param->second = value;
+            auto it_param = it_section->second.find(name);
+            if (it_param != it_section->second.end())
+            {
+                it_param->second = value;
+            }
+            else
+            {
+                it_section->second[name] = value;
+            }
         }
         else
         {
-            it_section->second[name] = value;
+            std::unordered_map<std::string, std::string> new_section;
+            new_section[name] = value;
+            m_data[section]   = new_section;
+        }
+        if (m_sync)
+        {
+            if (m_flush_thread)
+            {
+                // Let the write-behind thread store the modifications
+                if (!m_dirty)
+                {
+                    m_dirty       = true;
+                    m_dirty_since = std::chrono::steady_clock::now();
+                    m_flush_cond.notify_one();
+                }
+            }
+            else
+            {
+                store_now = true;
+                path      = m_file;
+            }
         }
     }
-    else
+    if (store_now)
+    {
+        // Not flushed to the storage on every modification to limit the latency and the wear of flash memories,
+        // the durability is only guaranteed by store(), flush() and the write-behind thread
+        storeData(path, false);
+    }
+}
+
+/** @brief Store the data in INI format to a file (must be called with the data mutex unlocked) */
+bool IniFile::storeData(const std::string& path, bool durable) const
+{
+    bool ret = false;
+
+    // Only one write at a time so that the last serialized data are the ones stored
+    std::lock_guard<std::mutex> store_lock(m_store_mutex);
+
+    // Serialize data, the readers are not blocked while writing to the filesystem
+    std::string data;
+    {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        std::stringstream                   ss;
+        for (const auto& section : m_data)
+        {
+            ss << "[" << section.first << "]\n";
+            for (const auto& param : section.second)
+            {
+                ss << param.first << "=" << param.second << "\n";
+            }
+        }
+        data = ss.str();
+    }
+
+    // Write to a temporary file and replace the previous file with it so that the file is never left
+    // partially written, the temporary file is flushed to the storage first for durable stores
+    // so that this also holds on a power loss
+    std::string tmp_path = path + ".tmp";
+    FILE*       file     = nullptr;
+#ifdef _MSC_VER
+    fopen_s(&file, tmp_path.c_str(), "wb");
+#else  // _MSC_VER
+    file = fopen(tmp_path.c_str(), "wb");
+#endif // _MSC_VER
+    if (file)
+    {
+        ret = (fwrite(data.c_str(), 1u, data.size(), file) == data.size());
+        ret = (fflush(file) == 0) && ret;
+        if (durable)
+        {
+#ifdef _MSC_VER
+            ret = (_commit(_fileno(file)) == 0) && ret;
+#else  // _MSC_VER
+            ret = (fsync(fileno(file)) == 0) && ret;
+#endif // _MSC_VER
+        }
+        ret = (fclose(file) == 0) && ret;
+    }
+    if (ret)
+    {
+        std::error_code err;
+        std::filesystem::rename(tmp_path, path, err);
+        ret = !err;
+#ifndef _MSC_VER
+        if (ret && durable)
+        {
+            // Flush the directory entry of the renamed file
+            std::string dir_path = std::filesystem::path(path).parent_path().string();
+            if (dir_path.empty())
+            {
+                dir_path = ".";
+            }
+            int dir = ::open(dir_path.c_str(), O_RDONLY);
+            if (dir >= 0)
+            {
+                fsync(dir);
+                ::close(dir);
+            }
+        }
+#endif // _MSC_VER
+    }
+    if (!ret)
     {
-        std::unordered_map<std::string, std::string> new_section;
-        new_section[name] = value;
-        m_data[section]   = new_section;
+        std::error_code err;
+        std::filesystem::remove(tmp_path, err);
     }
-    if (m_sync)
+
+    return ret;
+}
+
+/** @brief Stop the write-behind thread */
+void IniFile::stopFlushThread()
+{
+    if (m_flush_thread)
     {
-        store(m_file);
+        {
+            std::unique_lock<std::shared_mutex> lock(m_mutex);
+            m_end = true;
+            m_flush_cond.notify_one();
+        }
+        m_flush_thread->join();
+        delete m_flush_thread;
+        m_flush_thread = nullptr;
+    }
+}
+
+/** @brief Write-behind thread */
+void IniFile::flushThread()
+{
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    while (!m_end)
+    {
+        if (m_dirty)
+        {
+            auto due_date = m_dirty_since + m_write_behind_delay;
+            if (std::chrono::steady_clock::now() >= due_date)
+            {
+                // Store without blocking the readers and the writers
+                std::string path = m_file;
+                m_dirty          = false;
+                lock.unlock();
+                storeData(path, true);
+                lock.lock();
+            }
+            else
+            {
+                m_flush_cond.wait_until(lock, due_date);
+            }
+        }
+        else
+        {
+            m_flush_cond.wait(lock);
+        }
     }
 }
 
@@ -19,7 +19,12 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #ifndef OPENOCPP_INIFILE_H
 #define OPENOCPP_INIFILE_H
 
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -41,6 +46,7 @@ class IniFile
      * @brief Load constructor
      * @param path Path to the file
      * @param sync Force automatic sync to filesytem on every modification
+     *             (the file is only flushed to the storage by store(), flush() and the write-behind thread)
      */
     IniFile(const std::string& path, bool sync = true);
     /** @brief Destructor */
@@ -50,10 +56,24 @@ class IniFile
      * @brief Load a file in INI format
      * @param path Path to the file
      * @param sync Force automatic sync to filesytem on every modification
+     *             (the file is only flushed to the storage by store(), flush() and the write-behind thread)
      * @return true if the file has been opened, false otherwise
      */
     bool load(const std::string& path, bool sync = true);
 
+    /**
+     * @brief Delay the automatic sync to filesystem : all the modifications made during
+     *        the delay following a first modification are stored at once
+     * @param delay Delay before storing the modifications (0 = store on every modification)
+     */
+    void setWriteBehind(std::chrono::milliseconds delay);
+
+    /**
+     * @brief Store the modifications which are pending because of the write-behind delay
+     * @return true if the data has been stored or if there was nothing to store, false otherwise
+     */
+    bool flush();
+
     /**
      * @brief Store the data in INI format to the same file which has been used to load data
      * @return true if the data has been stored, false otherwise
@@ -167,9 +187,37 @@ class IniFile
     std::string m_file;
     /** @brief Force automatic sync to filesytem on every modification */
     bool m_sync;
+    /** @brief Delay before storing the modifications */
+    std::chrono::milliseconds m_write_behind_delay;
+    /** @brief Mutex to protect the data (shared by the readers) */
+    mutable std::shared_mutex m_mutex;
+    /** @brief Mutex to serialize the writes to the filesystem */
+    mutable std::mutex m_store_mutex;
+    /** @brief Condition variable to wakeup the write-behind thread */
+    std::condition_variable_any m_flush_cond;
+    /** @brief Write-behind thread */
+    std::thread* m_flush_thread;
+    /** @brief Indicate the end of processing to the write-behind thread */
+    bool m_end;
+    /** @brief Indicate that modifications have not been stored yet */
+    bool m_dirty;
+    /** @brief Date of the first modification which has not been stored yet */
+    std::chrono::steady_clock::time_point m_dirty_since;
 
     /** @brief Data */
     std::unordered_map<std::string, std::unordered_map<std::string, std::string>> m_data;
+
+    /**
+     * @brief Store the data in INI format to a file (must be called with the data mutex unlocked)
+     * @param path Path to the file
+     * @param durable Indicate if the file must be flushed to the storage before returning
+     * @return true if the file has been stored, false otherwise
+     */
+    bool storeData(const std::string& path, bool durable) const;
+    /** @brief Stop the write-behind thread */
+    void stopFlushThread();
+    /** @brief Write-behind thread */
+    void flushThread();
 };
 
 } // namespace helpers
@@ -19,6 +19,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "StringHelpers.h"
 
 #include <algorithm>
+#include <cstdio>
 #include <iomanip>
 #include <sstream>
 
@@ -171,5 +172,129 @@ std::vector<uint8_t> fromHexString(const std::string& hex_string)
     return ret;
 }
 
+/** @brief Powers of 10 used to scale decimal numbers */
+static const double POWERS_OF_10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8, 1e9,
+                                      1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18};
+/** @brief Maximum number of decimals handled by formatDecimal() */
+static constexpr unsigned int MAX_FORMAT_DECIMALS = 9u;
+/** @brief Maximum number of digits handled by parseDecimal() */
+static constexpr unsigned int MAX_PARSE_DIGITS = 18u;
+
+/** @brief Helper function to write a decimal number in fixed point notation without going through the C locale */
+size_t formatDecimal(char* buffer, double value, unsigned int decimals)
+{
+    size_t len = 0;
+
+    if (decimals > MAX_FORMAT_DECIMALS)
+    {
+        decimals = MAX_FORMAT_DECIMALS;
+    }
+    double scaled   = value * POWERS_OF_10[decimals];
+    bool   negative = (scaled < 0.);
+    if (negative)
+    {
+        scaled = -scaled;
+    }
+    if (scaled < POWERS_OF_10[MAX_PARSE_DIGITS])
+    {
+        // Integer arithmetic on the scaled value
+        uint64_t digits = static_cast<uint64_t>(scaled + 0.5);
+        char     reversed[MAX_DECIMAL_STR_SIZE];
+        size_t   count = 0;
+        do
+        {
+            reversed[count++] = static_cast<char>('0' + (digits % 10u));
+            digits /= 10u;
+        } while ((digits != 0) || (count <= decimals));
+
+        // Sign is not written for a value rounded to 0
+        bool zero = true;
+        for (size_t i = 0; (i < count) && zero; i++)
+        {
+            zero = (reversed[i] == '0');
+        }
+        if (negative && !zero)
+        {
+            buffer[len++] = '-';
+        }
+        while (count > 0)
+        {
+            count--;
+            buffer[len++] = reversed[count];
+            if ((count == decimals) && (count != 0))
+            {
+                buffer[len++] = '.';
+            }
+        }
+        buffer[len] = 0;
+    }
+    else
+    {
+        // Out of range or not a number
+        int ret = snprintf(buffer, MAX_DECIMAL_STR_SIZE, "%.*g", static_cast<int>(MAX_PARSE_DIGITS), value);
+        if (ret > 0)
+        {
+            len = std::min(static_cast<size_t>(ret), MAX_DECIMAL_STR_SIZE - 1u);
+        }
+    }
+
+    return len;
+}
+
+/** @brief Helper function to parse a decimal number in fixed point notation ([+-]digits[.digits]) */
+bool parseDecimal(const char* str, size_t size, double& value, unsigned int& decimals)
+{
+    bool ret = false;
+
+    // Sign
+    size_t index    = 0;
+    bool   negative = false;
+    if ((size > 0) && ((str[0] == '-') || (str[0] == '+')))
+    {
+        negative = (str[0] == '-');
+        index++;
+    }
+
+    // Digits
+    uint64_t     mantissa  = 0;
+    unsigned int digits    = 0;
+    unsigned int fraction  = 0;
+    bool         dot_found = false;
+    bool         valid     = true;
+    for (; (index < size) && valid; index++)
+    {
+        char c = str[index];
+        if ((c >= '0') && (c <= '9'))
+        {
+            mantissa = mantissa * 10u + static_cast<uint64_t>(c - '0');
+            digits++;
+            if (dot_found)
+            {
+                fraction++;
+            }
+        }
+        else if ((c == '.') && !dot_found)
+        {
+            dot_found = true;
+        }
+        else
+        {
+            valid = false;
+        }
+    }
+    if (valid && (digits != 0) && (digits <= MAX_PARSE_DIGITS))
+    {
+        value = static_cast<double>(mantissa) / POWERS_OF_10[fraction];
+        if (negative)
+        {
+            value = -value;
+        }
+        decimals = fraction;
+        ret      = true;
+    }
+
+    return ret;
+}
+
 } // namespace helpers
 } // namespace ocpp
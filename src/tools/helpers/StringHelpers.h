@@ -123,6 +123,28 @@ std::string toHexString(const ContiguousContainer& cont)
  */
 std::vector<uint8_t> fromHexString(const std::string& hex_string);
 
+/** @brief Maximum number of characters written by formatDecimal() including the null terminating character */
+static constexpr size_t MAX_DECIMAL_STR_SIZE = 32u;
+
+/**
+ * @brief Helper function to write a decimal number in fixed point notation without going through the C locale
+ * @param buffer Buffer to write into (at least MAX_DECIMAL_STR_SIZE bytes)
+ * @param value Value to write
+ * @param decimals Number of decimals to write (up to 9)
+ * @return Number of characters written (not including the null terminating character)
+ */
+size_t formatDecimal(char* buffer, double value, unsigned int decimals);
+
+/**
+ * @brief Helper function to parse a decimal number in fixed point notation ([+-]digits[.digits])
+ * @param str String to parse
+ * @param size Number of characters to parse
+ * @param value Parsed value
+ * @param decimals Number of decimals of the parsed value
+ * @return true if the string is a valid decimal number, false otherwise
+ */
+bool parseDecimal(const char* str, size_t size, double& value, unsigned int& decimals);
+
 } // namespace helpers
 } // namespace ocpp
 
@@ -148,6 +148,14 @@ bool Certificate::verify(const std::vector<uint8_t>& signature, const std::strin
     return ocpp::x509::verify(signature, filepath, sha, pkey);
 }
 
+/** @brief Verify the signature of an already computed digest using the certificate's public key */
+bool Certificate::verifyDigest(const std::vector<uint8_t>& signature, const std::vector<uint8_t>& digest, Sha2::Type sha)
+{
+    X509*     cert = reinterpret_cast<X509*>(m_openssl_object);
+    EVP_PKEY* pkey = X509_get0_pubkey(cert);
+    return ocpp::x509::verifyDigest(signature, digest, sha, pkey);
+}
+
 /** @brief Extract all the PEM certificates in the certificate chain */
 void Certificate::extractPemChain()
 {
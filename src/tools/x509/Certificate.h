@@ -114,6 +114,16 @@ class Certificate : public X509Document
      */
     bool verify(const std::vector<uint8_t>& signature, const std::string& filepath, Sha2::Type sha);
 
+    /**
+     * @brief Verify the signature of an already computed digest using the certificate's public key
+     *        (allows to compute the digest of a file while it is received)
+     * @param signature Expected signature
+     * @param digest Digest of the signed data
+     * @param sha Secure hash algorithm used to compute the digest
+     * @return true is the signature is valid, false otherwise
+     */
+    bool verifyDigest(const std::vector<uint8_t>& signature, const std::vector<uint8_t>& digest, Sha2::Type sha);
+
     /**
      * @brief Get the PEM encoded data representation of each certificate composing the certificate chain (if any)
      * @return PEM encoded data representation of each certificate composing the certificate chain (if any)
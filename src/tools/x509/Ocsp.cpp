@@ -0,0 +1,88 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Ocsp.h"
+#include "Base64.h"
+#include "openssl.h"
+
+namespace ocpp
+{
+namespace x509
+{
+namespace ocsp
+{
+
+/** @brief Get the remaining validity of an OCSP response */
+std::chrono::seconds remainingValidity(const std::string& b64_response)
+{
+    std::chrono::seconds validity(0);
+
+    // Decode response
+    std::vector<uint8_t> der = base64::decode(b64_response);
+    if (!der.empty())
+    {
+        const unsigned char* p_der    = der.data();
+        OCSP_RESPONSE*       response = d2i_OCSP_RESPONSE(nullptr, &p_der, static_cast<long>(der.size()));
+        if (response)
+        {
+            if (OCSP_response_status(response) == OCSP_RESPONSE_STATUS_SUCCESSFUL)
+            {
+                OCSP_BASICRESP* basic_response = OCSP_response_get1_basic(response);
+                if (basic_response)
+                {
+                    // Look for the earliest next update
+                    bool valid        = true;
+                    long min_validity = -1;
+                    int  count        = OCSP_resp_count(basic_response);
+                    for (int i = 0; valid && (i < count); i++)
+                    {
+                        ASN1_GENERALIZEDTIME* next_update = nullptr;
+                        OCSP_SINGLERESP*      single      = OCSP_resp_get0(basic_response, i);
+                        OCSP_single_get0_status(single, nullptr, nullptr, nullptr, &next_update);
+                        int day = 0;
+                        int sec = 0;
+                        if (next_update && ASN1_TIME_diff(&day, &sec, nullptr, next_update))
+                        {
+                            long remaining = static_cast<long>(day) * 24l * 3600l + static_cast<long>(sec);
+                            if ((min_validity < 0) || (remaining < min_validity))
+                            {
+                                min_validity = remaining;
+                            }
+                        }
+                        else
+                        {
+                            valid = false;
+                        }
+                    }
+                    if (valid && (min_validity > 0))
+                    {
+                        validity = std::chrono::seconds(min_validity);
+                    }
+                    OCSP_BASICRESP_free(basic_response);
+                }
+            }
+            OCSP_RESPONSE_free(response);
+        }
+    }
+
+    return validity;
+}
+
+} // namespace ocsp
+} // namespace x509
+} // namespace ocpp
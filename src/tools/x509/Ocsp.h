@@ -0,0 +1,45 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPENOCPP_OCSP_H
+#define OPENOCPP_OCSP_H
+
+#include <chrono>
+#include <string>
+
+namespace ocpp
+{
+namespace x509
+{
+namespace ocsp
+{
+
+/**
+ * @brief Get the remaining validity of an OCSP response, computed from
+ *        the earliest nextUpdate field of its single responses
+ * @param b64_response OCSPResponse as defined in IETF RFC 6960, DER encoded and then base64 encoded
+ * @return Remaining validity, 0 if the response is invalid, not successful, already
+ *         outdated or if it doesn't provide a nextUpdate field
+ */
+std::chrono::seconds remainingValidity(const std::string& b64_response);
+
+} // namespace ocsp
+} // namespace x509
+} // namespace ocpp
+
+#endif // OPENOCPP_OCSP_H
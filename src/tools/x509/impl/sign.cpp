@@ -19,17 +19,36 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "sign.h"
 #include "openssl.h"
 
-#include <fstream>
+#include <algorithm>
+#include <functional>
 #include <vector>
+#ifdef _MSC_VER
+#include <fstream>
+#else // _MSC_VER
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // _MSC_VER
 
 namespace ocpp
 {
 namespace x509
 {
 
+#ifndef _MSC_VER
+/** @brief Size of the blocks of a file which are mapped in memory to compute its digest */
+static constexpr size_t FILE_MAPPING_SIZE = 64u * 1024u * 1024u;
+#endif // _MSC_VER
+/** @brief Size of the read buffer used when a file cannot be mapped in memory */
+static constexpr size_t FILE_READ_BUFFER_SIZE = 1024u * 1024u;
+
 /** @brief Get the corresponding OpenSSL hash algorithm */
 static const EVP_MD* getHash(Sha2::Type sha);
 
+/** @brief Give the whole content of a file, in order, to a digest computation */
+static bool digestFile(const std::string& filepath, const std::function<void(const void*, size_t)>& update);
+
 /** @brief Compute the signature of a buffer using a key */
 std::vector<uint8_t> sign(const void* buffer, size_t size, Sha2::Type sha, EVP_PKEY* pkey)
 {
@@ -73,28 +92,19 @@ std::vector<uint8_t> sign(const std::string& filepath, Sha2::Type sha, EVP_PKEY*
     std::vector<uint8_t> signature;
     if (pkey)
     {
-        // Open the file
-        std::fstream file(filepath, std::fstream::in | std::fstream::binary);
-        if (file.is_open())
-        {
-            // Initialize signing context
-            EVP_MD_CTX* ctx = EVP_MD_CTX_new();
-            EVP_MD_CTX_init(ctx);
-
-            // Select hash algorithm
-            const EVP_MD* md = getHash(sha);
+        // Initialize signing context
+        EVP_MD_CTX* ctx = EVP_MD_CTX_new();
+        EVP_MD_CTX_init(ctx);
 
-            // Init signature computation
-            EVP_DigestSignInit(ctx, nullptr, md, nullptr, pkey);
+        // Select hash algorithm
+        const EVP_MD* md = getHash(sha);
 
-            // Compute digest
-            uint8_t buffer[1024];
-            do
-            {
-                file.read(reinterpret_cast<char*>(buffer), sizeof(buffer));
-                EVP_DigestSignUpdate(ctx, buffer, static_cast<size_t>(file.gcount()));
-            } while (file.gcount() == sizeof(buffer));
+        // Init signature computation
+        EVP_DigestSignInit(ctx, nullptr, md, nullptr, pkey);
 
+        // Compute digest
+        if (digestFile(filepath, [ctx](const void* data, size_t size) { EVP_DigestSignUpdate(ctx, data, size); }))
+        {
             // Compute signature
             signature.resize(static_cast<size_t>(EVP_PKEY_size(pkey)));
             size_t sig_size = signature.size();
@@ -106,10 +116,10 @@ std::vector<uint8_t> sign(const std::string& filepath, Sha2::Type sha, EVP_PKEY*
             {
                 signature.clear();
             }
-
-            // Release resources
-            EVP_MD_CTX_free(ctx);
         }
+
+        // Release resources
+        EVP_MD_CTX_free(ctx);
     }
     return signature;
 }
@@ -142,46 +152,56 @@ bool verify(const std::vector<uint8_t>& signature, const void* buffer, size_t si
     return ret;
 }
 
-/**
- * @brief Verify the signature of a file using a key
- * @param signature Expected signature
- * @param filepath Path to the file
- * @param sha Secure hash algorithm to use
- * @param pkey Key to use
- * @return true is the signature is valid, false otherwise
- */
+/** @brief Verify the signature of a file using a key */
 bool verify(const std::vector<uint8_t>& signature, const std::string& filepath, Sha2::Type sha, EVP_PKEY* pkey)
 {
     bool ret = false;
     if (!signature.empty() && pkey)
     {
-        // Open the file
-        std::fstream file(filepath, std::fstream::in | std::fstream::binary);
-        if (file.is_open())
+        // Initialize verify context
+        EVP_MD_CTX* ctx = EVP_MD_CTX_new();
+        EVP_MD_CTX_init(ctx);
+
+        // Select hash algorithm
+        const EVP_MD* md = getHash(sha);
+
+        // Init signature verification
+        EVP_DigestVerifyInit(ctx, nullptr, md, nullptr, pkey);
+
+        // Compute digest
+        if (digestFile(filepath, [ctx](const void* data, size_t size) { EVP_DigestVerifyUpdate(ctx, data, size); }))
         {
-            // Initialize verify context
-            EVP_MD_CTX* ctx = EVP_MD_CTX_new();
-            EVP_MD_CTX_init(ctx);
+            // Verify signature
+            ret = (EVP_DigestVerifyFinal(ctx, &signature[0], signature.size()) == 1);
+        }
 
+        // Release resources
+        EVP_MD_CTX_free(ctx);
+    }
+    return ret;
+}
+
+/** @brief Verify the signature of an already computed digest using a key */
+bool verifyDigest(const std::vector<uint8_t>& signature, const std::vector<uint8_t>& digest, Sha2::Type sha, EVP_PKEY* pkey)
+{
+    bool ret = false;
+    if (!signature.empty() && !digest.empty() && pkey)
+    {
+        // Initialize verify context
+        EVP_PKEY_CTX* ctx = EVP_PKEY_CTX_new(pkey, nullptr);
+        if (ctx)
+        {
             // Select hash algorithm
             const EVP_MD* md = getHash(sha);
 
-            // Init signature verification
-            EVP_DigestVerifyInit(ctx, nullptr, md, nullptr, pkey);
-
-            // Compute digest
-            uint8_t buffer[1024];
-            do
-            {
-                file.read(reinterpret_cast<char*>(buffer), sizeof(buffer));
-                EVP_DigestVerifyUpdate(ctx, buffer, static_cast<size_t>(file.gcount()));
-            } while (file.gcount() == sizeof(buffer));
-
             // Verify signature
-            ret = (EVP_DigestVerifyFinal(ctx, &signature[0], signature.size()) == 1);
+            if ((EVP_PKEY_verify_init(ctx) == 1) && (EVP_PKEY_CTX_set_signature_md(ctx, md) == 1))
+            {
+                ret = (EVP_PKEY_verify(ctx, &signature[0], signature.size(), &digest[0], digest.size()) == 1);
+            }
 
             // Release resources
-            EVP_MD_CTX_free(ctx);
+            EVP_PKEY_CTX_free(ctx);
         }
     }
     return ret;
@@ -208,5 +228,83 @@ static const EVP_MD* getHash(Sha2::Type sha)
     return md;
 }
 
+/** @brief Give the whole content of a file, in order, to a digest computation */
+static bool digestFile(const std::string& filepath, const std::function<void(const void*, size_t)>& update)
+{
+    bool ret = false;
+
+#ifdef _MSC_VER
+    // Read the file with large buffers
+    std::fstream file(filepath, std::fstream::in | std::fstream::binary);
+    if (file.is_open())
+    {
+        std::vector<uint8_t> buffer(FILE_READ_BUFFER_SIZE);
+        do
+        {
+            file.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+            update(buffer.data(), static_cast<size_t>(file.gcount()));
+        } while (static_cast<size_t>(file.gcount()) == buffer.size());
+        ret = true;
+    }
+#else  // _MSC_VER
+    // Open the file
+    int fd = open(filepath.c_str(), O_RDONLY);
+    if (fd >= 0)
+    {
+        struct stat file_stat;
+        if (fstat(fd, &file_stat) == 0)
+        {
+            // The file is read only once from start to end
+            posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+
+            // Map the file in memory by blocks to limit the address space usage
+            size_t file_size = static_cast<size_t>(file_stat.st_size);
+            size_t offset    = 0;
+            bool   mapped    = S_ISREG(file_stat.st_mode);
+            while (mapped && (offset < file_size))
+            {
+                size_t size  = std::min(FILE_MAPPING_SIZE, file_size - offset);
+                void*  block = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, static_cast<off_t>(offset));
+                if (block != MAP_FAILED)
+                {
+                    madvise(block, size, MADV_SEQUENTIAL);
+                    update(block, size);
+                    munmap(block, size);
+                    offset += size;
+                }
+                else
+                {
+                    mapped = false;
+                }
+            }
+            if (mapped)
+            {
+                ret = true;
+            }
+            else if (lseek(fd, static_cast<off_t>(offset), SEEK_SET) >= 0)
+            {
+                // Read the remaining part of the file with large buffers
+                std::vector<uint8_t> buffer(FILE_READ_BUFFER_SIZE);
+                ssize_t              count = 0;
+                do
+                {
+                    count = read(fd, buffer.data(), buffer.size());
+                    if (count > 0)
+                    {
+                        update(buffer.data(), static_cast<size_t>(count));
+                    }
+                } while (count > 0);
+                ret = (count == 0);
+            }
+        }
+
+        // Close the file
+        close(fd);
+    }
+#endif // _MSC_VER
+
+    return ret;
+}
+
 } // namespace x509
 } // namespace ocpp
@@ -68,6 +68,16 @@ bool verify(const std::vector<uint8_t>& signature, const void* buffer, size_t si
  */
 bool verify(const std::vector<uint8_t>& signature, const std::string& filepath, Sha2::Type sha, EVP_PKEY* pkey);
 
+/**
+ * @brief Verify the signature of an already computed digest using a key
+ * @param signature Expected signature
+ * @param digest Digest of the signed data
+ * @param sha Secure hash algorithm used to compute the digest
+ * @param pkey Key to use
+ * @return true is the signature is valid, false otherwise
+ */
+bool verifyDigest(const std::vector<uint8_t>& signature, const std::vector<uint8_t>& digest, Sha2::Type sha, EVP_PKEY* pkey);
+
 } // namespace x509
 } // namespace ocpp
 
@@ -29,6 +29,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include <openssl/bio.h>
 #include <openssl/err.h>
 #include <openssl/evp.h>
+#include <openssl/ocsp.h>
 #include <openssl/pem.h>
 #include <openssl/rand.h>
 #include <openssl/sha.h>
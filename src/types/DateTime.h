@@ -20,8 +20,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #define OPENOCPP_DATETIME_H
 
 #include <chrono>
-#include <iomanip>
-#include <sstream>
+#include <ctime>
 #include <string>
 
 namespace ocpp
@@ -33,6 +32,9 @@ namespace types
 class DateTime
 {
   public:
+    /** @brief Maximum size of the string representation including the null terminating character */
+    static constexpr size_t MAX_STR_SIZE = 25u;
+
     /** @brief Instanciate a date and time object with the current date and time
      *  @return Instanciated date and time
      */
@@ -62,33 +64,78 @@ class DateTime
     }
 
     /**
-     * @brief Assign a new value from a string representation in UTC time
+     * @brief Assign a new value from an ISO-8601 string representation
+     *        (YYYY-MM-DDTHH:MM:SS with optional fractional seconds and optional
+     *        timezone designator : Z, +HH:MM, +HHMM or +HH, UTC if not specified)
+     * @param value String representation
+     * @return true if the string is a valid date and time representation, false otherwise
+     */
+    bool assign(const std::string& value) { return assign(value.c_str()); }
+
+    /**
+     * @brief Assign a new value from an ISO-8601 string representation
+     *        (YYYY-MM-DDTHH:MM:SS with optional fractional seconds and optional
+     *        timezone designator : Z, +HH:MM, +HHMM or +HH, UTC if not specified)
      * @param value String representation
-     * @return true if the new value respects the max string size, false otherwise
+     * @return true if the string is a valid date and time representation, false otherwise
      */
-    bool assign(const std::string& value)
+    bool assign(const char* value)
     {
-        bool               ret = false;
-        std::istringstream ss(value);
-        std::tm            t = {};
-        ss >> std::get_time(&t, "%Y-%m-%dT%TZ");
-        if (ss.fail())
+        bool         ret   = false;
+        const char*  str   = value;
+        unsigned int year  = 0;
+        unsigned int month = 0;
+        unsigned int day   = 0;
+        unsigned int hour  = 0;
+        unsigned int min   = 0;
+        unsigned int sec   = 0;
+
+        // Date and time
+        bool valid = readNumber(str, 4u, year) && readChar(str, '-') && readNumber(str, 2u, month) && readChar(str, '-') &&
+                     readNumber(str, 2u, day) && (readChar(str, 'T') || readChar(str, 't')) && readNumber(str, 2u, hour) &&
+                     readChar(str, ':') && readNumber(str, 2u, min) && readChar(str, ':') && readNumber(str, 2u, sec);
+
+        // Fractional seconds are ignored
+        if (valid && (readChar(str, '.') || readChar(str, ',')))
+        {
+            valid = isDigit(*str);
+            while (isDigit(*str))
+            {
+                str++;
+            }
+        }
+
+        // Timezone designator
+        std::time_t offset = 0;
+        if (valid && !readChar(str, 'Z') && !readChar(str, 'z') && ((*str == '+') || (*str == '-')))
         {
-            ss.clear();
-            ss.str(value);
-            ss >> std::get_time(&t, "%Y-%m-%dT%T");
+            bool         negative = (*str == '-');
+            unsigned int off_hour = 0;
+            unsigned int off_min  = 0;
+            str++;
+            valid = readNumber(str, 2u, off_hour);
+            if (valid && (*str != 0))
+            {
+                readChar(str, ':');
+                valid = readNumber(str, 2u, off_min);
+            }
+            valid  = valid && (off_hour <= 23u) && (off_min <= 59u);
+            offset = static_cast<std::time_t>(off_hour * 3600u + off_min * 60u);
+            if (negative)
+            {
+                offset = -offset;
+            }
         }
-        if (!ss.fail())
+
+        // Check ranges
+        if (valid && (*str == 0) && (month >= 1u) && (month <= 12u) && (day >= 1u) && (day <= daysInMonth(year, month)) &&
+            (hour <= 23u) && (min <= 59u) && (sec <= 60u))
         {
-#ifdef _MSC_VER
-            m_datetime = _mkgmtime(&t);
-#else  // _MSC_VER
-            m_datetime = std::mktime(&t);
-            m_datetime += t.tm_gmtoff;
-            m_datetime -= (t.tm_isdst * 3600);
-#endif // _MSC_VER
-            ret = true;
+            // Convert to UNIX timestamp
+            m_datetime = daysFromCivil(year, month, day) * 86400 + static_cast<std::time_t>(hour * 3600u + min * 60u + sec) - offset;
+            ret        = true;
         }
+
         return ret;
     }
 
@@ -174,15 +221,69 @@ class DateTime
      */
     std::string str() const
     {
-        std::ostringstream ss;
-        std::tm            t = {};
-#ifdef _MSC_VER
-        gmtime_s(&t, &m_datetime);
-#else  // _MSC_VER
-        gmtime_r(&m_datetime, &t);
-#endif // _MSC_VER
-        ss << std::put_time(&t, "%Y-%m-%dT%TZ");
-        return ss.str();
+        char   buffer[MAX_STR_SIZE];
+        size_t len = format(buffer);
+        return std::string(buffer, len);
+    }
+
+    /**
+     * @brief Write the ISO-8601 representation of the date and time in UTC into a buffer
+     * @param buffer Buffer to write into (at least MAX_STR_SIZE bytes)
+     * @param milliseconds Milliseconds to append to the representation (none if negative)
+     * @return Number of characters written (not including the null terminating character)
+     */
+    size_t format(char* buffer, int milliseconds = -1) const
+    {
+        // Split into days and seconds of the day
+        std::time_t days = m_datetime / 86400;
+        std::time_t secs = m_datetime % 86400;
+        if (secs < 0)
+        {
+            secs += 86400;
+            days--;
+        }
+
+        // Convert days to civil date (proleptic gregorian calendar)
+        days += 719468;
+        std::time_t  era   = ((days >= 0) ? days : (days - 146096)) / 146097;
+        unsigned int doe   = static_cast<unsigned int>(days - era * 146097);
+        unsigned int yoe   = (doe - doe / 1460u + doe / 36524u - doe / 146096u) / 365u;
+        unsigned int doy   = doe - (365u * yoe + yoe / 4u - yoe / 100u);
+        unsigned int mp    = (5u * doy + 2u) / 153u;
+        unsigned int day   = doy - (153u * mp + 2u) / 5u + 1u;
+        unsigned int month = ((mp < 10u) ? (mp + 3u) : (mp - 9u));
+        std::time_t  year  = static_cast<std::time_t>(yoe) + era * 400 + ((month <= 2u) ? 1 : 0);
+
+        // Write representation
+        unsigned int y    = static_cast<unsigned int>(year) % 10000u;
+        unsigned int hour = static_cast<unsigned int>(secs / 3600);
+        unsigned int min  = static_cast<unsigned int>((secs / 60) % 60);
+        unsigned int sec  = static_cast<unsigned int>(secs % 60);
+        writeDigits(&buffer[0], y / 100u);
+        writeDigits(&buffer[2], y % 100u);
+        buffer[4] = '-';
+        writeDigits(&buffer[5], month);
+        buffer[7] = '-';
+        writeDigits(&buffer[8], day);
+        buffer[10] = 'T';
+        writeDigits(&buffer[11], hour);
+        buffer[13] = ':';
+        writeDigits(&buffer[14], min);
+        buffer[16] = ':';
+        writeDigits(&buffer[17], sec);
+        size_t len = 19u;
+        if (milliseconds >= 0)
+        {
+            unsigned int ms = static_cast<unsigned int>(milliseconds) % 1000u;
+            buffer[len++]   = '.';
+            buffer[len++]   = static_cast<char>('0' + ms / 100u);
+            writeDigits(&buffer[len], ms % 100u);
+            len += 2u;
+        }
+        buffer[len++] = 'Z';
+        buffer[len]   = 0;
+
+        return len;
     }
 
     /**
@@ -198,6 +299,63 @@ class DateTime
     bool empty() const { return (m_datetime == 0); }
 
   private:
+    /** @brief Indicate if a character is a decimal digit */
+    static bool isDigit(char c) { return ((c >= '0') && (c <= '9')); }
+
+    /** @brief Read an expected character */
+    static bool readChar(const char*& str, char c)
+    {
+        bool ret = (*str == c);
+        if (ret)
+        {
+            str++;
+        }
+        return ret;
+    }
+
+    /** @brief Read a fixed number of digits */
+    static bool readNumber(const char*& str, unsigned int digits, unsigned int& value)
+    {
+        bool ret = true;
+        value    = 0;
+        for (unsigned int i = 0; ret && (i < digits); i++)
+        {
+            ret = isDigit(*str);
+            if (ret)
+            {
+                value = value * 10u + static_cast<unsigned int>(*str - '0');
+                str++;
+            }
+        }
+        return ret;
+    }
+
+    /** @brief Get the number of days in a month */
+    static unsigned int daysInMonth(unsigned int year, unsigned int month)
+    {
+        static const unsigned int days[] = {31u, 28u, 31u, 30u, 31u, 30u, 31u, 31u, 30u, 31u, 30u, 31u};
+        bool                      leap   = (((year % 4u) == 0) && ((year % 100u) != 0)) || ((year % 400u) == 0);
+        return (((month == 2u) && leap) ? 29u : days[month - 1u]);
+    }
+
+    /** @brief Get the number of days since 1970-01-01 of a civil date (proleptic gregorian calendar) */
+    static std::time_t daysFromCivil(unsigned int year, unsigned int month, unsigned int day)
+    {
+        std::time_t  y   = static_cast<std::time_t>(year) - ((month <= 2u) ? 1 : 0);
+        std::time_t  era = ((y >= 0) ? y : (y - 399)) / 400;
+        unsigned int yoe = static_cast<unsigned int>(y - era * 400);
+        unsigned int doy = (153u * ((month > 2u) ? (month - 3u) : (month + 9u)) + 2u) / 5u + day - 1u;
+        unsigned int doe = yoe * 365u + yoe / 4u - yoe / 100u + doy;
+        return era * 146097 + static_cast<std::time_t>(doe) - 719468;
+    }
+
+    /** @brief Write a 2 digits number */
+    static void writeDigits(char* buffer, unsigned int value)
+    {
+        buffer[0] = static_cast<char>('0' + value / 10u);
+        buffer[1] = static_cast<char>('0' + value % 10u);
+    }
+
     /** @brief Underlying date and time in local time */
     std::time_t m_datetime;
 };
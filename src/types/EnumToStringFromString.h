@@ -21,7 +21,10 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 
 #include "StringHelpers.h"
 
-#include <unordered_map>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
 #include <vector>
 
 namespace ocpp
@@ -29,63 +32,171 @@ namespace ocpp
 namespace types
 {
 
-/** @brief Helper class for string to enum conversion */
+/**
+ * @brief Helper class for string to enum conversion
+ *
+ * Enum to string conversion is an indexed lookup into a table of preallocated strings.
+ * String to enum conversion uses a perfect hash table built once at construction
+ * so that the lookup needs a single hash computation and a single string comparison
+ * without any memory allocation.
+ */
 template <typename EnumType>
 class EnumToStringFromString
 {
   public:
     /** @brief Constructor */
     EnumToStringFromString(std::initializer_list<std::pair<EnumType, const char*>> mapping)
+        : m_enum_to_string(), m_empty(), m_default(mapping.begin()->first), m_hash_table(), m_hash_mask(0), m_hash_seed(0)
     {
+        // Enum to string table
         for (auto& it : mapping)
         {
-            m_enum_to_string[it.first]  = it.second;
-            m_string_to_enum[it.second] = it.first;
+            size_t index = static_cast<size_t>(it.first);
+            if (index >= m_enum_to_string.size())
+            {
+                m_enum_to_string.resize(index + 1u);
+            }
+            m_enum_to_string[index] = it.second;
+        }
+
+        // String to enum perfect hash table
+        size_t table_size = 4u;
+        while (table_size < (4u * mapping.size()))
+        {
+            table_size *= 2u;
+        }
+        bool found = false;
+        while (!found)
+        {
+            // Look for a seed without collisions
+            m_hash_table.assign(table_size, HashEntry());
+            m_hash_mask = table_size - 1u;
+            for (m_hash_seed = 0; !found && (m_hash_seed < MAX_SEED_TRIES); m_hash_seed++)
+            {
+                found = fillHashTable(mapping);
+            }
+            if (found)
+            {
+                m_hash_seed--;
+            }
+            else
+            {
+                // Retry with a bigger table
+                table_size *= 2u;
+            }
         }
     }
 
     /** @brief Get the string representation of the enum value */
-    std::string toString(EnumType value) const
+    const std::string& toString(EnumType value) const
     {
-        std::string ret;
-        auto        it = m_enum_to_string.find(value);
-        if (it != m_enum_to_string.end())
+        size_t index = static_cast<size_t>(value);
+        if (index < m_enum_to_string.size())
         {
-            ret = it->second;
+            return m_enum_to_string[index];
         }
-        return ret;
+        return m_empty;
     }
 
     /** @brief Get the value represented by a string */
-    EnumType fromString(const std::string& str) const
+    EnumType fromString(const std::string& str) const { return fromString(str.c_str(), str.size()); }
+
+    /** @brief Get the value represented by a string */
+    EnumType fromString(const char* str) const { return fromString(str, strlen(str)); }
+
+    /** @brief Get the value represented by a string */
+    EnumType fromString(const char* str, size_t size) const
     {
-        EnumType ret = m_string_to_enum.begin()->second;
-        auto     it  = m_string_to_enum.find(str);
-        if (it != m_string_to_enum.end())
-        {
-            ret = it->second;
-        }
+        EnumType ret = m_default;
+        fromString(str, size, ret);
         return ret;
     }
 
     /** @brief Get the value represented by a string */
-    bool fromString(const std::string& str, EnumType& val) const
+    bool fromString(const std::string& str, EnumType& val) const { return fromString(str.c_str(), str.size(), val); }
+
+    /** @brief Get the value represented by a string */
+    bool fromString(const char* str, EnumType& val) const { return fromString(str, strlen(str), val); }
+
+    /** @brief Get the value represented by a string */
+    bool fromString(const char* str, size_t size, EnumType& val) const
     {
-        bool ret = false;
-        auto it  = m_string_to_enum.find(str);
-        if (it != m_string_to_enum.end())
+        bool             ret   = false;
+        const HashEntry& entry = m_hash_table[hash(m_hash_seed, str, size) & m_hash_mask];
+        if (entry.str && (entry.size == size) && (memcmp(entry.str, str, size) == 0))
         {
-            val = it->second;
+            val = entry.value;
             ret = true;
         }
         return ret;
     }
 
   private:
-    /** @brief Map for enum to string conversion */
-    std::unordered_map<EnumType, std::string> m_enum_to_string;
-    /** @brief Map for string to enum conversion */
-    std::unordered_map<std::string, EnumType> m_string_to_enum;
+    /** @brief Maximum number of seeds to try before growing the hash table */
+    static constexpr unsigned int MAX_SEED_TRIES = 1000u;
+
+    /** @brief Entry of the perfect hash table */
+    struct HashEntry
+    {
+        /** @brief Constructor */
+        HashEntry() : str(nullptr), size(0), value() { }
+        /** @brief String representation (nullptr if the entry is empty) */
+        const char* str;
+        /** @brief Size of the string representation */
+        size_t size;
+        /** @brief Enum value */
+        EnumType value;
+    };
+
+    /** @brief Table for enum to string conversion */
+    std::vector<std::string> m_enum_to_string;
+    /** @brief Empty string for unknown enum values */
+    const std::string m_empty;
+    /** @brief Value returned for unknown strings */
+    EnumType m_default;
+    /** @brief Perfect hash table for string to enum conversion */
+    std::vector<HashEntry> m_hash_table;
+    /** @brief Mask to get an index in the perfect hash table */
+    size_t m_hash_mask;
+    /** @brief Seed of the perfect hash function */
+    unsigned int m_hash_seed;
+
+    /** @brief Seeded FNV-1a hash */
+    static size_t hash(unsigned int seed, const char* str, size_t size)
+    {
+        uint32_t h = 2166136261u ^ (seed * 16777619u);
+        for (size_t i = 0; i < size; i++)
+        {
+            h ^= static_cast<uint8_t>(str[i]);
+            h *= 16777619u;
+        }
+        h ^= (h >> 15u);
+        return static_cast<size_t>(h);
+    }
+
+    /** @brief Fill the hash table with the current seed, returns false on collision */
+    bool fillHashTable(std::initializer_list<std::pair<EnumType, const char*>> mapping)
+    {
+        bool ret = true;
+        std::fill(m_hash_table.begin(), m_hash_table.end(), HashEntry());
+        for (auto it = mapping.begin(); ret && (it != mapping.end()); ++it)
+        {
+            size_t     size  = strlen(it->second);
+            HashEntry& entry = m_hash_table[hash(m_hash_seed, it->second, size) & m_hash_mask];
+            if (entry.str)
+            {
+                // Duplicated strings keep the first mapping
+                ret = ((entry.size == size) && (memcmp(entry.str, it->second, size) == 0));
+            }
+            else
+            {
+                entry.str   = it->second;
+                entry.size  = size;
+                entry.value = it->first;
+            }
+        }
+        return ret;
+    }
 };
 
 /** @brief Helper function to get an enum list from a CSL string */
@@ -21,6 +21,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 
 #include "Enums.h"
 #include "Optional.h"
+#include "StringHelpers.h"
 
 #include <string>
 
@@ -35,8 +36,17 @@ struct SampledValue
     /** @brief Required. Value as a “Raw” (decimal) number or “SignedData”. Field Type is
                “string” to allow for digitally signed data readings. Decimal numeric values are
                also acceptable to allow fractional values for measurands such as Temperature
-               and Current */
+               and Current. Empty on reception if the numeric representation has been filled,
+               use str() to get the value whatever its representation */
     std::string value;
+    /** @brief Numeric representation of the value, only used when the value string is empty
+               and scale is not negative. It is formatted with scale decimals at serialization
+               time and filled instead of the value string at deserialization time if the value
+               is a decimal number which is formatted back identically */
+    double number = 0.;
+    /** @brief Number of decimals of the numeric representation, negative if there is no
+               numeric representation (SignedData or raw text only) */
+    int scale = -1;
     /** @brief Optional. Type of detail value: start, end or sample. Default = “Sample.Periodic” */
     Optional<ReadingContext> context;
     /** @brief Optional. Raw or signed data. Default = “Raw” */
@@ -53,6 +63,50 @@ struct SampledValue
     /** @brief Optional. Unit of the value. Default = “Wh” if the (default) measurand is an
                “Energy” type */
     Optional<UnitOfMeasure> unit;
+
+    /**
+     * @brief Set a numeric value which will be formatted only at serialization time
+     * @param _number Value
+     * @param _scale Number of decimals to use to format the value
+     */
+    void setNumber(double _number, unsigned int _scale)
+    {
+        value.clear();
+        number = _number;
+        scale  = static_cast<int>(_scale);
+    }
+
+    /**
+     * @brief Indicate if the numeric representation of the value is available
+     * @return true if the numeric representation is available, false otherwise
+     */
+    bool isNumeric() const { return (scale >= 0); }
+
+    /**
+     * @brief Indicate if the value must be serialized from its numeric representation
+     * @return true if the value must be serialized from its numeric representation, false otherwise
+     */
+    bool serializeNumber() const { return (value.empty() && isNumeric()); }
+
+    /**
+     * @brief Get the value as a string whatever its representation
+     * @return Value as a string
+     */
+    std::string str() const
+    {
+        std::string ret;
+        if (serializeNumber())
+        {
+            char   formatted[ocpp::helpers::MAX_DECIMAL_STR_SIZE];
+            size_t len = ocpp::helpers::formatDecimal(formatted, number, static_cast<unsigned int>(scale));
+            ret.assign(formatted, len);
+        }
+        else
+        {
+            ret = value;
+        }
+        return ret;
+    }
 };
 
 } // namespace types
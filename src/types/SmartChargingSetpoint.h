@@ -35,6 +35,25 @@ struct SmartChargingSetpoint
     unsigned int number_phases;
     /** @brief Minimum charging rate */
     Optional<float> min_charging_rate;
+
+    /**
+     * @brief Comparison operator
+     * @param setpoint Setpoint to compare
+     * @return true if the setpoints are identical, false otherwise
+     */
+    bool operator==(const SmartChargingSetpoint& setpoint) const
+    {
+        return ((value == setpoint.value) && (number_phases == setpoint.number_phases) &&
+                (min_charging_rate.isSet() == setpoint.min_charging_rate.isSet()) &&
+                (!min_charging_rate.isSet() || (min_charging_rate.value() == setpoint.min_charging_rate.value())));
+    }
+
+    /**
+     * @brief Comparison operator
+     * @param setpoint Setpoint to compare
+     * @return true if the setpoints are different, false otherwise
+     */
+    bool operator!=(const SmartChargingSetpoint& setpoint) const { return !(*this == setpoint); }
 };
 
 } // namespace types
@@ -19,6 +19,9 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #ifndef OPENOCPP_IWEBSOCKETCLIENT_H
 #define OPENOCPP_IWEBSOCKETCLIENT_H
 
+#include "SendQueueConfig.h"
+#include "TlsSession.h"
+
 #include <chrono>
 #include <string>
 
@@ -75,6 +78,30 @@ class IWebsocketClient
      */
     virtual bool send(const void* data, size_t size) = 0;
 
+    /**
+     * @brief Configure the send queue of the connection (must be called before connecting)
+     * @param config Send queue configuration
+     */
+    virtual void setSendQueueConfig(const SendQueueConfig& config) = 0;
+
+    /**
+     * @brief Get the statistics of the send queue of the connection
+     * @return Statistics of the send queue
+     */
+    virtual SendQueueStats sendQueueStats() const = 0;
+
+    /**
+     * @brief Set the store used to persist the TLS sessions of the connection (must be called before connecting)
+     * @param store TLS sessions store (nullptr = sessions are only kept in memory until the client is disconnected)
+     */
+    virtual void setTlsSessionStore(ITlsSessionStore* store) = 0;
+
+    /**
+     * @brief Get the statistics of the TLS handshakes of the connection
+     * @return Statistics of the TLS handshakes
+     */
+    virtual TlsStats tlsStats() const = 0;
+
     /**
      * @brief Register a listener to the websocket events
      * @param listener Listener object
@@ -19,6 +19,9 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #ifndef OPENOCPP_IWEBSOCKETSERVER_H
 #define OPENOCPP_IWEBSOCKETSERVER_H
 
+#include "SendQueueConfig.h"
+#include "TlsSession.h"
+
 #include <chrono>
 #include <memory>
 #include <string>
@@ -59,6 +62,18 @@ class IWebsocketServer
      */
     virtual bool stop() = 0;
 
+    /**
+     * @brief Configure the send queue of the client connections (must be called before starting the server)
+     * @param config Send queue configuration
+     */
+    virtual void setSendQueueConfig(const SendQueueConfig& config) = 0;
+
+    /**
+     * @brief Get the statistics of the TLS handshakes of the client connections
+     * @return Statistics of the TLS handshakes
+     */
+    virtual TlsStats tlsStats() const = 0;
+
     /**
      * @brief Register a listener to the websocket events
      * @param listener Listener object
@@ -142,6 +157,12 @@ class IWebsocketServer
          */
         virtual bool send(const void* data, size_t size) = 0;
 
+        /**
+         * @brief Get the statistics of the send queue of the connection
+         * @return Statistics of the send queue
+         */
+        virtual SendQueueStats sendQueueStats() const = 0;
+
         /**
          * @brief Register a listener to the websocket events
          * @param listener Listener object
@@ -202,6 +223,9 @@ class IWebsocketServer
         std::string server_certificate_ca;
         /** @bool Enable client authentication using certificate */
         bool client_certificate_authent;
+        /** @brief Interval between 2 rotations of the keys protecting the TLS session tickets, a ticket
+         *         stays valid during at least 1 interval (0 = no rotation, the keys are generated once at startup) */
+        std::chrono::seconds tls_ticket_key_rotation_interval;
     };
 };
 
@@ -0,0 +1,96 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPENOCPP_SENDQUEUECONFIG_H
+#define OPENOCPP_SENDQUEUECONFIG_H
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+
+namespace ocpp
+{
+namespace websockets
+{
+
+/** @brief Behavior of a websocket connection when its send queue is full */
+enum class SendQueuePolicy
+{
+    /** @brief The send operation fails immediately */
+    Fail,
+    /** @brief The send operation waits for room in the queue until a timeout is reached */
+    Block,
+    /** @brief The connection is considered as a slow consumer and is closed */
+    Disconnect
+};
+
+/** @brief Configuration of the send queue of a websocket connection */
+struct SendQueueConfig
+{
+    /** @brief Default constructor : unbounded queue */
+    SendQueueConfig() : max_messages(0), max_size(0), policy(SendQueuePolicy::Fail), block_timeout(0) { }
+
+    /**
+     * @brief Constructor
+     * @param _max_messages Maximum number of messages in the queue (0 = no limit)
+     * @param _max_size Maximum size in bytes of the messages in the queue (0 = no limit)
+     * @param _policy Behavior when the queue is full : fail, block or disconnect (default = fail)
+     * @param _block_timeout Maximum wait time for the block policy
+     */
+    SendQueueConfig(size_t _max_messages, size_t _max_size, const std::string& _policy, std::chrono::milliseconds _block_timeout)
+        : max_messages(_max_messages), max_size(_max_size), policy(SendQueuePolicy::Fail), block_timeout(_block_timeout)
+    {
+        if (_policy == "block")
+        {
+            policy = SendQueuePolicy::Block;
+        }
+        else if (_policy == "disconnect")
+        {
+            policy = SendQueuePolicy::Disconnect;
+        }
+    }
+
+    /** @brief Maximum number of messages in the queue (0 = no limit) */
+    size_t max_messages;
+    /** @brief Maximum size in bytes of the messages in the queue (0 = no limit) */
+    size_t max_size;
+    /** @brief Behavior when the queue is full */
+    SendQueuePolicy policy;
+    /** @brief Maximum wait time for room in the queue when using the block policy */
+    std::chrono::milliseconds block_timeout;
+};
+
+/** @brief Statistics of the send queue of a websocket connection */
+struct SendQueueStats
+{
+    /** @brief Number of messages waiting to be sent */
+    size_t messages;
+    /** @brief Size in bytes of the messages waiting to be sent */
+    size_t size;
+    /** @brief Highest number of messages waiting to be sent since the connection has been established */
+    size_t peak_messages;
+    /** @brief Highest size in bytes of the messages waiting to be sent since the connection has been established */
+    size_t peak_size;
+    /** @brief Number of messages which have been rejected because the queue was full */
+    size_t rejected;
+};
+
+} // namespace websockets
+} // namespace ocpp
+
+#endif // OPENOCPP_SENDQUEUECONFIG_H
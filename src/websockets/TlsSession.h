@@ -0,0 +1,75 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPENOCPP_TLSSESSION_H
+#define OPENOCPP_TLSSESSION_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ocpp
+{
+namespace websockets
+{
+
+/** @brief Statistics of the TLS handshakes of the websocket connections */
+struct TlsStats
+{
+    /** @brief Default constructor */
+    TlsStats() : handshakes(0), resumed_handshakes(0) { }
+
+    /** @brief Number of completed TLS handshakes */
+    uint64_t handshakes;
+    /** @brief Number of completed TLS handshakes which have resumed a previous session */
+    uint64_t resumed_handshakes;
+
+    /** @brief Ratio of resumed handshakes among the completed handshakes (0 = none, 1 = all) */
+    double resumptionRate() const
+    {
+        return ((handshakes != 0) ? (static_cast<double>(resumed_handshakes) / static_cast<double>(handshakes)) : 0.);
+    }
+};
+
+/** @brief Interface to persist the TLS sessions of the websocket clients across reconnections and restarts */
+class ITlsSessionStore
+{
+  public:
+    /** @brief Destructor */
+    virtual ~ITlsSessionStore() { }
+
+    /**
+     * @brief Load a TLS session
+     * @param key Key identifying the server and the credentials used for the session
+     * @param session Serialized TLS session
+     * @return true if a session has been found, false otherwise
+     */
+    virtual bool loadTlsSession(const std::string& key, std::vector<uint8_t>& session) = 0;
+
+    /**
+     * @brief Save a TLS session (replaces any previous session with the same key)
+     * @param key Key identifying the server and the credentials used for the session
+     * @param session Serialized TLS session
+     */
+    virtual void saveTlsSession(const std::string& key, const std::vector<uint8_t>& session) = 0;
+};
+
+} // namespace websockets
+} // namespace ocpp
+
+#endif // OPENOCPP_TLSSESSION_H
@@ -37,6 +37,11 @@ static std::vector<std::unique_ptr<LibWebsocketClientPool>> s_client_pools;
 /** @brief Indicate if the standard clients must be allocated from the pools */
 static bool s_force_clients_from_pool = false;
 
+/** @brief Minimum gap between the most and the less loaded pools relatively to the most loaded one to move a client */
+static constexpr double MIN_RELATIVE_IMBALANCE = 0.25;
+/** @brief Minimum gap between the most and the less loaded pools in load score to move a client (4 frames/s) */
+static constexpr double MIN_ABSOLUTE_IMBALANCE = 1024.;
+
 /** @brief Instanciate a client websocket */
 IWebsocketClient* WebsocketFactory::newClient()
 {
@@ -57,16 +62,20 @@ IWebsocketClient* WebsocketFactory::newClientFromPool()
     std::lock_guard<std::mutex> lock(s_client_pools_mutex);
     if (!s_client_pools.empty())
     {
-        // Look for the pool with the less associated clients
-        auto* selected_pool = &s_client_pools[0];
+        // Look for the less loaded pool, or the pool with the less associated clients for an equivalent load
+        LibWebsocketClientPool* selected_pool = nullptr;
+        ClientPoolLoad          selected_load = {0, 0., 0., 0.};
         for (auto& pool : s_client_pools)
         {
-            if (pool->getClientsCount() < (*selected_pool)->getClientsCount())
+            ClientPoolLoad load = pool->getLoad();
+            if (!selected_pool || (load.score < selected_load.score) ||
+                ((load.score == selected_load.score) && (load.clients < selected_load.clients)))
             {
-                selected_pool = &pool;
+                selected_pool = pool.get();
+                selected_load = load;
             }
         }
-        ret = (*selected_pool)->newClient();
+        ret = selected_pool->newClient();
     }
     return ret;
 }
@@ -135,5 +144,61 @@ void WebsocketFactory::forceClientPoolsUsage()
     s_force_clients_from_pool = true;
 }
 
+/** @brief Get the load of each client pool */
+std::vector<ClientPoolLoad> WebsocketFactory::getClientPoolsLoad()
+{
+    std::vector<ClientPoolLoad> loads;
+
+    std::lock_guard<std::mutex> lock(s_client_pools_mutex);
+    for (auto& pool : s_client_pools)
+    {
+        loads.push_back(pool->getLoad());
+    }
+
+    return loads;
+}
+
+/** @brief Move a client from the most loaded client pool to the less loaded one if the load is unbalanced */
+bool WebsocketFactory::balanceClientPools()
+{
+    bool ret = false;
+
+    // Look for the most and the less loaded pools
+    LibWebsocketClientPool* hot_pool   = nullptr;
+    LibWebsocketClientPool* cold_pool  = nullptr;
+    double                  hot_score  = 0.;
+    double                  cold_score = 0.;
+    {
+        std::lock_guard<std::mutex> lock(s_client_pools_mutex);
+        for (auto& pool : s_client_pools)
+        {
+            double score = pool->getLoad().score;
+            if (!hot_pool || (score > hot_score))
+            {
+                hot_pool  = pool.get();
+                hot_score = score;
+            }
+            if (!cold_pool || (score < cold_score))
+            {
+                cold_pool  = pool.get();
+                cold_score = score;
+            }
+        }
+    }
+
+    // Moving a client re-establishes its connection, so it is only done on a significant imbalance
+    double gap = hot_score - cold_score;
+    if ((hot_pool != cold_pool) && (gap >= MIN_ABSOLUTE_IMBALANCE) && (gap >= (hot_score * MIN_RELATIVE_IMBALANCE)))
+    {
+        // Moving a client with a load score s reduces the gap between the pools by 2 * s,
+        // only clients which do not reverse the imbalance can be moved
+        // (the pools are never destroyed so they can be used without the lock, which
+        //  must not be held while waiting for the disconnection of the moved client)
+        ret = hot_pool->migrateClient(*cold_pool, gap / 2.);
+    }
+
+    return ret;
+}
+
 } // namespace websockets
 } // namespace ocpp
@@ -22,11 +22,26 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "IWebsocketClient.h"
 #include "IWebsocketServer.h"
 
+#include <vector>
+
 namespace ocpp
 {
 namespace websockets
 {
 
+/** @brief Load of a client pool */
+struct ClientPoolLoad
+{
+    /** @brief Number of clients */
+    size_t clients;
+    /** @brief Received and sent frames per second */
+    double frames_rate;
+    /** @brief Received and sent bytes per second */
+    double bytes_rate;
+    /** @brief Load score (bytes per second, a frame is weighted as a fixed amount of bytes) */
+    double score;
+};
+
 /** @brief Factory to instanciate websockets */
 class WebsocketFactory
 {
@@ -46,6 +61,12 @@ class WebsocketFactory
     static bool stopClientPools();
     /** @brief Indicate to use the client pools even for new clients instanciated with the newClient API */
     static void forceClientPoolsUsage();
+    /** @brief Get the load of each client pool */
+    static std::vector<ClientPoolLoad> getClientPoolsLoad();
+    /** @brief Move a client from the most loaded client pool to the less loaded one if the load is significantly unbalanced
+     *         (the connection of the moved client is re-established, must be called periodically by the application,
+     *          typically every few minutes) */
+    static bool balanceClientPools();
 };
 
 } // namespace websockets
@@ -74,6 +74,7 @@ LibWebsocketClient::LibWebsocketClient()
       m_retry_policy(),
       m_retry_count(0),
       m_send_msgs(),
+      m_tls_sessions(),
       m_fragmented_frame(nullptr),
       m_fragmented_frame_size(0),
       m_fragmented_frame_index(0)
@@ -180,6 +181,19 @@ bool LibWebsocketClient::connect(const std::string&        url,
             m_context = lws_create_context(&info);
             if (m_context)
             {
+                // Restore the last TLS session to avoid a full handshake on first connection
+                if (m_url.protocol() == "wss")
+                {
+                    uint16_t port = 443u;
+                    if (m_url.port() != 0)
+                    {
+                        port = static_cast<uint16_t>(m_url.port());
+                    }
+                    m_tls_sessions.configure(
+                        (m_credentials.server_name.empty() ? m_url.address() : m_credentials.server_name), port, m_credentials);
+                    m_tls_sessions.load(lws_get_vhost_by_name(m_context, "default"));
+                }
+
                 // Schedule first connection now
                 memset(&m_sched_list, 0, sizeof(m_sched_list));
                 lws_sul_schedule(m_context, 0, &m_sched_list, LibWebsocketClient::connectCallback, 1);
@@ -211,11 +225,8 @@ bool LibWebsocketClient::disconnect()
     {
         // Stop thread
         m_end = true;
-        SendMsg* msg;
-        while (m_send_msgs.pop(msg, 0))
-        {
-            delete msg;
-        }
+        m_send_msgs.setEnable(false);
+        m_send_msgs.clear();
         lws_cancel_service(m_context);
         if (std::this_thread::get_id() != m_thread->get_id())
         {
@@ -249,16 +260,39 @@ bool LibWebsocketClient::send(const void* data, size_t size)
     if (m_connected)
     {
         // Prepare data to send
-        SendMsg* msg = new SendMsg(data, size);
-        ret          = m_send_msgs.push(msg);
+        ret = (m_send_msgs.push(data, size) == SendQueue::PushResult::Queued);
 
-        // Schedule a send
+        // Schedule a send or a close on overflow
         lws_cancel_service(m_context);
     }
 
     return ret;
 }
 
+/** @copydoc void IWebsocketClient::setSendQueueConfig(const SendQueueConfig&) */
+void LibWebsocketClient::setSendQueueConfig(const SendQueueConfig& config)
+{
+    m_send_msgs.setConfig(config);
+}
+
+/** @copydoc SendQueueStats IWebsocketClient::sendQueueStats() const */
+SendQueueStats LibWebsocketClient::sendQueueStats() const
+{
+    return m_send_msgs.stats();
+}
+
+/** @copydoc void IWebsocketClient::setTlsSessionStore(ITlsSessionStore*) */
+void LibWebsocketClient::setTlsSessionStore(ITlsSessionStore* store)
+{
+    m_tls_sessions.setStore(store);
+}
+
+/** @copydoc TlsStats IWebsocketClient::tlsStats() const */
+TlsStats LibWebsocketClient::tlsStats() const
+{
+    return m_tls_sessions.stats();
+}
+
 /** @copydoc void IWebsocketClient::registerListener(IListener&) */
 void LibWebsocketClient::registerListener(IListener& listener)
 {
@@ -270,6 +304,7 @@ void LibWebsocketClient::process()
 {
     // Save this pointer for further callbacks
     client = this;
+    m_send_msgs.setServiceThread(std::this_thread::get_id());
 
     // Mask SIG_PIPE signal
 #ifndef _MSC_VER
@@ -454,6 +489,8 @@ int LibWebsocketClient::eventCallback(struct lws* wsi, enum lws_callback_reasons
         }
 
         case LWS_CALLBACK_CLIENT_ESTABLISHED:
+            client->m_tls_sessions.connectionEstablished(wsi);
+            client->m_send_msgs.setEnable(true);
             client->m_connected = true;
             client->m_listener->wsClientConnected();
             break;
@@ -506,10 +543,16 @@ int LibWebsocketClient::eventCallback(struct lws* wsi, enum lws_callback_reasons
 
         case LWS_CALLBACK_CLIENT_WRITEABLE:
         {
+            // Close the connection if the peer doesn't read its data fast enough
+            if (client->m_send_msgs.overflowed())
+            {
+                return -1;
+            }
+
             // Send data if any ready
-            bool     error = false;
-            SendMsg* msg   = nullptr;
-            while (client->m_send_msgs.pop(msg, 0) && !error)
+            bool                error = false;
+            SendQueue::SendMsg* msg   = nullptr;
+            while (!error && client->m_send_msgs.pop(msg))
             {
                 if (lws_write(wsi, msg->payload, msg->size, LWS_WRITE_TEXT) < static_cast<int>(msg->size))
                 {
@@ -542,11 +585,8 @@ int LibWebsocketClient::eventCallback(struct lws* wsi, enum lws_callback_reasons
                 retry = true;
             }
 
-            SendMsg* msg;
-            while (client->m_send_msgs.pop(msg, 0))
-            {
-                delete msg;
-            }
+            client->m_send_msgs.setEnable(false);
+            client->m_send_msgs.clear();
             break;
 
         default:
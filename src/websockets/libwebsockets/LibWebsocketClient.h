@@ -20,7 +20,8 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #define OPENOCPP_LIBWEBSOCKETCLIENT_H
 
 #include "IWebsocketClient.h"
-#include "Queue.h"
+#include "SendQueue.h"
+#include "TlsSessionCache.h"
 #include "Url.h"
 #include "websockets.h"
 
@@ -60,32 +61,22 @@ class LibWebsocketClient : public IWebsocketClient
     /** @copydoc bool IWebsocketClient::send(const void*, size_t) */
     bool send(const void* data, size_t size) override;
 
+    /** @copydoc void IWebsocketClient::setSendQueueConfig(const SendQueueConfig&) */
+    void setSendQueueConfig(const SendQueueConfig& config) override;
+
+    /** @copydoc SendQueueStats IWebsocketClient::sendQueueStats() const */
+    SendQueueStats sendQueueStats() const override;
+
+    /** @copydoc void IWebsocketClient::setTlsSessionStore(ITlsSessionStore*) */
+    void setTlsSessionStore(ITlsSessionStore* store) override;
+
+    /** @copydoc TlsStats IWebsocketClient::tlsStats() const */
+    TlsStats tlsStats() const override;
+
     /** @copydoc void IWebsocketClient::registerListener(IListener&) */
     void registerListener(IListener& listener) override;
 
   private:
-    /** @brief Message to send */
-    struct SendMsg
-    {
-        /** @brief Constructor */
-        SendMsg(const void* _data, size_t _size)
-        {
-            data    = new unsigned char[LWS_PRE + _size];
-            size    = _size;
-            payload = &data[LWS_PRE];
-            memcpy(payload, _data, size);
-        }
-        /** @brief Destructor */
-        virtual ~SendMsg() { delete[] data; }
-
-        /** @brief Data buffer */
-        unsigned char* data;
-        /** @brief Payload start */
-        unsigned char* payload;
-        /** @brief Size in bytes */
-        size_t size;
-    };
-
     /** @brief Listener */
     IListener* m_listener;
     /** @brief Internal thread */
@@ -121,7 +112,9 @@ class LibWebsocketClient : public IWebsocketClient
     uint16_t m_retry_count;
 
     /** @brief Queue of messages to send */
-    ocpp::helpers::Queue<SendMsg*> m_send_msgs;
+    SendQueue m_send_msgs;
+    /** @brief TLS session persistency and statistics */
+    TlsSessionCache m_tls_sessions;
 
     /** @brief Buffer to store fragmented frames */
     uint8_t* m_fragmented_frame;
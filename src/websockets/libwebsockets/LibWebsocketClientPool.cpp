@@ -18,6 +18,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 
 #include "LibWebsocketClientPool.h"
 
+#include <cctype>
 #include <csignal>
 #include <cstdint>
 #include <functional>
@@ -33,14 +34,19 @@ namespace websockets
 /** @brief Thread local client instance used when callbacks doesn't provide user data */
 thread_local LibWebsocketClientPool* pool;
 
+/** @brief Minimum time between the (re)connection of a client and its migration to another pool */
+constexpr std::chrono::seconds LibWebsocketClientPool::MIGRATION_COOLDOWN;
+/** @brief Time after which a call without response does not prevent the migration of a client anymore */
+constexpr std::chrono::seconds LibWebsocketClientPool::PENDING_CALL_TIMEOUT;
+
 /** @brief Constructor */
 LibWebsocketClientPool::LibWebsocketClientPool()
     : m_context(nullptr),
       m_logs_context(),
       m_thread(nullptr),
       m_end(false),
-      m_clients_count(0),
-      m_clients_count_mutex(),
+      m_clients(),
+      m_clients_mutex(),
       m_waiting_connect_queue(),
       m_waiting_disconnect_queue(),
       m_waiting_send_queue()
@@ -117,8 +123,61 @@ bool LibWebsocketClientPool::stop()
 /** @brief Get the number of clients */
 size_t LibWebsocketClientPool::getClientsCount() const
 {
-    std::lock_guard<std::mutex> lock(m_clients_count_mutex);
-    return m_clients_count;
+    std::lock_guard<std::mutex> lock(m_clients_mutex);
+    return m_clients.size();
+}
+
+/** @brief Get the load of the pool */
+ClientPoolLoad LibWebsocketClientPool::getLoad()
+{
+    ClientPoolLoad load = {0, 0., 0., 0.};
+
+    std::lock_guard<std::mutex> lock(m_clients_mutex);
+    auto                        now = std::chrono::steady_clock::now();
+    for (Client* client : m_clients)
+    {
+        TrafficRate rate = client->m_traffic.rate(now);
+        load.frames_rate += rate.frames;
+        load.bytes_rate += rate.bytes;
+        load.score += rate.score();
+    }
+    load.clients = m_clients.size();
+
+    return load;
+}
+
+/** @brief Move the busiest client of the pool to another pool */
+bool LibWebsocketClientPool::migrateClient(LibWebsocketClientPool& pool, double max_client_score)
+{
+    bool ret = false;
+
+    // Look for the busiest client which can be moved
+    std::unique_lock<std::mutex> lock(m_clients_mutex);
+    Client*                      selected_client = nullptr;
+    double                       selected_score  = 0.;
+    auto                         now             = std::chrono::steady_clock::now();
+    for (Client* client : m_clients)
+    {
+        double score = client->m_traffic.rate(now).score();
+        if ((score > selected_score) && (score < max_client_score) && client->canMigrate(now))
+        {
+            selected_client = client;
+            selected_score  = score;
+        }
+    }
+    if (selected_client)
+    {
+        // The client cannot be destroyed while the migration lock is held
+        // (try lock since the client may be waiting for the pool lock in its destructor)
+        std::unique_lock<std::mutex> migration_lock(selected_client->m_migration_mutex, std::try_to_lock);
+        if (migration_lock.owns_lock())
+        {
+            lock.unlock();
+            ret = selected_client->migrate(pool);
+        }
+    }
+
+    return ret;
 }
 
 /** @brief Instanciate a client websocket */
@@ -237,7 +296,7 @@ int LibWebsocketClientPool::eventCallback(struct lws* wsi, enum lws_callback_rea
 /** @brief Constructor */
 LibWebsocketClientPool::Client::Client(LibWebsocketClientPool& pool)
     : IWebsocketClient(),
-      m_pool(pool),
+      m_pool(&pool),
       m_listener(nullptr),
       m_connect_timeout(0),
       m_retry_interval(0),
@@ -251,32 +310,42 @@ LibWebsocketClientPool::Client::Client(LibWebsocketClientPool& pool)
       m_disconnect_mutex(),
       m_disconnect_process_in_progress(false),
       m_disconnect_process_done(false),
-      m_context(m_pool.m_context),
+      m_migrating(false),
+      m_migration_mutex(),
+      m_connection_time(std::chrono::steady_clock::time_point()),
+      m_sent_call_time(std::chrono::steady_clock::time_point()),
+      m_received_call_time(std::chrono::steady_clock::time_point()),
+      m_context(m_pool->m_context),
       m_vhost(nullptr),
       m_wsi(nullptr),
       m_retry_policy(),
       m_retry_count(0),
       m_schedule_data(),
       m_send_msgs(),
+      m_traffic(),
+      m_tls_sessions(),
       m_fragmented_frame(nullptr),
       m_fragmented_frame_size(0),
       m_fragmented_frame_index(0)
 {
-    // Increase client count in the associated pool
-    std::lock_guard<std::mutex> lock(m_pool.m_clients_count_mutex);
-    m_pool.m_clients_count++;
+    // Add client to the associated pool
+    std::lock_guard<std::mutex> lock(m_pool->m_clients_mutex);
+    m_pool->m_clients.insert(this);
 }
 
 /** @brief Destructor */
 LibWebsocketClientPool::Client::~Client()
 {
+    // Wait for the end of a migration in progress
+    std::lock_guard<std::mutex> migration_lock(m_migration_mutex);
+
     // To prevent keeping an open connection in background
     disconnect();
     releaseFragmentedFrame();
 
-    // Decrease client count in the associated pool
-    std::lock_guard<std::mutex> lock(m_pool.m_clients_count_mutex);
-    m_pool.m_clients_count--;
+    // Remove client from the associated pool
+    std::lock_guard<std::mutex> lock(m_pool->m_clients_mutex);
+    m_pool->m_clients.erase(this);
 }
 
 /** @copydoc bool IWebsocketClient::connect(const std::string&, const std::string&, const Credentials&,
@@ -305,6 +374,16 @@ bool LibWebsocketClientPool::Client::connect(const std::string&        url,
             m_connect_timeout = static_cast<unsigned int>(std::chrono::duration_cast<std::chrono::seconds>(connect_timeout).count());
             m_retry_interval  = static_cast<uint32_t>(retry_interval.count());
             m_ping_interval   = static_cast<uint16_t>(std::chrono::duration_cast<std::chrono::seconds>(ping_interval).count());
+            if (m_url.protocol() == "wss")
+            {
+                uint16_t port = 443u;
+                if (m_url.port() != 0)
+                {
+                    port = static_cast<uint16_t>(m_url.port());
+                }
+                const std::string& host = (m_credentials.server_name.empty() ? m_url.address() : m_credentials.server_name);
+                m_tls_sessions.configure(host, port, m_credentials);
+            }
 
             // Configure retry policy
 #ifdef _MSC_VER
@@ -329,7 +408,7 @@ bool LibWebsocketClientPool::Client::connect(const std::string&        url,
             // Start connection process
             m_connection_error_notified = false;
             m_connected                 = false;
-            m_pool.m_waiting_connect_queue.push(this);
+            m_pool->m_waiting_connect_queue.push(this);
             lws_cancel_service(m_context);
 
             ret = true;
@@ -346,6 +425,9 @@ bool LibWebsocketClientPool::Client::disconnect()
 
     std::unique_lock<std::mutex> lock(m_disconnect_mutex);
 
+    // Cancel a migration in progress
+    m_migrating = false;
+
     // Check if connected
     if (!m_disconnect_process_in_progress && !m_protocol.empty())
     {
@@ -353,22 +435,19 @@ bool LibWebsocketClientPool::Client::disconnect()
         m_retry_interval                 = 0;
         m_disconnect_process_in_progress = true;
         m_disconnect_process_done        = false;
-        m_pool.m_waiting_disconnect_queue.push(this);
+        m_pool->m_waiting_disconnect_queue.push(this);
         lws_cancel_service(m_context);
 
         // Wait actual disconnection
-        if (std::this_thread::get_id() != m_pool.m_thread->get_id())
+        if (std::this_thread::get_id() != m_pool->m_thread->get_id())
         {
             m_disconnect_cond_var.wait(lock, [&] { return m_disconnect_process_done; });
         }
     }
 
     // Clear message queue
-    SendMsg* msg;
-    while (m_send_msgs.pop(msg, 0))
-    {
-        delete msg;
-    }
+    m_send_msgs.setEnable(false);
+    m_send_msgs.clear();
 
     ret = true;
 
@@ -378,7 +457,8 @@ bool LibWebsocketClientPool::Client::disconnect()
 /** @copydoc bool IWebsocketClient::isConnected() */
 bool LibWebsocketClientPool::Client::isConnected()
 {
-    return m_connected;
+    // A migrating client is seen as connected
+    return (m_connected || m_migrating);
 }
 
 /** @copydoc bool IWebsocketClient::send(const void*, size_t) */
@@ -386,29 +466,151 @@ bool LibWebsocketClientPool::Client::send(const void* data, size_t size)
 {
     bool ret = false;
 
-    std::lock_guard<std::mutex> lock(m_disconnect_mutex);
-
-    // Check if connected
-    if (m_connected)
+    // Check if connected (messages are queued during a migration and sent once connected to the new pool)
+    if (m_connected || m_migrating)
     {
         // Prepare data to send
-        SendMsg* msg = new SendMsg(data, size);
-        ret          = m_send_msgs.push(msg);
+        // => Done outside of the disconnect lock since the push operation may block
+        //    depending on the send queue policy
+        ret = (m_send_msgs.push(data, size) == SendQueue::PushResult::Queued);
+        if (ret)
+        {
+            m_traffic.add(size);
+            trackCalls(data, size, true);
+        }
 
-        // Schedule a send
-        m_pool.m_waiting_send_queue.push(this);
-        lws_cancel_service(m_context);
+        // Schedule a send or a close on overflow
+        std::lock_guard<std::mutex> lock(m_disconnect_mutex);
+        if (m_connected)
+        {
+            m_pool->m_waiting_send_queue.push(this);
+            lws_cancel_service(m_context);
+        }
     }
 
     return ret;
 }
 
+/** @copydoc void IWebsocketClient::setSendQueueConfig(const SendQueueConfig&) */
+void LibWebsocketClientPool::Client::setSendQueueConfig(const SendQueueConfig& config)
+{
+    m_send_msgs.setConfig(config);
+}
+
+/** @copydoc SendQueueStats IWebsocketClient::sendQueueStats() const */
+SendQueueStats LibWebsocketClientPool::Client::sendQueueStats() const
+{
+    return m_send_msgs.stats();
+}
+
+/** @copydoc void IWebsocketClient::setTlsSessionStore(ITlsSessionStore*) */
+void LibWebsocketClientPool::Client::setTlsSessionStore(ITlsSessionStore* store)
+{
+    m_tls_sessions.setStore(store);
+}
+
+/** @copydoc TlsStats IWebsocketClient::tlsStats() const */
+TlsStats LibWebsocketClientPool::Client::tlsStats() const
+{
+    return m_tls_sessions.stats();
+}
+
 /** @copydoc void IWebsocketClient::registerListener(IListener&) */
 void LibWebsocketClientPool::Client::registerListener(IListener& listener)
 {
     m_listener = &listener;
 }
 
+/** @brief Move the client to another pool */
+bool LibWebsocketClientPool::Client::migrate(LibWebsocketClientPool& pool)
+{
+    bool ret = false;
+
+    std::unique_lock<std::mutex> lock(m_disconnect_mutex);
+
+    // Only established connections can be moved, and never from the pool thread
+    if (m_connected && !m_disconnect_process_in_progress && !m_protocol.empty() && (&pool != m_pool) &&
+        (std::this_thread::get_id() != m_pool->m_thread->get_id()) && canMigrate(std::chrono::steady_clock::now()))
+    {
+        // Save connection parameters
+        std::string protocol       = m_protocol;
+        uint32_t    retry_interval = m_retry_interval;
+
+        // Disconnect from the current pool without notifying the listener
+        m_migrating                      = true;
+        m_retry_interval                 = 0;
+        m_disconnect_process_in_progress = true;
+        m_disconnect_process_done        = false;
+        m_pool->m_waiting_disconnect_queue.push(this);
+        lws_cancel_service(m_context);
+        m_disconnect_cond_var.wait(lock, [&] { return m_disconnect_process_done; });
+
+        // Check if the migration has not been cancelled by a disconnection request
+        if (m_migrating)
+        {
+            // Move to the new pool
+            {
+                std::lock_guard<std::mutex> clients_lock(m_pool->m_clients_mutex);
+                m_pool->m_clients.erase(this);
+            }
+            {
+                std::lock_guard<std::mutex> clients_lock(pool.m_clients_mutex);
+                pool.m_clients.insert(this);
+            }
+            m_pool    = &pool;
+            m_context = pool.m_context;
+
+            // Start connection process in the new pool
+            m_protocol       = protocol;
+            m_retry_interval = retry_interval;
+            memset(&m_schedule_data, 0, sizeof(m_schedule_data));
+            m_schedule_data.client = this;
+            m_pool->m_waiting_connect_queue.push(this);
+            lws_cancel_service(m_context);
+
+            ret = true;
+        }
+    }
+
+    return ret;
+}
+
+/** @brief Indicate if the client can be moved to another pool */
+bool LibWebsocketClientPool::Client::canMigrate(std::chrono::steady_clock::time_point now) const
+{
+    // A migration closes the connection : the responses to the pending calls would be lost
+    // and the clients must not be moved back and forth on traffic fluctuations
+    auto is_pending = [now](std::chrono::steady_clock::time_point call_time)
+    { return ((call_time != std::chrono::steady_clock::time_point()) && ((now - call_time) < PENDING_CALL_TIMEOUT)); };
+    return (((now - m_connection_time.load()) >= MIGRATION_COOLDOWN) && !is_pending(m_sent_call_time.load()) &&
+            !is_pending(m_received_call_time.load()));
+}
+
+/** @brief Track the calls waiting for a response from the OCPP-J message type of a frame */
+void LibWebsocketClientPool::Client::trackCalls(const void* data, size_t size, bool sent)
+{
+    // OCPP-J frames are JSON arrays starting with the message type : 2 = CALL, 3 = CALLRESULT, 4 = CALLERROR
+    const char* frame = reinterpret_cast<const char*>(data);
+    size_t      index = 0;
+    while ((index < size) && ((frame[index] == '[') || std::isspace(static_cast<unsigned char>(frame[index]))))
+    {
+        index++;
+    }
+    if (index < size)
+    {
+        auto& call_time     = (sent ? m_sent_call_time : m_received_call_time);
+        auto& response_time = (sent ? m_received_call_time : m_sent_call_time);
+        if (frame[index] == '2')
+        {
+            call_time = std::chrono::steady_clock::now();
+        }
+        else if ((frame[index] == '3') || (frame[index] == '4'))
+        {
+            response_time = std::chrono::steady_clock::time_point();
+        }
+    }
+}
+
 /** @brief Prepare the buffer to store a new fragmented frame */
 void LibWebsocketClientPool::Client::beginFragmentedFrame(size_t frame_size)
 {
@@ -525,8 +727,12 @@ void LibWebsocketClientPool::Client::connectCallback(struct lws_sorted_usec_list
                     }
                 }
 
-                // Create vhost
+                // Create vhost and restore the last TLS session
                 client->m_vhost = lws_create_vhost(client->m_context, &vhost_info);
+                if (client->m_url.protocol() == "wss")
+                {
+                    client->m_tls_sessions.load(client->m_vhost);
+                }
             }
             if (client->m_vhost)
             {
@@ -612,7 +818,15 @@ int LibWebsocketClientPool::Client::eventCallback(
     switch (reason)
     {
         case LWS_CALLBACK_CLIENT_CONNECTION_ERROR:
-            if (!client->m_connection_error_notified)
+            if (client->m_migrating)
+            {
+                // Connection could not be re-established after a migration
+                client->m_migrating = false;
+                client->m_send_msgs.setEnable(false);
+                client->m_send_msgs.clear();
+                client->m_listener->wsClientDisconnected();
+            }
+            else if (!client->m_connection_error_notified)
             {
                 client->m_connection_error_notified = true;
                 client->m_listener->wsClientFailed();
@@ -645,8 +859,21 @@ int LibWebsocketClientPool::Client::eventCallback(
 
         case LWS_CALLBACK_CLIENT_ESTABLISHED:
         {
-            client->m_connected = true;
-            client->m_listener->wsClientConnected();
+            client->m_tls_sessions.connectionEstablished(wsi);
+            client->m_send_msgs.setServiceThread(std::this_thread::get_id());
+            client->m_send_msgs.setEnable(true);
+            client->m_connected       = true;
+            client->m_connection_time = std::chrono::steady_clock::now();
+            if (client->m_migrating)
+            {
+                // End of migration, send the messages queued in the meantime
+                client->m_migrating = false;
+                lws_callback_on_writable(wsi);
+            }
+            else
+            {
+                client->m_listener->wsClientConnected();
+            }
             break;
         }
 
@@ -661,6 +888,8 @@ int LibWebsocketClientPool::Client::eventCallback(
                 if (is_first && is_last)
                 {
                     // Notify client
+                    client->m_traffic.add(len);
+                    client->trackCalls(in, len, false);
                     client->m_listener->wsClientDataReceived(in, len);
                 }
                 else if (is_first)
@@ -676,6 +905,8 @@ int LibWebsocketClientPool::Client::eventCallback(
                     if (is_last)
                     {
                         // Notify client
+                        client->m_traffic.add(client->m_fragmented_frame_size);
+                        client->trackCalls(client->m_fragmented_frame, client->m_fragmented_frame_size, false);
                         client->m_listener->wsClientDataReceived(client->m_fragmented_frame, client->m_fragmented_frame_size);
 
                         // Release resources
@@ -688,10 +919,16 @@ int LibWebsocketClientPool::Client::eventCallback(
 
         case LWS_CALLBACK_CLIENT_WRITEABLE:
         {
+            // Close the connection if the peer doesn't read its data fast enough
+            if (client->m_send_msgs.overflowed())
+            {
+                return -1;
+            }
+
             // Send data if any ready
-            bool     error = false;
-            SendMsg* msg   = nullptr;
-            while (client->m_send_msgs.pop(msg, 0) && !error)
+            bool                error = false;
+            SendQueue::SendMsg* msg   = nullptr;
+            while (!error && client->m_send_msgs.pop(msg))
             {
                 if (lws_write(wsi, msg->payload, msg->size, LWS_WRITE_TEXT) < static_cast<int>(msg->size))
                 {
@@ -718,16 +955,17 @@ int LibWebsocketClientPool::Client::eventCallback(
 
         case LWS_CALLBACK_CLIENT_CLOSED:
             client->m_connected = false;
-            client->m_listener->wsClientDisconnected();
             if (client->m_retry_interval != 0)
             {
                 retry = true;
             }
 
-            SendMsg* msg;
-            while (client->m_send_msgs.pop(msg, 0))
+            // Pending messages are kept when the client is migrating to another pool
+            if (!client->m_migrating)
             {
-                delete msg;
+                client->m_listener->wsClientDisconnected();
+                client->m_send_msgs.setEnable(false);
+                client->m_send_msgs.clear();
             }
             break;
 
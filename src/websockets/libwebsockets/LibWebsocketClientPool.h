@@ -21,12 +21,19 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 
 #include "IWebsocketClient.h"
 #include "Queue.h"
+#include "SendQueue.h"
+#include "TlsSessionCache.h"
+#include "TrafficMeter.h"
 #include "Url.h"
+#include "WebsocketFactory.h"
 #include "websockets.h"
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <mutex>
 #include <thread>
+#include <unordered_set>
 
 namespace ocpp
 {
@@ -41,6 +48,11 @@ class LibWebsocketClientPool
     friend class Client;
 
   public:
+    /** @brief Minimum time between the (re)connection of a client and its migration to another pool */
+    static constexpr std::chrono::seconds MIGRATION_COOLDOWN = std::chrono::minutes(5);
+    /** @brief Time after which a call without response does not prevent the migration of a client anymore */
+    static constexpr std::chrono::seconds PENDING_CALL_TIMEOUT = std::chrono::minutes(2);
+
     /** @brief Constructor */
     LibWebsocketClientPool();
     /** @brief Destructor */
@@ -52,6 +64,17 @@ class LibWebsocketClientPool
     bool stop();
     /** @brief Get the number of clients */
     size_t getClientsCount() const;
+    /** @brief Get the load of the pool */
+    ClientPoolLoad getLoad();
+
+    /**
+     * @brief Move the busiest client of the pool to another pool (the clients which have been (re)connected
+     *        recently or which have a call waiting for a response are never moved)
+     * @param pool Pool to move the client to
+     * @param max_client_score Only the clients with a load score lower than this value can be moved
+     * @return true if a client has been moved, false otherwise
+     */
+    bool migrateClient(LibWebsocketClientPool& pool, double max_client_score);
 
     /** @brief Instanciate a client websocket */
     IWebsocketClient* newClient();
@@ -65,10 +88,10 @@ class LibWebsocketClientPool
     std::thread* m_thread;
     /** @brief Indicate the end of processing to the thread */
     bool m_end;
-    /** @brief Number of clients */
-    size_t m_clients_count;
-    /** @brief Mutex for the number of clients */
-    mutable std::mutex m_clients_count_mutex;
+    /** @brief Clients */
+    std::unordered_set<Client*> m_clients;
+    /** @brief Mutex for the clients */
+    mutable std::mutex m_clients_mutex;
 
     /** @brief Clients queued for connection */
     ocpp::helpers::Queue<Client*> m_waiting_connect_queue;
@@ -112,32 +135,37 @@ class LibWebsocketClientPool
         /** @copydoc bool IWebsocketClient::send(const void*, size_t) */
         bool send(const void* data, size_t size) override;
 
+        /** @copydoc void IWebsocketClient::setSendQueueConfig(const SendQueueConfig&) */
+        void setSendQueueConfig(const SendQueueConfig& config) override;
+
+        /** @copydoc SendQueueStats IWebsocketClient::sendQueueStats() const */
+        SendQueueStats sendQueueStats() const override;
+
+        /** @copydoc void IWebsocketClient::setTlsSessionStore(ITlsSessionStore*) */
+        void setTlsSessionStore(ITlsSessionStore* store) override;
+
+        /** @copydoc TlsStats IWebsocketClient::tlsStats() const */
+        TlsStats tlsStats() const override;
+
         /** @copydoc void IWebsocketClient::registerListener(IListener&) */
         void registerListener(IListener& listener) override;
 
-      private:
-        /** @brief Message to send */
-        struct SendMsg
-        {
-            /** @brief Constructor */
-            SendMsg(const void* _data, size_t _size)
-            {
-                data    = new unsigned char[LWS_PRE + _size];
-                size    = _size;
-                payload = &data[LWS_PRE];
-                memcpy(payload, _data, size);
-            }
-            /** @brief Destructor */
-            virtual ~SendMsg() { delete[] data; }
-
-            /** @brief Data buffer */
-            unsigned char* data;
-            /** @brief Payload start */
-            unsigned char* payload;
-            /** @brief Size in bytes */
-            size_t size;
-        };
+        /**
+         * @brief Move the client to another pool, the connection is re-established through the new pool
+         *        without notifying the listener (messages received during the migration may be lost)
+         * @param pool Pool to move the client to
+         * @return true if the client has been moved, false otherwise
+         */
+        bool migrate(LibWebsocketClientPool& pool);
+
+        /**
+         * @brief Indicate if the client can be moved to another pool
+         * @param now Current time
+         * @return true if the client has been connected for long enough and has no call waiting for a response
+         */
+        bool canMigrate(std::chrono::steady_clock::time_point now) const;
 
+      private:
         /** @brief Schedule data */
         struct ScheduleData
         {
@@ -148,7 +176,7 @@ class LibWebsocketClientPool
         };
 
         /** @brief Associated client pool */
-        LibWebsocketClientPool& m_pool;
+        LibWebsocketClientPool* m_pool;
         /** @brief Listener */
         IListener* m_listener;
         /** @brief Connection timeout */
@@ -175,6 +203,16 @@ class LibWebsocketClientPool
         bool m_disconnect_process_in_progress;
         /** @brief Indicate that the disconnect process is done */
         bool m_disconnect_process_done;
+        /** @brief Indicate that the client is migrating to another pool */
+        std::atomic<bool> m_migrating;
+        /** @brief Migration mutex (prevents the destruction of the client during a migration) */
+        std::mutex m_migration_mutex;
+        /** @brief Time of the last established connection */
+        std::atomic<std::chrono::steady_clock::time_point> m_connection_time;
+        /** @brief Time of the last call sent and waiting for a response (time_point() = none) */
+        std::atomic<std::chrono::steady_clock::time_point> m_sent_call_time;
+        /** @brief Time of the last call received and waiting for a response (time_point() = none) */
+        std::atomic<std::chrono::steady_clock::time_point> m_received_call_time;
 
         /** @brief Websocket context */
         struct lws_context* m_context;
@@ -190,7 +228,11 @@ class LibWebsocketClientPool
         struct ScheduleData m_schedule_data;
 
         /** @brief Queue of messages to send */
-        ocpp::helpers::Queue<SendMsg*> m_send_msgs;
+        SendQueue m_send_msgs;
+        /** @brief Traffic measurement */
+        TrafficMeter m_traffic;
+        /** @brief TLS session persistency and statistics */
+        TlsSessionCache m_tls_sessions;
 
         /** @brief Buffer to store fragmented frames */
         uint8_t* m_fragmented_frame;
@@ -205,6 +247,8 @@ class LibWebsocketClientPool
         void appendFragmentedData(const void* data, size_t size);
         /** @brief Release the memory associated with the fragmented frame */
         void releaseFragmentedFrame();
+        /** @brief Track the calls waiting for a response from the OCPP-J message type of a frame */
+        void trackCalls(const void* data, size_t size, bool sent);
 
         /** @brief libwebsockets connection callback */
         static void connectCallback(struct lws_sorted_usec_list* sul) noexcept;
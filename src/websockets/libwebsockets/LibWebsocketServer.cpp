@@ -40,6 +40,10 @@ LibWebsocketServer::LibWebsocketServer()
       m_url(),
       m_protocol(""),
       m_credentials(),
+      m_send_queue_config(),
+      m_ticket_keys(),
+      m_tls_handshakes(0),
+      m_tls_resumed_handshakes(0),
       m_context(nullptr),
       m_logs_context(),
       m_wsi(nullptr),
@@ -121,6 +125,7 @@ bool LibWebsocketServer::start(const std::string&        url,
             }
             info.protocols             = &m_protocols[0];
             info.retry_and_idle_policy = &m_retry_policy;
+            info.user                  = this;
             m_credentials              = credentials;
             if (m_url.protocol() == "wss")
             {
@@ -180,6 +185,14 @@ bool LibWebsocketServer::start(const std::string&        url,
                 {
                     info.options |= LWS_SERVER_OPTION_REQUIRE_VALID_OPENSSL_CLIENT_CERT;
                 }
+                if (m_credentials.tls_ticket_key_rotation_interval.count() != 0)
+                {
+                    m_ticket_keys = std::make_unique<TlsTicketKeys>(m_credentials.tls_ticket_key_rotation_interval);
+                }
+                else
+                {
+                    m_ticket_keys.reset();
+                }
             }
 
             // Create context
@@ -224,6 +237,21 @@ bool LibWebsocketServer::stop()
     return ret;
 }
 
+/** @copydoc void IWebsocketServer::setSendQueueConfig(const SendQueueConfig&) */
+void LibWebsocketServer::setSendQueueConfig(const SendQueueConfig& config)
+{
+    m_send_queue_config = config;
+}
+
+/** @copydoc TlsStats IWebsocketServer::tlsStats() const */
+TlsStats LibWebsocketServer::tlsStats() const
+{
+    TlsStats stats;
+    stats.handshakes         = m_tls_handshakes;
+    stats.resumed_handshakes = m_tls_resumed_handshakes;
+    return stats;
+}
+
 /** @copydoc void IWebsocketServer::registerListener(IListener&) */
 void LibWebsocketServer::registerListener(IListener& listener)
 {
@@ -273,6 +301,22 @@ int LibWebsocketServer::eventCallback(struct lws* wsi, enum lws_callback_reasons
             server->m_wsi = wsi;
             break;
 
+        case LWS_CALLBACK_OPENSSL_LOAD_EXTRA_SERVER_VERIFY_CERTS:
+        {
+            // Called during the context creation, outside of the server thread
+            LibWebsocketServer* instance = reinterpret_cast<LibWebsocketServer*>(lws_context_user(lws_get_context(wsi)));
+            if (instance && instance->m_ticket_keys)
+            {
+                // Install the session ticket keys on the TLS context
+                if (!instance->m_ticket_keys->install(reinterpret_cast<SSL_CTX*>(user)))
+                {
+                    lwsl_err("unable to install the TLS session ticket keys\n");
+                    ret = -1;
+                }
+            }
+        }
+        break;
+
         case LWS_CALLBACK_FILTER_NETWORK_CONNECTION:
         {
             // Get parameters
@@ -434,11 +478,21 @@ int LibWebsocketServer::eventCallback(struct lws* wsi, enum lws_callback_reasons
 
         case LWS_CALLBACK_ESTABLISHED:
         {
+            // Update TLS statistics
+            if (lws_is_ssl(wsi))
+            {
+                server->m_tls_handshakes++;
+                if (SSL_session_reused(lws_get_ssl(wsi)))
+                {
+                    server->m_tls_resumed_handshakes++;
+                }
+            }
+
             // Get client IP address
             char* ip_address = reinterpret_cast<char*>(lws_wsi_user(wsi));
 
             // Instanciate a new client
-            std::shared_ptr<IClient> client(new Client(wsi, ip_address));
+            std::shared_ptr<IClient> client(new Client(wsi, ip_address, server->m_send_queue_config));
             server->m_clients[wsi] = client;
 
             // Notify connection
@@ -522,9 +576,9 @@ int LibWebsocketServer::eventCallback(struct lws* wsi, enum lws_callback_reasons
                 if (client->m_connected)
                 {
                     // Send data if any ready
-                    bool     error = false;
-                    SendMsg* msg   = nullptr;
-                    while (client->m_send_msgs.pop(msg, 0) && !error)
+                    bool                error = false;
+                    SendQueue::SendMsg* msg   = nullptr;
+                    while (!error && client->m_send_msgs.pop(msg))
                     {
                         if (lws_write(client->m_wsi, msg->payload, msg->size, LWS_WRITE_TEXT) < static_cast<int>(msg->size))
                         {
@@ -601,7 +655,7 @@ int LibWebsocketServer::eventCallback(struct lws* wsi, enum lws_callback_reasons
 }
 
 /** @brief Constructor */
-LibWebsocketServer::Client::Client(struct lws* wsi, const char* ip_address)
+LibWebsocketServer::Client::Client(struct lws* wsi, const char* ip_address, const SendQueueConfig& send_queue_config)
     : m_wsi(wsi),
       m_ip_address(ip_address),
       m_connected(true),
@@ -611,6 +665,9 @@ LibWebsocketServer::Client::Client(struct lws* wsi, const char* ip_address)
       m_fragmented_frame_size(0),
       m_fragmented_frame_index(0)
 {
+    // Clients are instanciated by the service thread which is in charge of emptying the queue
+    m_send_msgs.setConfig(send_queue_config);
+    m_send_msgs.setServiceThread(std::this_thread::get_id());
 }
 /** @brief Destructor */
 LibWebsocketServer::Client::~Client()
@@ -646,11 +703,8 @@ bool LibWebsocketServer::Client::disconnect(bool notify_disconnected)
     }
 
     // Empty message queue
-    SendMsg* msg = nullptr;
-    while (m_send_msgs.pop(msg, 0))
-    {
-        delete msg;
-    }
+    m_send_msgs.setEnable(false);
+    m_send_msgs.clear();
 
     return ret;
 }
@@ -670,16 +724,29 @@ bool LibWebsocketServer::Client::send(const void* data, size_t size)
     if (m_connected)
     {
         // Prepare data to send
-        SendMsg* msg = new SendMsg(data, size);
-        ret          = m_send_msgs.push(msg);
-
-        // Schedule a send
-        lws_cancel_service_pt(m_wsi);
+        SendQueue::PushResult result = m_send_msgs.push(data, size);
+        if (result == SendQueue::PushResult::Queued)
+        {
+            // Schedule a send
+            lws_cancel_service_pt(m_wsi);
+            ret = true;
+        }
+        else if (result == SendQueue::PushResult::Overflow)
+        {
+            // Slow consumer, close the connection
+            disconnect(true);
+        }
     }
 
     return ret;
 }
 
+/** @copydoc SendQueueStats IClient::sendQueueStats() const */
+SendQueueStats LibWebsocketServer::Client::sendQueueStats() const
+{
+    return m_send_msgs.stats();
+}
+
 /** @copydoc bool IClient::registerListener(IListener&) */
 void LibWebsocketServer::Client::registerListener(IClient::IListener& listener)
 {
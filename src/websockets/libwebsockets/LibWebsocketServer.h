@@ -20,11 +20,13 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #define OPENOCPP_LIBWEBSOCKETSERVER_H
 
 #include "IWebsocketServer.h"
-#include "Queue.h"
+#include "SendQueue.h"
+#include "TlsTicketKeys.h"
 #include "Url.h"
 #include "websockets.h"
 
 #include <array>
+#include <atomic>
 #include <condition_variable>
 #include <mutex>
 #include <thread>
@@ -54,32 +56,16 @@ class LibWebsocketServer : public IWebsocketServer
     /** @copydoc bool IWebsocketServer::stop() */
     bool stop() override;
 
+    /** @copydoc void IWebsocketServer::setSendQueueConfig(const SendQueueConfig&) */
+    void setSendQueueConfig(const SendQueueConfig& config) override;
+
+    /** @copydoc TlsStats IWebsocketServer::tlsStats() const */
+    TlsStats tlsStats() const override;
+
     /** @copydoc void IWebsocketServer::registerListener(IListener&) */
     void registerListener(IListener& listener) override;
 
   private:
-    /** @brief Message to send */
-    struct SendMsg
-    {
-        /** @brief Constructor */
-        SendMsg(const void* _data, size_t _size)
-        {
-            data    = new unsigned char[LWS_PRE + _size];
-            size    = _size;
-            payload = &data[LWS_PRE];
-            memcpy(payload, _data, size);
-        }
-        /** @brief Destructor */
-        virtual ~SendMsg() { delete[] data; }
-
-        /** @brief Data buffer */
-        unsigned char* data;
-        /** @brief Payload start */
-        unsigned char* payload;
-        /** @brief Size in bytes */
-        size_t size;
-    };
-
     /** @brief Websocket client connection */
     class Client : public IClient
     {
@@ -90,8 +76,9 @@ class LibWebsocketServer : public IWebsocketServer
          * @brief Constructor
          * @param wsi Client socket
          * @param ip_address IP address
+         * @param send_queue_config Send queue configuration
         */
-        Client(struct lws* wsi, const char* ip_address);
+        Client(struct lws* wsi, const char* ip_address, const SendQueueConfig& send_queue_config);
         /** @brief Destructor */
         virtual ~Client();
 
@@ -107,6 +94,9 @@ class LibWebsocketServer : public IWebsocketServer
         /** @copydoc bool IClient::send(const void*, size_t) */
         bool send(const void* data, size_t size) override;
 
+        /** @copydoc SendQueueStats IClient::sendQueueStats() const */
+        SendQueueStats sendQueueStats() const override;
+
         /** @copydoc bool IClient::registerListener(IListener&) */
         void registerListener(IClient::IListener& listener) override;
 
@@ -148,7 +138,7 @@ class LibWebsocketServer : public IWebsocketServer
         /** @brief Listener */
         IClient::IListener* m_listener;
         /** @brief Queue of messages to send */
-        ocpp::helpers::Queue<SendMsg*> m_send_msgs;
+        SendQueue m_send_msgs;
         /** @brief Buffer to store fragmented frames */
         uint8_t* m_fragmented_frame;
         /** @brief Size of the fragmented frame */
@@ -169,6 +159,14 @@ class LibWebsocketServer : public IWebsocketServer
     std::string m_protocol;
     /** @brief Credentials */
     Credentials m_credentials;
+    /** @brief Send queue configuration of the clients */
+    SendQueueConfig m_send_queue_config;
+    /** @brief Keys of the TLS session tickets */
+    std::unique_ptr<TlsTicketKeys> m_ticket_keys;
+    /** @brief Number of completed TLS handshakes */
+    std::atomic<uint64_t> m_tls_handshakes;
+    /** @brief Number of resumed TLS handshakes */
+    std::atomic<uint64_t> m_tls_resumed_handshakes;
 
     /** @brief Websocket context */
     struct lws_context* m_context;
@@ -0,0 +1,212 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "SendQueue.h"
+
+namespace ocpp
+{
+namespace websockets
+{
+
+/** @brief Constructor */
+SendQueue::SendQueue()
+    : m_mutex(), m_cond_var(), m_msgs(), m_config(), m_service_thread(), m_enabled(true), m_overflowed(false), m_stats()
+{
+}
+
+/** @brief Destructor */
+SendQueue::~SendQueue()
+{
+    clear();
+}
+
+/** @brief Set the configuration of the queue */
+void SendQueue::setConfig(const SendQueueConfig& config)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_config = config;
+    m_cond_var.notify_all();
+}
+
+/** @brief Set the identifier of the thread which is emptying the queue */
+void SendQueue::setServiceThread(std::thread::id id)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_service_thread = id;
+}
+
+/** @brief Update the state of the queue */
+void SendQueue::setEnable(bool enabled)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_enabled = enabled;
+    if (enabled)
+    {
+        // New connection, restart statistics
+        m_overflowed          = false;
+        m_stats.peak_messages = m_msgs.size();
+        m_stats.peak_size     = m_stats.size;
+    }
+    m_cond_var.notify_all();
+}
+
+/** @brief Copy a message into the queue */
+SendQueue::PushResult SendQueue::push(const void* data, size_t size)
+{
+    PushResult ret = PushResult::Rejected;
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_enabled)
+    {
+        bool room = hasRoom(size);
+        if (!room)
+        {
+            switch (m_config.policy)
+            {
+                case SendQueuePolicy::Block:
+                {
+                    // Never wait on the thread which is in charge of emptying the queue
+                    if (std::this_thread::get_id() != m_service_thread)
+                    {
+                        m_cond_var.wait_for(lock, m_config.block_timeout, [&] { return !m_enabled || hasRoom(size); });
+                        room = m_enabled && hasRoom(size);
+                    }
+                }
+                break;
+
+                case SendQueuePolicy::Disconnect:
+                {
+                    // Slow consumer, the connection must be closed
+                    m_overflowed = true;
+                    ret          = PushResult::Overflow;
+                }
+                break;
+
+                case SendQueuePolicy::Fail:
+                    // Intended fallthrough
+                default:
+                    break;
+            }
+        }
+        if (room)
+        {
+            // Queue message
+            m_msgs.push(new SendMsg(data, size));
+            m_stats.messages = m_msgs.size();
+            m_stats.size += size;
+            if (m_stats.messages > m_stats.peak_messages)
+            {
+                m_stats.peak_messages = m_stats.messages;
+            }
+            if (m_stats.size > m_stats.peak_size)
+            {
+                m_stats.peak_size = m_stats.size;
+            }
+            ret = PushResult::Queued;
+        }
+        else
+        {
+            m_stats.rejected++;
+        }
+    }
+
+    return ret;
+}
+
+/** @brief Get the next message to send */
+bool SendQueue::pop(SendMsg*& msg)
+{
+    bool ret = false;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_msgs.empty())
+    {
+        msg = m_msgs.front();
+        m_msgs.pop();
+        m_stats.messages = m_msgs.size();
+        m_stats.size -= msg->size;
+        ret = true;
+
+        // Wakeup waiting senders
+        m_cond_var.notify_all();
+    }
+
+    return ret;
+}
+
+/** @brief Indicate if the queue is empty */
+bool SendQueue::empty() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_msgs.empty();
+}
+
+/** @brief Indicate if the queue has overflowed with the disconnect policy */
+bool SendQueue::overflowed()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    bool                        ret = m_overflowed;
+    m_overflowed                    = false;
+    return ret;
+}
+
+/** @brief Release all the messages of the queue */
+void SendQueue::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    while (!m_msgs.empty())
+    {
+        delete m_msgs.front();
+        m_msgs.pop();
+    }
+    m_stats.messages = 0;
+    m_stats.size     = 0;
+    m_cond_var.notify_all();
+}
+
+/** @brief Get the statistics of the queue */
+SendQueueStats SendQueue::stats() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+/** @brief Indicate if a message can be queued (must be called with the mutex locked) */
+bool SendQueue::hasRoom(size_t size) const
+{
+    bool ret = true;
+
+    // An empty queue always accepts a message so that a message
+    // bigger than the size limit can still be sent
+    if (!m_msgs.empty())
+    {
+        if ((m_config.max_messages != 0) && (m_msgs.size() >= m_config.max_messages))
+        {
+            ret = false;
+        }
+        if ((m_config.max_size != 0) && ((m_stats.size + size) > m_config.max_size))
+        {
+            ret = false;
+        }
+    }
+
+    return ret;
+}
+
+} // namespace websockets
+} // namespace ocpp
@@ -0,0 +1,161 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPENOCPP_SENDQUEUE_H
+#define OPENOCPP_SENDQUEUE_H
+
+#include "SendQueueConfig.h"
+#include "websockets.h"
+
+#include <condition_variable>
+#include <cstring>
+#include <mutex>
+#include <queue>
+#include <thread>
+
+namespace ocpp
+{
+namespace websockets
+{
+
+/** @brief Bounded queue of messages waiting to be sent on a websocket connection */
+class SendQueue
+{
+  public:
+    /** @brief Message to send */
+    struct SendMsg
+    {
+        /** @brief Constructor */
+        SendMsg(const void* _data, size_t _size)
+        {
+            data    = new unsigned char[LWS_PRE + _size];
+            size    = _size;
+            payload = &data[LWS_PRE];
+            memcpy(payload, _data, size);
+        }
+        /** @brief Destructor */
+        virtual ~SendMsg() { delete[] data; }
+
+        /** @brief Data buffer */
+        unsigned char* data;
+        /** @brief Payload start */
+        unsigned char* payload;
+        /** @brief Size in bytes */
+        size_t size;
+    };
+
+    /** @brief Result of a push operation */
+    enum class PushResult
+    {
+        /** @brief Message has been queued */
+        Queued,
+        /** @brief Message has been rejected (queue full or disabled) */
+        Rejected,
+        /** @brief Message has been rejected and the connection must be closed */
+        Overflow
+    };
+
+    /** @brief Constructor */
+    SendQueue();
+    /** @brief Destructor */
+    virtual ~SendQueue();
+
+    /**
+     * @brief Set the configuration of the queue
+     * @param config Queue configuration
+     */
+    void setConfig(const SendQueueConfig& config);
+
+    /**
+     * @brief Set the identifier of the thread which is emptying the queue
+     *        (a push from this thread will never block)
+     * @param id Thread identifier
+     */
+    void setServiceThread(std::thread::id id);
+
+    /**
+     * @brief Update the state of the queue
+     * @param enabled If true messages can be queued,
+     *                if false abort current waiting push operations
+     *                and disable further message queuing
+     */
+    void setEnable(bool enabled);
+
+    /**
+     * @brief Copy a message into the queue
+     * @param data Data of the message
+     * @param size Size of the message in bytes
+     * @return Result of the operation
+     */
+    PushResult push(const void* data, size_t size);
+
+    /**
+     * @brief Get the next message to send
+     * @param msg Message retrieved from the queue (must be released by the caller)
+     * @return true if a message has been retrieved, false if the queue is empty
+     */
+    bool pop(SendMsg*& msg);
+
+    /**
+     * @brief Indicate if the queue is empty
+     * @return true if the queue is empty, false otherwise
+     */
+    bool empty() const;
+
+    /**
+     * @brief Indicate if the queue has overflowed with the disconnect policy
+     *        (the flag is cleared by the call)
+     * @return true if the connection must be closed, false otherwise
+     */
+    bool overflowed();
+
+    /** @brief Release all the messages of the queue */
+    void clear();
+
+    /**
+     * @brief Get the statistics of the queue
+     * @return Statistics of the queue
+     */
+    SendQueueStats stats() const;
+
+  private:
+    /** @brief Mutex for concurrent access */
+    mutable std::mutex m_mutex;
+    /** @brief Condition variable to wait for room in the queue */
+    std::condition_variable m_cond_var;
+    /** @brief Messages to send */
+    std::queue<SendMsg*> m_msgs;
+    /** @brief Configuration */
+    SendQueueConfig m_config;
+    /** @brief Service thread identifier */
+    std::thread::id m_service_thread;
+    /** @brief Indicate that the queue is enabled */
+    bool m_enabled;
+    /** @brief Indicate that the queue has overflowed with the disconnect policy */
+    bool m_overflowed;
+    /** @brief Statistics */
+    SendQueueStats m_stats;
+
+    /** @brief Indicate if a message can be queued (must be called with the mutex locked) */
+    bool hasRoom(size_t size) const;
+};
+
+} // namespace websockets
+} // namespace ocpp
+
+#endif // OPENOCPP_SENDQUEUE_H
@@ -0,0 +1,137 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "TlsSessionCache.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <openssl/evp.h>
+
+namespace ocpp
+{
+namespace websockets
+{
+
+/** @brief Constructor */
+TlsSessionCache::TlsSessionCache() : m_store(nullptr), m_host(), m_port(0), m_key(), m_handshakes(0), m_resumed_handshakes(0) { }
+
+/** @brief Destructor */
+TlsSessionCache::~TlsSessionCache() { }
+
+/** @brief Configure the server and the credentials of the next connections */
+void TlsSessionCache::configure(const std::string& host, uint16_t port, const IWebsocketClient::Credentials& credentials)
+{
+    m_host = host;
+    m_port = port;
+
+    // A session must only be resumed with the same trust chain and client certificate
+    // than the ones which have been used to establish it
+    std::string identity = credentials.server_certificate_ca;
+    identity.push_back('\0');
+    identity += credentials.client_certificate;
+
+    unsigned char digest[EVP_MAX_MD_SIZE];
+    unsigned int  digest_size = 0;
+    m_key                     = host + ":" + std::to_string(port) + "_";
+    if (EVP_Digest(identity.data(), identity.size(), digest, &digest_size, EVP_sha256(), nullptr) == 1)
+    {
+        static const char hex[] = "0123456789abcdef";
+        for (unsigned int i = 0; i < digest_size; i++)
+        {
+            m_key.push_back(hex[digest[i] >> 4u]);
+            m_key.push_back(hex[digest[i] & 0x0Fu]);
+        }
+    }
+}
+
+/** @brief Load the persisted session into the session cache of a vhost */
+void TlsSessionCache::load(struct lws_vhost* vhost)
+{
+    if (m_store && vhost)
+    {
+        lws_tls_session_dump_load(vhost, m_host.c_str(), m_port, &TlsSessionCache::loadCallback, this);
+    }
+}
+
+/** @brief Account for an established connection and persist its TLS session */
+void TlsSessionCache::connectionEstablished(struct lws* wsi)
+{
+    if (lws_is_ssl(wsi))
+    {
+        // Update statistics
+        m_handshakes++;
+        if (lws_tls_session_is_reused(wsi))
+        {
+            m_resumed_handshakes++;
+        }
+
+        // Persist the session
+        if (m_store)
+        {
+            lws_tls_session_dump_save(lws_get_vhost(wsi), m_host.c_str(), m_port, &TlsSessionCache::saveCallback, this);
+        }
+    }
+}
+
+/** @brief Get the statistics of the TLS handshakes */
+TlsStats TlsSessionCache::stats() const
+{
+    TlsStats stats;
+    stats.handshakes         = m_handshakes;
+    stats.resumed_handshakes = m_resumed_handshakes;
+    return stats;
+}
+
+/** @brief libwebsockets session load callback */
+int TlsSessionCache::loadCallback(struct lws_context* context, struct lws_tls_session_dump* info)
+{
+    int ret = 1;
+    (void)context;
+
+    TlsSessionCache*     cache = reinterpret_cast<TlsSessionCache*>(info->opaque);
+    std::vector<uint8_t> session;
+    if (cache->m_store->loadTlsSession(cache->m_key, session) && !session.empty())
+    {
+        // Blob is released by libwebsockets using free()
+        info->blob = malloc(session.size());
+        if (info->blob)
+        {
+            memcpy(info->blob, session.data(), session.size());
+            info->blob_len = session.size();
+            ret            = 0;
+        }
+    }
+
+    return ret;
+}
+
+/** @brief libwebsockets session save callback */
+int TlsSessionCache::saveCallback(struct lws_context* context, struct lws_tls_session_dump* info)
+{
+    (void)context;
+
+    TlsSessionCache*     cache = reinterpret_cast<TlsSessionCache*>(info->opaque);
+    const uint8_t*       blob  = reinterpret_cast<const uint8_t*>(info->blob);
+    std::vector<uint8_t> session(blob, blob + info->blob_len);
+    cache->m_store->saveTlsSession(cache->m_key, session);
+
+    return 0;
+}
+
+} // namespace websockets
+} // namespace ocpp
@@ -0,0 +1,96 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPENOCPP_TLSSESSIONCACHE_H
+#define OPENOCPP_TLSSESSIONCACHE_H
+
+#include "IWebsocketClient.h"
+#include "websockets.h"
+
+#include <atomic>
+
+namespace ocpp
+{
+namespace websockets
+{
+
+/** @brief Handle the persistency of the TLS session and the handshake statistics of a websocket client */
+class TlsSessionCache
+{
+  public:
+    /** @brief Constructor */
+    TlsSessionCache();
+    /** @brief Destructor */
+    virtual ~TlsSessionCache();
+
+    /**
+     * @brief Set the store used to persist the TLS session
+     * @param store TLS sessions store (nullptr = no persistency)
+     */
+    void setStore(ITlsSessionStore* store) { m_store = store; }
+
+    /**
+     * @brief Configure the server and the credentials of the next connections
+     * @param host Server name used for the TLS connection
+     * @param port Server port
+     * @param credentials Credentials of the connection
+     */
+    void configure(const std::string& host, uint16_t port, const IWebsocketClient::Credentials& credentials);
+
+    /**
+     * @brief Load the persisted session into the session cache of a vhost
+     * @param vhost Vhost used for the connections
+     */
+    void load(struct lws_vhost* vhost);
+
+    /**
+     * @brief Account for an established connection and persist its TLS session
+     * @param wsi Established connection
+     */
+    void connectionEstablished(struct lws* wsi);
+
+    /**
+     * @brief Get the statistics of the TLS handshakes
+     * @return Statistics of the TLS handshakes
+     */
+    TlsStats stats() const;
+
+  private:
+    /** @brief Store used to persist the TLS session */
+    ITlsSessionStore* m_store;
+    /** @brief Server name */
+    std::string m_host;
+    /** @brief Server port */
+    uint16_t m_port;
+    /** @brief Key of the session in the store */
+    std::string m_key;
+    /** @brief Number of completed TLS handshakes */
+    std::atomic<uint64_t> m_handshakes;
+    /** @brief Number of resumed TLS handshakes */
+    std::atomic<uint64_t> m_resumed_handshakes;
+
+    /** @brief libwebsockets session load callback */
+    static int loadCallback(struct lws_context* context, struct lws_tls_session_dump* info);
+    /** @brief libwebsockets session save callback */
+    static int saveCallback(struct lws_context* context, struct lws_tls_session_dump* info);
+};
+
+} // namespace websockets
+} // namespace ocpp
+
+#endif // OPENOCPP_TLSSESSIONCACHE_H
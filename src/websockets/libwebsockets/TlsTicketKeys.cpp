@@ -0,0 +1,210 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "TlsTicketKeys.h"
+
+#include <cstring>
+#include <openssl/evp.h>
+#include <openssl/rand.h>
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+#include <openssl/core_names.h>
+#include <openssl/params.h>
+#else
+#include <openssl/hmac.h>
+#endif // OPENSSL_VERSION_NUMBER
+
+namespace ocpp
+{
+namespace websockets
+{
+
+/** @brief Constructor */
+TlsTicketKeys::TlsTicketKeys(std::chrono::seconds rotation_interval)
+    : m_rotation_interval(rotation_interval), m_mutex(), m_current(), m_previous()
+{
+    m_current.valid  = false;
+    m_previous.valid = false;
+}
+
+/** @brief Destructor */
+TlsTicketKeys::~TlsTicketKeys()
+{
+    OPENSSL_cleanse(&m_current, sizeof(m_current));
+    OPENSSL_cleanse(&m_previous, sizeof(m_previous));
+}
+
+/** @brief Install the keys on a TLS server context */
+bool TlsTicketKeys::install(SSL_CTX* ssl_ctx)
+{
+    bool ret = false;
+
+    if (SSL_CTX_set_ex_data(ssl_ctx, exDataIndex(), this) == 1)
+    {
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+        ret = (SSL_CTX_set_tlsext_ticket_key_evp_cb(ssl_ctx, &TlsTicketKeys::ticketKeyCallback) == 1);
+#else
+        ret = (SSL_CTX_set_tlsext_ticket_key_cb(ssl_ctx, &TlsTicketKeys::ticketKeyCallback) == 1);
+#endif // OPENSSL_VERSION_NUMBER
+
+        // Tickets must not outlive the keys which have encrypted them
+        SSL_CTX_set_timeout(ssl_ctx, static_cast<long>(m_rotation_interval.count()));
+    }
+
+    return ret;
+}
+
+/** @brief Generate a new current key if the rotation interval has elapsed (must be called with the mutex locked) */
+void TlsTicketKeys::rotate()
+{
+    auto now = std::chrono::steady_clock::now();
+    if (!m_current.valid || ((now - m_current.creation) >= m_rotation_interval))
+    {
+        // Keep the current key to decrypt the tickets it has encrypted
+        m_previous = m_current;
+
+        // Generate a new key
+        if ((RAND_bytes(m_current.name, sizeof(m_current.name)) == 1) &&
+            (RAND_bytes(m_current.aes_key, sizeof(m_current.aes_key)) == 1) &&
+            (RAND_bytes(m_current.hmac_key, sizeof(m_current.hmac_key)) == 1))
+        {
+            m_current.creation = now;
+            m_current.valid    = true;
+        }
+        else
+        {
+            m_current.valid = false;
+        }
+    }
+}
+
+/** @brief Look for a key from its name (must be called with the mutex locked) */
+const TlsTicketKeys::Key* TlsTicketKeys::find(const unsigned char* name) const
+{
+    const Key* key = nullptr;
+    if (m_current.valid && (memcmp(m_current.name, name, sizeof(m_current.name)) == 0))
+    {
+        key = &m_current;
+    }
+    else if (m_previous.valid && (memcmp(m_previous.name, name, sizeof(m_previous.name)) == 0))
+    {
+        key = &m_previous;
+    }
+    return key;
+}
+
+/** @brief Select the key of a ticket operation and initialize the cipher context */
+int TlsTicketKeys::selectKey(unsigned char* key_name, unsigned char* iv, EVP_CIPHER_CTX* cipher_ctx, unsigned char* hmac_key, int enc)
+{
+    int ret = -1;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    rotate();
+    if (enc)
+    {
+        // New ticket, always use the current key
+        if (m_current.valid && (RAND_bytes(iv, EVP_CIPHER_iv_length(EVP_aes_256_cbc())) == 1) &&
+            (EVP_EncryptInit_ex(cipher_ctx, EVP_aes_256_cbc(), nullptr, m_current.aes_key, iv) == 1))
+        {
+            memcpy(key_name, m_current.name, sizeof(m_current.name));
+            memcpy(hmac_key, m_current.hmac_key, sizeof(m_current.hmac_key));
+            ret = 1;
+        }
+    }
+    else
+    {
+        // Received ticket, an unknown key means that the ticket has expired
+        const Key* key = find(key_name);
+        if (!key)
+        {
+            ret = 0;
+        }
+        else if (EVP_DecryptInit_ex(cipher_ctx, EVP_aes_256_cbc(), nullptr, key->aes_key, iv) == 1)
+        {
+            memcpy(hmac_key, key->hmac_key, sizeof(key->hmac_key));
+
+            // Ask for a ticket renewal when the ticket has been encrypted with the previous key
+            ret = ((key == &m_current) ? 1 : 2);
+        }
+    }
+
+    return ret;
+}
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+/** @brief OpenSSL ticket key callback */
+int TlsTicketKeys::ticketKeyCallback(
+    SSL* ssl, unsigned char* key_name, unsigned char* iv, EVP_CIPHER_CTX* cipher_ctx, EVP_MAC_CTX* hmac_ctx, int enc)
+{
+    int ret = -1;
+
+    TlsTicketKeys* keys = reinterpret_cast<TlsTicketKeys*>(SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl), exDataIndex()));
+    if (keys)
+    {
+        unsigned char hmac_key[sizeof(Key::hmac_key)];
+        ret = keys->selectKey(key_name, iv, cipher_ctx, hmac_key, enc);
+        if (ret > 0)
+        {
+            char       digest[] = "SHA256";
+            OSSL_PARAM params[] = {OSSL_PARAM_construct_octet_string(OSSL_MAC_PARAM_KEY, hmac_key, sizeof(hmac_key)),
+                                   OSSL_PARAM_construct_utf8_string(OSSL_MAC_PARAM_DIGEST, digest, 0),
+                                   OSSL_PARAM_construct_end()};
+            if (EVP_MAC_CTX_set_params(hmac_ctx, params) != 1)
+            {
+                ret = -1;
+            }
+        }
+        OPENSSL_cleanse(hmac_key, sizeof(hmac_key));
+    }
+
+    return ret;
+}
+#else
+/** @brief OpenSSL ticket key callback */
+int TlsTicketKeys::ticketKeyCallback(
+    SSL* ssl, unsigned char* key_name, unsigned char* iv, EVP_CIPHER_CTX* cipher_ctx, HMAC_CTX* hmac_ctx, int enc)
+{
+    int ret = -1;
+
+    TlsTicketKeys* keys = reinterpret_cast<TlsTicketKeys*>(SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl), exDataIndex()));
+    if (keys)
+    {
+        unsigned char hmac_key[sizeof(Key::hmac_key)];
+        ret = keys->selectKey(key_name, iv, cipher_ctx, hmac_key, enc);
+        if (ret > 0)
+        {
+            if (HMAC_Init_ex(hmac_ctx, hmac_key, sizeof(hmac_key), EVP_sha256(), nullptr) != 1)
+            {
+                ret = -1;
+            }
+        }
+        OPENSSL_cleanse(hmac_key, sizeof(hmac_key));
+    }
+
+    return ret;
+}
+#endif // OPENSSL_VERSION_NUMBER
+
+/** @brief Index of the instance pointer in the TLS server contexts */
+int TlsTicketKeys::exDataIndex()
+{
+    static const int index = SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+    return index;
+}
+
+} // namespace websockets
+} // namespace ocpp
@@ -0,0 +1,99 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPENOCPP_TLSTICKETKEYS_H
+#define OPENOCPP_TLSTICKETKEYS_H
+
+#include "websockets.h"
+
+#include <chrono>
+#include <mutex>
+
+namespace ocpp
+{
+namespace websockets
+{
+
+/** @brief Rotating keys protecting the TLS session tickets issued by a websocket server */
+class TlsTicketKeys
+{
+  public:
+    /**
+     * @brief Constructor
+     * @param rotation_interval Interval between 2 rotations of the keys
+     */
+    TlsTicketKeys(std::chrono::seconds rotation_interval);
+    /** @brief Destructor */
+    virtual ~TlsTicketKeys();
+
+    /**
+     * @brief Install the keys on a TLS server context
+     * @param ssl_ctx TLS server context
+     * @return true if the keys have been installed, false otherwise
+     */
+    bool install(SSL_CTX* ssl_ctx);
+
+  private:
+    /** @brief Ticket key */
+    struct Key
+    {
+        /** @brief Name of the key (sent in clear in the ticket) */
+        unsigned char name[16u];
+        /** @brief AES-256 encryption key */
+        unsigned char aes_key[32u];
+        /** @brief HMAC-SHA256 key */
+        unsigned char hmac_key[32u];
+        /** @brief Creation time */
+        std::chrono::steady_clock::time_point creation;
+        /** @brief Indicate if the key is valid */
+        bool valid;
+    };
+
+    /** @brief Interval between 2 rotations of the keys */
+    const std::chrono::seconds m_rotation_interval;
+    /** @brief Mutex to protect the keys */
+    std::mutex m_mutex;
+    /** @brief Key used to encrypt new tickets */
+    Key m_current;
+    /** @brief Previous key, only used to decrypt tickets */
+    Key m_previous;
+
+    /** @brief Generate a new current key if the rotation interval has elapsed (must be called with the mutex locked) */
+    void rotate();
+    /** @brief Look for a key from its name (must be called with the mutex locked) */
+    const Key* find(const unsigned char* name) const;
+    /** @brief Select the key of a ticket operation and initialize the cipher context */
+    int selectKey(unsigned char* key_name, unsigned char* iv, EVP_CIPHER_CTX* cipher_ctx, unsigned char* hmac_key, int enc);
+
+#if OPENSSL_VERSION_NUMBER >= 0x30000000L
+    /** @brief OpenSSL ticket key callback */
+    static int ticketKeyCallback(
+        SSL* ssl, unsigned char* key_name, unsigned char* iv, EVP_CIPHER_CTX* cipher_ctx, EVP_MAC_CTX* hmac_ctx, int enc);
+#else
+    /** @brief OpenSSL ticket key callback */
+    static int ticketKeyCallback(
+        SSL* ssl, unsigned char* key_name, unsigned char* iv, EVP_CIPHER_CTX* cipher_ctx, HMAC_CTX* hmac_ctx, int enc);
+#endif // OPENSSL_VERSION_NUMBER
+    /** @brief Index of the instance pointer in the TLS server contexts */
+    static int exDataIndex();
+};
+
+} // namespace websockets
+} // namespace ocpp
+
+#endif // OPENOCPP_TLSTICKETKEYS_H
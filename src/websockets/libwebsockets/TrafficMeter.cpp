@@ -0,0 +1,77 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "TrafficMeter.h"
+
+namespace ocpp
+{
+namespace websockets
+{
+
+/** @brief Processing cost of a frame expressed in bytes */
+constexpr double TrafficRate::FRAME_COST;
+/** @brief Minimum duration between 2 rate samples */
+constexpr std::chrono::milliseconds TrafficMeter::MIN_SAMPLE_PERIOD;
+/** @brief Weight of the last sample in the smoothed rate */
+constexpr double TrafficMeter::SMOOTHING_FACTOR;
+
+/** @brief Constructor */
+TrafficMeter::TrafficMeter()
+    : m_frames(0),
+      m_bytes(0),
+      m_mutex(),
+      m_last_sample_time(std::chrono::steady_clock::now()),
+      m_last_frames(0),
+      m_last_bytes(0),
+      m_rate()
+{
+}
+
+/** @brief Destructor */
+TrafficMeter::~TrafficMeter() { }
+
+/** @brief Get the smoothed traffic rates */
+TrafficRate TrafficMeter::rate(std::chrono::steady_clock::time_point now)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Check if a new sample must be taken
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - m_last_sample_time);
+    if (elapsed >= MIN_SAMPLE_PERIOD)
+    {
+        // Instantaneous rates since the last sample
+        size_t frames      = m_frames.load(std::memory_order_relaxed);
+        size_t bytes       = m_bytes.load(std::memory_order_relaxed);
+        double seconds     = static_cast<double>(elapsed.count()) / 1000.;
+        double frames_rate = static_cast<double>(frames - m_last_frames) / seconds;
+        double bytes_rate  = static_cast<double>(bytes - m_last_bytes) / seconds;
+
+        // Exponential smoothing
+        m_rate.frames = SMOOTHING_FACTOR * frames_rate + (1. - SMOOTHING_FACTOR) * m_rate.frames;
+        m_rate.bytes  = SMOOTHING_FACTOR * bytes_rate + (1. - SMOOTHING_FACTOR) * m_rate.bytes;
+
+        m_last_sample_time = now;
+        m_last_frames      = frames;
+        m_last_bytes       = bytes;
+    }
+
+    return m_rate;
+}
+
+} // namespace websockets
+} // namespace ocpp
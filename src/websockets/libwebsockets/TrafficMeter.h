@@ -0,0 +1,98 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPENOCPP_TRAFFICMETER_H
+#define OPENOCPP_TRAFFICMETER_H
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+
+namespace ocpp
+{
+namespace websockets
+{
+
+/** @brief Measured traffic rates */
+struct TrafficRate
+{
+    /** @brief Received and sent frames per second */
+    double frames;
+    /** @brief Received and sent bytes per second */
+    double bytes;
+
+    /** @brief Processing cost of a frame expressed in bytes */
+    static constexpr double FRAME_COST = 256.;
+
+    /** @brief Load score of the traffic (used to balance the connections between the client pools) */
+    double score() const { return bytes + FRAME_COST * frames; }
+};
+
+/** @brief Measure the frame and byte rates of a websocket connection */
+class TrafficMeter
+{
+  public:
+    /** @brief Minimum duration between 2 rate samples */
+    static constexpr std::chrono::milliseconds MIN_SAMPLE_PERIOD = std::chrono::milliseconds(1000);
+    /** @brief Weight of the last sample in the smoothed rate */
+    static constexpr double SMOOTHING_FACTOR = 0.5;
+
+    /** @brief Constructor */
+    TrafficMeter();
+    /** @brief Destructor */
+    virtual ~TrafficMeter();
+
+    /**
+     * @brief Account for a received or sent frame
+     * @param size Size of the frame in bytes
+     */
+    void add(size_t size)
+    {
+        m_frames.fetch_add(1u, std::memory_order_relaxed);
+        m_bytes.fetch_add(size, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Get the smoothed traffic rates (a new sample is taken if the sample period has elapsed)
+     * @param now Current time
+     * @return Smoothed traffic rates
+     */
+    TrafficRate rate(std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now());
+
+  private:
+    /** @brief Number of frames since the creation */
+    std::atomic<size_t> m_frames;
+    /** @brief Number of bytes since the creation */
+    std::atomic<size_t> m_bytes;
+    /** @brief Mutex to protect the samples */
+    std::mutex m_mutex;
+    /** @brief Time of the last sample */
+    std::chrono::steady_clock::time_point m_last_sample_time;
+    /** @brief Number of frames at the last sample */
+    size_t m_last_frames;
+    /** @brief Number of bytes at the last sample */
+    size_t m_last_bytes;
+    /** @brief Smoothed rates */
+    TrafficRate m_rate;
+};
+
+} // namespace websockets
+} // namespace ocpp
+
+#endif // OPENOCPP_TRAFFICMETER_H
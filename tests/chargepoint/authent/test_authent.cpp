@@ -21,6 +21,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "Authorize.h"
 #include "ChargePointConfigStub.h"
+#include "ConfigManagerStub.h"
 #include "Database.h"
 #include "GenericMessageSender.h"
 #include "GenericMessagesConverter.h"
@@ -46,9 +47,17 @@ static constexpr const char* DATABASE_PATH = "/tmp/test.db";
 Database              database;
 ChargePointConfigStub cp_config;
 OcppConfigStub        ocpp_config;
+ConfigManagerStub     config_mgr;
 InternalConfigManager internal_config(database);
 MessagesValidator     msgs_validator;
 
+/** @brief Set a value in the standard OCPP configuration and update the configuration snapshot */
+static void setOcppConfigValue(const std::string& key, const std::string& value)
+{
+    ocpp_config.setConfigValue(key, value);
+    config_mgr.setSnapshot(OcppConfigSnapshot(ocpp_config));
+}
+
 /** @brief Prepare a response to an Authorize request */
 static void setAuthorizeResponse(RpcStub& rpc, const IdTagInfo& tag_info)
 {
@@ -77,12 +86,12 @@ TEST_SUITE("Authentication component")
     TEST_CASE("Setup config")
     {
         cp_config.setConfigValue("AuthentCacheMaxEntriesCount", "5");
-        ocpp_config.setConfigValue("AuthorizationCacheEnabled", "true");
-        ocpp_config.setConfigValue("LocalAuthListEnabled", "true");
-        ocpp_config.setConfigValue("LocalAuthListMaxLength", "5");
-        ocpp_config.setConfigValue("SendLocalListMaxLength", "5");
-        ocpp_config.setConfigValue("LocalAuthorizeOffline", "true");
-        ocpp_config.setConfigValue("LocalPreAuthorize", "true");
+        setOcppConfigValue("AuthorizationCacheEnabled", "true");
+        setOcppConfigValue("LocalAuthListEnabled", "true");
+        setOcppConfigValue("LocalAuthListMaxLength", "5");
+        setOcppConfigValue("SendLocalListMaxLength", "5");
+        setOcppConfigValue("LocalAuthorizeOffline", "true");
+        setOcppConfigValue("LocalPreAuthorize", "true");
         internal_config.initDatabaseTable();
     }
 
@@ -127,10 +136,11 @@ TEST_SUITE("Authentication component")
         RpcStub               rpc;
         GenericMessageSender  msg_sender(rpc, msgs_converter, msgs_validator, std::chrono::milliseconds(1000));
 
-        ocpp_config.setConfigValue("LocalPreAuthorize", "false");
+        setOcppConfigValue("LocalPreAuthorize", "false");
         rpc.setConnected(true);
 
-        AuthentManager authent_mgr(cp_config, ocpp_config, database, internal_config, msgs_converter, msg_dispatcher, msg_sender);
+        AuthentManager authent_mgr(
+            cp_config, ocpp_config, config_mgr, database, internal_config, msgs_converter, msg_dispatcher, msg_sender);
 
         IdTagInfo           tag_info;
         AuthorizationStatus status;
@@ -173,10 +183,11 @@ TEST_SUITE("Authentication component")
         RpcStub               rpc;
         GenericMessageSender  msg_sender(rpc, msgs_converter, msgs_validator, std::chrono::milliseconds(1000));
 
-        ocpp_config.setConfigValue("LocalPreAuthorize", "true");
+        setOcppConfigValue("LocalPreAuthorize", "true");
         rpc.setConnected(true);
 
-        AuthentManager authent_mgr(cp_config, ocpp_config, database, internal_config, msgs_converter, msg_dispatcher, msg_sender);
+        AuthentManager authent_mgr(
+            cp_config, ocpp_config, config_mgr, database, internal_config, msgs_converter, msg_dispatcher, msg_sender);
 
         IdTagInfo           tag_info;
         AuthorizationStatus status;
@@ -213,7 +224,7 @@ TEST_SUITE("Authentication component")
 
         // Temporary disable local list to add a tag in
         // the cache which is also in local list
-        ocpp_config.setConfigValue("LocalAuthListEnabled", "false");
+        setOcppConfigValue("LocalAuthListEnabled", "false");
 
         tag_info.status = AuthorizationStatus::Accepted;
         tag_info.parentIdTag.value().assign("PARENT_TAG2");
@@ -223,7 +234,7 @@ TEST_SUITE("Authentication component")
         CHECK_EQ(status, AuthorizationStatus::Accepted);
         CHECK_EQ(parent_id, "PARENT_TAG2");
 
-        ocpp_config.setConfigValue("LocalAuthListEnabled", "true");
+        setOcppConfigValue("LocalAuthListEnabled", "true");
 
         // Tag is invalid in local list and valid in cache
         // Check that local list preempts cache
@@ -237,7 +248,7 @@ TEST_SUITE("Authentication component")
         tag_info.status = AuthorizationStatus::Accepted;
         tag_info.parentIdTag.value().assign("PARENT_TAG5");
         setAuthorizeResponse(rpc, tag_info);
-        ocpp_config.setConfigValue("AuthorizationCacheEnabled", "false");
+        setOcppConfigValue("AuthorizationCacheEnabled", "false");
 
         status = authent_mgr.authorize("TAG5", parent_id);
         CHECK_EQ(status, AuthorizationStatus::Accepted);
@@ -251,7 +262,7 @@ TEST_SUITE("Authentication component")
         CHECK_EQ(status, AuthorizationStatus::Expired);
         CHECK_EQ(parent_id, "");
 
-        ocpp_config.setConfigValue("AuthorizationCacheEnabled", "true");
+        setOcppConfigValue("AuthorizationCacheEnabled", "true");
 
         tag_info.status = AuthorizationStatus::Blocked;
         tag_info.parentIdTag.value().assign("PARENT_TAG5");
@@ -269,10 +280,11 @@ TEST_SUITE("Authentication component")
         RpcStub               rpc;
         GenericMessageSender  msg_sender(rpc, msgs_converter, msgs_validator, std::chrono::milliseconds(1000));
 
-        ocpp_config.setConfigValue("LocalAuthorizeOffline", "false");
+        setOcppConfigValue("LocalAuthorizeOffline", "false");
         rpc.setConnected(false);
 
-        AuthentManager authent_mgr(cp_config, ocpp_config, database, internal_config, msgs_converter, msg_dispatcher, msg_sender);
+        AuthentManager authent_mgr(
+            cp_config, ocpp_config, config_mgr, database, internal_config, msgs_converter, msg_dispatcher, msg_sender);
 
         IdTagInfo           tag_info;
         AuthorizationStatus status;
@@ -311,10 +323,11 @@ TEST_SUITE("Authentication component")
         RpcStub               rpc;
         GenericMessageSender  msg_sender(rpc, msgs_converter, msgs_validator, std::chrono::milliseconds(1000));
 
-        ocpp_config.setConfigValue("LocalAuthorizeOffline", "true");
+        setOcppConfigValue("LocalAuthorizeOffline", "true");
         rpc.setConnected(false);
 
-        AuthentManager authent_mgr(cp_config, ocpp_config, database, internal_config, msgs_converter, msg_dispatcher, msg_sender);
+        AuthentManager authent_mgr(
+            cp_config, ocpp_config, config_mgr, database, internal_config, msgs_converter, msg_dispatcher, msg_sender);
 
         IdTagInfo           tag_info;
         AuthorizationStatus status;
@@ -332,13 +345,13 @@ TEST_SUITE("Authentication component")
 
         // Disable local list
         // Check that local list is not called
-        ocpp_config.setConfigValue("LocalAuthListEnabled", "false");
+        setOcppConfigValue("LocalAuthListEnabled", "false");
 
         status = authent_mgr.authorize("TAG1", parent_id);
         CHECK_EQ(status, AuthorizationStatus::Invalid);
         CHECK_EQ(parent_id, "");
 
-        ocpp_config.setConfigValue("LocalAuthListEnabled", "true");
+        setOcppConfigValue("LocalAuthListEnabled", "true");
 
         // Tag not in local list but in cache with status blocked
         // Check that cache is called
@@ -348,13 +361,13 @@ TEST_SUITE("Authentication component")
 
         // Disable cache
         // Check that cache is not called
-        ocpp_config.setConfigValue("AuthorizationCacheEnabled", "false");
+        setOcppConfigValue("AuthorizationCacheEnabled", "false");
 
         status = authent_mgr.authorize("TAG5", parent_id);
         CHECK_EQ(status, AuthorizationStatus::Invalid);
         CHECK_EQ(parent_id, "");
 
-        ocpp_config.setConfigValue("AuthorizationCacheEnabled", "true");
+        setOcppConfigValue("AuthorizationCacheEnabled", "true");
 
         // Tag neither in cache nor local list
         tag_info.status = AuthorizationStatus::Accepted;
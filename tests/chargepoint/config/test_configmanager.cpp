@@ -0,0 +1,216 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "ConfigManager.h"
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "MessageDispatcherStub.h"
+#include "MessagesConverter.h"
+#include "OcppConfigStub.h"
+#include "doctest_wrapper.h"
+
+using namespace ocpp::chargepoint;
+using namespace ocpp::config;
+using namespace ocpp::messages;
+using namespace ocpp::types;
+
+/** @brief Snapshot listener for the tests */
+class SnapshotListener : public IConfigManager::IConfigSnapshotListener
+{
+  public:
+    /** @brief Constructor */
+    SnapshotListener() : notified(false), previous_attempts(0), current_attempts(0), changed_keys() { }
+
+    /** @copydoc void IConfigSnapshotListener::configurationSnapshotChanged(const OcppConfigSnapshot&,
+     *                                                                      const OcppConfigSnapshot&,
+     *                                                                      const std::vector<std::string>&) */
+    void configurationSnapshotChanged(const OcppConfigSnapshot&       previous,
+                                      const OcppConfigSnapshot&       current,
+                                      const std::vector<std::string>& changed_keys) override
+    {
+        notified           = true;
+        previous_attempts  = previous.transactionMessageAttempts;
+        current_attempts   = current.transactionMessageAttempts;
+        this->changed_keys = changed_keys;
+    }
+
+    /** @brief Indicate that the listener has been notified */
+    bool notified;
+    /** @brief Previous value of TransactionMessageAttempts */
+    unsigned int previous_attempts;
+    /** @brief Current value of TransactionMessageAttempts */
+    unsigned int current_attempts;
+    /** @brief Changed keys */
+    std::vector<std::string> changed_keys;
+};
+
+/** @brief Send a ChangeConfiguration request to the config manager */
+static ConfigurationStatus changeConfiguration(ConfigManager& config_mgr, const std::string& key, const std::string& value)
+{
+    ChangeConfigurationReq  request;
+    ChangeConfigurationConf response;
+    std::string             error_code;
+    std::string             error_message;
+    request.key.assign(key);
+    request.value.assign(value);
+    CHECK(config_mgr.handleMessage(request, response, error_code, error_message));
+    return response.status;
+}
+
+TEST_SUITE("Config manager")
+{
+    TEST_CASE("Configuration snapshot")
+    {
+        OcppConfigStub        ocpp_config;
+        MessagesConverter     msgs_converter;
+        MessageDispatcherStub msg_dispatcher;
+
+        ocpp_config.setConfigValue("TransactionMessageAttempts", "3");
+        ocpp_config.setConfigValue("TransactionMessageRetryInterval", "60");
+        ocpp_config.setConfigValue("LocalPreAuthorize", "true");
+
+        ConfigManager    config_mgr(ocpp_config, msgs_converter, msg_dispatcher);
+        SnapshotListener listener;
+        config_mgr.registerConfigSnapshotListener(listener);
+
+        // Initial values
+        auto snapshot = config_mgr.snapshot();
+        CHECK_EQ(snapshot->transactionMessageAttempts, 3u);
+        CHECK_EQ(snapshot->transactionMessageRetryInterval, std::chrono::seconds(60));
+        CHECK(snapshot->localPreAuthorize);
+        CHECK_FALSE(snapshot->localAuthorizeOffline);
+
+        // Value change
+        CHECK_EQ(changeConfiguration(config_mgr, "TransactionMessageAttempts", "5"), ConfigurationStatus::Accepted);
+        auto new_snapshot = config_mgr.snapshot();
+        CHECK_NE(new_snapshot.get(), snapshot.get());
+        CHECK_EQ(new_snapshot->transactionMessageAttempts, 5u);
+        CHECK_EQ(new_snapshot->transactionMessageRetryInterval, std::chrono::seconds(60));
+        CHECK(listener.notified);
+        CHECK_EQ(listener.previous_attempts, 3u);
+        CHECK_EQ(listener.current_attempts, 5u);
+        REQUIRE_EQ(listener.changed_keys.size(), 1u);
+        CHECK_EQ(listener.changed_keys[0], "TransactionMessageAttempts");
+
+        // The previous snapshot is left untouched for its readers
+        CHECK_EQ(snapshot->transactionMessageAttempts, 3u);
+
+        // Key which is not part of the snapshot
+        listener.notified = false;
+        CHECK_EQ(changeConfiguration(config_mgr, "HeartbeatInterval", "300"), ConfigurationStatus::Accepted);
+        CHECK_FALSE(listener.notified);
+
+        // Rejected value
+        config_mgr.registerCheckFunction("LocalPreAuthorize",
+                                         [](const std::string&, const std::string&) { return ConfigurationStatus::Rejected; });
+        CHECK_EQ(changeConfiguration(config_mgr, "LocalPreAuthorize", "false"), ConfigurationStatus::Rejected);
+        CHECK_FALSE(listener.notified);
+        CHECK(config_mgr.snapshot()->localPreAuthorize);
+    }
+
+    TEST_CASE("Configuration snapshot refresh")
+    {
+        OcppConfigStub        ocpp_config;
+        MessagesConverter     msgs_converter;
+        MessageDispatcherStub msg_dispatcher;
+
+        ocpp_config.setConfigValue("TransactionMessageAttempts", "3");
+        ocpp_config.setConfigValue("LocalPreAuthorize", "true");
+
+        ConfigManager    config_mgr(ocpp_config, msgs_converter, msg_dispatcher);
+        SnapshotListener listener;
+        config_mgr.registerConfigSnapshotListener(listener);
+
+        // Values modified by the application are not visible before a refresh
+        ocpp_config.setConfigValue("TransactionMessageAttempts", "7");
+        ocpp_config.setConfigValue("LocalPreAuthorize", "false");
+        auto snapshot = config_mgr.snapshot();
+        CHECK_EQ(snapshot->transactionMessageAttempts, 3u);
+        CHECK(snapshot->localPreAuthorize);
+
+        // Refresh
+        config_mgr.refreshSnapshot();
+        auto new_snapshot = config_mgr.snapshot();
+        CHECK_EQ(new_snapshot->transactionMessageAttempts, 7u);
+        CHECK_FALSE(new_snapshot->localPreAuthorize);
+        CHECK(listener.notified);
+        CHECK_EQ(listener.previous_attempts, 3u);
+        CHECK_EQ(listener.current_attempts, 7u);
+        REQUIRE_EQ(listener.changed_keys.size(), 2u);
+        CHECK_EQ(listener.changed_keys[0], "LocalPreAuthorize");
+        CHECK_EQ(listener.changed_keys[1], "TransactionMessageAttempts");
+
+        // Refresh without any change
+        listener.notified = false;
+        config_mgr.refreshSnapshot();
+        CHECK_FALSE(listener.notified);
+        CHECK_EQ(config_mgr.snapshot()->transactionMessageAttempts, 7u);
+    }
+
+    TEST_CASE("Get configuration")
+    {
+        OcppConfigStub        ocpp_config;
+        MessagesConverter     msgs_converter;
+        MessageDispatcherStub msg_dispatcher;
+
+        ocpp_config.setConfigValue("HeartbeatInterval", "300");
+        ocpp_config.setConfigValue("LocalPreAuthorize", "true");
+
+        ConfigManager config_mgr(ocpp_config, msgs_converter, msg_dispatcher);
+
+        rapidjson::Document request;
+        request.Parse("{\"key\": [\"HeartbeatInterval\", \"UnknownKey\"]}");
+        rapidjson::Document response;
+        response.Parse("{}");
+        std::string error_code;
+        std::string error_message;
+        CHECK(msg_dispatcher.dispatchMessage("GetConfiguration", request, response, error_code, error_message));
+
+        REQUIRE(response.HasMember("configurationKey"));
+        const rapidjson::Value& configuration_keys = response["configurationKey"];
+        REQUIRE_EQ(configuration_keys.Size(), 1u);
+        CHECK_EQ(std::string(configuration_keys[0]["key"].GetString()), "HeartbeatInterval");
+        CHECK_FALSE(configuration_keys[0]["readonly"].GetBool());
+        CHECK_EQ(std::string(configuration_keys[0]["value"].GetString()), "300");
+        REQUIRE(response.HasMember("unknownKey"));
+        REQUIRE_EQ(response["unknownKey"].Size(), 1u);
+        CHECK_EQ(std::string(response["unknownKey"][0].GetString()), "UnknownKey");
+
+        // All the keys
+        request.Parse("{}");
+        response.Parse("{}");
+        CHECK(msg_dispatcher.dispatchMessage("GetConfiguration", request, response, error_code, error_message));
+        REQUIRE(response.HasMember("configurationKey"));
+        CHECK_EQ(response["configurationKey"].Size(), 2u);
+    }
+
+    TEST_CASE("Snapshot diff")
+    {
+        OcppConfigSnapshot first;
+        OcppConfigSnapshot second;
+        CHECK(first.diff(second).empty());
+
+        second.localAuthListEnabled     = true;
+        second.minimumStatusDuration    = std::chrono::seconds(2);
+        second.meterValueSampleInterval = std::chrono::seconds(10);
+        auto changed_keys               = second.diff(first);
+        REQUIRE_EQ(changed_keys.size(), 3u);
+        CHECK_EQ(changed_keys[0], "LocalAuthListEnabled");
+        CHECK_EQ(changed_keys[1], "MeterValueSampleInterval");
+        CHECK_EQ(changed_keys[2], "MinimumStatusDuration");
+    }
+}
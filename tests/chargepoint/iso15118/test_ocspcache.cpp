@@ -0,0 +1,173 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Base64.h"
+#include "Certificate.h"
+#include "CertificateRequest.h"
+#include "OcspCache.h"
+#include "PrivateKey.h"
+#include "openssl.h"
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest_wrapper.h"
+
+#include <thread>
+
+using namespace ocpp::chargepoint;
+using namespace ocpp::types;
+using namespace ocpp::x509;
+
+/** @brief Build an OCSP request data */
+static OcspRequestDataType buildRequest(const std::string& serial_number)
+{
+    OcspRequestDataType request;
+    request.hashAlgorithm = HashAlgorithmEnumType::SHA256;
+    request.issuerNameHash.assign("A1B2C3");
+    request.issuerKeyHash.assign("D4E5F6");
+    request.serialNumber.assign(serial_number);
+    request.responderURL.assign("http://ocsp.example.com");
+    return request;
+}
+
+/** @brief Build a base64 encoded OCSP response signed by a self-signed certificate */
+static std::string buildResponse(long next_update_s)
+{
+    std::string ocsp_result;
+
+    // Self-signed responder certificate
+    PrivateKey           pkey(PrivateKey::Type::EC, PrivateKey::Curve::PRIME256_V1, "");
+    Certificate::Subject subject;
+    subject.common_name = "OCSP responder";
+    CertificateRequest csr(subject, pkey);
+    Certificate        certificate(csr, pkey, Sha2::Type::SHA256, 1u);
+
+    // Load OpenSSL objects
+    std::string pkey_pem = pkey.privatePemUnencrypted();
+    BIO*        bio      = BIO_new_mem_buf(pkey_pem.c_str(), static_cast<int>(pkey_pem.size()));
+    EVP_PKEY*   key      = PEM_read_bio_PrivateKey(bio, nullptr, nullptr, nullptr);
+    BIO_free(bio);
+    bio       = BIO_new_mem_buf(certificate.pem().c_str(), static_cast<int>(certificate.pem().size()));
+    X509* crt = PEM_read_bio_X509(bio, nullptr, nullptr, nullptr);
+    BIO_free(bio);
+
+    // Build response
+    OCSP_BASICRESP* basic_response = OCSP_BASICRESP_new();
+    OCSP_CERTID*    cert_id        = OCSP_cert_to_id(nullptr, crt, crt);
+    ASN1_TIME*      this_update    = ASN1_TIME_adj(nullptr, time(nullptr), 0, 0);
+    ASN1_TIME*      next_update    = ASN1_TIME_adj(nullptr, time(nullptr), 0, next_update_s);
+    OCSP_basic_add1_status(basic_response, cert_id, V_OCSP_CERTSTATUS_GOOD, 0, nullptr, this_update, next_update);
+    OCSP_basic_sign(basic_response, crt, key, EVP_sha256(), nullptr, 0);
+    OCSP_RESPONSE* response = OCSP_response_create(OCSP_RESPONSE_STATUS_SUCCESSFUL, basic_response);
+
+    // Encode response
+    unsigned char* der     = nullptr;
+    int            der_len = i2d_OCSP_RESPONSE(response, &der);
+    if (der_len > 0)
+    {
+        ocsp_result = base64::encode(der, static_cast<size_t>(der_len));
+        OPENSSL_free(der);
+    }
+
+    OCSP_RESPONSE_free(response);
+    ASN1_TIME_free(next_update);
+    ASN1_TIME_free(this_update);
+    OCSP_CERTID_free(cert_id);
+    OCSP_BASICRESP_free(basic_response);
+    X509_free(crt);
+    EVP_PKEY_free(key);
+
+    return ocsp_result;
+}
+
+TEST_SUITE("OCSP cache")
+{
+    TEST_CASE("Cache hit and expiry")
+    {
+        OcspCache   cache;
+        std::string ocsp_result;
+
+        CHECK_FALSE(cache.get(buildRequest("0102"), ocsp_result));
+
+        CHECK(cache.add(buildRequest("0102"), "response", std::chrono::milliseconds(200)));
+        CHECK_EQ(cache.size(), 1u);
+        CHECK(cache.get(buildRequest("0102"), ocsp_result));
+        CHECK_EQ(ocsp_result, "response");
+
+        // Fields are case insensitive
+        OcspRequestDataType request = buildRequest("0102");
+        request.issuerNameHash.assign("a1b2c3");
+        request.responderURL.assign("HTTP://OCSP.EXAMPLE.COM");
+        CHECK(cache.get(request, ocsp_result));
+
+        // Other certificate
+        CHECK_FALSE(cache.get(buildRequest("0103"), ocsp_result));
+
+        // Expiry
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        CHECK_FALSE(cache.get(buildRequest("0102"), ocsp_result));
+        CHECK_EQ(cache.size(), 0u);
+
+        // No validity
+        CHECK_FALSE(cache.add(buildRequest("0102"), "response", std::chrono::milliseconds(0)));
+        CHECK_EQ(cache.size(), 0u);
+    }
+
+    TEST_CASE("Maximum number of entries")
+    {
+        OcspCache   cache(2u);
+        std::string ocsp_result;
+
+        CHECK(cache.add(buildRequest("01"), "response1", std::chrono::milliseconds(10000)));
+        CHECK(cache.add(buildRequest("02"), "response2", std::chrono::milliseconds(5000)));
+        CHECK(cache.add(buildRequest("03"), "response3", std::chrono::milliseconds(10000)));
+        CHECK_EQ(cache.size(), 2u);
+
+        // The entry which expires first has been removed
+        CHECK(cache.get(buildRequest("01"), ocsp_result));
+        CHECK_FALSE(cache.get(buildRequest("02"), ocsp_result));
+        CHECK(cache.get(buildRequest("03"), ocsp_result));
+
+        // Update of an existing entry
+        CHECK(cache.add(buildRequest("03"), "response3bis", std::chrono::milliseconds(10000)));
+        CHECK_EQ(cache.size(), 2u);
+        CHECK(cache.get(buildRequest("03"), ocsp_result));
+        CHECK_EQ(ocsp_result, "response3bis");
+
+        cache.clear();
+        CHECK_EQ(cache.size(), 0u);
+    }
+
+    TEST_CASE("Validity from OCSP response")
+    {
+        OcspCache   cache;
+        std::string ocsp_result;
+
+        // Invalid responses
+        CHECK_FALSE(cache.add(buildRequest("01"), ""));
+        CHECK_FALSE(cache.add(buildRequest("01"), "not an OCSP response"));
+
+        // Outdated response
+        CHECK_FALSE(cache.add(buildRequest("01"), buildResponse(-60)));
+
+        // Valid response
+        std::string response = buildResponse(3600);
+        CHECK_FALSE(response.empty());
+        CHECK(cache.add(buildRequest("01"), response));
+        CHECK(cache.get(buildRequest("01"), ocsp_result));
+        CHECK_EQ(ocsp_result, response);
+    }
+}
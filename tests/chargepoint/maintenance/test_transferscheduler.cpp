@@ -0,0 +1,160 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "TransferScheduler.h"
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "TestableTimerPool.h"
+#include "doctest_wrapper.h"
+
+#include <thread>
+
+using namespace ocpp::chargepoint;
+using namespace ocpp::helpers;
+
+/** @brief Wait for a condition to be true */
+static bool waitFor(std::function<bool()> condition)
+{
+    for (unsigned int i = 0; (i < 200u) && !condition(); i++)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return condition();
+}
+
+TEST_SUITE("Transfer scheduler")
+{
+    TEST_CASE("Single operation")
+    {
+        TestableTimerPool timer_pool;
+        TransferScheduler scheduler(timer_pool, "Test scheduler", 0);
+
+        CHECK(scheduler.acquire());
+        CHECK_FALSE(scheduler.acquire());
+        scheduler.release();
+        CHECK(scheduler.acquire());
+        scheduler.release();
+    }
+
+    TEST_CASE("Retries")
+    {
+        TestableTimerPool timer_pool;
+        TransferScheduler scheduler(timer_pool, "Test scheduler", 0);
+        Timer*            timer = timer_pool.getTimer("Test scheduler");
+        REQUIRE(timer != nullptr);
+
+        std::atomic<unsigned int> attempts(0);
+        std::atomic<int>          result(-1);
+        CHECK(scheduler.acquire());
+        scheduler.transfer(
+            "Test transfer",
+            3u,
+            std::chrono::seconds(10),
+            [&attempts](TransferProgress&)
+            {
+                attempts++;
+                return false;
+            },
+            [&scheduler, &result](bool success)
+            {
+                result = (success ? 1 : 0);
+                scheduler.release();
+            });
+
+        // First attempt is immediate, the retries are scheduled on the timer
+        CHECK(waitFor([&] { return timer->isStarted(); }));
+        CHECK_EQ(attempts, 1u);
+        CHECK_EQ(timer->getInterval(), std::chrono::seconds(10));
+        CHECK_EQ(result, -1);
+
+        timer->stop();
+        timer->getCallback()();
+        CHECK(waitFor([&] { return timer->isStarted(); }));
+        CHECK_EQ(attempts, 2u);
+
+        timer->stop();
+        timer->getCallback()();
+        CHECK(waitFor([&] { return (result != -1); }));
+        CHECK_EQ(attempts, 3u);
+        CHECK_EQ(result, 0);
+        CHECK_FALSE(timer->isStarted());
+        CHECK(scheduler.acquire());
+        scheduler.release();
+
+        // Success on the first attempt
+        attempts = 0;
+        result   = -1;
+        scheduler.transfer(
+            "Test transfer",
+            3u,
+            std::chrono::seconds(10),
+            [&attempts](TransferProgress&)
+            {
+                attempts++;
+                return true;
+            },
+            [&result](bool success) { result = (success ? 1 : 0); });
+        CHECK(waitFor([&] { return (result != -1); }));
+        CHECK_EQ(attempts, 1u);
+        CHECK_EQ(result, 1);
+        CHECK_FALSE(timer->isStarted());
+    }
+
+    TEST_CASE("Run at a date")
+    {
+        TestableTimerPool timer_pool;
+        TransferScheduler scheduler(timer_pool, "Test scheduler", 0);
+        Timer*            timer = timer_pool.getTimer("Test scheduler");
+        REQUIRE(timer != nullptr);
+
+        std::atomic<bool> done(false);
+        scheduler.runAt(ocpp::types::DateTime(ocpp::types::DateTime::now().timestamp() + 60), [&done] { done = true; });
+        CHECK(timer->isStarted());
+        CHECK_GE(timer->getInterval(), std::chrono::seconds(59));
+        CHECK_FALSE(done);
+
+        timer->stop();
+        timer->getCallback()();
+        CHECK(waitFor([&] { return done.load(); }));
+
+        // Elapsed date
+        done = false;
+        scheduler.runAt(ocpp::types::DateTime::now(), [&done] { done = true; });
+        CHECK_FALSE(timer->isStarted());
+        CHECK(waitFor([&] { return done.load(); }));
+    }
+
+    TEST_CASE("Progress and bandwidth")
+    {
+        std::vector<size_t> notifications;
+        TransferProgress    progress(10000u, [&notifications](size_t transferred) { notifications.push_back(transferred); });
+
+        auto start = std::chrono::steady_clock::now();
+        progress.restart();
+        for (unsigned int i = 0; i < 10u; i++)
+        {
+            progress.update(1000u);
+        }
+        auto duration = std::chrono::steady_clock::now() - start;
+        CHECK_EQ(progress.transferred(), 10000u);
+        CHECK_GE(duration, std::chrono::milliseconds(900));
+        CHECK_FALSE(notifications.empty());
+
+        progress.restart();
+        CHECK_EQ(progress.transferred(), 0u);
+    }
+}
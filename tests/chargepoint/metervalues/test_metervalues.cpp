@@ -25,11 +25,14 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include "GenericMessageSender.h"
 #include "MessagesConverter.h"
 #include "MessagesValidator.h"
+#include "MeterValueConverter.h"
+#include "MeterValuesBuilder.h"
 #include "MeterValues.h"
 #include "OcppConfigStub.h"
 #include "RequestFifoStub.h"
 #include "RpcStub.h"
 #include "StatusManagerStub.h"
+#include "StringHelpers.h"
 #include "TestableTimerPool.h"
 #include "TestableWorkerThreadPool.h"
 #include "TriggerMessageManagerStub.h"
@@ -91,21 +94,21 @@ static void checkClockAligned(const std::vector<std::pair<std::string, std::uniq
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].format, ValueFormat::Raw);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].unit, UnitOfMeasure::A);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].context, ReadingContext::SampleClock);
-    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].value, "20");
+    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].str(), "20");
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].measurand, Measurand::EnergyActiveImportRegister);
     CHECK_FALSE(meter_value_req.meterValue[0].sampledValue[1].phase.isSet());
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].location, Location::Inlet);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].format, ValueFormat::Raw);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].unit, UnitOfMeasure::kWh);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].context, ReadingContext::SampleClock);
-    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].value, "123");
+    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].str(), "123");
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].measurand, Measurand::PowerActiveImport);
     CHECK_FALSE(meter_value_req.meterValue[0].sampledValue[2].phase.isSet());
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].location, Location::Inlet);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].format, ValueFormat::Raw);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].unit, UnitOfMeasure::kW);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].context, ReadingContext::SampleClock);
-    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].value, "22");
+    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].str(), "22");
 
     CHECK(deserializeMeterValue((*messages[1].second), meter_value_req));
     CHECK_EQ(meter_value_req.connectorId, 1);
@@ -118,21 +121,21 @@ static void checkClockAligned(const std::vector<std::pair<std::string, std::uniq
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].format, ValueFormat::Raw);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].unit, UnitOfMeasure::A);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].context, ReadingContext::SampleClock);
-    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].value, "12");
+    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].str(), "12");
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].measurand, Measurand::EnergyActiveImportRegister);
     CHECK_FALSE(meter_value_req.meterValue[0].sampledValue[1].phase.isSet());
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].location, Location::Outlet);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].format, ValueFormat::Raw);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].unit, UnitOfMeasure::kWh);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].context, ReadingContext::SampleClock);
-    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].value, "100");
+    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].str(), "100");
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].measurand, Measurand::PowerActiveImport);
     CHECK_FALSE(meter_value_req.meterValue[0].sampledValue[2].phase.isSet());
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].location, Location::Outlet);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].format, ValueFormat::Raw);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].unit, UnitOfMeasure::kW);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].context, ReadingContext::SampleClock);
-    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].value, "6");
+    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].str(), "6");
 
     CHECK(deserializeMeterValue((*messages[2].second), meter_value_req));
     CHECK_EQ(meter_value_req.connectorId, 2);
@@ -145,21 +148,21 @@ static void checkClockAligned(const std::vector<std::pair<std::string, std::uniq
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].format, ValueFormat::Raw);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].unit, UnitOfMeasure::A);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].context, ReadingContext::SampleClock);
-    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].value, "8");
+    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].str(), "8");
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].measurand, Measurand::EnergyActiveImportRegister);
     CHECK_FALSE(meter_value_req.meterValue[0].sampledValue[1].phase.isSet());
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].location, Location::Outlet);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].format, ValueFormat::Raw);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].unit, UnitOfMeasure::kWh);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].context, ReadingContext::SampleClock);
-    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].value, "23");
+    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].str(), "23");
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].measurand, Measurand::PowerActiveImport);
     CHECK_FALSE(meter_value_req.meterValue[0].sampledValue[2].phase.isSet());
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].location, Location::Outlet);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].format, ValueFormat::Raw);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].unit, UnitOfMeasure::kW);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].context, ReadingContext::SampleClock);
-    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].value, "16");
+    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].str(), "16");
 }
 
 /** @brief Check all the sampled meter values */
@@ -184,28 +187,28 @@ static void checkAllSampled(const std::vector<std::pair<std::string, std::unique
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].format, ValueFormat::Raw);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].unit, UnitOfMeasure::A);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].context, context);
-    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].value, "10");
+    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].str(), "10");
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].measurand, Measurand::CurrentImport);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].phase, Phase::L2);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].location, Location::Inlet);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].format, ValueFormat::Raw);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].unit, UnitOfMeasure::A);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].context, context);
-    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].value, "20");
+    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].str(), "20");
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].measurand, Measurand::CurrentImport);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].phase, Phase::L3);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].location, Location::Inlet);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].format, ValueFormat::Raw);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].unit, UnitOfMeasure::A);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].context, context);
-    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].value, "30");
+    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].str(), "30");
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[3].measurand, Measurand::EnergyActiveImportRegister);
     CHECK_FALSE(meter_value_req.meterValue[0].sampledValue[3].phase.isSet());
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[3].location, Location::Inlet);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[3].format, ValueFormat::Raw);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[3].unit, UnitOfMeasure::kWh);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[3].context, context);
-    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[3].value, "123");
+    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[3].str(), "123");
 
     CHECK(deserializeMeterValue((*messages[1].second), meter_value_req));
     CHECK_EQ(meter_value_req.connectorId, 1);
@@ -218,28 +221,28 @@ static void checkAllSampled(const std::vector<std::pair<std::string, std::unique
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].format, ValueFormat::Raw);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].unit, UnitOfMeasure::A);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].context, context);
-    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].value, "40");
+    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].str(), "40");
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].measurand, Measurand::CurrentImport);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].phase, Phase::L2);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].location, Location::Outlet);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].format, ValueFormat::Raw);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].unit, UnitOfMeasure::A);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].context, context);
-    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].value, "50");
+    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].str(), "50");
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].measurand, Measurand::CurrentImport);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].phase, Phase::L3);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].location, Location::Outlet);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].format, ValueFormat::Raw);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].unit, UnitOfMeasure::A);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].context, context);
-    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].value, "60");
+    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].str(), "60");
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[3].measurand, Measurand::EnergyActiveImportRegister);
     CHECK_FALSE(meter_value_req.meterValue[0].sampledValue[3].phase.isSet());
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[3].location, Location::Outlet);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[3].format, ValueFormat::Raw);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[3].unit, UnitOfMeasure::kWh);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[3].context, context);
-    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[3].value, "100");
+    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[3].str(), "100");
 
     CHECK(deserializeMeterValue((*messages[2].second), meter_value_req));
     CHECK_EQ(meter_value_req.connectorId, 2);
@@ -252,28 +255,28 @@ static void checkAllSampled(const std::vector<std::pair<std::string, std::unique
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].format, ValueFormat::Raw);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].unit, UnitOfMeasure::A);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].context, context);
-    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].value, "70");
+    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].str(), "70");
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].measurand, Measurand::CurrentImport);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].phase, Phase::L2);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].location, Location::Outlet);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].format, ValueFormat::Raw);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].unit, UnitOfMeasure::A);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].context, context);
-    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].value, "80");
+    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].str(), "80");
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].measurand, Measurand::CurrentImport);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].phase, Phase::L3);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].location, Location::Outlet);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].format, ValueFormat::Raw);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].unit, UnitOfMeasure::A);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].context, context);
-    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].value, "90");
+    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].str(), "90");
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[3].measurand, Measurand::EnergyActiveImportRegister);
     CHECK_FALSE(meter_value_req.meterValue[0].sampledValue[3].phase.isSet());
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[3].location, Location::Outlet);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[3].format, ValueFormat::Raw);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[3].unit, UnitOfMeasure::kWh);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[3].context, context);
-    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[3].value, "23");
+    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[3].str(), "23");
 }
 
 /** @brief Check the sampled meter values */
@@ -296,7 +299,7 @@ static void checkSampled(const std::vector<std::pair<std::string, std::unique_pt
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].format, ValueFormat::Raw);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].unit, UnitOfMeasure::A);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].context, ReadingContext::SamplePeriodic);
-    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].value, "70");
+    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].str(), "70");
 
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].measurand, Measurand::CurrentImport);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].phase, Phase::L2);
@@ -304,7 +307,7 @@ static void checkSampled(const std::vector<std::pair<std::string, std::unique_pt
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].format, ValueFormat::Raw);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].unit, UnitOfMeasure::A);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].context, ReadingContext::SamplePeriodic);
-    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].value, "80");
+    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].str(), "80");
 
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].measurand, Measurand::CurrentImport);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].phase, Phase::L3);
@@ -312,7 +315,7 @@ static void checkSampled(const std::vector<std::pair<std::string, std::unique_pt
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].format, ValueFormat::Raw);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].unit, UnitOfMeasure::A);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].context, ReadingContext::SamplePeriodic);
-    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].value, "90");
+    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].str(), "90");
 
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[3].measurand, Measurand::EnergyActiveImportRegister);
     CHECK_FALSE(meter_value_req.meterValue[0].sampledValue[3].phase.isSet());
@@ -320,7 +323,7 @@ static void checkSampled(const std::vector<std::pair<std::string, std::unique_pt
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[3].format, ValueFormat::Raw);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[3].unit, UnitOfMeasure::kWh);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[3].context, ReadingContext::SamplePeriodic);
-    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[3].value, "23");
+    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[3].str(), "23");
 }
 
 /** @brief Check the triggered meter values */
@@ -342,7 +345,7 @@ static void checkTriggered(const std::vector<std::pair<std::string, std::unique_
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].format, ValueFormat::Raw);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].unit, UnitOfMeasure::A);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].context, ReadingContext::Trigger);
-    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].value, "70");
+    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].str(), "70");
 
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].measurand, Measurand::CurrentImport);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].phase, Phase::L2);
@@ -350,7 +353,7 @@ static void checkTriggered(const std::vector<std::pair<std::string, std::unique_
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].format, ValueFormat::Raw);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].unit, UnitOfMeasure::A);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].context, ReadingContext::Trigger);
-    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].value, "80");
+    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].str(), "80");
 
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].measurand, Measurand::CurrentImport);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].phase, Phase::L3);
@@ -358,7 +361,7 @@ static void checkTriggered(const std::vector<std::pair<std::string, std::unique_
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].format, ValueFormat::Raw);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].unit, UnitOfMeasure::A);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].context, ReadingContext::Trigger);
-    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].value, "90");
+    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[2].str(), "90");
 
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[3].measurand, Measurand::EnergyActiveImportRegister);
     CHECK_FALSE(meter_value_req.meterValue[0].sampledValue[3].phase.isSet());
@@ -366,7 +369,7 @@ static void checkTriggered(const std::vector<std::pair<std::string, std::unique_
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[3].format, ValueFormat::Raw);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[3].unit, UnitOfMeasure::kWh);
     CHECK_EQ(meter_value_req.meterValue[0].sampledValue[3].context, ReadingContext::Trigger);
-    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[3].value, "23");
+    CHECK_EQ(meter_value_req.meterValue[0].sampledValue[3].str(), "23");
 }
 
 TEST_SUITE("Metervalues component")
@@ -778,14 +781,14 @@ TEST_SUITE("Metervalues component")
         CHECK_EQ(meter_values[0].sampledValue[0].format, ValueFormat::Raw);
         CHECK_EQ(meter_values[0].sampledValue[0].unit, UnitOfMeasure::A);
         CHECK_EQ(meter_values[0].sampledValue[0].context, ReadingContext::SampleClock);
-        CHECK_EQ(meter_values[0].sampledValue[0].value, "12");
+        CHECK_EQ(meter_values[0].sampledValue[0].str(), "12");
         CHECK_EQ(meter_values[0].sampledValue[1].measurand, Measurand::EnergyActiveImportRegister);
         CHECK_FALSE(meter_values[0].sampledValue[1].phase.isSet());
         CHECK_EQ(meter_values[0].sampledValue[1].location, Location::Outlet);
         CHECK_EQ(meter_values[0].sampledValue[1].format, ValueFormat::Raw);
         CHECK_EQ(meter_values[0].sampledValue[1].unit, UnitOfMeasure::kWh);
         CHECK_EQ(meter_values[0].sampledValue[1].context, ReadingContext::SampleClock);
-        CHECK_EQ(meter_values[0].sampledValue[1].value, "100");
+        CHECK_EQ(meter_values[0].sampledValue[1].str(), "100");
 
         CHECK_EQ(meter_values[1].sampledValue.size(), 4u);
         CHECK_EQ(meter_values[1].sampledValue[0].measurand, Measurand::CurrentImport);
@@ -794,28 +797,28 @@ TEST_SUITE("Metervalues component")
         CHECK_EQ(meter_values[1].sampledValue[0].format, ValueFormat::Raw);
         CHECK_EQ(meter_values[1].sampledValue[0].unit, UnitOfMeasure::A);
         CHECK_EQ(meter_values[1].sampledValue[0].context, ReadingContext::SamplePeriodic);
-        CHECK_EQ(meter_values[1].sampledValue[0].value, "40");
+        CHECK_EQ(meter_values[1].sampledValue[0].str(), "40");
         CHECK_EQ(meter_values[1].sampledValue[1].measurand, Measurand::CurrentImport);
         CHECK_EQ(meter_values[1].sampledValue[1].phase, Phase::L2);
         CHECK_EQ(meter_values[1].sampledValue[1].location, Location::Outlet);
         CHECK_EQ(meter_values[1].sampledValue[1].format, ValueFormat::Raw);
         CHECK_EQ(meter_values[1].sampledValue[1].unit, UnitOfMeasure::A);
         CHECK_EQ(meter_values[1].sampledValue[1].context, ReadingContext::SamplePeriodic);
-        CHECK_EQ(meter_values[1].sampledValue[1].value, "50");
+        CHECK_EQ(meter_values[1].sampledValue[1].str(), "50");
         CHECK_EQ(meter_values[1].sampledValue[2].measurand, Measurand::CurrentImport);
         CHECK_EQ(meter_values[1].sampledValue[2].phase, Phase::L3);
         CHECK_EQ(meter_values[1].sampledValue[2].location, Location::Outlet);
         CHECK_EQ(meter_values[1].sampledValue[2].format, ValueFormat::Raw);
         CHECK_EQ(meter_values[1].sampledValue[2].unit, UnitOfMeasure::A);
         CHECK_EQ(meter_values[1].sampledValue[2].context, ReadingContext::SamplePeriodic);
-        CHECK_EQ(meter_values[1].sampledValue[2].value, "60");
+        CHECK_EQ(meter_values[1].sampledValue[2].str(), "60");
         CHECK_EQ(meter_values[1].sampledValue[3].measurand, Measurand::EnergyActiveImportRegister);
         CHECK_FALSE(meter_values[1].sampledValue[3].phase.isSet());
         CHECK_EQ(meter_values[1].sampledValue[3].location, Location::Outlet);
         CHECK_EQ(meter_values[1].sampledValue[3].format, ValueFormat::Raw);
         CHECK_EQ(meter_values[1].sampledValue[3].unit, UnitOfMeasure::kWh);
         CHECK_EQ(meter_values[1].sampledValue[3].context, ReadingContext::SamplePeriodic);
-        CHECK_EQ(meter_values[1].sampledValue[3].value, "100");
+        CHECK_EQ(meter_values[1].sampledValue[3].str(), "100");
 
         CHECK_EQ(meter_values[2].sampledValue.size(), 4u);
         CHECK_EQ(meter_values[2].sampledValue[0].measurand, Measurand::CurrentImport);
@@ -824,28 +827,28 @@ TEST_SUITE("Metervalues component")
         CHECK_EQ(meter_values[2].sampledValue[0].format, ValueFormat::Raw);
         CHECK_EQ(meter_values[2].sampledValue[0].unit, UnitOfMeasure::A);
         CHECK_EQ(meter_values[2].sampledValue[0].context, ReadingContext::SamplePeriodic);
-        CHECK_EQ(meter_values[2].sampledValue[0].value, "40");
+        CHECK_EQ(meter_values[2].sampledValue[0].str(), "40");
         CHECK_EQ(meter_values[2].sampledValue[1].measurand, Measurand::CurrentImport);
         CHECK_EQ(meter_values[2].sampledValue[1].phase, Phase::L2);
         CHECK_EQ(meter_values[2].sampledValue[1].location, Location::Outlet);
         CHECK_EQ(meter_values[2].sampledValue[1].format, ValueFormat::Raw);
         CHECK_EQ(meter_values[2].sampledValue[1].unit, UnitOfMeasure::A);
         CHECK_EQ(meter_values[2].sampledValue[1].context, ReadingContext::SamplePeriodic);
-        CHECK_EQ(meter_values[2].sampledValue[1].value, "50");
+        CHECK_EQ(meter_values[2].sampledValue[1].str(), "50");
         CHECK_EQ(meter_values[2].sampledValue[2].measurand, Measurand::CurrentImport);
         CHECK_EQ(meter_values[2].sampledValue[2].phase, Phase::L3);
         CHECK_EQ(meter_values[2].sampledValue[2].location, Location::Outlet);
         CHECK_EQ(meter_values[2].sampledValue[2].format, ValueFormat::Raw);
         CHECK_EQ(meter_values[2].sampledValue[2].unit, UnitOfMeasure::A);
         CHECK_EQ(meter_values[2].sampledValue[2].context, ReadingContext::SamplePeriodic);
-        CHECK_EQ(meter_values[2].sampledValue[2].value, "60");
+        CHECK_EQ(meter_values[2].sampledValue[2].str(), "60");
         CHECK_EQ(meter_values[2].sampledValue[3].measurand, Measurand::EnergyActiveImportRegister);
         CHECK_FALSE(meter_values[2].sampledValue[3].phase.isSet());
         CHECK_EQ(meter_values[2].sampledValue[3].location, Location::Outlet);
         CHECK_EQ(meter_values[2].sampledValue[3].format, ValueFormat::Raw);
         CHECK_EQ(meter_values[2].sampledValue[3].unit, UnitOfMeasure::kWh);
         CHECK_EQ(meter_values[2].sampledValue[3].context, ReadingContext::SamplePeriodic);
-        CHECK_EQ(meter_values[2].sampledValue[3].value, "100");
+        CHECK_EQ(meter_values[2].sampledValue[3].str(), "100");
 
         CHECK_EQ(meter_values[3].sampledValue.size(), 2u);
         CHECK_EQ(meter_values[3].sampledValue[0].measurand, Measurand::CurrentImport);
@@ -854,18 +857,20 @@ TEST_SUITE("Metervalues component")
         CHECK_EQ(meter_values[3].sampledValue[0].format, ValueFormat::Raw);
         CHECK_EQ(meter_values[3].sampledValue[0].unit, UnitOfMeasure::A);
         CHECK_EQ(meter_values[3].sampledValue[0].context, ReadingContext::SampleClock);
-        CHECK_EQ(meter_values[3].sampledValue[0].value, "12");
+        CHECK_EQ(meter_values[3].sampledValue[0].str(), "12");
         CHECK_EQ(meter_values[3].sampledValue[1].measurand, Measurand::EnergyActiveImportRegister);
         CHECK_FALSE(meter_values[3].sampledValue[1].phase.isSet());
         CHECK_EQ(meter_values[3].sampledValue[1].location, Location::Outlet);
         CHECK_EQ(meter_values[3].sampledValue[1].format, ValueFormat::Raw);
         CHECK_EQ(meter_values[3].sampledValue[1].unit, UnitOfMeasure::kWh);
         CHECK_EQ(meter_values[3].sampledValue[1].context, ReadingContext::SampleClock);
-        CHECK_EQ(meter_values[3].sampledValue[1].value, "100");
+        CHECK_EQ(meter_values[3].sampledValue[1].str(), "100");
 
         // Disable stop transaction values
         ocpp_config.setConfigValue("StopTxnAlignedData", "");
         ocpp_config.setConfigValue("StopTxnSampledData", "");
+        meter_mgr.configurationValueChanged("StopTxnAlignedData");
+        meter_mgr.configurationValueChanged("StopTxnSampledData");
 
         // Start transaction on connector 1
         connectors.getConnector(1u)->transaction_id = 987;
@@ -1039,14 +1044,14 @@ TEST_SUITE("Metervalues component")
         CHECK_FALSE(meter_value_req.meterValue[0].sampledValue[0].format.isSet());
         CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].unit, UnitOfMeasure::Celsius);
         CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].context, ReadingContext::InterruptionBegin);
-        CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].value, "1234");
+        CHECK_EQ(meter_value_req.meterValue[0].sampledValue[0].str(), "1234");
         CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].measurand, Measurand::Frequency);
         CHECK_FALSE(meter_value_req.meterValue[0].sampledValue[1].phase.isSet());
         CHECK_FALSE(meter_value_req.meterValue[0].sampledValue[1].location.isSet());
         CHECK_FALSE(meter_value_req.meterValue[0].sampledValue[1].format.isSet());
         CHECK_FALSE(meter_value_req.meterValue[0].sampledValue[1].unit.isSet());
         CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].context, ReadingContext::Other);
-        CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].value, "50");
+        CHECK_EQ(meter_value_req.meterValue[0].sampledValue[1].str(), "50");
         CHECK_EQ(meter_value_req.meterValue[1].sampledValue.size(), 2u);
         CHECK_EQ(meter_value_req.meterValue[1].sampledValue[0].measurand, Measurand::PowerFactor);
         CHECK_FALSE(meter_value_req.meterValue[1].sampledValue[0].phase.isSet());
@@ -1054,20 +1059,147 @@ TEST_SUITE("Metervalues component")
         CHECK_FALSE(meter_value_req.meterValue[1].sampledValue[0].format.isSet());
         CHECK_EQ(meter_value_req.meterValue[1].sampledValue[0].unit, UnitOfMeasure::Percent);
         CHECK_EQ(meter_value_req.meterValue[1].sampledValue[0].context, ReadingContext::InterruptionEnd);
-        CHECK_EQ(meter_value_req.meterValue[1].sampledValue[0].value, "90");
+        CHECK_EQ(meter_value_req.meterValue[1].sampledValue[0].str(), "90");
         CHECK_EQ(meter_value_req.meterValue[1].sampledValue[1].measurand, Measurand::RPM);
         CHECK_FALSE(meter_value_req.meterValue[1].sampledValue[1].phase.isSet());
         CHECK_FALSE(meter_value_req.meterValue[1].sampledValue[1].location.isSet());
         CHECK_FALSE(meter_value_req.meterValue[1].sampledValue[1].format.isSet());
         CHECK_FALSE(meter_value_req.meterValue[1].sampledValue[1].unit.isSet());
         CHECK_EQ(meter_value_req.meterValue[1].sampledValue[1].context, ReadingContext::Other);
-        CHECK_EQ(meter_value_req.meterValue[1].sampledValue[1].value, "3000");
+        CHECK_EQ(meter_value_req.meterValue[1].sampledValue[1].str(), "3000");
 
         // Clear stubs
         event_handler.clearCalls();
         rpc.clearCalls();
     }
 
+    TEST_CASE("Meter values builder")
+    {
+        MeterValuesReq meter_values_req;
+        meter_values_req.connectorId   = 2u;
+        meter_values_req.transactionId = 1234;
+        meter_values_req.meterValue.emplace_back();
+        MeterValue& meter_value = meter_values_req.meterValue.back();
+        meter_value.timestamp   = DateTime(1700000000);
+        for (Phase phase : {Phase::L1, Phase::L2, Phase::L3})
+        {
+            SampledValue sampled_value;
+            sampled_value.value     = "16.5";
+            sampled_value.context   = ReadingContext::SamplePeriodic;
+            sampled_value.measurand = Measurand::CurrentImport;
+            sampled_value.phase     = phase;
+            sampled_value.unit      = UnitOfMeasure::A;
+            meter_value.sampledValue.push_back(sampled_value);
+        }
+
+        // Reference conversion
+        rapidjson::Document     expected;
+        MeterValuesReqConverter meter_values_conv;
+        expected.Parse("{}");
+        meter_values_conv.setAllocator(&expected.GetAllocator());
+        CHECK(meter_values_conv.toJson(meter_values_req, expected));
+
+        // Built request, several times to reuse the buffers
+        MeterValuesBuilder builder;
+        for (size_t i = 0; i < 3u; i++)
+        {
+            builder.meterValue() = meter_value;
+            CHECK_EQ(builder.buildRequest(2u, 1234), expected);
+        }
+        builder.meterValue() = meter_value;
+        CHECK_FALSE(builder.buildRequest(2u, Optional<int>()).HasMember("transactionId"));
+
+        // Serialized meter value
+        rapidjson::Document serialized;
+        serialized.Parse(builder.serialize());
+        CHECK_EQ(serialized, expected["meterValue"][0]);
+    }
+
+    TEST_CASE("Numeric sampled values")
+    {
+        // Formatting
+        char   buffer[ocpp::helpers::MAX_DECIMAL_STR_SIZE];
+        size_t len = ocpp::helpers::formatDecimal(buffer, 16.5, 1u);
+        CHECK_EQ(std::string(buffer, len), "16.5");
+        len = ocpp::helpers::formatDecimal(buffer, 1234.5678, 2u);
+        CHECK_EQ(std::string(buffer, len), "1234.57");
+        len = ocpp::helpers::formatDecimal(buffer, -3.25, 3u);
+        CHECK_EQ(std::string(buffer, len), "-3.250");
+        len = ocpp::helpers::formatDecimal(buffer, -0.001, 2u);
+        CHECK_EQ(std::string(buffer, len), "0.00");
+        len = ocpp::helpers::formatDecimal(buffer, 230., 0u);
+        CHECK_EQ(std::string(buffer, len), "230");
+
+        // Parsing
+        double       number = 0.;
+        unsigned int scale  = 0;
+        CHECK(ocpp::helpers::parseDecimal("-12.050", 7u, number, scale));
+        CHECK_EQ(number, doctest::Approx(-12.05));
+        CHECK_EQ(scale, 3u);
+        CHECK(ocpp::helpers::parseDecimal("42", 2u, number, scale));
+        CHECK_EQ(number, 42.);
+        CHECK_EQ(scale, 0u);
+        CHECK_FALSE(ocpp::helpers::parseDecimal("4.2e3", 5u, number, scale));
+        CHECK_FALSE(ocpp::helpers::parseDecimal("1.2.3", 5u, number, scale));
+        CHECK_FALSE(ocpp::helpers::parseDecimal("", 0u, number, scale));
+
+        // Numeric values are serialized as their string counterparts
+        MeterValue meter_value;
+        meter_value.timestamp = DateTime(1700000000);
+        meter_value.sampledValue.emplace_back();
+        meter_value.sampledValue.back().value     = "16.5";
+        meter_value.sampledValue.back().measurand = Measurand::CurrentImport;
+        meter_value.sampledValue.emplace_back();
+        meter_value.sampledValue.back().value  = "AB01CD";
+        meter_value.sampledValue.back().format = ValueFormat::SignedData;
+
+        MeterValue numeric_meter_value = meter_value;
+        numeric_meter_value.sampledValue[0].setNumber(16.5, 1u);
+        CHECK(numeric_meter_value.sampledValue[0].value.empty());
+
+        rapidjson::Document expected;
+        rapidjson::Document numeric;
+        MeterValueConverter meter_value_conv;
+        expected.Parse("{}");
+        meter_value_conv.setAllocator(&expected.GetAllocator());
+        CHECK(meter_value_conv.toJson(meter_value, expected));
+        numeric.Parse("{}");
+        meter_value_conv.setAllocator(&numeric.GetAllocator());
+        CHECK(meter_value_conv.toJson(numeric_meter_value, numeric));
+        CHECK_EQ(numeric, expected);
+
+        MeterValuesBuilder builder;
+        builder.meterValue() = numeric_meter_value;
+        rapidjson::Document serialized;
+        serialized.Parse(builder.serialize());
+        CHECK_EQ(serialized, expected);
+
+        // Numeric representation is filled at deserialization
+        MeterValue  parsed;
+        std::string error_code;
+        std::string error_message;
+        CHECK(meter_value_conv.fromJson(expected, parsed, error_code, error_message));
+        REQUIRE_EQ(parsed.sampledValue.size(), 2u);
+        CHECK(parsed.sampledValue[0].value.empty());
+        CHECK_EQ(parsed.sampledValue[0].str(), "16.5");
+        CHECK(parsed.sampledValue[0].isNumeric());
+        CHECK_EQ(parsed.sampledValue[0].number, 16.5);
+        CHECK_EQ(parsed.sampledValue[0].scale, 1);
+        CHECK_EQ(parsed.sampledValue[1].value, "AB01CD");
+        CHECK_FALSE(parsed.sampledValue[1].isNumeric());
+
+        // Values which would not be formatted back identically are kept as strings
+        rapidjson::Document non_canonical;
+        non_canonical.Parse(R"({"timestamp":"2023-11-14T22:13:20Z","sampledValue":[{"value":"007.50"},{"value":"+5"}]})");
+        parsed.sampledValue.clear();
+        CHECK(meter_value_conv.fromJson(non_canonical, parsed, error_code, error_message));
+        REQUIRE_EQ(parsed.sampledValue.size(), 2u);
+        CHECK_EQ(parsed.sampledValue[0].value, "007.50");
+        CHECK_FALSE(parsed.sampledValue[0].isNumeric());
+        CHECK_EQ(parsed.sampledValue[1].value, "+5");
+        CHECK_FALSE(parsed.sampledValue[1].isNumeric());
+    }
+
     TEST_CASE("Cleanup")
     {
         CHECK(database.close());
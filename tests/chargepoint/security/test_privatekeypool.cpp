@@ -0,0 +1,85 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "PrivateKeyPool.h"
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest_wrapper.h"
+
+#include <thread>
+
+using namespace ocpp::chargepoint;
+using namespace ocpp::x509;
+
+/** @brief Wait for the pool to have a given number of ready keys */
+static bool waitAvailable(const PrivateKeyPool& pool, size_t count)
+{
+    for (unsigned int i = 0; (i < 100u) && (pool.available() != count); i++)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+    return (pool.available() == count);
+}
+
+TEST_SUITE("Private key pool")
+{
+    TEST_CASE("Disabled pool")
+    {
+        PrivateKeyPool pool;
+        CHECK_EQ(pool.available(), 0u);
+
+        auto key = pool.get(PrivateKey::Type::EC, PrivateKey::Curve::PRIME256_V1, "");
+        REQUIRE(key);
+        CHECK(key->isValid());
+        CHECK_EQ(pool.available(), 0u);
+    }
+
+    TEST_CASE("Keys generated in advance")
+    {
+        PrivateKeyPool pool;
+        pool.configure(2u, PrivateKey::Type::EC, PrivateKey::Curve::PRIME256_V1, "");
+        CHECK(waitAvailable(pool, 2u));
+
+        // Ready keys are used only once and replaced in background
+        auto key1 = pool.get(PrivateKey::Type::EC, PrivateKey::Curve::PRIME256_V1, "");
+        auto key2 = pool.get(PrivateKey::Type::EC, PrivateKey::Curve::PRIME256_V1, "");
+        REQUIRE(key1);
+        REQUIRE(key2);
+        CHECK(key1->isValid());
+        CHECK(key2->isValid());
+        CHECK_NE(key1->privatePem(), key2->privatePem());
+        CHECK(waitAvailable(pool, 2u));
+
+        // Other parameters : generated on demand
+        auto key3 = pool.get(PrivateKey::Type::EC, PrivateKey::Curve::SECP384_R1, "");
+        REQUIRE(key3);
+        CHECK(key3->isValid());
+        CHECK_EQ(pool.available(), 2u);
+
+        // New configuration : previous keys are discarded
+        pool.configure(1u, PrivateKey::Type::EC, PrivateKey::Curve::SECP384_R1, "secret");
+        CHECK(waitAvailable(pool, 1u));
+        auto key4 = pool.get(PrivateKey::Type::EC, PrivateKey::Curve::SECP384_R1, "secret");
+        REQUIRE(key4);
+        CHECK(key4->isValid());
+        CHECK_NE(key4->privatePem().find("ENCRYPTED"), std::string::npos);
+
+        // Disable the pool
+        pool.configure(0u, PrivateKey::Type::EC, PrivateKey::Curve::SECP384_R1, "secret");
+        CHECK_EQ(pool.available(), 0u);
+    }
+}
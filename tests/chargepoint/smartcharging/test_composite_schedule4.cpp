@@ -0,0 +1,264 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "ChargePointConfigStub.h"
+#include "ChargePointEventsHandlerStub.h"
+#include "Connectors.h"
+#include "Database.h"
+#include "GenericMessageSender.h"
+#include "MessageDispatcherStub.h"
+#include "MessagesConverter.h"
+#include "MessagesValidator.h"
+#include "OcppConfigStub.h"
+#include "RpcStub.h"
+#include "SmartChargingManager.h"
+#include "TestableTimerPool.h"
+#include "TestableWorkerThreadPool.h"
+#include "doctest_wrapper.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <numeric>
+#include <random>
+
+using namespace ocpp::chargepoint;
+using namespace ocpp::config;
+using namespace ocpp::database;
+using namespace ocpp::messages;
+using namespace ocpp::types;
+using namespace ocpp::rpc;
+using namespace ocpp::helpers;
+
+static constexpr const char* DATABASE_PATH = "/tmp/test.db";
+
+Database                     database;
+OcppConfigStub               ocpp_config;
+ChargePointConfigStub        stack_config;
+ChargePointEventsHandlerStub event_handler;
+TestableWorkerThreadPool     worker_pool;
+RpcStub                      rpc;
+MessagesValidator            msgs_validator;
+MessagesConverter            msgs_converter;
+MessageDispatcherStub        msg_dispatcher;
+GenericMessageSender         msg_sender(rpc, msgs_converter, msgs_validator, std::chrono::milliseconds(1000));
+TestableTimerPool            timer_pool;
+Connectors                   connectors(ocpp_config, database, timer_pool);
+
+/** @brief Expected composite schedule period */
+struct ExpectedPeriod
+{
+    int          start;
+    float        limit;
+    unsigned int phases;
+};
+
+TEST_SUITE("Get composite schedule - randomized profiles")
+{
+    TEST_CASE("Setup")
+    {
+        std::filesystem::remove(DATABASE_PATH);
+        CHECK(database.open(DATABASE_PATH));
+
+        stack_config.setConfigValue("OperatingVoltage", "230");
+        ocpp_config.setConfigValue("NumberOfConnectors", "2");
+        ocpp_config.setConfigValue("ChargingScheduleMaxPeriods", "10");
+        ocpp_config.setConfigValue("ChargeProfileMaxStackLevel", "10");
+        ocpp_config.setConfigValue("MaxChargingProfilesInstalled", "10");
+        ocpp_config.setConfigValue("ChargingScheduleAllowedChargingRateUnit", "Current,Power");
+
+        connectors.initDatabaseTable();
+    }
+
+    void clearAllProfiles(SmartChargingManager & smartcharging_mgr)
+    {
+        ClearChargingProfileReq  clearprofiles_req;
+        ClearChargingProfileConf clearprofiles_conf;
+        std::string              error_code;
+        std::string              error_message;
+        smartcharging_mgr.handleMessage(clearprofiles_req, clearprofiles_conf, error_code, error_message);
+    }
+
+    bool installProfile(unsigned int connector_id, const ChargingProfile& profile, SmartChargingManager& smartcharging_mgr)
+    {
+        SetChargingProfileReq setprofile_req;
+        setprofile_req.connectorId        = connector_id;
+        setprofile_req.csChargingProfiles = profile;
+        SetChargingProfileConf setprofile_conf;
+        setprofile_conf.status = ChargingProfileStatus::Rejected;
+        std::string error_code;
+        std::string error_message;
+        smartcharging_mgr.handleMessage(setprofile_req, setprofile_conf, error_code, error_message);
+        return (setprofile_conf.status == ChargingProfileStatus::Accepted);
+    }
+
+    /** @brief Compute the expected composite schedule by evaluating the profiles on each second */
+    bool expectedSchedule(const std::vector<ChargingProfile>& profiles,
+                          time_t                              schedule_start,
+                          int                                 duration,
+                          std::vector<ExpectedPeriod>&        periods,
+                          int&                                offset,
+                          int&                                covered)
+    {
+        bool hole = false;
+        periods.clear();
+        offset  = -1;
+        covered = 0;
+        for (int t = 0; t < duration; t++)
+        {
+            // Highest stack level first
+            time_t                        time_point = schedule_start + t;
+            const ChargingSchedulePeriod* active     = nullptr;
+            for (const auto& profile : profiles)
+            {
+                const ChargingSchedule& schedule = profile.chargingSchedule;
+                time_t                  start    = schedule.startSchedule.value().timestamp();
+                if ((start <= time_point) && (!schedule.duration.isSet() || (time_point < (start + schedule.duration.value()))))
+                {
+                    for (const auto& period : schedule.chargingSchedulePeriod)
+                    {
+                        if ((start + period.startPeriod) <= time_point)
+                        {
+                            active = &period;
+                        }
+                    }
+                    break;
+                }
+            }
+
+            if (active)
+            {
+                if (offset < 0)
+                {
+                    offset = t;
+                }
+                else if ((offset + covered) != t)
+                {
+                    hole = true;
+                }
+                if (periods.empty() || (periods.back().limit != active->limit) ||
+                    (periods.back().phases != active->numberPhases.value()))
+                {
+                    periods.push_back({t - offset, active->limit, active->numberPhases.value()});
+                }
+                covered++;
+            }
+        }
+        return !periods.empty() && !hole;
+    }
+
+    TEST_CASE("Sweep line merge against per second evaluation")
+    {
+        SmartChargingManager smartcharging_mgr(
+            stack_config, ocpp_config, database, event_handler, timer_pool, worker_pool, connectors, msgs_converter, msg_dispatcher);
+
+        static constexpr int DURATION       = 3600;
+        static const float   LIMITS[]       = {6.f, 8.f, 10.f, 16.f, 20.f, 32.f};
+        unsigned int         accepted_count = 0;
+        std::mt19937         random(0x0CB9u);
+        for (unsigned int iteration = 0; iteration < 200u; iteration++)
+        {
+            clearAllProfiles(smartcharging_mgr);
+
+            // Generate random absolute profiles with distinct stack levels
+            DateTime                  now = DateTime::now();
+            std::vector<unsigned int> stack_levels(10u);
+            std::iota(stack_levels.begin(), stack_levels.end(), 1u);
+            std::shuffle(stack_levels.begin(), stack_levels.end(), random);
+            std::vector<ChargingProfile> profiles(1u + random() % 4u);
+            for (size_t i = 0; i < profiles.size(); i++)
+            {
+                ChargingProfile& profile       = profiles[i];
+                profile.chargingProfileId      = static_cast<int>(i + 1u);
+                profile.stackLevel             = stack_levels[i];
+                profile.chargingProfilePurpose = ChargingProfilePurposeType::TxDefaultProfile;
+                profile.chargingProfileKind    = ChargingProfileKindType::Absolute;
+
+                int start_offset = static_cast<int>(random() % 4000u) - 1000;
+                int start_period = 0;
+                for (unsigned int j = 0; j <= (random() % 4u); j++)
+                {
+                    ChargingSchedulePeriod charging_period;
+                    charging_period.startPeriod  = start_period;
+                    charging_period.limit        = LIMITS[random() % 6u];
+                    charging_period.numberPhases = 1u + random() % 3u;
+                    profile.chargingSchedule.chargingSchedulePeriod.push_back(charging_period);
+                    start_period += 50 + static_cast<int>(random() % 800u);
+                }
+                profile.chargingSchedule.chargingRateUnit = ChargingRateUnitType::A;
+                profile.chargingSchedule.startSchedule    = DateTime(now.timestamp() + start_offset);
+                if ((random() % 2u) != 0)
+                {
+                    // Profile must not be expired
+                    int min_duration                   = std::max(10, 10 - start_offset);
+                    profile.chargingSchedule.duration = min_duration + static_cast<int>(random() % 2000u);
+                }
+                CHECK(installProfile(1, profile, smartcharging_mgr));
+            }
+            std::sort(profiles.begin(),
+                      profiles.end(),
+                      [](const ChargingProfile& lhs, const ChargingProfile& rhs) { return (lhs.stackLevel > rhs.stackLevel); });
+
+            // Compute composite schedule
+            GetCompositeScheduleReq getcomposite_req;
+            getcomposite_req.connectorId      = 1;
+            getcomposite_req.duration         = DURATION;
+            getcomposite_req.chargingRateUnit = ChargingRateUnitType::A;
+            GetCompositeScheduleConf getcomposite_conf;
+            std::string              error_code;
+            std::string              error_message;
+            smartcharging_mgr.handleMessage(getcomposite_req, getcomposite_conf, error_code, error_message);
+
+            // Compare with the expected schedule
+            time_t schedule_start = now.timestamp();
+            if (getcomposite_conf.scheduleStart.isSet())
+            {
+                schedule_start = getcomposite_conf.scheduleStart.value().timestamp();
+            }
+            std::vector<ExpectedPeriod> expected_periods;
+            int                         expected_offset  = 0;
+            int                         expected_covered = 0;
+            bool expected = expectedSchedule(profiles, schedule_start, DURATION, expected_periods, expected_offset, expected_covered);
+            CHECK_EQ(getcomposite_conf.status == GetCompositeScheduleStatus::Accepted, expected);
+            if (expected && (getcomposite_conf.status == GetCompositeScheduleStatus::Accepted))
+            {
+                accepted_count++;
+
+                const ChargingSchedule& schedule = getcomposite_conf.chargingSchedule;
+                CHECK_EQ(schedule.startSchedule.value().timestamp(), schedule_start + expected_offset);
+                CHECK_EQ(schedule.duration.value(), expected_covered);
+                REQUIRE_EQ(schedule.chargingSchedulePeriod.size(), expected_periods.size());
+                for (size_t i = 0; i < expected_periods.size(); i++)
+                {
+                    CHECK_EQ(schedule.chargingSchedulePeriod[i].startPeriod, expected_periods[i].start);
+                    CHECK_EQ(schedule.chargingSchedulePeriod[i].limit, expected_periods[i].limit);
+                    CHECK_EQ(schedule.chargingSchedulePeriod[i].numberPhases.value(), expected_periods[i].phases);
+                }
+            }
+        }
+
+        // Most of the generated profiles sets must lead to a valid schedule
+        CHECK_GT(accepted_count, 100u);
+    }
+
+    TEST_CASE("Cleanup")
+    {
+        CHECK(database.close());
+        std::filesystem::remove(DATABASE_PATH);
+    }
+}
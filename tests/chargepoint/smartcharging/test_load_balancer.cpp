@@ -0,0 +1,185 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "LoadBalancer.h"
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest_wrapper.h"
+
+using namespace ocpp::chargepoint;
+using namespace ocpp::types;
+
+/** @brief Build the state of a connector */
+static LoadBalancer::ConnectorState connectorState(bool active, float consumption, float min_current, float max_current, time_t priority)
+{
+    LoadBalancer::ConnectorState state;
+    state.active      = active;
+    state.consumption = consumption;
+    state.min_current = min_current;
+    state.max_current = max_current;
+    state.priority    = priority;
+    return state;
+}
+
+TEST_SUITE("Load balancer")
+{
+    TEST_CASE("Policy names")
+    {
+        CHECK_EQ(LoadBalancer::parsePolicy("none"), LoadBalancingPolicy::None);
+        CHECK_EQ(LoadBalancer::parsePolicy("proportional"), LoadBalancingPolicy::Proportional);
+        CHECK_EQ(LoadBalancer::parsePolicy("priority"), LoadBalancingPolicy::Priority);
+        CHECK_EQ(LoadBalancer::parsePolicy("minrate"), LoadBalancingPolicy::MinRate);
+        CHECK_EQ(LoadBalancer::parsePolicy("unknown"), LoadBalancingPolicy::None);
+    }
+
+    TEST_CASE("No policy")
+    {
+        LoadBalancer balancer;
+        std::vector<LoadBalancer::ConnectorState> connectors(3u);
+        connectors[1] = connectorState(true, 10.f, 0.f, 32.f, 1);
+        connectors[2] = connectorState(true, 10.f, 0.f, 32.f, 2);
+
+        CHECK(balancer.update(32.f, connectors));
+        REQUIRE_EQ(balancer.allocations().size(), 3u);
+        CHECK_FALSE(balancer.allocations()[1].isSet());
+        CHECK_FALSE(balancer.allocations()[2].isSet());
+    }
+
+    TEST_CASE("Proportional policy")
+    {
+        LoadBalancer balancer;
+        balancer.setPolicy(LoadBalancingPolicy::Proportional);
+
+        std::vector<LoadBalancer::ConnectorState> connectors(4u);
+        connectors[1] = connectorState(true, 10.f, 0.f, 32.f, 1);
+        connectors[2] = connectorState(true, 30.f, 0.f, 32.f, 2);
+        connectors[3] = connectorState(false, 0.f, 0.f, 32.f, 0);
+
+        // Proportional to the consumption
+        CHECK(balancer.update(32.f, connectors));
+        const std::vector<Optional<float>>& allocations = balancer.allocations();
+        REQUIRE_EQ(allocations.size(), 4u);
+        CHECK_FALSE(allocations[0].isSet());
+        CHECK_EQ(allocations[1].value(), doctest::Approx(8.f));
+        CHECK_EQ(allocations[2].value(), doctest::Approx(24.f));
+        CHECK_FALSE(allocations[3].isSet());
+
+        // Same inputs, nothing to compute
+        CHECK_FALSE(balancer.update(32.f, connectors));
+
+        // Saturated connector
+        connectors[2].max_current = 16.f;
+        CHECK(balancer.update(32.f, connectors));
+        CHECK_EQ(balancer.allocations()[1].value(), doctest::Approx(16.f));
+        CHECK_EQ(balancer.allocations()[2].value(), doctest::Approx(16.f));
+
+        // No consumption, equal sharing
+        connectors[1].consumption = 0.f;
+        connectors[2].consumption = 0.f;
+        connectors[2].max_current = 32.f;
+        connectors[3]             = connectorState(true, 0.f, 0.f, 32.f, 3);
+        CHECK(balancer.update(30.f, connectors));
+        CHECK_EQ(balancer.allocations()[1].value(), doctest::Approx(10.f));
+        CHECK_EQ(balancer.allocations()[2].value(), doctest::Approx(10.f));
+        CHECK_EQ(balancer.allocations()[3].value(), doctest::Approx(10.f));
+
+        // Reset
+        balancer.clear();
+        CHECK(balancer.allocations().empty());
+    }
+
+    TEST_CASE("Proportional policy - newly plugged connector")
+    {
+        LoadBalancer balancer;
+        balancer.setPolicy(LoadBalancingPolicy::Proportional);
+
+        std::vector<LoadBalancer::ConnectorState> connectors(3u);
+        connectors[1] = connectorState(true, 32.f, 0.f, 32.f, 1);
+
+        // Busy connector alone
+        CHECK(balancer.update(32.f, connectors));
+        CHECK_EQ(balancer.allocations()[1].value(), doctest::Approx(32.f));
+
+        // New connector without consumption nor minimum charging rate gets a starting share
+        connectors[2] = connectorState(true, 0.f, 0.f, 32.f, 2);
+        CHECK(balancer.update(32.f, connectors));
+        CHECK_GT(balancer.allocations()[2].value(), 0.f);
+        CHECK_EQ(balancer.allocations()[1].value(), doctest::Approx(32.f * 32.f / 48.f));
+        CHECK_EQ(balancer.allocations()[2].value(), doctest::Approx(32.f * 16.f / 48.f));
+        CHECK_EQ(balancer.allocations()[1].value() + balancer.allocations()[2].value(), doctest::Approx(32.f));
+
+        // Minimum charging rate greater than the starting share
+        connectors[2].min_current = 24.f;
+        CHECK(balancer.update(32.f, connectors));
+        CHECK_EQ(balancer.allocations()[2].value(), doctest::Approx(32.f * 24.f / 56.f));
+
+        // Once consuming, the connector is weighted with its consumption
+        connectors[1].consumption = 21.f;
+        connectors[2].consumption = 11.f;
+        connectors[2].min_current = 0.f;
+        CHECK(balancer.update(32.f, connectors));
+        CHECK_EQ(balancer.allocations()[1].value(), doctest::Approx(21.f));
+        CHECK_EQ(balancer.allocations()[2].value(), doctest::Approx(11.f));
+    }
+
+    TEST_CASE("Priority policy")
+    {
+        LoadBalancer balancer;
+        balancer.setPolicy(LoadBalancingPolicy::Priority);
+
+        std::vector<LoadBalancer::ConnectorState> connectors(4u);
+        connectors[1] = connectorState(true, 0.f, 0.f, 16.f, 30);
+        connectors[2] = connectorState(true, 0.f, 0.f, 32.f, 10);
+        connectors[3] = connectorState(true, 0.f, 0.f, 32.f, 20);
+
+        // First started transactions are served first
+        CHECK(balancer.update(40.f, connectors));
+        CHECK_EQ(balancer.allocations()[2].value(), doctest::Approx(32.f));
+        CHECK_EQ(balancer.allocations()[3].value(), doctest::Approx(8.f));
+        CHECK_EQ(balancer.allocations()[1].value(), doctest::Approx(0.f));
+
+        // End of a transaction
+        connectors[2].active = false;
+        CHECK(balancer.update(40.f, connectors));
+        CHECK_FALSE(balancer.allocations()[2].isSet());
+        CHECK_EQ(balancer.allocations()[3].value(), doctest::Approx(32.f));
+        CHECK_EQ(balancer.allocations()[1].value(), doctest::Approx(8.f));
+    }
+
+    TEST_CASE("Minimum rate policy")
+    {
+        LoadBalancer balancer;
+        balancer.setPolicy(LoadBalancingPolicy::MinRate);
+
+        std::vector<LoadBalancer::ConnectorState> connectors(4u);
+        connectors[1] = connectorState(true, 0.f, 6.f, 32.f, 1);
+        connectors[2] = connectorState(true, 0.f, 10.f, 32.f, 2);
+        connectors[3] = connectorState(true, 0.f, 6.f, 32.f, 3);
+
+        // Minimum rates and equal sharing of the remaining current
+        CHECK(balancer.update(31.f, connectors));
+        CHECK_EQ(balancer.allocations()[1].value(), doctest::Approx(9.f));
+        CHECK_EQ(balancer.allocations()[2].value(), doctest::Approx(13.f));
+        CHECK_EQ(balancer.allocations()[3].value(), doctest::Approx(9.f));
+
+        // Not enough current for the last connector
+        CHECK(balancer.update(20.f, connectors));
+        CHECK_EQ(balancer.allocations()[1].value(), doctest::Approx(8.f));
+        CHECK_EQ(balancer.allocations()[2].value(), doctest::Approx(12.f));
+        CHECK_EQ(balancer.allocations()[3].value(), doctest::Approx(0.f));
+    }
+}
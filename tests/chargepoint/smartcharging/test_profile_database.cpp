@@ -237,6 +237,129 @@ TEST_SUITE("Profile database")
         CHECK_EQ(profile_db.chargePointMaxProfiles().size(), 0u);
     }
 
+    TEST_CASE("Profile clearing and persistency")
+    {
+        OcppConfigStub ocpp_config;
+
+        ocpp_config.setConfigValue("MaxChargingProfilesInstalled", "10");
+
+        std::vector<ChargingProfile> profiles(6u);
+        for (size_t i = 0; i < profiles.size(); i++)
+        {
+            profiles[i].chargingProfileId                 = static_cast<int>(i);
+            profiles[i].stackLevel                        = static_cast<unsigned int>(i % 3u);
+            profiles[i].chargingProfileKind               = ChargingProfileKindType::Absolute;
+            profiles[i].chargingProfilePurpose            = ChargingProfilePurposeType::TxDefaultProfile;
+            profiles[i].chargingSchedule.chargingRateUnit = ChargingRateUnitType::A;
+        }
+
+        {
+            ProfileDatabase profile_db(ocpp_config, database);
+            for (size_t i = 0; i < profiles.size(); i++)
+            {
+                CHECK(profile_db.install(static_cast<unsigned int>(i / 3u), profiles[i]));
+            }
+            CHECK_EQ(profile_db.txDefaultProfiles().size(), 6u);
+
+            // Same id replaces the existing profile
+            profiles[5].stackLevel = 8u;
+            CHECK(profile_db.install(1u, profiles[5]));
+            CHECK_EQ(profile_db.txDefaultProfiles().size(), 6u);
+            CHECK_EQ(profile_db.txDefaultProfiles().cbegin()->second.chargingProfileId, 5);
+
+            // Clear by stack level on all the connectors
+            CHECK(profile_db.clear(Optional<int>(), Optional<unsigned int>(), Optional<ChargingProfilePurposeType>(), 1u));
+            CHECK_EQ(profile_db.txDefaultProfiles().size(), 4u);
+            CHECK_FALSE(profile_db.clear(Optional<int>(), Optional<unsigned int>(), Optional<ChargingProfilePurposeType>(), 1u));
+
+            // Clear by connector and purpose
+            CHECK_FALSE(profile_db.clear(Optional<int>(), 0u, ChargingProfilePurposeType::TxProfile));
+            CHECK(profile_db.clear(Optional<int>(), 0u, ChargingProfilePurposeType::TxDefaultProfile));
+            CHECK_EQ(profile_db.txDefaultProfiles().size(), 2u);
+        }
+
+        // Reload from the database
+        {
+            ProfileDatabase profile_db(ocpp_config, database);
+            REQUIRE_EQ(profile_db.txDefaultProfiles().size(), 2u);
+
+            auto iter = profile_db.txDefaultProfiles().cbegin();
+            CHECK_EQ(iter->first, 1u);
+            CHECK_EQ(iter->second.chargingProfileId, 5);
+            CHECK_EQ(iter->second.stackLevel, 8u);
+            ++iter;
+            CHECK_EQ(iter->first, 1u);
+            CHECK_EQ(iter->second.chargingProfileId, 3);
+            CHECK_EQ(iter->second.stackLevel, 0u);
+
+            // Clear by id
+            CHECK(profile_db.clear(3));
+            CHECK_FALSE(profile_db.clear(3));
+            CHECK(profile_db.clear(Optional<int>()));
+            CHECK(profile_db.txDefaultProfiles().empty());
+        }
+    }
+
+    TEST_CASE("Profile clearing without stack level")
+    {
+        OcppConfigStub ocpp_config;
+
+        ocpp_config.setConfigValue("MaxChargingProfilesInstalled", "10");
+
+        std::vector<ChargingProfile> profiles(6u);
+        for (size_t i = 0; i < profiles.size(); i++)
+        {
+            profiles[i].chargingProfileId                 = static_cast<int>(i);
+            profiles[i].stackLevel                        = static_cast<unsigned int>(i % 3u) * 2u;
+            profiles[i].chargingProfileKind               = ChargingProfileKindType::Absolute;
+            profiles[i].chargingProfilePurpose            = ChargingProfilePurposeType::TxDefaultProfile;
+            profiles[i].chargingSchedule.chargingRateUnit = ChargingRateUnitType::A;
+        }
+        profiles[0].chargingProfilePurpose = ChargingProfilePurposeType::ChargePointMaxProfile;
+        profiles[1].chargingProfilePurpose = ChargingProfilePurposeType::ChargePointMaxProfile;
+
+        {
+            ProfileDatabase profile_db(ocpp_config, database);
+            CHECK(profile_db.install(0u, profiles[0]));
+            CHECK(profile_db.install(0u, profiles[1]));
+            CHECK(profile_db.install(0u, profiles[2]));
+            CHECK(profile_db.install(1u, profiles[3]));
+            CHECK(profile_db.install(1u, profiles[4]));
+            CHECK(profile_db.install(2u, profiles[5]));
+            CHECK_EQ(profile_db.chargePointMaxProfiles().size(), 2u);
+            CHECK_EQ(profile_db.txDefaultProfiles().size(), 4u);
+
+            // Clear by purpose only : all the stack levels and all the connectors
+            CHECK(profile_db.clear(Optional<int>(), Optional<unsigned int>(), ChargingProfilePurposeType::TxDefaultProfile));
+            CHECK(profile_db.txDefaultProfiles().empty());
+            CHECK_EQ(profile_db.chargePointMaxProfiles().size(), 2u);
+            CHECK_FALSE(profile_db.clear(Optional<int>(), Optional<unsigned int>(), ChargingProfilePurposeType::TxDefaultProfile));
+        }
+
+        // Reload from the database
+        {
+            ProfileDatabase profile_db(ocpp_config, database);
+            CHECK(profile_db.txDefaultProfiles().empty());
+            CHECK_EQ(profile_db.chargePointMaxProfiles().size(), 2u);
+
+            // Clear without any criteria : all the profiles
+            CHECK(profile_db.install(1u, profiles[4]));
+            CHECK(profile_db.install(2u, profiles[5]));
+            CHECK(profile_db.clear(Optional<int>()));
+            CHECK(profile_db.chargePointMaxProfiles().empty());
+            CHECK(profile_db.txDefaultProfiles().empty());
+            CHECK(profile_db.txProfiles().empty());
+            CHECK_FALSE(profile_db.clear(Optional<int>()));
+        }
+
+        // Reload from the database
+        {
+            ProfileDatabase profile_db(ocpp_config, database);
+            CHECK(profile_db.chargePointMaxProfiles().empty());
+            CHECK(profile_db.txDefaultProfiles().empty());
+        }
+    }
+
     TEST_CASE("Cleanup")
     {
         CHECK(database.close());
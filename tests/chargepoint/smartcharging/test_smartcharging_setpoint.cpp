@@ -929,6 +929,190 @@ TEST_SUITE("Get composite schedule - multiple OCPP profiles")
         CHECK_EQ(connector_setpoint.value().min_charging_rate.value(), 10.f);
     }
 
+    TEST_CASE("Next setpoint change")
+    {
+        SmartChargingManager smartcharging_mgr(
+            stack_config, ocpp_config, database, event_handler, timer_pool, worker_pool, connectors, msgs_converter, msg_dispatcher);
+        clearAllProfiles(smartcharging_mgr);
+
+        Connector* connector         = connectors.getConnector(1);
+        connector->transaction_id    = 0;
+        connector->transaction_start = 0;
+
+        DateTime now = DateTime::now();
+
+        ChargingProfile profile1;
+        profile1.chargingProfileId      = 1;
+        profile1.stackLevel             = 5;
+        profile1.chargingProfilePurpose = ChargingProfilePurposeType::TxDefaultProfile;
+        profile1.chargingProfileKind    = ChargingProfileKindType::Relative;
+
+        ChargingSchedulePeriod charging_period;
+        charging_period.limit        = 5.f;
+        charging_period.startPeriod  = 0;
+        charging_period.numberPhases = 1;
+        profile1.chargingSchedule.chargingSchedulePeriod.push_back(charging_period);
+        charging_period.limit        = 13.f;
+        charging_period.startPeriod  = 50;
+        charging_period.numberPhases = 2;
+        profile1.chargingSchedule.chargingSchedulePeriod.push_back(charging_period);
+        charging_period.limit        = 25.f;
+        charging_period.startPeriod  = 200;
+        charging_period.numberPhases = 3;
+        profile1.chargingSchedule.chargingSchedulePeriod.push_back(charging_period);
+        profile1.chargingSchedule.chargingRateUnit = ChargingRateUnitType::A;
+        CHECK(installProfile(1, profile1, smartcharging_mgr));
+
+        ChargingProfile profile2;
+        profile2.chargingProfileId      = 2;
+        profile2.stackLevel             = 4;
+        profile2.chargingProfilePurpose = ChargingProfilePurposeType::ChargePointMaxProfile;
+        profile2.chargingProfileKind    = ChargingProfileKindType::Absolute;
+
+        charging_period.limit        = 20.f;
+        charging_period.startPeriod  = 0;
+        charging_period.numberPhases = 3;
+        profile2.chargingSchedule.chargingSchedulePeriod.push_back(charging_period);
+        profile2.chargingSchedule.chargingRateUnit = ChargingRateUnitType::A;
+        profile2.chargingSchedule.startSchedule    = DateTime(now.timestamp() - 100);
+        profile2.chargingSchedule.duration         = 1000;
+        CHECK(installProfile(0, profile2, smartcharging_mgr));
+
+        // No transaction : first period of the relative profile until the end of the absolute profile
+        ocpp::types::Optional<ocpp::types::SmartChargingSetpoint> charge_point_setpoint;
+        ocpp::types::Optional<ocpp::types::SmartChargingSetpoint> connector_setpoint;
+        DateTime                                                  next_change;
+        CHECK(smartcharging_mgr.getSetpoint(1u, charge_point_setpoint, connector_setpoint, next_change, ChargingRateUnitType::A));
+        CHECK(charge_point_setpoint.isSet());
+        CHECK_EQ(charge_point_setpoint.value().value, 20.f);
+        CHECK(connector_setpoint.isSet());
+        CHECK_EQ(connector_setpoint.value().value, 5.f);
+        CHECK_EQ(next_change.timestamp(), now.timestamp() + 901);
+
+        // Transaction in progress : the relative profile starts with the transaction
+        connector->transaction_id    = 1;
+        connector->transaction_start = DateTime(now.timestamp() - 100);
+        CHECK(smartcharging_mgr.getSetpoint(1u, charge_point_setpoint, connector_setpoint, next_change, ChargingRateUnitType::A));
+        CHECK(connector_setpoint.isSet());
+        CHECK_EQ(connector_setpoint.value().value, 13.f);
+        CHECK_EQ(connector_setpoint.value().number_phases, 2);
+        CHECK_EQ(next_change.timestamp(), now.timestamp() + 100);
+
+        // Profile cleared
+        clearAllProfiles(smartcharging_mgr);
+        CHECK(smartcharging_mgr.getSetpoint(1u, charge_point_setpoint, connector_setpoint, next_change, ChargingRateUnitType::A));
+        CHECK_FALSE(charge_point_setpoint.isSet());
+        CHECK_FALSE(connector_setpoint.isSet());
+        CHECK_GE(next_change.timestamp(), now.timestamp() + 86400);
+
+        connector->transaction_id    = 0;
+        connector->transaction_start = 0;
+    }
+
+    TEST_CASE("Setpoint change notification")
+    {
+        SmartChargingManager smartcharging_mgr(
+            stack_config, ocpp_config, database, event_handler, timer_pool, worker_pool, connectors, msgs_converter, msg_dispatcher);
+        clearAllProfiles(smartcharging_mgr);
+        event_handler.clearCalls();
+
+        DateTime now = DateTime::now();
+
+        ChargingProfile profile1;
+        profile1.chargingProfileId      = 1;
+        profile1.stackLevel             = 5;
+        profile1.chargingProfilePurpose = ChargingProfilePurposeType::TxDefaultProfile;
+        profile1.chargingProfileKind    = ChargingProfileKindType::Absolute;
+
+        ChargingSchedulePeriod charging_period;
+        charging_period.limit        = 16.f;
+        charging_period.startPeriod  = 0;
+        charging_period.numberPhases = 3;
+        profile1.chargingSchedule.chargingSchedulePeriod.push_back(charging_period);
+        charging_period.limit       = 32.f;
+        charging_period.startPeriod = 300;
+        profile1.chargingSchedule.chargingSchedulePeriod.push_back(charging_period);
+        profile1.chargingSchedule.chargingRateUnit = ChargingRateUnitType::A;
+        profile1.chargingSchedule.startSchedule    = DateTime(now.timestamp() - 100);
+        profile1.chargingSchedule.duration         = 1000;
+
+        // Installation triggers a notification
+        std::map<std::string, std::string> params;
+        CHECK(installProfile(2, profile1, smartcharging_mgr));
+        CHECK(event_handler.methodCalled("setpointChanged", params));
+        CHECK_EQ(params["connector_id"], "2");
+        CHECK_EQ(params["charge_point_setpoint"], "not set");
+        CHECK_EQ(params["connector_setpoint"], std::to_string(16.f));
+
+        // Notification timer scheduled on the next period boundary
+        Timer* notify_timer = timer_pool.getTimer("Setpoint notification");
+        REQUIRE(notify_timer);
+        CHECK(notify_timer->isStarted());
+        CHECK(notify_timer->isSingleShot());
+        CHECK_LE(notify_timer->getInterval(), std::chrono::seconds(200));
+
+        // No notification if the setpoints have not changed
+        event_handler.clearCalls();
+        notify_timer->getCallback()();
+        CHECK_FALSE(event_handler.methodCalled("setpointChanged", params));
+
+        // Clearing the profile triggers a notification
+        clearAllProfiles(smartcharging_mgr);
+        CHECK(event_handler.methodCalled("setpointChanged", params));
+        CHECK_EQ(params["connector_id"], "2");
+        CHECK_EQ(params["connector_setpoint"], "not set");
+    }
+
+    TEST_CASE("Next setpoint change - daily recurrence at the end of the horizon")
+    {
+        SmartChargingManager smartcharging_mgr(
+            stack_config, ocpp_config, database, event_handler, timer_pool, worker_pool, connectors, msgs_converter, msg_dispatcher);
+        clearAllProfiles(smartcharging_mgr);
+
+        Connector* connector         = connectors.getConnector(1);
+        connector->transaction_id    = 0;
+        connector->transaction_start = 0;
+
+        DateTime now = DateTime::now();
+
+        // Today's recurrence is over, the next one starts just before the end of the horizon
+        ChargingProfile profile1;
+        profile1.chargingProfileId      = 1;
+        profile1.stackLevel             = 5;
+        profile1.chargingProfilePurpose = ChargingProfilePurposeType::TxDefaultProfile;
+        profile1.chargingProfileKind    = ChargingProfileKindType::Recurring;
+        profile1.recurrencyKind         = RecurrencyKindType::Daily;
+
+        ChargingSchedulePeriod charging_period;
+        charging_period.limit        = 16.f;
+        charging_period.startPeriod  = 0;
+        charging_period.numberPhases = 3;
+        profile1.chargingSchedule.chargingSchedulePeriod.push_back(charging_period);
+        profile1.chargingSchedule.chargingRateUnit = ChargingRateUnitType::A;
+        profile1.chargingSchedule.startSchedule    = DateTime(now.timestamp() - 60);
+        profile1.chargingSchedule.duration         = 30;
+        CHECK(installProfile(1, profile1, smartcharging_mgr));
+
+        ocpp::types::Optional<ocpp::types::SmartChargingSetpoint> charge_point_setpoint;
+        ocpp::types::Optional<ocpp::types::SmartChargingSetpoint> connector_setpoint;
+        DateTime                                                  next_change;
+        CHECK(smartcharging_mgr.getSetpoint(1u, charge_point_setpoint, connector_setpoint, next_change, ChargingRateUnitType::A));
+        CHECK_FALSE(charge_point_setpoint.isSet());
+        CHECK_FALSE(connector_setpoint.isSet());
+        CHECK_EQ(next_change.timestamp(), now.timestamp() - 60 + 86400);
+
+        // Next recurrence starts 1s before the end of the horizon
+        clearAllProfiles(smartcharging_mgr);
+        profile1.chargingSchedule.startSchedule = DateTime(now.timestamp() - 1);
+        profile1.chargingSchedule.duration      = 0;
+        CHECK(installProfile(1, profile1, smartcharging_mgr));
+        CHECK(smartcharging_mgr.getSetpoint(1u, charge_point_setpoint, connector_setpoint, next_change, ChargingRateUnitType::A));
+        CHECK_FALSE(connector_setpoint.isSet());
+        CHECK_EQ(next_change.timestamp(), now.timestamp() - 1 + 86400);
+
+        clearAllProfiles(smartcharging_mgr);
+    }
+
     TEST_CASE("Cleanup")
     {
         CHECK(database.close());
@@ -72,6 +72,16 @@ class CentralSystemConfig : public ICentralSystemConfig
     std::string tlsServerCertificateCa() const override { return ""; }
     /** @brief Enable client authentication using certificate */
     bool tlsClientCertificateAuthent() const override { return false; }
+    /** @brief Interval between 2 rotations of the keys protecting the TLS session tickets (0 = no rotation) */
+    std::chrono::seconds tlsTicketKeyRotationInterval() const override { return std::chrono::seconds(0); }
+    /** @brief Maximum number of messages waiting to be sent on the websocket connection (0 = no limit) */
+    unsigned int webSocketSendQueueMaxMessages() const override { return 0; }
+    /** @brief Maximum size in bytes of the messages waiting to be sent on the websocket connection (0 = no limit) */
+    unsigned int webSocketSendQueueMaxSize() const override { return 0; }
+    /** @brief Behavior when the websocket send queue is full : fail, block or disconnect */
+    std::string webSocketSendQueuePolicy() const override { return "fail"; }
+    /** @brief Maximum wait time for room in the websocket send queue when using the block policy */
+    std::chrono::milliseconds webSocketSendQueueBlockTimeout() const override { return std::chrono::milliseconds(0); }
 
     // Log
 
@@ -173,6 +183,16 @@ class ChargePointConfig : public IChargePointConfig
     /** @brief Skip server name check in certificates for TLS connections
      *         (Warning : enabling this feature is not recommended in production) */
     bool tlsSkipServerNameCheck() const override { return false; }
+    /** @brief Persist the TLS session in the database to resume it on the next connections */
+    bool tlsSessionResumption() const override { return false; }
+    /** @brief Maximum number of messages waiting to be sent on the websocket connection (0 = no limit) */
+    unsigned int webSocketSendQueueMaxMessages() const override { return 0; }
+    /** @brief Maximum size in bytes of the messages waiting to be sent on the websocket connection (0 = no limit) */
+    unsigned int webSocketSendQueueMaxSize() const override { return 0; }
+    /** @brief Behavior when the websocket send queue is full : fail, block or disconnect */
+    std::string webSocketSendQueuePolicy() const override { return "fail"; }
+    /** @brief Maximum wait time for room in the websocket send queue when using the block policy */
+    std::chrono::milliseconds webSocketSendQueueBlockTimeout() const override { return std::chrono::milliseconds(0); }
 
     // Charge point identification
 
@@ -210,6 +230,11 @@ class ChargePointConfig : public IChargePointConfig
     /** @brief Maximum number of entries in the log (0 = no logs in database) */
     unsigned int logMaxEntriesCount() const override { return 100u; }
 
+    // Maintenance
+
+    /** @brief Maximum bandwidth of the diagnostics, logs and firmware transfers in bytes per second (0 = no limit) */
+    unsigned int transferMaxBandwidth() const override { return 0; }
+
     // Security
 
     /** @brief Enable internal certificate management : the certificates will be managed by Open OCPP only */
@@ -218,6 +243,8 @@ class ChargePointConfig : public IChargePointConfig
     bool securityEventNotificationEnabled() const override { return true; }
     /** @brief Maximum number of entries in the security log (0 = no security logs in database) */
     unsigned int securityLogMaxEntriesCount() const override { return 100u; }
+    /** @brief Compression of the security log exports : none or gzip */
+    std::string securityLogExportCompression() const override { return "none"; }
     /** @brief Hash type for certificate request generation : sha256, sha384 or sha512 */
     std::string clientCertificateRequestHashType() const override { return ""; }
     /** @brief Key type for certificate request generation : ec or rsa */
@@ -229,6 +256,9 @@ class ChargePointConfig : public IChargePointConfig
      *         if ec has been selected for key type : prime256v1, secp256k1, secp384r1, secp521r1,
      *         brainpoolP256t1, brainpoolP384t1 or brainpoolP512t1 */
     std::string clientCertificateRequestEcCurve() const override { return ""; }
+    /** @brief Number of private keys generated in advance in background for certificate request generation
+     *         (0 = keys are generated on demand) */
+    unsigned int clientCertificateRequestKeyPoolSize() const override { return 0; }
     /** @brief Country for the subject field of certificate request generation (can be left empty) */
     std::string clientCertificateRequestSubjectCountry() const override { return ""; }
     /** @brief State for the subject field of certificate request generation (can be left empty) */
@@ -673,6 +703,34 @@ class ChargePointEventsHandler : public IChargePointEventsHandler
         return false;
     }
 
+    /**
+     * @brief Called when the smart charging setpoints of a connector have changed
+     * @param connector_id Id of the concerned connector
+     * @param charge_point_setpoint New setpoint of the whole charge point in A (not set if no active profile)
+     * @param connector_setpoint New setpoint of the connector in A (not set if no active profile)
+     */
+    void setpointChanged(unsigned int                                                     connector_id,
+                         const ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& charge_point_setpoint,
+                         const ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& connector_setpoint) override
+    {
+        (void)connector_id;
+        (void)charge_point_setpoint;
+        (void)connector_setpoint;
+    }
+
+    /**
+     * @brief Called to get the current consumption of a connector for the local load balancing
+     * @param connector_id Id of the concerned connector
+     * @param current Measured current in A
+     * @return true if the consumption has been measured, false otherwise
+     */
+    bool getConnectorConsumption(unsigned int connector_id, float& current) override
+    {
+        (void)connector_id;
+        (void)current;
+        return false;
+    }
+
     /**
      * @brief Called on a reset request from the Central System
      * @param reset_type Type of reset
@@ -0,0 +1,147 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "CentralSystemProxyStub.h"
+#include "ChargePointHandler.h"
+#include "LocalControllerConfigStub.h"
+#include "MessageDispatcher.h"
+#include "MessagesConverter.h"
+#include "MessagesValidator.h"
+#include "UserMessageHandler.h"
+#include "doctest_wrapper.h"
+
+using namespace ocpp::config;
+using namespace ocpp::localcontroller;
+using namespace ocpp::messages;
+using namespace ocpp::rpc;
+
+static constexpr const char* CHARGEPOINT_ID = "CP1";
+
+LocalControllerConfigStub stack_config;
+CentralSystemProxyStub    central_system;
+MessagesValidator         msgs_validator;
+MessagesConverter         msgs_converter;
+
+/** @brief Dispatch a request received from the Charge Point */
+static bool dispatch(MessageDispatcher& dispatcher, const std::string& action, const std::string& payload, std::string& error_code)
+{
+    rapidjson::Document request;
+    request.Parse(payload.c_str());
+    rapidjson::Document response;
+    std::string         error_message;
+    error_code.clear();
+    return dispatcher.dispatchMessage(action, request, response, error_code, error_message);
+}
+
+TEST_SUITE("Charge point handler - transparent forwarding")
+{
+    TEST_CASE("Setup")
+    {
+        CHECK(msgs_validator.load(SCHEMAS_DIR));
+
+        stack_config.setConfigValue("TransparentForwarding", "true");
+        stack_config.setConfigValue("TransparentForwardingValidation", "false");
+        central_system.setConnected(true);
+    }
+
+    TEST_CASE("Raw forwarding")
+    {
+        MessageDispatcher  dispatcher(msgs_validator);
+        ChargePointHandler handler(CHARGEPOINT_ID, msgs_converter, dispatcher, stack_config, central_system);
+
+        // Requests are forwarded without being decoded
+        std::string error_code;
+        CHECK(dispatch(dispatcher, "Authorize", R"({"idTag":"TAG1","vendorField":1})", error_code));
+        CHECK(dispatch(dispatcher, "Heartbeat", R"({})", error_code));
+        CHECK_FALSE(dispatch(dispatcher, "Heartbeat", R"([])", error_code));
+        CHECK_EQ(error_code, IRpc::RPC_ERROR_FORMATION_VIOLATION);
+
+        auto forwarded = central_system.forwarded();
+        REQUIRE_EQ(forwarded.size(), 2u);
+        CHECK_EQ(forwarded[0].action, "Authorize");
+        CHECK_EQ(forwarded[0].request, R"({"idTag":"TAG1","vendorField":1})");
+        CHECK_EQ(forwarded[1].action, "Heartbeat");
+
+        // Central System errors are sent back to the Charge Point
+        central_system.setError(IRpc::RPC_ERROR_NOT_SUPPORTED);
+        CHECK_FALSE(dispatch(dispatcher, "Heartbeat", R"({})", error_code));
+        CHECK_EQ(error_code, IRpc::RPC_ERROR_NOT_SUPPORTED);
+        central_system.setError("");
+
+        central_system.clearForwarded();
+    }
+
+    TEST_CASE("Raw forwarding with validation")
+    {
+        stack_config.setConfigValue("TransparentForwardingValidation", "true");
+
+        MessageDispatcher  dispatcher(msgs_validator);
+        ChargePointHandler handler(CHARGEPOINT_ID, msgs_converter, dispatcher, stack_config, central_system);
+
+        std::string error_code;
+        CHECK_FALSE(dispatch(dispatcher, "Authorize", R"({"idTag":"TAG1","vendorField":1})", error_code));
+        CHECK_EQ(error_code, IRpc::RPC_ERROR_TYPE_CONSTRAINT_VIOLATION);
+        CHECK(dispatch(dispatcher, "Authorize", R"({"idTag":"TAG1"})", error_code));
+
+        auto forwarded = central_system.forwarded();
+        REQUIRE_EQ(forwarded.size(), 1u);
+        CHECK_EQ(forwarded[0].request, R"({"idTag":"TAG1"})");
+
+        stack_config.setConfigValue("TransparentForwardingValidation", "false");
+        central_system.clearForwarded();
+    }
+
+    TEST_CASE("User handler overrides raw forwarding")
+    {
+        MessageDispatcher  dispatcher(msgs_validator);
+        ChargePointHandler handler(CHARGEPOINT_ID, msgs_converter, dispatcher, stack_config, central_system);
+
+        // Register a user handler as the Charge Point proxy does
+        unsigned int                                    user_calls = 0;
+        UserMessageHandler<AuthorizeReq, AuthorizeConf> user_handler(
+            "Authorize",
+            msgs_converter,
+            [&user_calls](const AuthorizeReq& request, AuthorizeConf& response, std::string&, std::string&)
+            {
+                user_calls++;
+                CHECK_EQ(request.idTag.str(), "TAG1");
+                response.idTagInfo.status = ocpp::types::AuthorizationStatus::Blocked;
+                return true;
+            });
+        CHECK(dispatcher.registerHandler("Authorize", user_handler, true));
+
+        rapidjson::Document request;
+        request.Parse(R"({"idTag":"TAG1"})");
+        rapidjson::Document response;
+        std::string         error_code;
+        std::string         error_message;
+        response.Parse("{}");
+        CHECK(dispatcher.dispatchMessage("Authorize", request, response, error_code, error_message));
+        CHECK_EQ(user_calls, 1u);
+        CHECK_EQ(std::string(response["idTagInfo"]["status"].GetString()), "Blocked");
+
+        // Other requests are still forwarded
+        CHECK(dispatch(dispatcher, "Heartbeat", R"({})", error_code));
+        auto forwarded = central_system.forwarded();
+        REQUIRE_EQ(forwarded.size(), 1u);
+        CHECK_EQ(forwarded[0].action, "Heartbeat");
+
+        central_system.clearForwarded();
+    }
+}
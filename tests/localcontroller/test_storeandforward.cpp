@@ -0,0 +1,339 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "CentralSystemProxyStub.h"
+#include "Database.h"
+#include "LocalControllerConfigStub.h"
+#include "StoreAndForwardManager.h"
+#include "TestableTimerPool.h"
+#include "TestableWorkerThreadPool.h"
+#include "Timer.h"
+#include "doctest_wrapper.h"
+
+#include <filesystem>
+
+using namespace ocpp::config;
+using namespace ocpp::database;
+using namespace ocpp::helpers;
+using namespace ocpp::localcontroller;
+
+static constexpr const char* DATABASE_PATH   = "/tmp/test_storeandforward.db";
+static constexpr const char* CHARGEPOINT_ID  = "CP1";
+static constexpr const char* REPLAY_TIMER_ID = "Store and forward";
+
+Database                  database;
+LocalControllerConfigStub stack_config;
+TestableWorkerThreadPool  worker_pool;
+CentralSystemProxyStub    central_system;
+
+/** @brief Process a request received from the Charge Point */
+static bool process(StoreAndForwardManager& manager, const std::string& action, const std::string& payload, rapidjson::Document& response)
+{
+    rapidjson::Document request;
+    request.Parse(payload.c_str());
+    std::string error;
+    std::string message;
+    return manager.process(action, request, response, error, message);
+}
+
+/** @brief Process a request received from the Charge Point and get the transaction id of the response */
+static int processStart(StoreAndForwardManager& manager, const std::string& payload)
+{
+    int                 ret = 0;
+    rapidjson::Document response;
+    if (process(manager, "StartTransaction", payload, response))
+    {
+        ret = response["transactionId"].GetInt();
+    }
+    return ret;
+}
+
+/** @brief Trigger a replay */
+static void replay(TestableTimerPool& timer_pool)
+{
+    Timer* timer = timer_pool.getTimer(REPLAY_TIMER_ID);
+    REQUIRE(timer);
+    CHECK(timer->isStarted());
+    timer->getCallback()();
+}
+
+TEST_SUITE("Store and forward manager")
+{
+    TEST_CASE("Setup")
+    {
+        std::filesystem::remove(DATABASE_PATH);
+        CHECK(database.open(DATABASE_PATH));
+
+        stack_config.setConfigValue("StoreAndForwardMaxMessages", "10");
+        stack_config.setConfigValue("StoreAndForwardReplayBatchSize", "0");
+        stack_config.setConfigValue("StoreAndForwardReplayInterval", "1000");
+    }
+
+    TEST_CASE("Direct forward")
+    {
+        TestableTimerPool      timer_pool;
+        StoreAndForwardManager manager(CHARGEPOINT_ID, stack_config, &database, timer_pool, worker_pool, central_system);
+        manager.initDatabaseTable();
+
+        central_system.setConnected(true);
+        central_system.setNextTransactionId(100);
+
+        rapidjson::Document response;
+        CHECK(process(manager, "StartTransaction", R"({"connectorId":1,"idTag":"TAG1","meterStart":0,"timestamp":"t0"})", response));
+        CHECK_EQ(response["transactionId"].GetInt(), 100);
+        CHECK(process(manager, "StopTransaction", R"({"transactionId":100,"meterStop":10,"timestamp":"t1"})", response));
+
+        auto forwarded = central_system.forwarded();
+        REQUIRE_EQ(forwarded.size(), 2u);
+        CHECK_EQ(forwarded[0].action, "StartTransaction");
+        CHECK_EQ(forwarded[1].action, "StopTransaction");
+        CHECK_EQ(forwarded[1].request, R"({"transactionId":100,"meterStop":10,"timestamp":"t1"})");
+        CHECK_FALSE(timer_pool.getTimer(REPLAY_TIMER_ID)->isStarted());
+
+        central_system.clearForwarded();
+    }
+
+    TEST_CASE("Storing and replay")
+    {
+        TestableTimerPool      timer_pool;
+        StoreAndForwardManager manager(CHARGEPOINT_ID, stack_config, &database, timer_pool, worker_pool, central_system);
+        manager.initDatabaseTable();
+
+        // Central System unreachable : requests are stored and acknowledged locally with negative transaction ids
+        central_system.setConnected(false);
+        CHECK_EQ(processStart(manager, R"({"connectorId":1,"idTag":"TAG1","meterStart":0,"timestamp":"t0"})"), -1);
+        CHECK_EQ(processStart(manager, R"({"connectorId":2,"idTag":"TAG2","meterStart":0,"timestamp":"t1"})"), -2);
+
+        rapidjson::Document response;
+        CHECK(process(manager, "MeterValues", R"({"connectorId":1,"transactionId":-1,"meterValue":[]})", response));
+        CHECK(process(manager, "StopTransaction", R"({"transactionId":-1,"meterStop":10,"timestamp":"t2"})", response));
+        CHECK(central_system.forwarded().empty());
+
+        // Central System reachable but older requests pending : the new request must be stored
+        central_system.setConnected(true);
+        CHECK(process(manager, "StopTransaction", R"({"transactionId":-2,"meterStop":20,"timestamp":"t3"})", response));
+        CHECK(central_system.forwarded().empty());
+
+        // Replay in order with the transaction ids allocated by the Central System
+        central_system.setNextTransactionId(200);
+        replay(timer_pool);
+
+        auto forwarded = central_system.forwarded();
+        REQUIRE_EQ(forwarded.size(), 5u);
+        CHECK_EQ(forwarded[0].action, "StartTransaction");
+        CHECK_EQ(forwarded[0].request, R"({"connectorId":1,"idTag":"TAG1","meterStart":0,"timestamp":"t0"})");
+        CHECK_EQ(forwarded[1].action, "StartTransaction");
+        CHECK_EQ(forwarded[1].request, R"({"connectorId":2,"idTag":"TAG2","meterStart":0,"timestamp":"t1"})");
+        CHECK_EQ(forwarded[2].action, "MeterValues");
+        CHECK_EQ(forwarded[2].request, R"({"connectorId":1,"transactionId":200,"meterValue":[]})");
+        CHECK_EQ(forwarded[3].action, "StopTransaction");
+        CHECK_EQ(forwarded[3].request, R"({"transactionId":200,"meterStop":10,"timestamp":"t2"})");
+        CHECK_EQ(forwarded[4].action, "StopTransaction");
+        CHECK_EQ(forwarded[4].request, R"({"transactionId":201,"meterStop":20,"timestamp":"t3"})");
+        CHECK_FALSE(timer_pool.getTimer(REPLAY_TIMER_ID)->isStarted());
+
+        // Nothing left to replay
+        central_system.clearForwarded();
+        CHECK(process(manager, "MeterValues", R"({"connectorId":1,"transactionId":300,"meterValue":[]})", response));
+        forwarded = central_system.forwarded();
+        REQUIRE_EQ(forwarded.size(), 1u);
+        CHECK_EQ(forwarded[0].request, R"({"connectorId":1,"transactionId":300,"meterValue":[]})");
+
+        central_system.clearForwarded();
+    }
+
+    TEST_CASE("Replay by batches")
+    {
+        stack_config.setConfigValue("StoreAndForwardReplayBatchSize", "2");
+
+        TestableTimerPool      timer_pool;
+        StoreAndForwardManager manager(CHARGEPOINT_ID, stack_config, &database, timer_pool, worker_pool, central_system);
+        manager.initDatabaseTable();
+
+        central_system.setConnected(false);
+        rapidjson::Document response;
+        for (int i = 0; i < 5; i++)
+        {
+            std::string payload = R"({"connectorId":1,"transactionId":)" + std::to_string(i) + R"(,"meterValue":[]})";
+            CHECK(process(manager, "MeterValues", payload, response));
+        }
+
+        central_system.setConnected(true);
+        replay(timer_pool);
+        CHECK_EQ(central_system.forwarded().size(), 2u);
+        replay(timer_pool);
+        CHECK_EQ(central_system.forwarded().size(), 4u);
+        replay(timer_pool);
+        auto forwarded = central_system.forwarded();
+        REQUIRE_EQ(forwarded.size(), 5u);
+        for (int i = 0; i < 5; i++)
+        {
+            CHECK_EQ(forwarded[i].request, R"({"connectorId":1,"transactionId":)" + std::to_string(i) + R"(,"meterValue":[]})");
+        }
+        CHECK_FALSE(timer_pool.getTimer(REPLAY_TIMER_ID)->isStarted());
+
+        stack_config.setConfigValue("StoreAndForwardReplayBatchSize", "0");
+        central_system.clearForwarded();
+    }
+
+    TEST_CASE("FIFO full")
+    {
+        stack_config.setConfigValue("StoreAndForwardMaxMessages", "2");
+
+        TestableTimerPool      timer_pool;
+        StoreAndForwardManager manager(CHARGEPOINT_ID, stack_config, &database, timer_pool, worker_pool, central_system);
+        manager.initDatabaseTable();
+
+        central_system.setConnected(false);
+        rapidjson::Document response;
+        CHECK(process(manager, "MeterValues", R"({"connectorId":1,"transactionId":1,"meterValue":[]})", response));
+        CHECK(process(manager, "MeterValues", R"({"connectorId":1,"transactionId":2,"meterValue":[]})", response));
+        CHECK_FALSE(process(manager, "MeterValues", R"({"connectorId":1,"transactionId":3,"meterValue":[]})", response));
+
+        central_system.setConnected(true);
+        replay(timer_pool);
+        CHECK_EQ(central_system.forwarded().size(), 2u);
+
+        stack_config.setConfigValue("StoreAndForwardMaxMessages", "10");
+        central_system.clearForwarded();
+    }
+
+    TEST_CASE("Rejected transaction")
+    {
+        stack_config.setConfigValue("StoreAndForwardReplayBatchSize", "1");
+
+        {
+            TestableTimerPool      timer_pool;
+            StoreAndForwardManager manager(CHARGEPOINT_ID, stack_config, &database, timer_pool, worker_pool, central_system);
+            manager.initDatabaseTable();
+
+            central_system.setConnected(false);
+            rapidjson::Document response;
+            CHECK_EQ(processStart(manager, R"({"connectorId":1,"idTag":"TAG1","meterStart":0,"timestamp":"t0"})"), -1);
+            CHECK(process(manager, "MeterValues", R"({"connectorId":1,"transactionId":-1,"meterValue":[]})", response));
+            CHECK_EQ(processStart(manager, R"({"connectorId":2,"idTag":"TAG2","meterStart":0,"timestamp":"t1"})"), -2);
+            CHECK(process(manager, "StopTransaction", R"({"transactionId":-2,"meterStop":20,"timestamp":"t2"})", response));
+
+            // The first StartTransaction request is rejected by the Central System
+            central_system.setConnected(true);
+            central_system.setError("SecurityError");
+            replay(timer_pool);
+            central_system.setError("");
+            auto forwarded = central_system.forwarded();
+            REQUIRE_EQ(forwarded.size(), 1u);
+            CHECK_EQ(forwarded[0].action, "StartTransaction");
+
+            // The requests of the rejected transaction are dropped, the other ones are replayed
+            stack_config.setConfigValue("StoreAndForwardReplayBatchSize", "0");
+            central_system.setNextTransactionId(400);
+            replay(timer_pool);
+            forwarded = central_system.forwarded();
+            REQUIRE_EQ(forwarded.size(), 3u);
+            CHECK_EQ(forwarded[1].action, "StartTransaction");
+            CHECK_EQ(forwarded[1].request, R"({"connectorId":2,"idTag":"TAG2","meterStart":0,"timestamp":"t1"})");
+            CHECK_EQ(forwarded[2].action, "StopTransaction");
+            CHECK_EQ(forwarded[2].request, R"({"transactionId":400,"meterStop":20,"timestamp":"t2"})");
+            CHECK_FALSE(timer_pool.getTimer(REPLAY_TIMER_ID)->isStarted());
+
+            // The new requests of the rejected transaction are acknowledged locally without being forwarded
+            CHECK(process(manager, "MeterValues", R"({"connectorId":1,"transactionId":-1,"meterValue":[]})", response));
+            CHECK(process(manager, "StopTransaction", R"({"transactionId":-1,"meterStop":10,"timestamp":"t3"})", response));
+            CHECK_EQ(central_system.forwarded().size(), 3u);
+            CHECK_FALSE(timer_pool.getTimer(REPLAY_TIMER_ID)->isStarted());
+        }
+        central_system.clearForwarded();
+
+        // All the transactions are terminated : the local transaction ids are available again
+        TestableTimerPool      timer_pool;
+        StoreAndForwardManager manager(CHARGEPOINT_ID, stack_config, &database, timer_pool, worker_pool, central_system);
+        manager.initDatabaseTable();
+        CHECK_FALSE(timer_pool.getTimer(REPLAY_TIMER_ID)->isStarted());
+
+        central_system.setConnected(false);
+        rapidjson::Document response;
+        CHECK_EQ(processStart(manager, R"({"connectorId":1,"idTag":"TAG1","meterStart":0,"timestamp":"t4"})"), -1);
+        CHECK(process(manager, "StopTransaction", R"({"transactionId":-1,"meterStop":10,"timestamp":"t5"})", response));
+        central_system.setConnected(true);
+        central_system.setNextTransactionId(500);
+        replay(timer_pool);
+        auto forwarded = central_system.forwarded();
+        REQUIRE_EQ(forwarded.size(), 2u);
+        CHECK_EQ(forwarded[1].request, R"({"transactionId":500,"meterStop":10,"timestamp":"t5"})");
+
+        central_system.clearForwarded();
+    }
+
+    TEST_CASE("Reload after restart")
+    {
+        // Store requests then stop
+        {
+            TestableTimerPool      timer_pool;
+            StoreAndForwardManager manager(CHARGEPOINT_ID, stack_config, &database, timer_pool, worker_pool, central_system);
+            manager.initDatabaseTable();
+
+            central_system.setConnected(false);
+            CHECK_EQ(processStart(manager, R"({"connectorId":1,"idTag":"TAG1","meterStart":0,"timestamp":"t0"})"), -1);
+            CHECK_EQ(processStart(manager, R"({"connectorId":2,"idTag":"TAG2","meterStart":0,"timestamp":"t1"})"), -2);
+
+            // Connection lost after the first answer : only the first StartTransaction is acknowledged
+            central_system.setConnected(true);
+            central_system.setNextTransactionId(300);
+            central_system.disconnectAfter(1);
+            replay(timer_pool);
+            CHECK_EQ(central_system.forwarded().size(), 1u);
+            CHECK(timer_pool.getTimer(REPLAY_TIMER_ID)->isStarted());
+        }
+        central_system.clearForwarded();
+
+        // Restart : the pending requests and the transaction ids are reloaded
+        TestableTimerPool      timer_pool;
+        StoreAndForwardManager manager(CHARGEPOINT_ID, stack_config, &database, timer_pool, worker_pool, central_system);
+        manager.initDatabaseTable();
+        CHECK(timer_pool.getTimer(REPLAY_TIMER_ID)->isStarted());
+
+        // New local transaction ids must not collide with the ones still in use
+        CHECK_EQ(processStart(manager, R"({"connectorId":3,"idTag":"TAG3","meterStart":0,"timestamp":"t2"})"), -3);
+        rapidjson::Document response;
+        CHECK(process(manager, "StopTransaction", R"({"transactionId":-1,"meterStop":10,"timestamp":"t3"})", response));
+        CHECK(process(manager, "StopTransaction", R"({"transactionId":-2,"meterStop":20,"timestamp":"t4"})", response));
+
+        // The acknowledged StartTransaction request is not replayed again
+        central_system.setConnected(true);
+        replay(timer_pool);
+        auto forwarded = central_system.forwarded();
+        REQUIRE_EQ(forwarded.size(), 4u);
+        CHECK_EQ(forwarded[0].action, "StartTransaction");
+        CHECK_EQ(forwarded[0].request, R"({"connectorId":2,"idTag":"TAG2","meterStart":0,"timestamp":"t1"})");
+        CHECK_EQ(forwarded[1].action, "StartTransaction");
+        CHECK_EQ(forwarded[1].request, R"({"connectorId":3,"idTag":"TAG3","meterStart":0,"timestamp":"t2"})");
+        CHECK_EQ(forwarded[2].action, "StopTransaction");
+        CHECK_EQ(forwarded[2].request, R"({"transactionId":300,"meterStop":10,"timestamp":"t3"})");
+        CHECK_EQ(forwarded[3].action, "StopTransaction");
+        CHECK_EQ(forwarded[3].request, R"({"transactionId":301,"meterStop":20,"timestamp":"t4"})");
+        CHECK_FALSE(timer_pool.getTimer(REPLAY_TIMER_ID)->isStarted());
+
+        central_system.clearForwarded();
+    }
+
+    TEST_CASE("Cleanup")
+    {
+        database.close();
+        std::filesystem::remove(DATABASE_PATH);
+    }
+}
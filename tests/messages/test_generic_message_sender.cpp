@@ -0,0 +1,154 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "GenericMessageSender.h"
+#include "MessagesConverter.h"
+#include "MessagesValidator.h"
+#include "RpcStub.h"
+#include "doctest_wrapper.h"
+
+using namespace ocpp::messages;
+using namespace ocpp::rpc;
+
+RpcStub              rpc;
+MessagesValidator    msgs_validator;
+MessagesConverter    msgs_converter;
+GenericMessageSender msg_sender(rpc, msgs_converter, msgs_validator, std::chrono::milliseconds(1000));
+
+/** @brief Build a JSON document from a string */
+static rapidjson::Document parse(const std::string& json)
+{
+    rapidjson::Document doc;
+    doc.Parse(json.c_str());
+    return doc;
+}
+
+TEST_SUITE("Generic message sender - forwarding")
+{
+    TEST_CASE("Setup")
+    {
+        CHECK(msgs_validator.load(SCHEMAS_DIR));
+    }
+
+    TEST_CASE("Response received")
+    {
+        rpc.setConnected(true);
+        rpc.setCallWilFail(false);
+        rpc.setError("");
+        rpc.setMessage("");
+        rpc.setResponse(parse(R"({"idTagInfo":{"status":"Accepted"}})"));
+
+        rapidjson::Document request = parse(R"({"idTag":"TAG1"})");
+        rapidjson::Document response;
+        std::string         error;
+        std::string         message;
+        CHECK_EQ(msg_sender.forward("Authorize", request, response, error, message, true), CallResult::Ok);
+        CHECK(error.empty());
+        CHECK(message.empty());
+        REQUIRE(response.IsObject());
+        CHECK_EQ(std::string(response["idTagInfo"]["status"].GetString()), "Accepted");
+
+        // The request is sent as is
+        REQUIRE_EQ(rpc.getCalls().size(), 1u);
+        CHECK_EQ(rpc.getCalls()[0].first, "Authorize");
+        CHECK(*rpc.getCalls()[0].second == request);
+
+        // The response remains valid once the frame has been released
+        rapidjson::Document copy;
+        copy.CopyFrom(response, copy.GetAllocator());
+        CHECK(copy == parse(R"({"idTagInfo":{"status":"Accepted"}})"));
+
+        rpc.clearCalls();
+    }
+
+    TEST_CASE("Response validation")
+    {
+        rpc.setConnected(true);
+        rpc.setCallWilFail(false);
+        rpc.setError("");
+        rpc.setMessage("");
+        rpc.setResponse(parse(R"({"idTagInfo":{"status":"Unknown"}})"));
+
+        rapidjson::Document request = parse(R"({"idTag":"TAG1"})");
+        rapidjson::Document response;
+        std::string         error;
+        std::string         message;
+
+        // Invalid response is rejected when validation is enabled
+        CHECK_EQ(msg_sender.forward("Authorize", request, response, error, message, true), CallResult::Failed);
+
+        // Invalid response is forwarded as is when validation is disabled
+        CHECK_EQ(msg_sender.forward("Authorize", request, response, error, message, false), CallResult::Ok);
+        CHECK_EQ(std::string(response["idTagInfo"]["status"].GetString()), "Unknown");
+
+        // Response must always be a JSON object
+        rpc.setResponse(parse(R"([1,2,3])"));
+        CHECK_EQ(msg_sender.forward("Authorize", request, response, error, message, false), CallResult::Failed);
+
+        rpc.clearCalls();
+    }
+
+    TEST_CASE("CallError received")
+    {
+        rpc.setConnected(true);
+        rpc.setCallWilFail(false);
+        rpc.setError(IRpc::RPC_ERROR_NOT_SUPPORTED);
+        rpc.setMessage("Not supported by the Central System");
+        rpc.setResponse(parse(R"({})"));
+
+        rapidjson::Document request = parse(R"({"idTag":"TAG1"})");
+        rapidjson::Document response;
+        std::string         error;
+        std::string         message;
+        CHECK_EQ(msg_sender.forward("Authorize", request, response, error, message, true), CallResult::Error);
+        CHECK_EQ(error, IRpc::RPC_ERROR_NOT_SUPPORTED);
+        CHECK_EQ(message, "Not supported by the Central System");
+        CHECK_EQ(rpc.getCalls().size(), 1u);
+
+        rpc.setError("");
+        rpc.setMessage("");
+        rpc.clearCalls();
+    }
+
+    TEST_CASE("No response")
+    {
+        rpc.setConnected(true);
+        rpc.setCallWilFail(true);
+        rpc.setResponse(parse(R"({"idTagInfo":{"status":"Accepted"}})"));
+
+        rapidjson::Document request = parse(R"({"idTag":"TAG1"})");
+        rapidjson::Document response;
+        std::string         error;
+        std::string         message;
+
+        // Timeout
+        CHECK_EQ(msg_sender.forward("Authorize", request, response, error, message, true), CallResult::Failed);
+        CHECK(error.empty());
+        CHECK_EQ(rpc.getCalls().size(), 1u);
+
+        // Not connected
+        rpc.setCallWilFail(false);
+        rpc.setConnected(false);
+        CHECK_EQ(msg_sender.forward("Authorize", request, response, error, message, true), CallResult::Failed);
+        CHECK(error.empty());
+        CHECK_EQ(rpc.getCalls().size(), 1u);
+
+        rpc.clearCalls();
+    }
+}
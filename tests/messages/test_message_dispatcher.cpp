@@ -0,0 +1,154 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "IRpc.h"
+#include "MessageDispatcher.h"
+#include "MessagesValidator.h"
+#include "doctest_wrapper.h"
+
+using namespace ocpp::messages;
+using namespace ocpp::rpc;
+
+/** @brief Message handler which records the received payloads */
+class MessageHandlerStub : public IMessageDispatcher::IMessageHandler
+{
+  public:
+    /** @brief Constructor */
+    MessageHandlerStub() : m_calls(0), m_last_payload() { }
+
+    /** @copydoc bool IMessageDispatcher::IMessageHandler::handle(const std::string&,
+     *                                                            const rapidjson::Value&,
+     *                                                            rapidjson::Document&,
+     *                                                            std::string&,
+     *                                                            std::string&) */
+    bool handle(const std::string&      action,
+                const rapidjson::Value& payload,
+                rapidjson::Document&    response,
+                std::string&            error_code,
+                std::string&            error_message) override
+    {
+        (void)action;
+        (void)error_code;
+        (void)error_message;
+
+        m_calls++;
+        m_last_payload.CopyFrom(payload, m_last_payload.GetAllocator());
+        response.SetObject();
+        return true;
+    }
+
+    /** @brief Number of calls to the handler */
+    unsigned int calls() const { return m_calls; }
+    /** @brief Last received payload */
+    const rapidjson::Document& lastPayload() const { return m_last_payload; }
+
+  private:
+    /** @brief Number of calls to the handler */
+    unsigned int m_calls;
+    /** @brief Last received payload */
+    rapidjson::Document m_last_payload;
+};
+
+MessagesValidator msgs_validator;
+
+/** @brief Dispatch a payload given as a JSON string */
+static bool dispatch(MessageDispatcher& dispatcher, const std::string& action, const std::string& payload, std::string& error_code)
+{
+    rapidjson::Document request;
+    request.Parse(payload.c_str());
+    rapidjson::Document response;
+    std::string         error_message;
+    error_code.clear();
+    return dispatcher.dispatchMessage(action, request, response, error_code, error_message);
+}
+
+TEST_SUITE("Message dispatcher")
+{
+    TEST_CASE("Setup")
+    {
+        CHECK(msgs_validator.load(SCHEMAS_DIR));
+    }
+
+    TEST_CASE("Validated payloads")
+    {
+        MessageDispatcher  dispatcher(msgs_validator);
+        MessageHandlerStub handler;
+        CHECK(dispatcher.registerHandler("Authorize", handler));
+
+        std::string error_code;
+        CHECK(dispatch(dispatcher, "Authorize", R"({"idTag":"TAG1"})", error_code));
+        CHECK(error_code.empty());
+        CHECK_EQ(handler.calls(), 1u);
+
+        CHECK_FALSE(dispatch(dispatcher, "Authorize", R"({"idTag":1})", error_code));
+        CHECK_EQ(error_code, IRpc::RPC_ERROR_TYPE_CONSTRAINT_VIOLATION);
+        CHECK_EQ(handler.calls(), 1u);
+
+        CHECK_FALSE(dispatch(dispatcher, "Heartbeat", R"({})", error_code));
+        CHECK_EQ(error_code, IRpc::RPC_ERROR_NOT_IMPLEMENTED);
+    }
+
+    TEST_CASE("Payloads without validation")
+    {
+        MessageDispatcher  dispatcher(msgs_validator);
+        MessageHandlerStub handler;
+        CHECK(dispatcher.registerHandler("Authorize", handler, false, false));
+
+        // Any JSON object is accepted, even if it does not match the schema
+        std::string error_code;
+        CHECK(dispatch(dispatcher, "Authorize", R"({"idTag":1,"unknown":true})", error_code));
+        CHECK(error_code.empty());
+        CHECK_EQ(handler.calls(), 1u);
+        CHECK_EQ(handler.lastPayload()["idTag"].GetInt(), 1);
+
+        // Only the JSON type of the payload is checked
+        CHECK_FALSE(dispatch(dispatcher, "Authorize", R"(["idTag"])", error_code));
+        CHECK_EQ(error_code, IRpc::RPC_ERROR_FORMATION_VIOLATION);
+        CHECK_FALSE(dispatch(dispatcher, "Authorize", R"("TAG1")", error_code));
+        CHECK_EQ(error_code, IRpc::RPC_ERROR_FORMATION_VIOLATION);
+        CHECK_EQ(handler.calls(), 1u);
+
+        // Actions without schema can be registered
+        MessageHandlerStub custom_handler;
+        CHECK_FALSE(dispatcher.registerHandler("CustomAction", custom_handler, false, true));
+        CHECK(dispatcher.registerHandler("CustomAction", custom_handler, false, false));
+        CHECK(dispatch(dispatcher, "CustomAction", R"({"data":[1,2,3]})", error_code));
+        CHECK_EQ(custom_handler.calls(), 1u);
+    }
+
+    TEST_CASE("Handler replacement")
+    {
+        MessageDispatcher  dispatcher(msgs_validator);
+        MessageHandlerStub raw_handler;
+        MessageHandlerStub user_handler;
+        CHECK(dispatcher.registerHandler("Authorize", raw_handler, true, false));
+
+        // Replacement must be explicitly allowed
+        CHECK_FALSE(dispatcher.registerHandler("Authorize", user_handler, false));
+        CHECK(dispatcher.registerHandler("Authorize", user_handler, true));
+
+        // The new handler validates the payloads
+        std::string error_code;
+        CHECK(dispatch(dispatcher, "Authorize", R"({"idTag":"TAG1"})", error_code));
+        CHECK_FALSE(dispatch(dispatcher, "Authorize", R"({"idTag":1})", error_code));
+        CHECK_EQ(error_code, IRpc::RPC_ERROR_TYPE_CONSTRAINT_VIOLATION);
+        CHECK_EQ(raw_handler.calls(), 0u);
+        CHECK_EQ(user_handler.calls(), 1u);
+    }
+}
@@ -99,6 +99,28 @@ class RpcClientListener : public IRpc::IListener, public RpcClient::IListener
     bool        received_error;
 };
 
+class RpcFastPathHandler : public RpcBase::IFastPathHandler
+{
+  public:
+    RpcFastPathHandler() : action(), response(nullptr) { }
+    virtual ~RpcFastPathHandler() { }
+
+    /** @copydoc bool RpcBase::IFastPathHandler::rpcFastCallReceived(const char*, const rapidjson::Value&, std::string&) */
+    bool rpcFastCallReceived(const char* _action, const rapidjson::Value& _payload, std::string& _response) override
+    {
+        (void)_payload;
+        action = _action;
+        if (response)
+        {
+            _response = response;
+        }
+        return (response != nullptr);
+    }
+
+    std::string action;
+    const char* response;
+};
+
 static constexpr const char* WS_PROTOCOL = "ocpp1.6";
 static constexpr const char* WS_URL      = "ws://localhost:8080/ocpp/";
 
@@ -319,4 +341,35 @@ TEST_SUITE("CALL messages")
         CHECK(websocket.sendCalled());
         CHECK_EQ(strcmp(reinterpret_cast<const char*>(websocket.sentData()), EXPECTED_CALLERROR_MESSAGE_0), 0);
     }
+
+    TEST_CASE("Fast path processing of call requests")
+    {
+        RpcClientListener             listener;
+        RpcFastPathHandler            fast_path;
+        WebsocketClientStub           websocket;
+        IWebsocketClient::Credentials credentials;
+        RpcClient                     client(websocket, WS_PROTOCOL);
+        client.registerListener(listener);
+        client.registerClientListener(listener);
+        client.registerFastPathHandler(fast_path);
+        client.start("", credentials);
+
+        // Request handled by the fast path
+        fast_path.response = CALLRESULT_PAYLOAD;
+        websocket.notifyDataReceived(EXPECTED_CALL_MESSAGE_1, strlen(EXPECTED_CALL_MESSAGE_1));
+        CHECK_EQ(fast_path.action, ACTION);
+        CHECK(websocket.sendCalled());
+        CHECK_EQ(strcmp(reinterpret_cast<const char*>(websocket.sentData()), EXPECTED_CALLRESULT_MESSAGE_1), 0);
+        std::this_thread::sleep_for(std::chrono::milliseconds(50u));
+        CHECK(listener.action.empty());
+
+        // Request declined by the fast path
+        fast_path.response = nullptr;
+        listener.response  = CALLRESULT_PAYLOAD;
+        websocket.notifyDataReceived(EXPECTED_CALL_MESSAGE_2, strlen(EXPECTED_CALL_MESSAGE_2));
+        std::this_thread::sleep_for(std::chrono::milliseconds(50u));
+        CHECK_EQ(listener.action, ACTION);
+        CHECK_EQ(listener.payload, CALL_PAYLOAD);
+        CHECK_EQ(strcmp(reinterpret_cast<const char*>(websocket.sentData()), EXPECTED_CALLRESULT_MESSAGE_2), 0);
+    }
 }
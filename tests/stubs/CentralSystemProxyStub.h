@@ -0,0 +1,317 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef CENTRALSYSTEMPROXYSTUB_H
+#define CENTRALSYSTEMPROXYSTUB_H
+
+#include "ICentralSystemProxy.h"
+
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <mutex>
+#include <vector>
+
+namespace ocpp
+{
+namespace localcontroller
+{
+
+/** @brief Central System proxy stub for unit tests : only the forwarding of the requests is simulated */
+class CentralSystemProxyStub : public ICentralSystemProxy
+{
+  public:
+    /** @brief Forwarded request */
+    struct ForwardedRequest
+    {
+        /** @brief Action */
+        std::string action;
+        /** @brief Serialized JSON payload */
+        std::string request;
+    };
+
+    /** @brief Constructor */
+    CentralSystemProxyStub()
+        : m_identifier("CS"), m_mutex(), m_connected(false), m_remaining_responses(-1), m_error(), m_next_transaction_id(1), m_forwarded()
+    {
+    }
+    /** @brief Destructor */
+    virtual ~CentralSystemProxyStub() { }
+
+    /** @brief Set the connection state */
+    void setConnected(bool connected)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_connected           = connected;
+        m_remaining_responses = -1;
+    }
+    /** @brief Simulate a connection loss after a given number of responses */
+    void disconnectAfter(int responses)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_remaining_responses = responses;
+    }
+    /** @brief Set the CallError to answer to the requests (empty = no error) */
+    void setError(const std::string& error)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_error = error;
+    }
+    /** @brief Set the next transaction id allocated on a StartTransaction request */
+    void setNextTransactionId(int transaction_id)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_next_transaction_id = transaction_id;
+    }
+    /** @brief Get the requests which have been received by the Central System */
+    std::vector<ForwardedRequest> forwarded() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_forwarded;
+    }
+    /** @brief Clear the list of the received requests */
+    void clearForwarded()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_forwarded.clear();
+    }
+
+    // ICentralSystemProxy interface
+
+    /** @copydoc const std::string& ICentralSystemProxy::identifier() const */
+    const std::string& identifier() const override { return m_identifier; }
+
+    /** @copydoc void ICentralSystemProxy::setTimeout(std::chrono::milliseconds) */
+    void setTimeout(std::chrono::milliseconds) override { }
+
+    /** @copydoc bool ICentralSystemProxy::connect(const std::string&, const ocpp::websockets::IWebsocketClient::Credentials&,
+     *                                            std::chrono::milliseconds, std::chrono::milliseconds, std::chrono::milliseconds) */
+    bool connect(const std::string&,
+                 const ocpp::websockets::IWebsocketClient::Credentials&,
+                 std::chrono::milliseconds,
+                 std::chrono::milliseconds,
+                 std::chrono::milliseconds) override
+    {
+        return false;
+    }
+
+    /** @copydoc void ICentralSystemProxy::disconnect() */
+    void disconnect() override { setConnected(false); }
+
+    /** @copydoc bool ICentralSystemProxy::isConnected() const */
+    bool isConnected() const override
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_connected;
+    }
+
+    /** @copydoc void ICentralSystemProxy::registerListener(ILocalControllerProxyEventsHandler&) */
+    void registerListener(ILocalControllerProxyEventsHandler&) override { }
+
+    /** @copydoc bool ICentralSystemProxy::forward(const std::string&, const rapidjson::Value&, rapidjson::Document&,
+     *                                            std::string&, std::string&) */
+    bool forward(const std::string&      action,
+                 const rapidjson::Value& request,
+                 rapidjson::Document&    response,
+                 std::string&            error,
+                 std::string&            message) override
+    {
+        bool ret = false;
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_connected && (m_remaining_responses != 0))
+        {
+            // Request received by the Central System
+            rapidjson::StringBuffer                    buffer;
+            rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+            request.Accept(writer);
+            m_forwarded.push_back({action, buffer.GetString()});
+
+            // Build response
+            if (m_error.empty())
+            {
+                response.SetObject();
+                if (action == "StartTransaction")
+                {
+                    rapidjson::Value id_tag_info(rapidjson::kObjectType);
+                    id_tag_info.AddMember("status", "Accepted", response.GetAllocator());
+                    response.AddMember("idTagInfo", id_tag_info, response.GetAllocator());
+                    response.AddMember("transactionId", m_next_transaction_id, response.GetAllocator());
+                    m_next_transaction_id++;
+                }
+                ret = true;
+            }
+            else
+            {
+                error   = m_error;
+                message = "Error from stub";
+            }
+
+            // Simulated connection loss
+            if (m_remaining_responses > 0)
+            {
+                m_remaining_responses--;
+            }
+        }
+        if (m_remaining_responses == 0)
+        {
+            m_connected = false;
+        }
+
+        return ret;
+    }
+
+    bool call(const ocpp::messages::BootNotificationReq&, ocpp::messages::BootNotificationConf&, std::string&, std::string&) override
+    {
+        return false;
+    }
+    bool call(const ocpp::messages::StatusNotificationReq&, ocpp::messages::StatusNotificationConf&, std::string&, std::string&) override
+    {
+        return false;
+    }
+    bool call(const ocpp::messages::AuthorizeReq&, ocpp::messages::AuthorizeConf&, std::string&, std::string&) override { return false; }
+    bool call(const ocpp::messages::StartTransactionReq&, ocpp::messages::StartTransactionConf&, std::string&, std::string&) override
+    {
+        return false;
+    }
+    bool call(const ocpp::messages::StopTransactionReq&, ocpp::messages::StopTransactionConf&, std::string&, std::string&) override
+    {
+        return false;
+    }
+    bool call(const ocpp::messages::DataTransferReq&, ocpp::messages::DataTransferConf&, std::string&, std::string&) override
+    {
+        return false;
+    }
+    bool call(const ocpp::messages::MeterValuesReq&, ocpp::messages::MeterValuesConf&, std::string&, std::string&) override
+    {
+        return false;
+    }
+    bool call(const ocpp::messages::DiagnosticsStatusNotificationReq&,
+              ocpp::messages::DiagnosticsStatusNotificationConf&,
+              std::string&,
+              std::string&) override
+    {
+        return false;
+    }
+    bool call(const ocpp::messages::FirmwareStatusNotificationReq&,
+              ocpp::messages::FirmwareStatusNotificationConf&,
+              std::string&,
+              std::string&) override
+    {
+        return false;
+    }
+    bool call(const ocpp::messages::HeartbeatReq&, ocpp::messages::HeartbeatConf&, std::string&, std::string&) override { return false; }
+    bool call(const ocpp::messages::SecurityEventNotificationReq&,
+              ocpp::messages::SecurityEventNotificationConf&,
+              std::string&,
+              std::string&) override
+    {
+        return false;
+    }
+    bool call(const ocpp::messages::SignCertificateReq&, ocpp::messages::SignCertificateConf&, std::string&, std::string&) override
+    {
+        return false;
+    }
+    bool call(const ocpp::messages::LogStatusNotificationReq&,
+              ocpp::messages::LogStatusNotificationConf&,
+              std::string&,
+              std::string&) override
+    {
+        return false;
+    }
+    bool call(const ocpp::messages::SignedFirmwareStatusNotificationReq&,
+              ocpp::messages::SignedFirmwareStatusNotificationConf&,
+              std::string&,
+              std::string&) override
+    {
+        return false;
+    }
+
+    /** @brief Handler of a request from the Central System */
+    template <typename RequestType, typename ResponseType>
+    using Handler = std::function<bool(const RequestType&, ResponseType&, std::string&, std::string&)>;
+
+    bool registerHandler(Handler<ocpp::messages::CancelReservationReq, ocpp::messages::CancelReservationConf>) override { return true; }
+    bool registerHandler(Handler<ocpp::messages::ChangeAvailabilityReq, ocpp::messages::ChangeAvailabilityConf>) override { return true; }
+    bool registerHandler(Handler<ocpp::messages::ChangeConfigurationReq, ocpp::messages::ChangeConfigurationConf>) override { return true; }
+    bool registerHandler(Handler<ocpp::messages::ClearCacheReq, ocpp::messages::ClearCacheConf>) override { return true; }
+    bool registerHandler(Handler<ocpp::messages::ClearChargingProfileReq, ocpp::messages::ClearChargingProfileConf>) override
+    {
+        return true;
+    }
+    bool registerHandler(Handler<ocpp::messages::DataTransferReq, ocpp::messages::DataTransferConf>) override { return true; }
+    bool registerHandler(Handler<ocpp::messages::GetCompositeScheduleReq, ocpp::messages::GetCompositeScheduleConf>) override
+    {
+        return true;
+    }
+    bool registerHandler(Handler<ocpp::messages::GetConfigurationReq, ocpp::messages::GetConfigurationConf>) override { return true; }
+    bool registerHandler(Handler<ocpp::messages::GetDiagnosticsReq, ocpp::messages::GetDiagnosticsConf>) override { return true; }
+    bool registerHandler(Handler<ocpp::messages::GetLocalListVersionReq, ocpp::messages::GetLocalListVersionConf>) override { return true; }
+    bool registerHandler(Handler<ocpp::messages::RemoteStartTransactionReq, ocpp::messages::RemoteStartTransactionConf>) override
+    {
+        return true;
+    }
+    bool registerHandler(Handler<ocpp::messages::RemoteStopTransactionReq, ocpp::messages::RemoteStopTransactionConf>) override
+    {
+        return true;
+    }
+    bool registerHandler(Handler<ocpp::messages::ReserveNowReq, ocpp::messages::ReserveNowConf>) override { return true; }
+    bool registerHandler(Handler<ocpp::messages::ResetReq, ocpp::messages::ResetConf>) override { return true; }
+    bool registerHandler(Handler<ocpp::messages::SendLocalListReq, ocpp::messages::SendLocalListConf>) override { return true; }
+    bool registerHandler(Handler<ocpp::messages::SetChargingProfileReq, ocpp::messages::SetChargingProfileConf>) override { return true; }
+    bool registerHandler(Handler<ocpp::messages::TriggerMessageReq, ocpp::messages::TriggerMessageConf>) override { return true; }
+    bool registerHandler(Handler<ocpp::messages::UnlockConnectorReq, ocpp::messages::UnlockConnectorConf>) override { return true; }
+    bool registerHandler(Handler<ocpp::messages::UpdateFirmwareReq, ocpp::messages::UpdateFirmwareConf>) override { return true; }
+    bool registerHandler(Handler<ocpp::messages::CertificateSignedReq, ocpp::messages::CertificateSignedConf>) override { return true; }
+    bool registerHandler(Handler<ocpp::messages::DeleteCertificateReq, ocpp::messages::DeleteCertificateConf>) override { return true; }
+    bool registerHandler(Handler<ocpp::messages::ExtendedTriggerMessageReq, ocpp::messages::ExtendedTriggerMessageConf>) override
+    {
+        return true;
+    }
+    bool registerHandler(Handler<ocpp::messages::GetInstalledCertificateIdsReq, ocpp::messages::GetInstalledCertificateIdsConf>) override
+    {
+        return true;
+    }
+    bool registerHandler(Handler<ocpp::messages::GetLogReq, ocpp::messages::GetLogConf>) override { return true; }
+    bool registerHandler(Handler<ocpp::messages::InstallCertificateReq, ocpp::messages::InstallCertificateConf>) override { return true; }
+    bool registerHandler(Handler<ocpp::messages::SignedUpdateFirmwareReq, ocpp::messages::SignedUpdateFirmwareConf>) override
+    {
+        return true;
+    }
+
+  private:
+    /** @brief Identifier */
+    const std::string m_identifier;
+    /** @brief Mutex for concurrent access */
+    mutable std::mutex m_mutex;
+    /** @brief Connection state */
+    bool m_connected;
+    /** @brief Number of responses before a simulated connection loss (-1 = no connection loss) */
+    int m_remaining_responses;
+    /** @brief CallError to answer to the requests */
+    std::string m_error;
+    /** @brief Next transaction id allocated on a StartTransaction request */
+    int m_next_transaction_id;
+    /** @brief Requests received by the Central System */
+    std::vector<ForwardedRequest> m_forwarded;
+};
+
+} // namespace localcontroller
+} // namespace ocpp
+
+#endif // CENTRALSYSTEMPROXYSTUB_H
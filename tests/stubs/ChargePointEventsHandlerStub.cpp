@@ -167,6 +167,33 @@ bool ChargePointEventsHandlerStub::getLocalLimitationsSchedule(unsigned int
     return false;
 }
 
+/** @copydoc void IChargePointEventsHandler::setpointChanged(unsigned int,
+                                                             const ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>&,
+                                                             const ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>&) */
+void ChargePointEventsHandlerStub::setpointChanged(unsigned int                                                     connector_id,
+                                                   const ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& charge_point_setpoint,
+                                                   const ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& connector_setpoint)
+{
+    m_calls["setpointChanged"] = {
+        {"connector_id", std::to_string(connector_id)},
+        {"charge_point_setpoint", (charge_point_setpoint.isSet() ? std::to_string(charge_point_setpoint.value().value) : "not set")},
+        {"connector_setpoint", (connector_setpoint.isSet() ? std::to_string(connector_setpoint.value().value) : "not set")}};
+}
+
+/** @copydoc bool IChargePointEventsHandler::getConnectorConsumption(unsigned int, float&) */
+bool ChargePointEventsHandlerStub::getConnectorConsumption(unsigned int connector_id, float& current)
+{
+    m_calls["getConnectorConsumption"] = {{"connector_id", std::to_string(connector_id)}};
+    bool ret                           = false;
+    auto iter                          = m_consumptions.find(connector_id);
+    if (iter != m_consumptions.end())
+    {
+        current = iter->second;
+        ret     = true;
+    }
+    return ret;
+}
+
 /** @copydoc bool IChargePointEventsHandler::resetRequested(ocpp::types::ResetType) */
 bool ChargePointEventsHandlerStub::resetRequested(ocpp::types::ResetType reset_type)
 {
@@ -86,6 +86,16 @@ class ChargePointEventsHandlerStub : public ocpp::chargepoint::IChargePointEvent
     /** @copydoc bool IChargePointEventsHandler::getLocalLimitationsSchedule(unsigned int, unsigned int, ocpp::types::ChargingSchedule&) */
     bool getLocalLimitationsSchedule(unsigned int connector_id, unsigned int duration, ocpp::types::ChargingSchedule& schedule) override;
 
+    /** @copydoc void IChargePointEventsHandler::setpointChanged(unsigned int,
+                                                                 const ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>&,
+                                                                 const ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>&) */
+    void setpointChanged(unsigned int                                                     connector_id,
+                         const ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& charge_point_setpoint,
+                         const ocpp::types::Optional<ocpp::types::SmartChargingSetpoint>& connector_setpoint) override;
+
+    /** @copydoc bool IChargePointEventsHandler::getConnectorConsumption(unsigned int, float&) */
+    bool getConnectorConsumption(unsigned int connector_id, float& current) override;
+
     /** @copydoc bool IChargePointEventsHandler::resetRequested(ocpp::types::ResetType) */
     bool resetRequested(ocpp::types::ResetType reset_type) override;
 
@@ -215,6 +225,8 @@ class ChargePointEventsHandlerStub : public ocpp::chargepoint::IChargePointEvent
     void setMeterValue(unsigned int                                                                 connector_id,
                        std::pair<ocpp::types::Measurand, ocpp::types::Optional<ocpp::types::Phase>> measurand,
                        const ocpp::types::MeterValue&                                               meter_value);
+    /** @brief Set the consumption of a connector */
+    void setConnectorConsumption(unsigned int connector_id, float current) { m_consumptions[connector_id] = current; }
 
   private:
     /** @brief Calls to the event handler */
@@ -234,6 +246,8 @@ class ChargePointEventsHandlerStub : public ocpp::chargepoint::IChargePointEvent
     std::string m_diag_file;
     /** @brief Meter values */
     std::map<unsigned int, std::map<std::string, ocpp::types::MeterValue>> m_meter_values;
+    /** @brief Connector consumptions */
+    std::map<unsigned int, float> m_consumptions;
 
     /** @brief Get the call result of a method */
     bool callResult(const std::string method_name);
@@ -21,6 +21,9 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 
 #include "IConfigManager.h"
 
+#include <map>
+#include <vector>
+
 namespace ocpp
 {
 namespace chargepoint
@@ -31,7 +34,10 @@ class ConfigManagerStub : public IConfigManager
 {
   public:
     /** @brief Constructor */
-    ConfigManagerStub() : m_specific_checks(), m_listeners() { }
+    ConfigManagerStub()
+        : m_specific_checks(), m_listeners(), m_snapshot_listeners(), m_snapshot(std::make_shared<OcppConfigSnapshot>())
+    {
+    }
     /** @brief Destructor */
     virtual ~ConfigManagerStub() { }
 
@@ -41,18 +47,31 @@ class ConfigManagerStub : public IConfigManager
     /** @copydoc void IConfigManager::registerConfigChangedListener(const std::string&, IConfigChangedListener&) */
     void registerConfigChangedListener(const std::string& key, IConfigChangedListener& listener) override { m_listeners[key] = &listener; }
 
+    /** @copydoc void IConfigManager::registerConfigSnapshotListener(IConfigSnapshotListener&) */
+    void registerConfigSnapshotListener(IConfigSnapshotListener& listener) override { m_snapshot_listeners.push_back(&listener); }
+
+    /** @copydoc std::shared_ptr<const OcppConfigSnapshot> IConfigManager::snapshot() const */
+    std::shared_ptr<const OcppConfigSnapshot> snapshot() const override { return m_snapshot; }
+
+    /** @copydoc void IConfigManager::refreshSnapshot() */
+    void refreshSnapshot() override { }
+
     // API
 
     /** @brief Check if a checker has been registered for a configuration key */
     bool isCheckerRegistered(const std::string& key) const { return (m_specific_checks.find(key) != m_specific_checks.end()); }
     /** @brief Check if a listener has been registered for a configuration key */
     bool isListenerRegistered(const std::string& key) const { return (m_listeners.find(key) != m_listeners.end()); }
+    /** @brief Set the configuration snapshot */
+    void setSnapshot(const OcppConfigSnapshot& snapshot) { m_snapshot = std::make_shared<OcppConfigSnapshot>(snapshot); }
 
     /** @brief Reset stub data */
     void reset()
     {
         m_specific_checks.clear();
         m_listeners.clear();
+        m_snapshot_listeners.clear();
+        m_snapshot = std::make_shared<OcppConfigSnapshot>();
     }
 
   private:
@@ -60,6 +79,10 @@ class ConfigManagerStub : public IConfigManager
     std::map<std::string, ConfigurationValueCheckFunc> m_specific_checks;
     /** @brief Configuration listeners */
     std::map<std::string, IConfigChangedListener*> m_listeners;
+    /** @brief Configuration snapshot listeners */
+    std::vector<IConfigSnapshotListener*> m_snapshot_listeners;
+    /** @brief Configuration snapshot */
+    std::shared_ptr<const OcppConfigSnapshot> m_snapshot;
 };
 
 } // namespace chargepoint
@@ -0,0 +1,185 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef LOCALCONTROLLERCONFIGSTUB_H
+#define LOCALCONTROLLERCONFIGSTUB_H
+
+#include "ILocalControllerConfig.h"
+
+#include <map>
+
+namespace ocpp
+{
+namespace config
+{
+
+/** @brief Local Controller stack internal configuration stub for unit tests */
+class LocalControllerConfigStub : public ILocalControllerConfig
+{
+  public:
+    /** @brief Constructor */
+    LocalControllerConfigStub() : m_config() { }
+    /** @brief Destructor */
+    virtual ~LocalControllerConfigStub() { }
+
+    /** @brief Set the value of a stack internal configuration key */
+    void setConfigValue(const std::string& key, const std::string& value) { m_config[key] = value; }
+
+    // Paths
+
+    /** @brief Path to the database to store persistent data */
+    std::string databasePath() const override { return getString("DatabasePath"); }
+    /** @brief Path to the JSON schemas to validate the messages */
+    std::string jsonSchemasPath() const override { return getString("JsonSchemasPath"); }
+
+    // Communication parameters
+
+    /** @brief Listen URL */
+    std::string listenUrl() const override { return getString("ListenUrl"); }
+    /** @brief Call request timeout */
+    std::chrono::milliseconds callRequestTimeout() const override { return get<std::chrono::milliseconds>("CallRequestTimeout"); }
+    /** @brief Websocket PING interval */
+    std::chrono::seconds webSocketPingInterval() const override { return get<std::chrono::seconds>("WebSocketPingInterval"); }
+    /** @brief Boot notification retry interval */
+    std::chrono::seconds bootNotificationRetryInterval() const override
+    {
+        return get<std::chrono::seconds>("BootNotificationRetryInterval");
+    }
+    /** @brief Heartbeat interval */
+    std::chrono::seconds heartbeatInterval() const override { return get<std::chrono::seconds>("HeartbeatInterval"); }
+    /** @brief Enable HTTP basic authentication */
+    bool httpBasicAuthent() const override { return getBool("HttpBasicAuthent"); }
+    /** @brief Cipher list to use for TLSv1.2 connections */
+    std::string tlsv12CipherList() const override { return getString("Tlsv12CipherList"); }
+    /** @brief Cipher list to use for TLSv1.3 connections */
+    std::string tlsv13CipherList() const override { return getString("Tlsv13CipherList"); }
+    /** @brief ECDH curve to use for TLS connections */
+    std::string tlsEcdhCurve() const override { return getString("TlsEcdhCurve"); }
+    /** @brief Server certificate */
+    std::string tlsServerCertificate() const override { return getString("TlsServerCertificate"); }
+    /** @brief Server certificate's private key */
+    std::string tlsServerCertificatePrivateKey() const override { return getString("TlsServerCertificatePrivateKey"); }
+    /** @brief Server certificate's private key passphrase */
+    std::string tlsServerCertificatePrivateKeyPassphrase() const override { return getString("TlsServerCertificatePrivateKeyPassphrase"); }
+    /** @brief Certification Authority signing chain for the server certificate */
+    std::string tlsServerCertificateCa() const override { return getString("TlsServerCertificateCa"); }
+    /** @brief Enable client authentication using certificate */
+    bool tlsClientCertificateAuthent() const override { return getBool("TlsClientCertificateAuthent"); }
+    /** @brief Interval between 2 rotations of the keys protecting the TLS session tickets (0 = no rotation) */
+    std::chrono::seconds tlsTicketKeyRotationInterval() const override { return get<std::chrono::seconds>("TlsTicketKeyRotationInterval"); }
+    /** @brief Maximum number of messages waiting to be sent on the websocket connection (0 = no limit) */
+    unsigned int webSocketSendQueueMaxMessages() const override { return get<unsigned int>("WebSocketSendQueueMaxMessages"); }
+    /** @brief Maximum size in bytes of the messages waiting to be sent on the websocket connection (0 = no limit) */
+    unsigned int webSocketSendQueueMaxSize() const override { return get<unsigned int>("WebSocketSendQueueMaxSize"); }
+    /** @brief Behavior when the websocket send queue is full : fail, block or disconnect */
+    std::string webSocketSendQueuePolicy() const override { return getString("WebSocketSendQueuePolicy"); }
+    /** @brief Maximum wait time for room in the websocket send queue when using the block policy */
+    std::chrono::milliseconds webSocketSendQueueBlockTimeout() const override
+    {
+        return get<std::chrono::milliseconds>("WebSocketSendQueueBlockTimeout");
+    }
+
+    // Log
+
+    /** @brief Maximum number of entries in the log (0 = no logs in database) */
+    unsigned int logMaxEntriesCount() const override { return get<unsigned int>("LogMaxEntriesCount"); }
+
+    // Behavior
+
+    /** @brief Size of the thread pool to handle incoming requests from the Charge Points */
+    unsigned int incomingRequestsFromCpThreadPoolSize() const override { return get<unsigned int>("IncomingRequestsFromCpThreadPoolSize"); }
+
+    // ISO 15118 PnC extensions
+
+    /** @brief Support of the ISO 15118 plug and charge messages via the DataTransfer mechanism */
+    bool iso15118PnCEnabled() const override { return getBool("Iso15118PnCEnabled"); }
+
+    // Local controller behavior
+
+    /** @brief Size of the thread pool to handle incoming requests from the Central System */
+    unsigned int incomingRequestsFromCsThreadPoolSize() const override { return get<unsigned int>("IncomingRequestsFromCsThreadPoolSize"); }
+    /** @brief Disconnect from Charge Point on Central System disconnection */
+    bool disconnectFromCpWhenCsDisconnected() const override { return getBool("DisconnectFromCpWhenCsDisconnected"); }
+    /** @brief Forward the requests between Charge Point and Central System without decoding them
+               (only the requests for which a user handler has been registered are decoded) */
+    bool transparentForwarding() const override { return getBool("TransparentForwarding"); }
+    /** @brief Validate the JSON payloads of the requests and responses forwarded in transparent mode against the OCPP schemas */
+    bool transparentForwardingValidation() const override { return getBool("TransparentForwardingValidation"); }
+    /** @brief Acknowledge locally the transaction related requests (StartTransaction, StopTransaction, MeterValues)
+               when the Central System is unreachable, and replay them once the connection is back */
+    bool storeAndForward() const override { return getBool("StoreAndForward"); }
+    /** @brief Maximum number of stored requests per Charge Point (0 = no limit) */
+    unsigned int storeAndForwardMaxMessages() const override { return get<unsigned int>("StoreAndForwardMaxMessages"); }
+    /** @brief Maximum number of stored requests replayed in a row (0 = no limit) */
+    unsigned int storeAndForwardReplayBatchSize() const override { return get<unsigned int>("StoreAndForwardReplayBatchSize"); }
+    /** @brief Interval between 2 replays of stored requests */
+    std::chrono::milliseconds storeAndForwardReplayInterval() const override
+    {
+        return get<std::chrono::milliseconds>("StoreAndForwardReplayInterval");
+    }
+
+  private:
+    /** @brief Configuration */
+    std::map<std::string, std::string> m_config;
+
+    /** @brief Get a boolean parameter */
+    bool getBool(const std::string& param) const
+    {
+        auto iter = m_config.find(param);
+        if (iter != m_config.end())
+        {
+            return (m_config.at(param) == "true");
+        }
+        else
+        {
+            return false;
+        }
+    }
+    /** @brief Get a string parameter */
+    std::string getString(const std::string& param) const
+    {
+        auto iter = m_config.find(param);
+        if (iter != m_config.end())
+        {
+            return m_config.at(param);
+        }
+        else
+        {
+            return "";
+        }
+    }
+    /** @brief Get a value which can be created from an unsigned integer */
+    template <typename T>
+    T get(const std::string& param) const
+    {
+        auto iter = m_config.find(param);
+        if (iter != m_config.end())
+        {
+            return T(std::strtoul(m_config.at(param).c_str(), nullptr, 10));
+        }
+        else
+        {
+            return T(0);
+        }
+    }
+};
+
+} // namespace config
+} // namespace ocpp
+
+#endif // LOCALCONTROLLERCONFIGSTUB_H
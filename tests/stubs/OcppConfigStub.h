@@ -58,9 +58,34 @@ class OcppConfigStub : public IOcppConfig
                           std::vector<ocpp::types::KeyValue>&                values,
                           std::vector<ocpp::types::CiStringType<50u>>&       unknown_values) override
     {
-        (void)keys;
-        (void)values;
-        (void)unknown_values;
+        if (keys.empty())
+        {
+            for (const auto& param : m_config)
+            {
+                values.emplace_back();
+                values.back().key.assign(param.first);
+                values.back().readonly = false;
+                values.back().value.value().assign(param.second);
+            }
+        }
+        else
+        {
+            for (const auto& key : keys)
+            {
+                auto iter = m_config.find(key);
+                if (iter != m_config.end())
+                {
+                    values.emplace_back();
+                    values.back().key.assign(iter->first);
+                    values.back().readonly = false;
+                    values.back().value.value().assign(iter->second);
+                }
+                else
+                {
+                    unknown_values.push_back(key);
+                }
+            }
+        }
     }
 
     ///
@@ -70,9 +95,8 @@ class OcppConfigStub : public IOcppConfig
     /** @copydoc ConfigurationStatus IOcppConfig::setConfiguration(const std::string&, const std::string&) */
     ocpp::types::ConfigurationStatus setConfiguration(const std::string& key, const std::string& value) override
     {
-        (void)key;
-        (void)value;
-        return ocpp::types::ConfigurationStatus::Rejected;
+        m_config[key] = value;
+        return ocpp::types::ConfigurationStatus::Accepted;
     }
 
     //
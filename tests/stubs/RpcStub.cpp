@@ -30,10 +30,10 @@ RpcStub::RpcStub()
 /** @brief Destructor */
 RpcStub::~RpcStub() { }
 
-/** @copydoc bool IRpc::call(const std::string&, const rapidjson::Document&, rapidjson::Document&, rapidjson::Value&,
+/** @copydoc bool IRpc::call(const std::string&, const rapidjson::Value&, rapidjson::Document&, rapidjson::Value&,
                              std::string&, std::string&, std::chrono::milliseconds) */
 bool RpcStub::call(const std::string&         action,
-                   const rapidjson::Document& payload,
+                   const rapidjson::Value&    payload,
                    rapidjson::Document&       rpc_frame,
                    rapidjson::Value&          response,
                    std::string&               error,
@@ -41,10 +41,10 @@ class RpcStub : public IRpc
     /** @copydoc bool IRpc::isConnected() */
     bool isConnected() const override { return m_connected; }
 
-    /** @copydoc bool IRpc::call(const std::string&, const rapidjson::Document&, rapidjson::Document&, rapidjson::Value&,
+    /** @copydoc bool IRpc::call(const std::string&, const rapidjson::Value&, rapidjson::Document&, rapidjson::Value&,
      *                           std::string&, std::string&, std::chrono::milliseconds) */
     bool call(const std::string&         action,
-              const rapidjson::Document& payload,
+              const rapidjson::Value&    payload,
               rapidjson::Document&       rpc_frame,
               rapidjson::Value&          response,
               std::string&               error,
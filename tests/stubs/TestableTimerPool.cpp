@@ -41,12 +41,13 @@ Timer* TestableTimerPool::createTimer(const char* name)
 /** @copydoc Timer* ITimerPool::getTimer(const std::string&) */
 Timer* TestableTimerPool::getTimer(const std::string& timer_name)
 {
+    // Most recently created timer first
     Timer* ret = nullptr;
-    for (Timer* timer : m_timers)
+    for (auto iter = m_timers.rbegin(); iter != m_timers.rend(); iter++)
     {
-        if (timer->getName() == timer_name)
+        if ((*iter)->getName() == timer_name)
         {
-            ret = timer;
+            ret = *iter;
             break;
         }
     }
@@ -39,6 +39,7 @@ WebsocketClientStub::WebsocketClientStub()
       m_send_called(false),
       m_sent_data(nullptr),
       m_sent_size(0),
+      m_send_queue_config(),
       m_listener(nullptr),
       m_next_call_will_fail(false)
 {
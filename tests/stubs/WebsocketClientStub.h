@@ -58,6 +58,18 @@ class WebsocketClientStub : public IWebsocketClient
     /** @copydoc bool IWebsocketClient::send(const void*, size_t) */
     bool send(const void* data, size_t size) override;
 
+    /** @copydoc void IWebsocketClient::setSendQueueConfig(const SendQueueConfig&) */
+    void setSendQueueConfig(const SendQueueConfig& config) override { m_send_queue_config = config; }
+
+    /** @copydoc SendQueueStats IWebsocketClient::sendQueueStats() const */
+    SendQueueStats sendQueueStats() const override { return SendQueueStats(); }
+
+    /** @copydoc void IWebsocketClient::setTlsSessionStore(ITlsSessionStore*) */
+    void setTlsSessionStore(ITlsSessionStore* store) override { (void)store; }
+
+    /** @copydoc TlsStats IWebsocketClient::tlsStats() const */
+    TlsStats tlsStats() const override { return TlsStats(); }
+
     /** @copydoc void IWebsocketClient::registerListener(IListener&) */
     void registerListener(IListener& listener) override;
 
@@ -89,17 +101,18 @@ class WebsocketClientStub : public IWebsocketClient
 
     /// Getters
 
-    bool               connectCalled() const { return m_connect_called; }
-    std::string        url() const { return m_url; }
-    std::string        protocol() const { return m_protocol; }
-    const Credentials& credentials() const { return m_credentials; }
-    unsigned int       connectTimeout() const { return m_connect_timeout; }
-    unsigned int       retryInterval() const { return m_retry_interval; }
-    unsigned int       pingInterval() const { return m_ping_interval; }
-    bool               disconnectCalled() const { return m_disconnect_called; }
-    bool               sendCalled() const { return m_send_called; }
-    const uint8_t*     sentData() const { return m_sent_data; }
-    size_t             sentSize() const { return m_sent_size; }
+    bool                   connectCalled() const { return m_connect_called; }
+    std::string            url() const { return m_url; }
+    std::string            protocol() const { return m_protocol; }
+    const Credentials&     credentials() const { return m_credentials; }
+    unsigned int           connectTimeout() const { return m_connect_timeout; }
+    unsigned int           retryInterval() const { return m_retry_interval; }
+    unsigned int           pingInterval() const { return m_ping_interval; }
+    bool                   disconnectCalled() const { return m_disconnect_called; }
+    bool                   sendCalled() const { return m_send_called; }
+    const uint8_t*         sentData() const { return m_sent_data; }
+    size_t                 sentSize() const { return m_sent_size; }
+    const SendQueueConfig& sendQueueConfig() const { return m_send_queue_config; }
 
   private:
     /** @brief Indicate if the connect() function has been called */
@@ -126,6 +139,8 @@ class WebsocketClientStub : public IWebsocketClient
     uint8_t* m_sent_data;
     /** @brief Sent data size */
     size_t m_sent_size;
+    /** @brief Send queue configuration */
+    SendQueueConfig m_send_queue_config;
     /** @brief Listener */
     IListener* m_listener;
     /** @brief Indicate that the next call will fail */
@@ -0,0 +1,196 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Clock.h"
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest_wrapper.h"
+
+#include <cstring>
+#include <iomanip>
+#include <random>
+#include <sstream>
+
+using namespace ocpp::helpers;
+using namespace ocpp::types;
+
+/** @brief Reference implementation of the ISO-8601 formatting */
+static std::string referenceStr(std::time_t timestamp)
+{
+    std::ostringstream ss;
+    std::tm            t = {};
+#ifdef _MSC_VER
+    gmtime_s(&t, &timestamp);
+#else  // _MSC_VER
+    gmtime_r(&timestamp, &t);
+#endif // _MSC_VER
+    ss << std::put_time(&t, "%Y-%m-%dT%TZ");
+    return ss.str();
+}
+
+/** @brief Reference implementation of the ISO-8601 parsing */
+static bool referenceAssign(const std::string& value, std::time_t& timestamp)
+{
+    std::istringstream ss(value);
+    std::tm            t = {};
+    ss >> std::get_time(&t, "%Y-%m-%dT%TZ");
+    if (!ss.fail())
+    {
+#ifdef _MSC_VER
+        timestamp = _mkgmtime(&t);
+#else  // _MSC_VER
+        timestamp = timegm(&t);
+#endif // _MSC_VER
+    }
+    return !ss.fail();
+}
+
+/** @brief Run a benchmark and return the mean duration of an iteration in nanoseconds */
+template <typename Func>
+static double benchmark(std::time_t iterations, Func func)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (std::time_t i = 0; i < iterations; i++)
+    {
+        func(i);
+    }
+    auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    return static_cast<double>(duration.count()) / static_cast<double>(iterations);
+}
+
+TEST_SUITE("Clock class test suite")
+{
+    TEST_CASE("Date and time formatting")
+    {
+        char buffer[DateTime::MAX_STR_SIZE];
+
+        CHECK_EQ(DateTime(0).str(), "1970-01-01T00:00:00Z");
+        CHECK_EQ(DateTime(951782400).str(), "2000-02-29T00:00:00Z");
+        CHECK_EQ(DateTime(4107542399).str(), "2100-02-28T23:59:59Z");
+        CHECK_EQ(DateTime(-1).str(), "1969-12-31T23:59:59Z");
+
+        CHECK_EQ(DateTime(1700000000).format(buffer), 20u);
+        CHECK_EQ(strcmp(buffer, "2023-11-14T22:13:20Z"), 0);
+        CHECK_EQ(DateTime(1700000000).format(buffer, 7), 24u);
+        CHECK_EQ(strcmp(buffer, "2023-11-14T22:13:20.007Z"), 0);
+        CHECK_EQ(DateTime(1700000000).format(buffer, 999), 24u);
+        CHECK_EQ(strcmp(buffer, "2023-11-14T22:13:20.999Z"), 0);
+
+        std::mt19937_64                            generator(12345u);
+        std::uniform_int_distribution<std::time_t> distribution(0, 253402300799);
+        for (unsigned int i = 0; i < 10000u; i++)
+        {
+            std::time_t timestamp = distribution(generator);
+            CHECK_EQ(DateTime(timestamp).str(), referenceStr(timestamp));
+        }
+    }
+
+    TEST_CASE("Date and time parsing")
+    {
+        DateTime dt;
+
+        CHECK(dt.assign("1970-01-01T00:00:00Z"));
+        CHECK_EQ(dt.timestamp(), 0);
+        CHECK(dt.assign("2000-02-29T00:00:00Z"));
+        CHECK_EQ(dt.timestamp(), 951782400);
+        CHECK(dt.assign("1969-12-31T23:59:59Z"));
+        CHECK_EQ(dt.timestamp(), -1);
+
+        // Optional parts
+        CHECK(dt.assign("2023-11-14T22:13:20"));
+        CHECK_EQ(dt.timestamp(), 1700000000);
+        CHECK(dt.assign("2023-11-14T22:13:20.123456Z"));
+        CHECK_EQ(dt.timestamp(), 1700000000);
+        CHECK(dt.assign("2023-11-15T00:13:20+02:00"));
+        CHECK_EQ(dt.timestamp(), 1700000000);
+        CHECK(dt.assign("2023-11-14T18:43:20.5-0330"));
+        CHECK_EQ(dt.timestamp(), 1700000000);
+        CHECK(dt.assign("2023-11-14T23:13:20+01"));
+        CHECK_EQ(dt.timestamp(), 1700000000);
+
+        // Invalid representations keep the previous value
+        CHECK_FALSE(dt.assign(""));
+        CHECK_FALSE(dt.assign("2023-11-14"));
+        CHECK_FALSE(dt.assign("2023-11-14T22:13"));
+        CHECK_FALSE(dt.assign("2023-13-14T22:13:20Z"));
+        CHECK_FALSE(dt.assign("2023-02-29T22:13:20Z"));
+        CHECK_FALSE(dt.assign("2023-11-14T24:13:20Z"));
+        CHECK_FALSE(dt.assign("2023-11-14T22:13:20.Z"));
+        CHECK_FALSE(dt.assign("2023-11-14T22:13:20+2"));
+        CHECK_FALSE(dt.assign("2023-11-14T22:13:20Zabc"));
+        CHECK_FALSE(dt.assign("2023/11/14T22:13:20Z"));
+        CHECK_EQ(dt.timestamp(), 1700000000);
+
+        // Round trip
+        std::mt19937_64                            generator(54321u);
+        std::uniform_int_distribution<std::time_t> distribution(0, 253402300799);
+        for (unsigned int i = 0; i < 10000u; i++)
+        {
+            std::time_t timestamp = distribution(generator);
+            std::string str       = DateTime(timestamp).str();
+            std::time_t expected  = 0;
+            CHECK(referenceAssign(str, expected));
+            CHECK(dt.assign(str));
+            CHECK_EQ(dt.timestamp(), expected);
+        }
+    }
+
+    TEST_CASE("Coalesced clock")
+    {
+        char buffer[DateTime::MAX_STR_SIZE];
+
+        // Retry in case of second change during the test
+        std::string expected;
+        std::string clock_str;
+        for (unsigned int i = 0; (i < 3u) && ((i == 0) || (clock_str != expected)); i++)
+        {
+            expected  = DateTime::now().str();
+            clock_str = Clock::str();
+        }
+        CHECK_EQ(clock_str, expected);
+
+        CHECK_EQ(Clock::format(buffer), 20u);
+        CHECK_EQ(buffer[19], 'Z');
+        CHECK_EQ(Clock::format(buffer, true), 24u);
+        CHECK_EQ(buffer[19], '.');
+        CHECK_EQ(buffer[23], 'Z');
+        CHECK_EQ(strlen(buffer), 24u);
+    }
+
+    TEST_CASE("Benchmark")
+    {
+        static constexpr std::time_t ITERATIONS = 100000;
+        static constexpr std::time_t BASE       = 1700000000;
+        char                         buffer[DateTime::MAX_STR_SIZE];
+        size_t                       total = 0;
+
+        double legacy_ns     = benchmark(ITERATIONS, [&](std::time_t i) { total += referenceStr(BASE + i).size(); });
+        double format_ns     = benchmark(ITERATIONS, [&](std::time_t i) { total += DateTime(BASE + i).format(buffer); });
+        double now_legacy_ns = benchmark(ITERATIONS, [&](std::time_t) { total += referenceStr(DateTime::now()).size(); });
+        double clock_ns      = benchmark(ITERATIONS, [&](std::time_t) { total += Clock::format(buffer); });
+
+        std::string str          = DateTime(BASE).str();
+        std::time_t parsed       = 0;
+        double      get_time_ns  = benchmark(ITERATIONS, [&](std::time_t) { total += referenceAssign(str, parsed) ? 1u : 0u; });
+        double      hand_made_ns = benchmark(ITERATIONS, [&](std::time_t) { total += DateTime().assign(str.c_str()) ? 1u : 0u; });
+
+        MESSAGE("put_time formatting : " << legacy_ns << " ns - hand-written formatting : " << format_ns << " ns");
+        MESSAGE("now() + put_time : " << now_legacy_ns << " ns - coalesced clock : " << clock_ns << " ns");
+        MESSAGE("get_time parsing : " << get_time_ns << " ns - hand-written parsing : " << hand_made_ns << " ns");
+        CHECK_GT(total, 0u);
+    }
+}
@@ -20,8 +20,11 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "doctest_wrapper.h"
 
+#include <atomic>
+#include <chrono>
 #include <filesystem>
 #include <limits>
+#include <thread>
 
 using namespace ocpp::database;
 
@@ -135,5 +138,73 @@ TEST_SUITE("Database class test suite")
         CHECK_EQ(query.get(), nullptr);
     }
 
+    TEST_CASE("Transactions")
+    {
+        Database db;
+        CHECK(db.open(test_database_path.string()));
+
+        auto query = db.query("CREATE TABLE IF NOT EXISTS TransactionTable ([IntField] INTEGER);");
+        CHECK_NE(query.get(), nullptr);
+        CHECK(query->exec());
+        auto insert_query = db.query("INSERT INTO TransactionTable VALUES (?);");
+        CHECK_NE(insert_query.get(), nullptr);
+        auto count_query = db.query("SELECT COUNT(*) FROM TransactionTable WHERE [IntField]=?;");
+        CHECK_NE(count_query.get(), nullptr);
+        auto count = [&count_query](int value)
+        {
+            unsigned int ret = 0;
+            count_query->bind(0, value);
+            if (count_query->exec() && count_query->hasRows())
+            {
+                ret = count_query->getUInt32(0);
+            }
+            count_query->reset();
+            return ret;
+        };
+
+        // No transaction started
+        CHECK_FALSE(db.commitTransaction());
+        CHECK_FALSE(db.rollbackTransaction());
+
+        // Commit
+        CHECK(db.beginTransaction());
+        CHECK_FALSE(db.beginTransaction());
+        CHECK(insert_query->bind(0, 1));
+        CHECK(insert_query->exec());
+        insert_query->reset();
+        CHECK(db.commitTransaction());
+        CHECK_FALSE(db.commitTransaction());
+        CHECK_EQ(count(1), 1u);
+
+        // Rollback while another thread is inserting data : its query must wait for the end of the transaction
+        CHECK(db.beginTransaction());
+        CHECK(insert_query->bind(0, 2));
+        CHECK(insert_query->exec());
+        insert_query->reset();
+
+        std::atomic<bool> inserted(false);
+        std::thread       other_thread(
+            [&db, &inserted]
+            {
+                auto other_query = db.query("INSERT INTO TransactionTable VALUES (3);");
+                if (other_query)
+                {
+                    other_query->exec();
+                }
+                inserted = true;
+            });
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        CHECK_FALSE(inserted);
+
+        CHECK(db.rollbackTransaction());
+        other_thread.join();
+        CHECK(inserted);
+        CHECK_EQ(count(2), 0u);
+        CHECK_EQ(count(3), 1u);
+
+        CHECK(db.close());
+        CHECK_FALSE(db.beginTransaction());
+    }
+
     TEST_CASE("Cleanup") { std::filesystem::remove(test_database_path); }
 }
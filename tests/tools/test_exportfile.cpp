@@ -0,0 +1,120 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "ExportFile.h"
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest_wrapper.h"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#ifdef WITH_ZLIB
+#include <zlib.h>
+#endif // WITH_ZLIB
+
+using namespace ocpp::helpers;
+
+/** @brief Generate the expected content of the test files */
+static std::string expectedContent()
+{
+    std::stringstream ss;
+    ss << "Timestamp,Type,Message\n";
+    for (unsigned int i = 0; i < 10000u; i++)
+    {
+        ss << i << ",TestEvent,Message number " << i << "\n";
+    }
+    return ss.str();
+}
+
+/** @brief Write the test content into an export file */
+static bool writeContent(const std::string& path, ExportFile::Compression compression)
+{
+    ExportFile  export_file(path, compression, 1024u);
+    std::string content = expectedContent();
+    CHECK(export_file.isOpen());
+
+    // Write line by line
+    size_t start = 0;
+    size_t end   = content.find('\n');
+    while (end != std::string::npos)
+    {
+        export_file.write(content.substr(start, end - start + 1u));
+        start = end + 1u;
+        end   = content.find('\n', start);
+    }
+    return export_file.close();
+}
+
+TEST_SUITE("ExportFile class test suite")
+{
+    TEST_CASE("Uncompressed")
+    {
+        std::string path = (std::filesystem::temp_directory_path() / "test_export.csv").string();
+        std::filesystem::remove(path);
+
+        CHECK(writeContent(path, ExportFile::Compression::None));
+
+        std::ifstream     file(path, std::ifstream::binary);
+        std::stringstream content;
+        content << file.rdbuf();
+        CHECK_EQ(content.str(), expectedContent());
+
+        std::filesystem::remove(path);
+    }
+
+    TEST_CASE("Not opened")
+    {
+        ExportFile export_file("/not_existing_dir/test_export.csv");
+        CHECK_FALSE(export_file.isOpen());
+        export_file.write("data");
+        CHECK_FALSE(export_file.close());
+    }
+
+    TEST_CASE("Compression")
+    {
+        CHECK_EQ(ExportFile::compression("none"), ExportFile::Compression::None);
+        CHECK_EQ(ExportFile::compression("unknown"), ExportFile::Compression::None);
+        CHECK_EQ(std::string(ExportFile::extension(ExportFile::Compression::None)), "");
+        CHECK_EQ(std::string(ExportFile::extension(ExportFile::Compression::Gzip)), ".gz");
+
+#ifdef WITH_ZLIB
+        CHECK_EQ(ExportFile::compression("gzip"), ExportFile::Compression::Gzip);
+
+        std::string path = (std::filesystem::temp_directory_path() / "test_export.csv.gz").string();
+        std::filesystem::remove(path);
+
+        CHECK(writeContent(path, ExportFile::Compression::Gzip));
+        std::string expected = expectedContent();
+        CHECK_LT(std::filesystem::file_size(path), expected.size());
+
+        gzFile      file = gzopen(path.c_str(), "rb");
+        std::string content(expected.size() + 1u, '\0');
+        REQUIRE(file != nullptr);
+        int size = gzread(file, &content[0], static_cast<unsigned int>(content.size()));
+        gzclose(file);
+        REQUIRE_EQ(size, static_cast<int>(expected.size()));
+        content.resize(static_cast<size_t>(size));
+        CHECK_EQ(content, expected);
+
+        std::filesystem::remove(path);
+#else
+        CHECK_EQ(ExportFile::compression("gzip"), ExportFile::Compression::None);
+#endif // WITH_ZLIB
+    }
+}
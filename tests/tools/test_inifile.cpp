@@ -20,6 +20,9 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include "doctest_wrapper.h"
 
+#include <filesystem>
+#include <thread>
+
 using namespace ocpp::helpers;
 
 TEST_SUITE("IniFile class test suite")
@@ -116,6 +119,45 @@ TEST_SUITE("IniFile class test suite")
         CHECK_EQ(ini_file3.get("Third section", "My param 1").toUInt(), 6789u);
     }
 
+    TEST_CASE("Write-behind")
+    {
+        IniFile ini_file;
+        ini_file.set("Section", "Param", IniFile::Value(1));
+        CHECK(ini_file.store("/tmp/test_write_behind.ini"));
+        CHECK(ini_file.load("/tmp/test_write_behind.ini"));
+        ini_file.setWriteBehind(std::chrono::milliseconds(200));
+
+        // Modifications are not stored immediately
+        ini_file.set("Section", "Param", IniFile::Value(2));
+        ini_file.set("Section", "Other param", IniFile::Value("value"));
+        IniFile ini_file2;
+        CHECK(ini_file2.load("/tmp/test_write_behind.ini", false));
+        CHECK_EQ(ini_file2.get("Section", "Param").toInt(), 1);
+        CHECK(ini_file2.get("Section", "Other param").isEmpty());
+
+        // All the modifications are stored at once after the delay
+        std::this_thread::sleep_for(std::chrono::milliseconds(400));
+        CHECK(ini_file2.load("/tmp/test_write_behind.ini", false));
+        CHECK_EQ(ini_file2.get("Section", "Param").toInt(), 2);
+        CHECK_EQ(ini_file2.get("Section", "Other param").toString(), "value");
+
+        // Pending modifications are stored on flush
+        ini_file.set("Section", "Param", IniFile::Value(3));
+        CHECK(ini_file.flush());
+        CHECK(ini_file2.load("/tmp/test_write_behind.ini", false));
+        CHECK_EQ(ini_file2.get("Section", "Param").toInt(), 3);
+
+        // Pending modifications are stored on destruction
+        {
+            IniFile ini_file3("/tmp/test_write_behind.ini");
+            ini_file3.setWriteBehind(std::chrono::seconds(60));
+            ini_file3.set("Section", "Param", IniFile::Value(4));
+        }
+        CHECK(ini_file2.load("/tmp/test_write_behind.ini", false));
+        CHECK_EQ(ini_file2.get("Section", "Param").toInt(), 4);
+        CHECK_FALSE(std::filesystem::exists("/tmp/test_write_behind.ini.tmp"));
+    }
+
     TEST_CASE("Values")
     {
         IniFile::Value val1("12345");
@@ -26,6 +26,7 @@ along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
 #include <openssl/bio.h>
 #include <openssl/pem.h>
 
+#include <filesystem>
 #include <fstream>
 #include <iostream>
 using namespace std;
@@ -716,6 +717,30 @@ TEST_SUITE("Certificate generation")
         // Check restored signature with the certificate
         data_signature[24]--;
         CHECK(cert.verify(data_signature, data.c_str(), data.size()));
+
+        // Check signature of a file
+        std::filesystem::path data_file = std::filesystem::temp_directory_path() / "test_x509_data.bin";
+        {
+            std::fstream file(data_file, std::fstream::out | std::fstream::binary | std::fstream::trunc);
+            file << data;
+        }
+        std::vector<uint8_t> file_signature = pkey_cert.sign(data_file.string());
+        CHECK_FALSE(file_signature.empty());
+        CHECK(cert.verify(file_signature, data_file.string(), Sha2::Type::SHA256));
+        CHECK(cert.verify(data_signature, data_file.string(), Sha2::Type::SHA256));
+        CHECK_FALSE(cert.verify(data_signature, std::string("/does/not/exist"), Sha2::Type::SHA256));
+
+        // Check signature of a digest computed incrementally
+        Sha2 sha;
+        sha.init();
+        sha.update(data.c_str(), 10u);
+        sha.update(data.c_str() + 10u, data.size() - 10u);
+        CHECK(cert.verifyDigest(data_signature, sha.finalize(), Sha2::Type::SHA256));
+        data_signature[24]++;
+        CHECK_FALSE(cert.verifyDigest(data_signature, sha.result(), Sha2::Type::SHA256));
+        data_signature[24]--;
+        CHECK_FALSE(cert.verifyDigest(data_signature, sha.compute(data.c_str(), 10u), Sha2::Type::SHA256));
+        std::filesystem::remove(data_file);
     }
 }
 
@@ -0,0 +1,230 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "EnumToStringFromString.h"
+#include "Enums.h"
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest_wrapper.h"
+
+#include <set>
+
+using namespace ocpp::types;
+
+/** @brief OCPP 1.6 actions */
+enum class Action
+{
+    Authorize,
+    BootNotification,
+    CancelReservation,
+    ChangeAvailability,
+    ChangeConfiguration,
+    ClearCache,
+    ClearChargingProfile,
+    DataTransfer,
+    DiagnosticsStatusNotification,
+    FirmwareStatusNotification,
+    GetCompositeSchedule,
+    GetConfiguration,
+    GetDiagnostics,
+    GetLocalListVersion,
+    Heartbeat,
+    MeterValues,
+    RemoteStartTransaction,
+    RemoteStopTransaction,
+    ReserveNow,
+    Reset,
+    SendLocalList,
+    SetChargingProfile,
+    StartTransaction,
+    StatusNotification,
+    StopTransaction,
+    TriggerMessage,
+    UnlockConnector,
+    UpdateFirmware
+};
+
+/** @brief Mapping of the OCPP 1.6 actions */
+static const std::vector<std::pair<Action, const char*>> ACTIONS = {
+    {Action::Authorize, "Authorize"},
+    {Action::BootNotification, "BootNotification"},
+    {Action::CancelReservation, "CancelReservation"},
+    {Action::ChangeAvailability, "ChangeAvailability"},
+    {Action::ChangeConfiguration, "ChangeConfiguration"},
+    {Action::ClearCache, "ClearCache"},
+    {Action::ClearChargingProfile, "ClearChargingProfile"},
+    {Action::DataTransfer, "DataTransfer"},
+    {Action::DiagnosticsStatusNotification, "DiagnosticsStatusNotification"},
+    {Action::FirmwareStatusNotification, "FirmwareStatusNotification"},
+    {Action::GetCompositeSchedule, "GetCompositeSchedule"},
+    {Action::GetConfiguration, "GetConfiguration"},
+    {Action::GetDiagnostics, "GetDiagnostics"},
+    {Action::GetLocalListVersion, "GetLocalListVersion"},
+    {Action::Heartbeat, "Heartbeat"},
+    {Action::MeterValues, "MeterValues"},
+    {Action::RemoteStartTransaction, "RemoteStartTransaction"},
+    {Action::RemoteStopTransaction, "RemoteStopTransaction"},
+    {Action::ReserveNow, "ReserveNow"},
+    {Action::Reset, "Reset"},
+    {Action::SendLocalList, "SendLocalList"},
+    {Action::SetChargingProfile, "SetChargingProfile"},
+    {Action::StartTransaction, "StartTransaction"},
+    {Action::StatusNotification, "StatusNotification"},
+    {Action::StopTransaction, "StopTransaction"},
+    {Action::TriggerMessage, "TriggerMessage"},
+    {Action::UnlockConnector, "UnlockConnector"},
+    {Action::UpdateFirmware, "UpdateFirmware"}};
+
+/** @brief Helper to convert the OCPP 1.6 actions */
+static const EnumToStringFromString<Action> ActionHelper = {{Action::Authorize, "Authorize"},
+                                                            {Action::BootNotification, "BootNotification"},
+                                                            {Action::CancelReservation, "CancelReservation"},
+                                                            {Action::ChangeAvailability, "ChangeAvailability"},
+                                                            {Action::ChangeConfiguration, "ChangeConfiguration"},
+                                                            {Action::ClearCache, "ClearCache"},
+                                                            {Action::ClearChargingProfile, "ClearChargingProfile"},
+                                                            {Action::DataTransfer, "DataTransfer"},
+                                                            {Action::DiagnosticsStatusNotification, "DiagnosticsStatusNotification"},
+                                                            {Action::FirmwareStatusNotification, "FirmwareStatusNotification"},
+                                                            {Action::GetCompositeSchedule, "GetCompositeSchedule"},
+                                                            {Action::GetConfiguration, "GetConfiguration"},
+                                                            {Action::GetDiagnostics, "GetDiagnostics"},
+                                                            {Action::GetLocalListVersion, "GetLocalListVersion"},
+                                                            {Action::Heartbeat, "Heartbeat"},
+                                                            {Action::MeterValues, "MeterValues"},
+                                                            {Action::RemoteStartTransaction, "RemoteStartTransaction"},
+                                                            {Action::RemoteStopTransaction, "RemoteStopTransaction"},
+                                                            {Action::ReserveNow, "ReserveNow"},
+                                                            {Action::Reset, "Reset"},
+                                                            {Action::SendLocalList, "SendLocalList"},
+                                                            {Action::SetChargingProfile, "SetChargingProfile"},
+                                                            {Action::StartTransaction, "StartTransaction"},
+                                                            {Action::StatusNotification, "StatusNotification"},
+                                                            {Action::StopTransaction, "StopTransaction"},
+                                                            {Action::TriggerMessage, "TriggerMessage"},
+                                                            {Action::UnlockConnector, "UnlockConnector"},
+                                                            {Action::UpdateFirmware, "UpdateFirmware"}};
+
+/** @brief Check that a string is rejected */
+static void checkRejected(const std::string& str)
+{
+    Action value = Action::UpdateFirmware;
+    CHECK_FALSE(ActionHelper.fromString(str, value));
+    CHECK_EQ(value, Action::UpdateFirmware);
+    CHECK_FALSE(ActionHelper.fromString(str.c_str(), str.size(), value));
+    CHECK_EQ(value, Action::UpdateFirmware);
+
+    // Unknown strings fall back to the first mapping entry
+    CHECK_EQ(ActionHelper.fromString(str), Action::Authorize);
+}
+
+TEST_SUITE("Enum to string and string to enum conversions")
+{
+    TEST_CASE("Registered values")
+    {
+        for (const auto& [action, name] : ACTIONS)
+        {
+            std::string str(name);
+            CHECK_EQ(ActionHelper.toString(action), str);
+
+            Action value = Action::Authorize;
+            CHECK(ActionHelper.fromString(str, value));
+            CHECK_EQ(value, action);
+            value = Action::Authorize;
+            CHECK(ActionHelper.fromString(name, value));
+            CHECK_EQ(value, action);
+            CHECK_EQ(ActionHelper.fromString(name), action);
+
+            // Not null terminated string
+            std::string padded = str + "Padding";
+            value              = Action::Authorize;
+            CHECK(ActionHelper.fromString(padded.c_str(), str.size(), value));
+            CHECK_EQ(value, action);
+        }
+
+        // Helpers of the stack
+        for (auto trigger : {MessageTrigger::BootNotification,
+                             MessageTrigger::DiagnosticsStatusNotification,
+                             MessageTrigger::FirmwareStatusNotification,
+                             MessageTrigger::Heartbeat,
+                             MessageTrigger::MeterValues,
+                             MessageTrigger::StatusNotification})
+        {
+            CHECK_EQ(MessageTriggerHelper.fromString(MessageTriggerHelper.toString(trigger)), trigger);
+        }
+
+        // Unknown enum value
+        CHECK(ActionHelper.toString(static_cast<Action>(1000)).empty());
+    }
+
+    TEST_CASE("Unknown values")
+    {
+        checkRejected("");
+        checkRejected("Unknown");
+        checkRejected(" Heartbeat");
+        checkRejected("Heartbeat ");
+        checkRejected("heartbeat");
+        checkRejected("HEARTBEAT");
+        checkRejected("Heart");
+        checkRejected("HeartbeatHeartbeat");
+        checkRejected(std::string("Heartbeat\0", 10u));
+
+        // Strings close to the registered ones
+        for (const auto& [action, name] : ACTIONS)
+        {
+            std::string str(name);
+            checkRejected(str.substr(0, str.size() - 1u));
+            checkRejected(str + "s");
+            for (size_t i = 0; i < str.size(); i++)
+            {
+                std::string modified = str;
+                modified[i]          = static_cast<char>(modified[i] ^ 0x01);
+                checkRejected(modified);
+            }
+        }
+    }
+
+    TEST_CASE("Colliding values")
+    {
+        std::set<std::string> names;
+        for (const auto& [action, name] : ACTIONS)
+        {
+            names.insert(name);
+        }
+
+        // The hash table is mostly empty, so many of these strings land in a
+        // slot which is used by a registered value : they must be rejected by
+        // the string comparison
+        size_t accepted = 0;
+        for (unsigned int i = 0; i < 100000u; i++)
+        {
+            std::string str = "Action" + std::to_string(i);
+            Action      value;
+            if (ActionHelper.fromString(str, value))
+            {
+                accepted++;
+            }
+        }
+        CHECK_EQ(accepted, 0u);
+
+        // Duplicated strings keep the first mapping
+        EnumToStringFromString<Action> helper = {{Action::Heartbeat, "Heartbeat"}, {Action::Reset, "Heartbeat"}, {Action::Reset, "Reset"}};
+        CHECK_EQ(helper.fromString("Heartbeat"), Action::Heartbeat);
+        CHECK_EQ(helper.fromString("Reset"), Action::Reset);
+        CHECK_EQ(helper.toString(Action::Reset), "Reset");
+    }
+}
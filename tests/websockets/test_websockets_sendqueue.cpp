@@ -0,0 +1,143 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "SendQueue.h"
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest_wrapper.h"
+
+#include <thread>
+
+using namespace ocpp::websockets;
+
+static const char MSG[] = "[2,\"1\",\"Heartbeat\",{}]";
+
+TEST_SUITE("Websocket send queue")
+{
+    TEST_CASE("Unbounded queue")
+    {
+        SendQueue queue;
+        CHECK(queue.empty());
+
+        for (size_t i = 0; i < 100u; i++)
+        {
+            CHECK_EQ(queue.push(MSG, sizeof(MSG)), SendQueue::PushResult::Queued);
+        }
+        SendQueueStats stats = queue.stats();
+        CHECK_EQ(stats.messages, 100u);
+        CHECK_EQ(stats.size, 100u * sizeof(MSG));
+        CHECK_EQ(stats.peak_messages, 100u);
+        CHECK_EQ(stats.rejected, 0u);
+
+        SendQueue::SendMsg* msg = nullptr;
+        CHECK(queue.pop(msg));
+        CHECK_EQ(msg->size, sizeof(MSG));
+        CHECK_EQ(memcmp(msg->payload, MSG, sizeof(MSG)), 0);
+        delete msg;
+
+        queue.clear();
+        CHECK(queue.empty());
+        stats = queue.stats();
+        CHECK_EQ(stats.messages, 0u);
+        CHECK_EQ(stats.size, 0u);
+        CHECK_EQ(stats.peak_messages, 100u);
+    }
+
+    TEST_CASE("Fail policy")
+    {
+        SendQueue queue;
+        queue.setConfig(SendQueueConfig(2u, 0u, "fail", std::chrono::milliseconds(0)));
+
+        CHECK_EQ(queue.push(MSG, sizeof(MSG)), SendQueue::PushResult::Queued);
+        CHECK_EQ(queue.push(MSG, sizeof(MSG)), SendQueue::PushResult::Queued);
+        CHECK_EQ(queue.push(MSG, sizeof(MSG)), SendQueue::PushResult::Rejected);
+        CHECK_EQ(queue.stats().rejected, 1u);
+        CHECK_FALSE(queue.overflowed());
+
+        // Size limit
+        queue.clear();
+        queue.setConfig(SendQueueConfig(0u, 2u * sizeof(MSG), "fail", std::chrono::milliseconds(0)));
+        CHECK_EQ(queue.push(MSG, sizeof(MSG)), SendQueue::PushResult::Queued);
+        CHECK_EQ(queue.push(MSG, sizeof(MSG)), SendQueue::PushResult::Queued);
+        CHECK_EQ(queue.push(MSG, 1u), SendQueue::PushResult::Rejected);
+
+        // A message bigger than the limit is accepted in an empty queue
+        queue.clear();
+        char big[4u * sizeof(MSG)];
+        memset(big, ' ', sizeof(big));
+        CHECK_EQ(queue.push(big, sizeof(big)), SendQueue::PushResult::Queued);
+        CHECK_EQ(queue.push(MSG, sizeof(MSG)), SendQueue::PushResult::Rejected);
+    }
+
+    TEST_CASE("Disconnect policy")
+    {
+        SendQueue queue;
+        queue.setConfig(SendQueueConfig(1u, 0u, "disconnect", std::chrono::milliseconds(0)));
+
+        CHECK_EQ(queue.push(MSG, sizeof(MSG)), SendQueue::PushResult::Queued);
+        CHECK_EQ(queue.push(MSG, sizeof(MSG)), SendQueue::PushResult::Overflow);
+        CHECK(queue.overflowed());
+        CHECK_FALSE(queue.overflowed());
+    }
+
+    TEST_CASE("Block policy")
+    {
+        SendQueue queue;
+        queue.setConfig(SendQueueConfig(1u, 0u, "block", std::chrono::milliseconds(100)));
+
+        // Timeout
+        CHECK_EQ(queue.push(MSG, sizeof(MSG)), SendQueue::PushResult::Queued);
+        auto start = std::chrono::steady_clock::now();
+        CHECK_EQ(queue.push(MSG, sizeof(MSG)), SendQueue::PushResult::Rejected);
+        CHECK_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(100));
+
+        // Room made by the service thread
+        queue.setConfig(SendQueueConfig(1u, 0u, "block", std::chrono::milliseconds(2000)));
+        std::thread pop_thread(
+            [&queue]
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                SendQueue::SendMsg* msg = nullptr;
+                if (queue.pop(msg))
+                {
+                    delete msg;
+                }
+            });
+        CHECK_EQ(queue.push(MSG, sizeof(MSG)), SendQueue::PushResult::Queued);
+        pop_thread.join();
+
+        // Service thread never blocks
+        queue.setServiceThread(std::this_thread::get_id());
+        start = std::chrono::steady_clock::now();
+        CHECK_EQ(queue.push(MSG, sizeof(MSG)), SendQueue::PushResult::Rejected);
+        CHECK_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(1000));
+
+        // Disabling the queue releases the waiting senders
+        queue.setServiceThread(std::thread::id());
+        std::thread disable_thread(
+            [&queue]
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                queue.setEnable(false);
+            });
+        start = std::chrono::steady_clock::now();
+        CHECK_EQ(queue.push(MSG, sizeof(MSG)), SendQueue::PushResult::Rejected);
+        CHECK_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(1000));
+        disable_thread.join();
+        CHECK_EQ(queue.push(MSG, sizeof(MSG)), SendQueue::PushResult::Rejected);
+    }
+}
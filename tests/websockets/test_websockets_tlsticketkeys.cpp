@@ -0,0 +1,149 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "Certificate.h"
+#include "CertificateRequest.h"
+#include "PrivateKey.h"
+#include "TlsTicketKeys.h"
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest_wrapper.h"
+
+#include <openssl/pem.h>
+
+#include <thread>
+
+using namespace ocpp::websockets;
+using namespace ocpp::x509;
+
+/** @brief Create a TLS server context with a self-signed certificate */
+static SSL_CTX* createServerContext()
+{
+    PrivateKey            pkey(PrivateKey::Type::EC, PrivateKey::Curve::PRIME256_V1, "");
+    X509Document::Subject subject;
+    subject.common_name = "Open OCPP";
+    CertificateRequest csr(subject, pkey);
+    Certificate        cert(csr, pkey, Sha2::Type::SHA256, 1u);
+
+    BIO*      bio      = BIO_new_mem_buf(cert.pem().c_str(), static_cast<int>(cert.pem().size()));
+    X509*     x509     = PEM_read_bio_X509(bio, nullptr, nullptr, nullptr);
+    BIO_free(bio);
+    bio                = BIO_new_mem_buf(pkey.privatePem().c_str(), static_cast<int>(pkey.privatePem().size()));
+    EVP_PKEY* evp_pkey = PEM_read_bio_PrivateKey(bio, nullptr, nullptr, nullptr);
+    BIO_free(bio);
+
+    SSL_CTX* ssl_ctx = SSL_CTX_new(TLS_server_method());
+    SSL_CTX_set_max_proto_version(ssl_ctx, TLS1_2_VERSION);
+    SSL_CTX_set_session_cache_mode(ssl_ctx, SSL_SESS_CACHE_OFF);
+    SSL_CTX_use_certificate(ssl_ctx, x509);
+    SSL_CTX_use_PrivateKey(ssl_ctx, evp_pkey);
+    X509_free(x509);
+    EVP_PKEY_free(evp_pkey);
+
+    return ssl_ctx;
+}
+
+/** @brief Perform a TLS handshake in memory and indicate if the session has been resumed */
+static bool handshake(SSL_CTX* server_ctx, SSL_CTX* client_ctx, SSL_SESSION* session, SSL_SESSION** new_session)
+{
+    SSL* server = SSL_new(server_ctx);
+    SSL* client = SSL_new(client_ctx);
+    BIO* server_bio;
+    BIO* client_bio;
+    BIO_new_bio_pair(&server_bio, 0, &client_bio, 0);
+    SSL_set_bio(server, server_bio, server_bio);
+    SSL_set_bio(client, client_bio, client_bio);
+    SSL_set_accept_state(server);
+    SSL_set_connect_state(client);
+    if (session)
+    {
+        SSL_set_session(client, session);
+    }
+
+    bool server_done = false;
+    bool client_done = false;
+    for (unsigned int i = 0; (i < 100u) && !(server_done && client_done); i++)
+    {
+        client_done = (SSL_do_handshake(client) == 1);
+        server_done = (SSL_do_handshake(server) == 1);
+    }
+    CHECK(server_done);
+    CHECK(client_done);
+
+    bool ret = (SSL_session_reused(server) == 1);
+    if (new_session)
+    {
+        *new_session = SSL_get1_session(client);
+    }
+
+    // A session is only resumable after a clean shutdown
+    SSL_shutdown(client);
+    SSL_shutdown(server);
+    SSL_free(client);
+    SSL_free(server);
+    return ret;
+}
+
+TEST_SUITE("TLS session ticket keys")
+{
+    TEST_CASE("Resumption")
+    {
+        SSL_CTX* server_ctx = createServerContext();
+        SSL_CTX* client_ctx = SSL_CTX_new(TLS_client_method());
+        TlsTicketKeys keys(std::chrono::seconds(3600));
+        CHECK(keys.install(server_ctx));
+
+        // Full handshake
+        SSL_SESSION* session = nullptr;
+        CHECK_FALSE(handshake(server_ctx, client_ctx, nullptr, &session));
+        REQUIRE(session != nullptr);
+
+        // Resumed handshake
+        CHECK(handshake(server_ctx, client_ctx, session, nullptr));
+
+        // Another server with its own keys cannot decrypt the ticket
+        SSL_CTX*      other_ctx = createServerContext();
+        TlsTicketKeys other_keys(std::chrono::seconds(3600));
+        CHECK(other_keys.install(other_ctx));
+        CHECK_FALSE(handshake(other_ctx, client_ctx, session, nullptr));
+
+        SSL_SESSION_free(session);
+        SSL_CTX_free(other_ctx);
+        SSL_CTX_free(client_ctx);
+        SSL_CTX_free(server_ctx);
+    }
+
+    TEST_CASE("Expiry")
+    {
+        SSL_CTX* server_ctx = createServerContext();
+        SSL_CTX* client_ctx = SSL_CTX_new(TLS_client_method());
+        TlsTicketKeys keys(std::chrono::seconds(1));
+        CHECK(keys.install(server_ctx));
+
+        SSL_SESSION* session = nullptr;
+        CHECK_FALSE(handshake(server_ctx, client_ctx, nullptr, &session));
+        REQUIRE(session != nullptr);
+
+        // Ticket outlived its keys
+        std::this_thread::sleep_for(std::chrono::milliseconds(2100));
+        CHECK_FALSE(handshake(server_ctx, client_ctx, session, nullptr));
+
+        SSL_SESSION_free(session);
+        SSL_CTX_free(client_ctx);
+        SSL_CTX_free(server_ctx);
+    }
+}
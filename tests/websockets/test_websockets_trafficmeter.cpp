@@ -0,0 +1,67 @@
+/*
+Copyright (c) 2020 Cedric Jimenez
+This file is part of OpenOCPP.
+
+OpenOCPP is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 2.1 of the License, or
+(at your option) any later version.
+
+OpenOCPP is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with OpenOCPP. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "TrafficMeter.h"
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include "doctest_wrapper.h"
+
+using namespace ocpp::websockets;
+
+TEST_SUITE("Websocket traffic meter")
+{
+    TEST_CASE("Rates")
+    {
+        TrafficMeter meter;
+        auto         start = std::chrono::steady_clock::now();
+
+        // No traffic
+        TrafficRate rate = meter.rate(start + std::chrono::seconds(1));
+        CHECK_EQ(rate.frames, doctest::Approx(0.));
+        CHECK_EQ(rate.bytes, doctest::Approx(0.));
+        CHECK_EQ(rate.score(), doctest::Approx(0.));
+
+        // 10 frames of 100 bytes during 1s
+        for (size_t i = 0; i < 10u; i++)
+        {
+            meter.add(100u);
+        }
+        rate = meter.rate(start + std::chrono::seconds(2));
+        CHECK_EQ(rate.frames, doctest::Approx(5.));
+        CHECK_EQ(rate.bytes, doctest::Approx(500.));
+        CHECK_EQ(rate.score(), doctest::Approx(500. + 5. * TrafficRate::FRAME_COST));
+
+        // No new sample before the end of the sample period
+        for (size_t i = 0; i < 10u; i++)
+        {
+            meter.add(100u);
+        }
+        rate = meter.rate(start + std::chrono::milliseconds(2500));
+        CHECK_EQ(rate.frames, doctest::Approx(5.));
+        CHECK_EQ(rate.bytes, doctest::Approx(500.));
+
+        // Same traffic during 2s
+        rate = meter.rate(start + std::chrono::seconds(4));
+        CHECK_EQ(rate.frames, doctest::Approx(5.));
+        CHECK_EQ(rate.bytes, doctest::Approx(500.));
+
+        // Traffic stops
+        rate = meter.rate(start + std::chrono::seconds(5));
+        CHECK_EQ(rate.frames, doctest::Approx(2.5));
+        CHECK_EQ(rate.bytes, doctest::Approx(250.));
+    }
+}